@@ -112,8 +112,164 @@ void BM_validate(benchmark::State& state) {
     state.SetBytesProcessed(totalSize);
 }
 
+void BM_validateUtf8Heavy(benchmark::State& state) {
+    // Multi-byte UTF-8 content in both field names and values, the shape that stresses the
+    // cstring scan in validation.
+    BSONObjBuilder bob;
+    for (int i = 0; i < state.range(0); i++) {
+        bob.append(fmt::format("ключ_キー_{}", i),
+                   fmt::format("значение значение значение キーキーキー {}", i));
+    }
+    BSONObj obj = bob.obj();
+    size_t totalSize = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(validateBSON(obj.objdata(), obj.objsize()));
+        totalSize += obj.objsize();
+    }
+    state.SetBytesProcessed(totalSize);
+}
+
+void BM_fieldLookupByPosition(benchmark::State& state) {
+    // Wide flat document; look up a field near the end, the shard-key-at-the-end pattern.
+    BSONObjBuilder bob;
+    auto len = state.range(0);
+    for (auto j = 0; j < len; j++)
+        bob.append(fmt::format("field{}", j), j);
+    BSONObj obj = bob.obj();
+    std::string target = fmt::format("field{}", len - 1);
+    size_t totalItems = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(obj[StringData(target)]);
+        totalItems++;
+    }
+    state.SetItemsProcessed(totalItems);
+}
+
+void BM_nestedPathTraversal(benchmark::State& state) {
+    // Build a document nested to the requested depth and walk a dotted path to the leaf.
+    auto depth = state.range(0);
+    BSONObj obj = BSON("leaf" << 1);
+    for (auto d = 0; d < depth; d++)
+        obj = BSON("sub" << obj);
+    size_t totalItems = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        BSONElement elem = obj.firstElement();
+        for (auto d = 0; d < depth - 1; d++)
+            elem = elem.Obj().firstElement();
+        benchmark::DoNotOptimize(elem.Obj()["leaf"]);
+        totalItems++;
+    }
+    state.SetItemsProcessed(totalItems);
+}
+
+void BM_woCompareFlat(benchmark::State& state) {
+    BSONObj lhs = buildSampleObj(1);
+    BSONObj rhs = buildSampleObj(1);  // Equal except for the OIDs, so compares walk everything.
+    size_t totalItems = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(lhs.woCompare(rhs));
+        totalItems++;
+    }
+    state.SetItemsProcessed(totalItems);
+}
+
+void BM_woCompareLargeArrays(benchmark::State& state) {
+    auto len = state.range(0);
+    BSONArrayBuilder lhsBuilder;
+    BSONArrayBuilder rhsBuilder;
+    for (auto j = 0; j < len; j++) {
+        lhsBuilder.append(j);
+        rhsBuilder.append(j);
+    }
+    BSONObj lhs = BSON("a" << lhsBuilder.arr());
+    BSONObj rhs = BSON("a" << rhsBuilder.arr());
+    size_t totalItems = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(lhs.woCompare(rhs));
+        totalItems++;
+    }
+    state.SetItemsProcessed(totalItems);
+}
+
+void BM_builderGrowth(benchmark::State& state) {
+    // Build a document with no size hint so the underlying buffer has to realloc as it grows.
+    auto len = state.range(0);
+    std::string value(64, 'x');
+    size_t totalBytes = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        BSONObjBuilder bob(0);
+        for (auto j = 0; j < len; j++)
+            bob.append(fmt::format("f{}", j), value);
+        totalBytes += bob.len();
+        benchmark::DoNotOptimize(bob.obj());
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_builderSizeHinted(benchmark::State& state) {
+    // Same shape as BM_builderGrowth but with an exact size hint, isolating realloc cost.
+    auto len = state.range(0);
+    std::string value(64, 'x');
+    int hint = 0;
+    {
+        BSONObjBuilder sizing;
+        for (auto j = 0; j < len; j++)
+            sizing.append(fmt::format("f{}", j), value);
+        hint = sizing.len() + 16;
+    }
+    size_t totalBytes = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        BSONObjBuilder bob(hint);
+        for (auto j = 0; j < len; j++)
+            bob.append(fmt::format("f{}", j), value);
+        totalBytes += bob.len();
+        benchmark::DoNotOptimize(bob.obj());
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_iterateSampleDocs(benchmark::State& state) {
+    // Full element iteration over realistic mixed-type documents.
+    std::vector<BSONObj> docs;
+    for (int i = 0; i < 100; i++)
+        docs.push_back(buildSampleObj(i));
+    size_t totalItems = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        for (const auto& doc : docs) {
+            for (auto&& elem : doc)
+                benchmark::DoNotOptimize(elem);
+        }
+        totalItems += docs.size();
+    }
+    state.SetItemsProcessed(totalItems);
+}
+
 BENCHMARK(BM_arrayBuilder)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_arrayLookup)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_validate)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_validateUtf8Heavy)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_fieldLookupByPosition)->Ranges({{{4}, {1'024}}});
+BENCHMARK(BM_nestedPathTraversal)->Ranges({{{2}, {64}}});
+BENCHMARK(BM_woCompareFlat);
+BENCHMARK(BM_woCompareLargeArrays)->Ranges({{{16}, {16'384}}});
+BENCHMARK(BM_builderGrowth)->Ranges({{{4}, {4'096}}});
+BENCHMARK(BM_builderSizeHinted)->Ranges({{{4}, {4'096}}});
+BENCHMARK(BM_iterateSampleDocs);
 
 }  // namespace mongo
@@ -0,0 +1,98 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bson_field_extractor.h"
+
+#include <algorithm>
+
+namespace mongo {
+
+BSONFieldExtractor::BSONFieldExtractor(const std::vector<std::string>& dottedPaths) {
+    for (const auto& path : dottedPaths) {
+        _addPath(&_root, path);
+    }
+}
+
+void BSONFieldExtractor::_addPath(Node* node, StringData remainingPath) {
+    if (remainingPath.empty())
+        return;
+
+    auto dot = remainingPath.find('.');
+    StringData head =
+        dot == std::string::npos ? remainingPath : remainingPath.substr(0, dot);
+    StringData rest = dot == std::string::npos ? StringData() : remainingPath.substr(dot + 1);
+
+    auto it = std::lower_bound(
+        node->children.begin(), node->children.end(), head, [](const Node& n, StringData name) {
+            return StringData(n.name) < name;
+        });
+    if (it == node->children.end() || StringData(it->name) != head) {
+        it = node->children.insert(it, Node{head.toString(), {}});
+    } else if (it->isLeaf()) {
+        // A whole-subtree path already covers this one.
+        return;
+    }
+    _addPath(&*it, rest);
+}
+
+void BSONFieldExtractor::_extractInto(const Node& node, const BSONObj& obj, BSONObjBuilder* bob) {
+    for (auto&& elem : obj) {
+        StringData fieldName = elem.fieldNameStringData();
+        auto it = std::lower_bound(node.children.begin(),
+                                   node.children.end(),
+                                   fieldName,
+                                   [](const Node& n, StringData name) {
+                                       return StringData(n.name) < name;
+                                   });
+        if (it == node.children.end() || StringData(it->name) != fieldName)
+            continue;
+
+        if (it->isLeaf()) {
+            // Copy the element (including any subobject) wholesale.
+            bob->append(elem);
+        } else if (elem.type() == Object) {
+            BSONObjBuilder sub(bob->subobjStart(fieldName));
+            _extractInto(*it, elem.embeddedObject(), &sub);
+        }
+        // Paths descending through non-objects (including arrays) produce nothing; callers
+        // needing array traversal semantics should use the projection executor.
+    }
+}
+
+void BSONFieldExtractor::extractInto(const BSONObj& obj, BSONObjBuilder* bob) const {
+    _extractInto(_root, obj, bob);
+}
+
+BSONObj BSONFieldExtractor::extract(const BSONObj& obj) const {
+    BSONObjBuilder bob;
+    extractInto(obj, &bob);
+    return bob.obj();
+}
+
+}  // namespace mongo
@@ -0,0 +1,86 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+
+namespace mongo {
+
+/**
+ * Extracts a fixed set of dotted paths from BSON documents in a single left-to-right pass,
+ * appending matched elements straight into a BSONObjBuilder without materializing intermediate
+ * documents. The path set is compiled once into a trie; extraction then costs one traversal of
+ * the input document, with matched subobject bytes copied wholesale rather than re-built element
+ * by element.
+ *
+ * Intended for hot paths that repeatedly apply the same simple inclusion projection (or shard key
+ * pattern) to many documents. Matched elements appear in the order they occur in the input
+ * document, matching the semantics of a simple inclusion projection without metadata, positional
+ * or computed fields.
+ */
+class BSONFieldExtractor {
+public:
+    /**
+     * Compiles the extractor from a set of dotted paths. If one path is a prefix of another
+     * (e.g. "a" and "a.b"), the shorter path wins and the longer one is ignored.
+     */
+    explicit BSONFieldExtractor(const std::vector<std::string>& dottedPaths);
+
+    /**
+     * Appends all matched elements of 'obj' to 'bob' in document order.
+     */
+    void extractInto(const BSONObj& obj, BSONObjBuilder* bob) const;
+
+    /**
+     * Convenience wrapper returning the projected document.
+     */
+    BSONObj extract(const BSONObj& obj) const;
+
+private:
+    struct Node {
+        std::string name;
+        std::vector<Node> children;  // Sorted by name; empty for leaves.
+
+        bool isLeaf() const {
+            return children.empty();
+        }
+    };
+
+    static void _addPath(Node* node, StringData remainingPath);
+    static void _extractInto(const Node& node, const BSONObj& obj, BSONObjBuilder* bob);
+
+    Node _root;
+};
+
+}  // namespace mongo
@@ -0,0 +1,76 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bson_field_extractor.h"
+
+#include "mongo/bson/json.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(BSONFieldExtractor, TopLevelFields) {
+    BSONFieldExtractor extractor({"a", "c"});
+    BSONObj result = extractor.extract(fromjson("{a: 1, b: 2, c: 3, d: 4}"));
+    ASSERT_BSONOBJ_EQ(result, fromjson("{a: 1, c: 3}"));
+}
+
+TEST(BSONFieldExtractor, PreservesDocumentOrder) {
+    BSONFieldExtractor extractor({"a", "z"});
+    BSONObj result = extractor.extract(fromjson("{z: 1, b: 2, a: 3}"));
+    ASSERT_BSONOBJ_EQ(result, fromjson("{z: 1, a: 3}"));
+}
+
+TEST(BSONFieldExtractor, DottedPaths) {
+    BSONFieldExtractor extractor({"a.b", "a.d", "e"});
+    BSONObj result = extractor.extract(fromjson("{a: {b: 1, c: 2, d: 3}, e: 4, f: 5}"));
+    ASSERT_BSONOBJ_EQ(result, fromjson("{a: {b: 1, d: 3}, e: 4}"));
+}
+
+TEST(BSONFieldExtractor, WholeSubobjectCopiedVerbatim) {
+    BSONFieldExtractor extractor({"sub"});
+    BSONObj obj = fromjson("{sub: {x: 1, y: [1, 2, {z: 3}]}, other: 1}");
+    BSONObj result = extractor.extract(obj);
+    ASSERT_BSONOBJ_EQ(result["sub"].embeddedObject(), obj["sub"].embeddedObject());
+}
+
+TEST(BSONFieldExtractor, PrefixPathWins) {
+    BSONFieldExtractor extractor({"a", "a.b"});
+    BSONObj result = extractor.extract(fromjson("{a: {b: 1, c: 2}}"));
+    ASSERT_BSONOBJ_EQ(result, fromjson("{a: {b: 1, c: 2}}"));
+}
+
+TEST(BSONFieldExtractor, MissingAndNonObjectPaths) {
+    BSONFieldExtractor extractor({"missing", "scalar.sub"});
+    BSONObj result = extractor.extract(fromjson("{scalar: 5, other: 1}"));
+    ASSERT_BSONOBJ_EQ(result, BSONObj());
+}
+
+}  // namespace
+}  // namespace mongo
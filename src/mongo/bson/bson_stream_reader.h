@@ -0,0 +1,247 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include "mongo/base/data_view.h"
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+
+/**
+ * Iterates the top-level elements of a BSON document held in a caller-owned buffer that need not
+ * contain the complete document. Unlike BSONObjIterator, every advance is bounds-checked against
+ * the bytes actually available, so a consumer can walk a document straight out of a storage or
+ * socket buffer as it arrives, without first copying the full 16MB maximum into an owned
+ * contiguous allocation.
+ *
+ * Usage:
+ *     BSONStreamReader reader(buf, len);
+ *     for (;;) {
+ *         switch (reader.next()) {
+ *             case BSONStreamReader::State::kElement:
+ *                 use(reader.element());
+ *                 break;
+ *             case BSONStreamReader::State::kNeedMoreData:
+ *                 reader.resume(biggerBuf, biggerLen);  // same document, more bytes
+ *                 break;
+ *             case BSONStreamReader::State::kDone:
+ *                 ...
+ *         }
+ *     }
+ *
+ * Elements handed out are views into the caller's buffer and are invalidated by resume(). The
+ * reader checks structural well-formedness only as far as it must to walk safely (lengths and
+ * termination); callers needing full validation should run validateBSON() on the complete
+ * document.
+ */
+class BSONStreamReader {
+public:
+    enum class State {
+        kElement,       // element() returns the next element.
+        kNeedMoreData,  // The next element is not fully buffered yet; call resume().
+        kDone,          // The document's EOO byte was reached.
+        kCorrupt,       // The buffered bytes cannot be a BSON document.
+    };
+
+    BSONStreamReader(const char* buf, size_t len) : _buf(buf), _len(len) {}
+
+    /**
+     * Advances to the next top-level element.
+     */
+    State next() {
+        if (_state != State::kElement)
+            return _state;
+
+        // Read the document length once we have it; afterwards it bounds the walk.
+        if (_docLen == 0) {
+            if (_len < sizeof(int32_t))
+                return State::kNeedMoreData;
+            int32_t docLen = ConstDataView(_buf).read<LittleEndian<int32_t>>();
+            if (docLen < 5 || docLen > BSONObjMaxInternalSize)
+                return _fail();
+            _docLen = static_cast<size_t>(docLen);
+            _offset = sizeof(int32_t);
+        }
+
+        if (_offset >= _docLen)
+            return _fail();  // Walked past the encoded length without seeing EOO.
+        if (_offset >= _len)
+            return State::kNeedMoreData;
+
+        if (_buf[_offset] == static_cast<char>(EOO)) {
+            if (_offset + 1 != _docLen)
+                return _fail();
+            _state = State::kDone;
+            return _state;
+        }
+
+        // An element is type byte + NUL-terminated name + value. We must establish the element's
+        // total size from buffered bytes only; BSONElement::size() may not be called until the
+        // bytes it reads are known to be present. Locate the name terminator first.
+        const size_t bound = std::min(_len, _docLen);
+        size_t nameEnd = _offset + 1;
+        while (nameEnd < bound && _buf[nameEnd] != '\0')
+            ++nameEnd;
+        if (nameEnd >= bound)
+            return nameEnd + 1 >= _docLen ? _fail() : State::kNeedMoreData;
+
+        const size_t valueStart = nameEnd + 1;
+        size_t valueSize = 0;
+        switch (static_cast<uint8_t>(_buf[_offset])) {
+            case Undefined:
+            case jstNULL:
+            case MinKey:
+            case MaxKey:
+                valueSize = 0;
+                break;
+            case Bool:
+                valueSize = 1;
+                break;
+            case NumberInt:
+                valueSize = 4;
+                break;
+            case NumberDouble:
+            case NumberLong:
+            case Date:
+            case bsonTimestamp:
+                valueSize = 8;
+                break;
+            case jstOID:
+                valueSize = 12;
+                break;
+            case NumberDecimal:
+                valueSize = 16;
+                break;
+            case String:
+            case Code:
+            case Symbol:
+            case Object:
+            case Array:
+            case BinData:
+            case DBRef:
+            case CodeWScope: {
+                if (valueStart + 4 > bound)
+                    return valueStart + 4 > _docLen ? _fail() : State::kNeedMoreData;
+                const int32_t prefix =
+                    ConstDataView(_buf + valueStart).read<LittleEndian<int32_t>>();
+                if (prefix < 0 || static_cast<size_t>(prefix) > _docLen)
+                    return _fail();
+                switch (static_cast<uint8_t>(_buf[_offset])) {
+                    case Object:
+                    case Array:
+                    case CodeWScope:
+                        valueSize = static_cast<size_t>(prefix);  // Prefix is the total size.
+                        break;
+                    case BinData:
+                        valueSize = 4 + 1 + static_cast<size_t>(prefix);
+                        break;
+                    case DBRef:
+                        valueSize = 4 + static_cast<size_t>(prefix) + 12;
+                        break;
+                    default:  // String, Code, Symbol
+                        valueSize = 4 + static_cast<size_t>(prefix);
+                        break;
+                }
+                break;
+            }
+            case RegEx: {
+                // Two NUL-terminated strings; scan within the buffered bytes.
+                size_t p = valueStart;
+                for (int i = 0; i < 2; i++) {
+                    while (p < bound && _buf[p] != '\0')
+                        ++p;
+                    if (p >= bound)
+                        return p + 1 >= _docLen ? _fail() : State::kNeedMoreData;
+                    ++p;
+                }
+                valueSize = p - valueStart;
+                break;
+            }
+            default:
+                return _fail();
+        }
+
+        const size_t totalSize = (valueStart - _offset) + valueSize;
+        if (_offset + totalSize > _docLen)
+            return _fail();
+        if (_offset + totalSize > _len)
+            return State::kNeedMoreData;
+
+        _element = BSONElement(_buf + _offset,
+                               valueStart - _offset - 1 /* field name size incl. NUL */,
+                               totalSize,
+                               BSONElement::CachedSizeTag());
+        _offset += totalSize;
+        return State::kElement;
+    }
+
+    /**
+     * Continues reading after kNeedMoreData. 'buf' must contain the same document from its first
+     * byte, extended with more data (e.g. the caller's grown receive buffer).
+     */
+    void resume(const char* buf, size_t len) {
+        invariant(len >= _len);
+        _buf = buf;
+        _len = len;
+    }
+
+    /**
+     * The element most recently returned by next(). Valid only directly after next() returned
+     * kElement and until the next call to next() or resume().
+     */
+    const BSONElement& element() const {
+        return _element;
+    }
+
+    /**
+     * Total encoded size of the document, or 0 if the length prefix has not been read yet.
+     */
+    size_t documentSize() const {
+        return _docLen;
+    }
+
+private:
+    State _fail() {
+        _state = State::kCorrupt;
+        return _state;
+    }
+
+    const char* _buf;
+    size_t _len;
+    size_t _docLen = 0;
+    size_t _offset = 0;
+    BSONElement _element;
+    State _state = State::kElement;
+};
+
+}  // namespace mongo
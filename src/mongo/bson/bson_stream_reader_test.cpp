@@ -0,0 +1,131 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bson_stream_reader.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/json.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+std::vector<BSONElement> readAll(const BSONObj& obj) {
+    BSONStreamReader reader(obj.objdata(), obj.objsize());
+    std::vector<BSONElement> elems;
+    while (reader.next() == BSONStreamReader::State::kElement) {
+        elems.push_back(reader.element());
+    }
+    return elems;
+}
+
+TEST(BSONStreamReader, ReadsCompleteDocument) {
+    BSONObj obj = fromjson(
+        "{a: 1, b: 'str', c: {x: 1}, d: [1, 2], e: null, f: true, g: 1.5, "
+        "h: NumberLong(7)}");
+    auto elems = readAll(obj);
+    ASSERT_EQ(elems.size(), 8u);
+    size_t i = 0;
+    for (auto&& expected : obj) {
+        ASSERT_EQ(elems[i++].woCompare(expected), 0);
+    }
+}
+
+TEST(BSONStreamReader, EmptyDocument) {
+    BSONObj obj;
+    BSONStreamReader reader(obj.objdata(), obj.objsize());
+    ASSERT(reader.next() == BSONStreamReader::State::kDone);
+}
+
+TEST(BSONStreamReader, IncrementalFeed) {
+    BSONObj obj = fromjson("{alpha: 'first value', beta: 12345, gamma: {nested: 'doc'}}");
+
+    // Feed the document one byte at a time; the reader must only ever report elements that are
+    // fully buffered and must eventually see all of them.
+    std::vector<std::string> seen;
+    BSONStreamReader reader(obj.objdata(), 0);
+    size_t available = 0;
+    for (;;) {
+        auto state = reader.next();
+        if (state == BSONStreamReader::State::kElement) {
+            seen.push_back(reader.element().fieldName());
+            continue;
+        }
+        if (state == BSONStreamReader::State::kDone)
+            break;
+        ASSERT(state == BSONStreamReader::State::kNeedMoreData);
+        ASSERT_LT(available, static_cast<size_t>(obj.objsize()));
+        reader.resume(obj.objdata(), ++available);
+    }
+    ASSERT_EQ(seen.size(), 3u);
+    ASSERT_EQ(seen[0], "alpha");
+    ASSERT_EQ(seen[1], "beta");
+    ASSERT_EQ(seen[2], "gamma");
+}
+
+TEST(BSONStreamReader, RegexAndBinData) {
+    BSONObjBuilder bob;
+    bob.appendRegex("re", "^a.*b$", "i");
+    bob.appendBinData("bin", 5, BinDataGeneral, "\x01\x02\x03\x04\x05");
+    BSONObj obj = bob.obj();
+    auto elems = readAll(obj);
+    ASSERT_EQ(elems.size(), 2u);
+    ASSERT_EQ(elems[0].regex(), std::string("^a.*b$"));
+    int len = 0;
+    elems[1].binData(len);
+    ASSERT_EQ(len, 5);
+}
+
+TEST(BSONStreamReader, RejectsBadLength) {
+    char buf[8];
+    DataView(buf).write<LittleEndian<int32_t>>(3);  // Impossibly small document.
+    BSONStreamReader reader(buf, sizeof(buf));
+    ASSERT(reader.next() == BSONStreamReader::State::kCorrupt);
+}
+
+TEST(BSONStreamReader, RejectsUnknownType) {
+    BSONObj obj = BSON("a" << 1);
+    std::string copy(obj.objdata(), obj.objsize());
+    copy[4] = '\x7e';  // Clobber the type byte with an invalid type.
+    BSONStreamReader reader(copy.data(), copy.size());
+    ASSERT(reader.next() == BSONStreamReader::State::kCorrupt);
+}
+
+TEST(BSONStreamReader, RejectsTruncatedEncodedLength) {
+    BSONObj obj = BSON("a"
+                       << "value");
+    std::string copy(obj.objdata(), obj.objsize());
+    // Claim a string length that runs past the document's encoded size.
+    DataView(copy.data() + 7).write<LittleEndian<int32_t>>(1000);
+    BSONStreamReader reader(copy.data(), copy.size());
+    ASSERT(reader.next() == BSONStreamReader::State::kCorrupt);
+}
+
+}  // namespace
+}  // namespace mongo
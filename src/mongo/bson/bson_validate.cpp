@@ -31,11 +31,16 @@
 #include <cstring>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "mongo/base/data_view.h"
 #include "mongo/bson/bson_depth.h"
 #include "mongo/bson/bson_validate.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/bits.h"
 
 namespace mongo {
 namespace {
@@ -150,6 +155,17 @@ private:
             // This is actually by far the hottest code in all of BSON validation.
             dassert(ptr < end);
             size_t len = 0;
+#if defined(__SSE2__)
+            // Scan for the terminating NUL in 16-byte chunks as long as a full chunk is in
+            // bounds. The buffer is terminated by the EOO byte before 'end', so the scalar tail
+            // loop below cannot run off the end either.
+            while (ptr + len + 16 <= end) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + len));
+                if (int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_setzero_si128())))
+                    return len + countTrailingZeros64(static_cast<unsigned>(mask));
+                len += 16;
+            }
+#endif
             while (ptr[len])
                 ++len;
             return len;
@@ -0,0 +1,99 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+
+/**
+ * An offset table over the top-level fields of a BSONObj, turning repeated getField() calls from
+ * linear scans into binary searches. BSONObj::getField() is fine for a single lookup, but stages
+ * that probe the same document for many fields (projection, shard key extraction) pay a quadratic
+ * cost on wide documents; building this index costs one pass and makes each subsequent lookup
+ * O(log n).
+ *
+ * The index shares ownership of the object's buffer, so it remains valid after the original
+ * BSONObj goes out of scope (for owned objects; unowned objects have the usual BSONObj lifetime
+ * caveats). Only worth constructing when at least a handful of lookups will be made.
+ */
+class BSONObjFieldIndex {
+public:
+    explicit BSONObjFieldIndex(BSONObj obj) : _obj(std::move(obj)) {
+        for (auto&& elem : _obj) {
+            _offsets.push_back(static_cast<uint32_t>(elem.rawdata() - _obj.objdata()));
+        }
+        std::sort(_offsets.begin(), _offsets.end(), [&](uint32_t lhs, uint32_t rhs) {
+            return _fieldName(lhs) < _fieldName(rhs);
+        });
+    }
+
+    /**
+     * Returns the element with the given field name, or an eoo element if there is none. Like
+     * BSONObj::getField(), returns the first occurrence for (invalid) objects with duplicate
+     * field names only if it sorts lowest; duplicate fields are not otherwise distinguished.
+     */
+    BSONElement getField(StringData name) const {
+        auto it = std::lower_bound(
+            _offsets.begin(), _offsets.end(), name, [&](uint32_t off, StringData probe) {
+                return _fieldName(off) < probe;
+            });
+        if (it == _offsets.end() || _fieldName(*it) != name)
+            return BSONElement();
+        return BSONElement(_obj.objdata() + *it);
+    }
+
+    BSONElement operator[](StringData name) const {
+        return getField(name);
+    }
+
+    size_t nFields() const {
+        return _offsets.size();
+    }
+
+    const BSONObj& obj() const {
+        return _obj;
+    }
+
+private:
+    StringData _fieldName(uint32_t offset) const {
+        // Skip the type byte; the field name is NUL terminated.
+        return StringData(_obj.objdata() + offset + 1);
+    }
+
+    BSONObj _obj;
+    std::vector<uint32_t> _offsets;
+};
+
+}  // namespace mongo
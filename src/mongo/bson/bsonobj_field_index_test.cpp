@@ -0,0 +1,88 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bsonobj_field_index.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(BSONObjFieldIndex, FindsAllFields) {
+    BSONObjBuilder bob;
+    for (int i = 0; i < 250; i++) {
+        bob.append("field" + std::to_string(i), i);
+    }
+    BSONObj obj = bob.obj();
+
+    BSONObjFieldIndex index(obj);
+    ASSERT_EQ(index.nFields(), 250u);
+    for (int i = 0; i < 250; i++) {
+        auto elem = index.getField("field" + std::to_string(i));
+        ASSERT_FALSE(elem.eoo());
+        ASSERT_EQ(elem.numberInt(), i);
+    }
+}
+
+TEST(BSONObjFieldIndex, MissingFieldReturnsEOO) {
+    BSONObjFieldIndex index(BSON("a" << 1 << "b" << 2));
+    ASSERT_TRUE(index.getField("c").eoo());
+    ASSERT_TRUE(index.getField("").eoo());
+    ASSERT_TRUE(index.getField("aa").eoo());
+}
+
+TEST(BSONObjFieldIndex, EmptyObject) {
+    BSONObjFieldIndex index(BSONObj{});
+    ASSERT_EQ(index.nFields(), 0u);
+    ASSERT_TRUE(index.getField("a").eoo());
+}
+
+TEST(BSONObjFieldIndex, SharesBufferOwnership) {
+    BSONObjFieldIndex index = [] {
+        BSONObjBuilder bob;
+        bob.append("x", "value");
+        return BSONObjFieldIndex(bob.obj());
+    }();
+    // The original BSONObj is gone; the index keeps the buffer alive.
+    ASSERT_EQ(index["x"].str(), "value");
+}
+
+TEST(BSONObjFieldIndex, MatchesGetFieldSemantics) {
+    BSONObj obj = BSON("a" << 1 << "sub" << BSON("inner" << 2) << "z" << 3);
+    BSONObjFieldIndex index(obj);
+    ASSERT_EQ(index["a"].woCompare(obj["a"]), 0);
+    ASSERT_EQ(index["sub"].woCompare(obj["sub"]), 0);
+    ASSERT_EQ(index["z"].woCompare(obj["z"]), 0);
+    // Dotted paths are not resolved, matching BSONObj::getField().
+    ASSERT_TRUE(index["sub.inner"].eoo());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,176 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "mongo/base/data_view.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/oid.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/str.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * A stencil for emitting fixed-shape BSON documents cheaply. The document layout (field names,
+ * order, types) is fixed once by a prototype; emitting a document is then a single buffer copy
+ * plus in-place writes of the fixed-width values at precomputed offsets, bypassing per-field
+ * BSONObjBuilder name handling entirely.
+ *
+ * Intended for internal hot paths that build thousands of identically-shaped documents —
+ * heartbeats, cursor replies, metrics — where the field-name table is effectively static. Only
+ * fixed-width value types can be restamped: NumberInt, NumberLong, NumberDouble, Bool, Date,
+ * bsonTimestamp and jstOID. Variable-width fields (strings, subobjects) keep their prototype
+ * values; shapes whose variable-width content changes per document should use BSONObjBuilder.
+ *
+ * Example:
+ *     static const BSONObjStencil kStencil(BSON("ok" << 1.0 << "n" << 0 << "t" << Date_t()));
+ *     ...
+ *     auto obj = kStencil.stamp([&](BSONObjStencil::Writer& w) {
+ *         w.setInt("n", count);
+ *         w.setDate("t", now);
+ *     });
+ */
+class BSONObjStencil {
+public:
+    class Writer {
+    public:
+        void setInt(StringData fieldName, int value) {
+            _write<int>(fieldName, NumberInt, value);
+        }
+        void setLong(StringData fieldName, long long value) {
+            _write<long long>(fieldName, NumberLong, value);
+        }
+        void setDouble(StringData fieldName, double value) {
+            _write<double>(fieldName, NumberDouble, value);
+        }
+        void setBool(StringData fieldName, bool value) {
+            _write<char>(fieldName, Bool, value ? 1 : 0);
+        }
+        void setDate(StringData fieldName, Date_t value) {
+            _write<long long>(fieldName, Date, value.toMillisSinceEpoch());
+        }
+        void setTimestamp(StringData fieldName, Timestamp value) {
+            _write<unsigned long long>(fieldName, bsonTimestamp, value.asULL());
+        }
+        void setOID(StringData fieldName, const OID& value) {
+            auto& slot = _stencil->_findSlot(fieldName, jstOID);
+            std::memcpy(_buf.get() + slot.valueOffset, value.view().view(), OID::kOIDSize);
+        }
+
+    private:
+        friend class BSONObjStencil;
+        Writer(const BSONObjStencil* stencil, SharedBuffer buf)
+            : _stencil(stencil), _buf(std::move(buf)) {}
+
+        template <typename T, typename V>
+        void _write(StringData fieldName, BSONType type, V value) {
+            auto& slot = _stencil->_findSlot(fieldName, type);
+            DataView(_buf.get() + slot.valueOffset).write<LittleEndian<T>>(value);
+        }
+
+        const BSONObjStencil* _stencil;
+        SharedBuffer _buf;
+    };
+
+    explicit BSONObjStencil(BSONObj prototype) : _prototype(prototype.getOwned()) {
+        for (auto&& elem : _prototype) {
+            if (!_isFixedWidth(elem.type()))
+                continue;
+            _slots.push_back({elem.fieldNameStringData().toString(),
+                              static_cast<uint32_t>(elem.value() - _prototype.objdata()),
+                              elem.type()});
+        }
+        std::sort(_slots.begin(), _slots.end(), [](const Slot& lhs, const Slot& rhs) {
+            return lhs.fieldName < rhs.fieldName;
+        });
+    }
+
+    /**
+     * Produces a new owned document: copies the prototype buffer and lets 'fillValues' overwrite
+     * the fixed-width slots through a Writer.
+     */
+    template <typename F>
+    BSONObj stamp(F&& fillValues) const {
+        auto size = _prototype.objsize();
+        auto buf = SharedBuffer::allocate(size);
+        std::memcpy(buf.get(), _prototype.objdata(), size);
+        Writer writer(this, std::move(buf));
+        fillValues(writer);
+        BSONObj result(writer._buf.get());
+        result.shareOwnershipWith(std::move(writer._buf));
+        return result;
+    }
+
+private:
+    struct Slot {
+        std::string fieldName;
+        uint32_t valueOffset;
+        BSONType type;
+    };
+
+    static bool _isFixedWidth(BSONType type) {
+        switch (type) {
+            case NumberInt:
+            case NumberLong:
+            case NumberDouble:
+            case Bool:
+            case Date:
+            case bsonTimestamp:
+            case jstOID:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    const Slot& _findSlot(StringData fieldName, BSONType type) const {
+        auto it = std::lower_bound(
+            _slots.begin(), _slots.end(), fieldName, [](const Slot& slot, StringData name) {
+                return StringData(slot.fieldName) < name;
+            });
+        invariant(it != _slots.end() && StringData(it->fieldName) == fieldName,
+                  str::stream() << "no stampable field '" << fieldName << "' in stencil");
+        invariant(it->type == type,
+                  str::stream() << "type mismatch stamping field '" << fieldName << "'");
+        return *it;
+    }
+
+    BSONObj _prototype;
+    std::vector<Slot> _slots;
+};
+
+}  // namespace mongo
@@ -0,0 +1,90 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bsonobj_stencil.h"
+
+#include "mongo/unittest/death_test.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(BSONObjStencil, StampsFixedWidthValues) {
+    BSONObjStencil stencil(BSON("ok" << 1.0 << "n" << 0 << "big" << 0LL << "flag" << false));
+
+    auto obj = stencil.stamp([](BSONObjStencil::Writer& w) {
+        w.setDouble("ok", 0.0);
+        w.setInt("n", 42);
+        w.setLong("big", 1LL << 40);
+        w.setBool("flag", true);
+    });
+
+    ASSERT_BSONOBJ_EQ(obj, BSON("ok" << 0.0 << "n" << 42 << "big" << (1LL << 40) << "flag" << true));
+    ASSERT_TRUE(obj.isOwned());
+}
+
+TEST(BSONObjStencil, UnstampedFieldsKeepPrototypeValues) {
+    BSONObjStencil stencil(BSON("msg"
+                                << "static text"
+                                << "n" << 7));
+    auto obj = stencil.stamp([](BSONObjStencil::Writer& w) { w.setInt("n", 8); });
+    ASSERT_EQ(obj["msg"].str(), "static text");
+    ASSERT_EQ(obj["n"].numberInt(), 8);
+}
+
+TEST(BSONObjStencil, StampDateTimestampAndOID) {
+    auto oid = OID::gen();
+    BSONObjStencil stencil(
+        BSON("when" << Date_t() << "ts" << Timestamp() << "_id" << OID()));
+    auto when = Date_t::fromMillisSinceEpoch(123456789);
+    auto obj = stencil.stamp([&](BSONObjStencil::Writer& w) {
+        w.setDate("when", when);
+        w.setTimestamp("ts", Timestamp(5, 3));
+        w.setOID("_id", oid);
+    });
+    ASSERT_EQ(obj["when"].date(), when);
+    ASSERT_EQ(obj["ts"].timestamp(), Timestamp(5, 3));
+    ASSERT_EQ(obj["_id"].OID(), oid);
+}
+
+TEST(BSONObjStencil, EachStampIsIndependent) {
+    BSONObjStencil stencil(BSON("n" << 0));
+    auto first = stencil.stamp([](BSONObjStencil::Writer& w) { w.setInt("n", 1); });
+    auto second = stencil.stamp([](BSONObjStencil::Writer& w) { w.setInt("n", 2); });
+    ASSERT_EQ(first["n"].numberInt(), 1);
+    ASSERT_EQ(second["n"].numberInt(), 2);
+}
+
+DEATH_TEST_REGEX(BSONObjStencil, UnknownFieldInvariants, "no stampable field") {
+    BSONObjStencil stencil(BSON("n" << 0));
+    stencil.stamp([](BSONObjStencil::Writer& w) { w.setInt("other", 1); });
+}
+
+}  // namespace
+}  // namespace mongo
@@ -35,9 +35,14 @@
 #include <cstdint>
 #include <fmt/format.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "mongo/base/parse_number.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/decimal128.h"
 #include "mongo/platform/strtoll.h"
 #include "mongo/util/base64.h"
@@ -95,6 +100,42 @@ static const char *LBRACE = "{", *RBRACE = "}", *LBRACKET = "[", *RBRACKET = "]"
                   *RPAREN = ")", *COLON = ":", *COMMA = ",", *FORWARDSLASH = "/",
                   *SINGLEQUOTE = "'", *DOUBLEQUOTE = "\"";
 
+namespace {
+
+/**
+ * Returns a pointer to the first character in [p, end) that is 'terminal', a backslash, or a
+ * control character, or 'end' if there is none. Everything before the returned pointer can be
+ * copied into the result verbatim, which lets quoted string parsing process plain spans in bulk
+ * instead of a byte at a time.
+ */
+const char* findSpecialChar(const char* p, const char* end, char terminal) {
+#if defined(__SSE2__)
+    const __m128i terminalVec = _mm_set1_epi8(terminal);
+    const __m128i backslashVec = _mm_set1_epi8('\\');
+    while (p + 16 <= end) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chunk, terminalVec),
+                                       _mm_cmpeq_epi8(chunk, backslashVec));
+        // Control characters are 0x00-0x1F: signed less-than 0x20 but not negative (UTF-8
+        // continuation bytes are negative as signed chars and must not match).
+        __m128i control = _mm_and_si128(_mm_cmplt_epi8(chunk, _mm_set1_epi8(0x20)),
+                                        _mm_cmpgt_epi8(chunk, _mm_set1_epi8(-1)));
+        special = _mm_or_si128(special, control);
+        if (int mask = _mm_movemask_epi8(special))
+            return p + countTrailingZeros64(static_cast<unsigned>(mask));
+        p += 16;
+    }
+#endif
+    for (; p < end; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c == static_cast<unsigned char>(terminal) || c == '\\' || c < 0x20)
+            break;
+    }
+    return p;
+}
+
+}  // namespace
+
 JParse::JParse(StringData str)
     : _buf(str.rawData()), _input(_buf), _input_end(_input + str.size()) {}
 
@@ -1248,8 +1289,20 @@ Status JParse::chars(std::string* result, const char* terminalSet, const char* a
         return parseError("Unexpected end of input");
     }
     const char* q = _input;
+    // Quoted strings (a single-character terminal set, no allowed set) are by far the most common
+    // use and are dominated by plain text: copy maximal spans free of the terminator, escapes and
+    // control characters in bulk, and let the byte-wise loop handle the rest.
+    const bool bulkScan = allowedSet == nullptr && terminalSet[0] != '\0' && terminalSet[1] == '\0';
     while (q < _input_end && !match(*q, terminalSet)) {
         MONGO_JSON_DEBUG("q: " << q);
+        if (bulkScan) {
+            const char* stop = findSpecialChar(q, _input_end, *terminalSet);
+            if (stop != q) {
+                result->append(q, stop - q);
+                q = stop;
+                continue;
+            }
+        }
         if (allowedSet != nullptr) {
             if (!match(*q, allowedSet)) {
                 _input = q;
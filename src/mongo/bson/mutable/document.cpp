@@ -1105,6 +1105,14 @@ private:
         return &_fieldNames[fieldNameId];
     }
 
+    // Whether this Impl may be recycled for a future Document. Impls that have grown large
+    // buffers are destroyed instead, so the pool can't pin memory proportional to the largest
+    // document ever built on the thread.
+    bool isCheapToRecycle() const {
+        return _leafBuf.capacity() <= static_cast<int>(64 * 1024) &&
+            _slowElements.capacity() <= 4096 && _fieldNames.capacity() <= 64 * 1024;
+    }
+
     size_t _numElements;
     ElementRep _fastElements[kFastReps];
     std::vector<ElementRep> _slowElements;
@@ -2267,12 +2275,44 @@ void Document::Impl::writeChildren(Element::RepIdx repIdx, Builder* builder) con
     }
 }
 
-Document::Document() : _impl(new Impl(Document::kInPlaceDisabled)), _root(makeRootElement()) {
+namespace {
+// Upper bound on the number of Impls retained per thread. Update-heavy workloads use at most a
+// couple of Documents at a time (the object being updated and the oplog entry being built).
+const size_t kMaxPooledImpls = 4;
+}  // namespace
+
+std::vector<std::unique_ptr<Document::Impl>>& Document::_implPool() {
+    thread_local std::vector<std::unique_ptr<Impl>> pool;
+    return pool;
+}
+
+std::unique_ptr<Document::Impl> Document::_acquireImpl(InPlaceMode inPlaceMode) {
+    auto& pool = _implPool();
+    if (!pool.empty()) {
+        std::unique_ptr<Impl> impl = std::move(pool.back());
+        pool.pop_back();
+        impl->reset(inPlaceMode);
+        return impl;
+    }
+    return std::make_unique<Impl>(inPlaceMode);
+}
+
+void Document::_recycleImpl(std::unique_ptr<Impl> impl) {
+    auto& pool = _implPool();
+    if (impl->isCheapToRecycle() && pool.size() < kMaxPooledImpls) {
+        // Reset now rather than at acquire time so a pooled Impl doesn't keep refcounted
+        // buffers from its last document alive.
+        impl->reset(Document::kInPlaceDisabled);
+        pool.push_back(std::move(impl));
+    }
+}
+
+Document::Document() : _impl(_acquireImpl(Document::kInPlaceDisabled)), _root(makeRootElement()) {
     dassert(_root._repIdx == kRootRepIdx);
 }
 
 Document::Document(const BSONObj& value, InPlaceMode inPlaceMode)
-    : _impl(new Impl(inPlaceMode)), _root(makeRootElement(value)) {
+    : _impl(_acquireImpl(inPlaceMode)), _root(makeRootElement(value)) {
     dassert(_root._repIdx == kRootRepIdx);
 }
 
@@ -2290,7 +2330,9 @@ void Document::reset(const BSONObj& value, InPlaceMode inPlaceMode) {
     dassert(_root._repIdx == kRootRepIdx);
 }
 
-Document::~Document() {}
+Document::~Document() {
+    _recycleImpl(std::move(_impl));
+}
 
 void Document::reserveDamageEvents(size_t expectedEvents) {
     return getImpl().reserveDamageEvents(expectedEvents);
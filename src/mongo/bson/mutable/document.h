@@ -30,6 +30,8 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/mutable/const_element.h"
@@ -513,7 +515,13 @@ private:
     MONGO_PRIVATE Element makeRootElement(const BSONObj& value);
     MONGO_PRIVATE Element makeElement(ConstElement element, const StringData* fieldName);
 
-    const std::unique_ptr<Impl> _impl;
+    // Impls hold a multi-kilobyte ElementRep slab plus several growable vectors, so rather than
+    // hitting the heap for every Document we recycle them through a small thread-local pool.
+    MONGO_PRIVATE static std::vector<std::unique_ptr<Impl>>& _implPool();
+    MONGO_PRIVATE static std::unique_ptr<Impl> _acquireImpl(InPlaceMode inPlaceMode);
+    MONGO_PRIVATE static void _recycleImpl(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> _impl;
 
     // The root element of this document.
     const Element _root;
@@ -37,6 +37,7 @@
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <boost/optional.hpp>
 
@@ -220,6 +221,99 @@ private:
     UniqueBuffer _buf;
 };
 
+/**
+ * A free list of heap buffers that can be recycled across BufBuilder instances. This lets a
+ * component that constructs many short-lived buffers (e.g. reply assembly on a session) reuse
+ * allocations instead of going to the global allocator for every message.
+ *
+ * Not thread-safe: a pool is intended to be owned by a single operation or session. Buffers that
+ * end up owned by a BSONObj or Message simply never return to the pool and are freed normally by
+ * their refcount.
+ */
+class BufBuilderPool {
+    BufBuilderPool(const BufBuilderPool&) = delete;
+    BufBuilderPool& operator=(const BufBuilderPool&) = delete;
+
+public:
+    // Keep at most this many buffers, and don't retain unusually large ones, so a single jumbo
+    // response doesn't pin memory for the lifetime of the session.
+    static constexpr size_t kMaxPooledBuffers = 8;
+    static constexpr size_t kMaxPooledBufferSize = 1024 * 1024;
+
+    BufBuilderPool() = default;
+
+    SharedBuffer acquire(size_t sz) {
+        while (!_buffers.empty()) {
+            SharedBuffer buf = std::move(_buffers.back());
+            _buffers.pop_back();
+            if (buf.capacity() >= sz)
+                return buf;
+        }
+        return SharedBuffer::allocate(sz);
+    }
+
+    void release(SharedBuffer buf) {
+        if (!buf || buf.isShared() || buf.capacity() > kMaxPooledBufferSize ||
+            _buffers.size() >= kMaxPooledBuffers)
+            return;  // Let the buffer be freed (or kept alive by its other owners).
+        _buffers.push_back(std::move(buf));
+    }
+
+private:
+    std::vector<SharedBuffer> _buffers;
+};
+
+/**
+ * Like SharedBufferAllocator, but draws its initial buffer from a BufBuilderPool and returns it
+ * there on free(). The pool must outlive the allocator.
+ */
+class PooledSharedBufferAllocator {
+    PooledSharedBufferAllocator(const PooledSharedBufferAllocator&) = delete;
+    PooledSharedBufferAllocator& operator=(const PooledSharedBufferAllocator&) = delete;
+
+public:
+    explicit PooledSharedBufferAllocator(BufBuilderPool& pool) : _pool(&pool) {}
+    PooledSharedBufferAllocator(BufBuilderPool& pool, size_t sz) : _pool(&pool) {
+        if (sz > 0)
+            malloc(sz);
+    }
+    ~PooledSharedBufferAllocator() {
+        free();
+    }
+
+    PooledSharedBufferAllocator(PooledSharedBufferAllocator&&) = default;
+    PooledSharedBufferAllocator& operator=(PooledSharedBufferAllocator&&) = default;
+
+    void malloc(size_t sz) {
+        _buf = _pool->acquire(sz);
+    }
+
+    void realloc(size_t sz) {
+        _buf.realloc(sz);
+    }
+
+    void free() {
+        if (_buf)
+            _pool->release(std::move(_buf));
+    }
+
+    SharedBuffer release() {
+        return std::move(_buf);
+    }
+
+    size_t capacity() const {
+        return _buf.capacity();
+    }
+
+    char* get() const {
+        return _buf.get();
+    }
+
+private:
+    BufBuilderPool* _pool;
+    SharedBuffer _buf;
+};
+
 enum { StackSizeDefault = 512 };
 template <size_t SZ>
 class StackAllocator {
@@ -502,6 +596,23 @@ public:
 };
 MONGO_STATIC_ASSERT(std::is_move_constructible_v<BufBuilder>);
 
+/**
+ * A BufBuilder whose buffer is drawn from (and recycled into) a BufBuilderPool. Interchangeable
+ * with BufBuilder for callers that release() the buffer: released buffers are refcounted
+ * SharedBuffers and never return to the pool.
+ */
+class PooledBufBuilder : public BasicBufBuilder<PooledSharedBufferAllocator> {
+public:
+    explicit PooledBufBuilder(BufBuilderPool& pool,
+                              size_t initsize = BufBuilder::kDefaultInitSizeBytes)
+        : BasicBufBuilder(pool, initsize) {}
+
+    /* assume ownership of the buffer */
+    SharedBuffer release() {
+        return _buf.release();
+    }
+};
+
 class UniqueBufBuilder : public BasicBufBuilder<UniqueBufferAllocator> {
 public:
     static constexpr size_t kDefaultInitSizeBytes = 512;
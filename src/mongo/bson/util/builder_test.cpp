@@ -124,4 +124,35 @@ TEST(Builder, AppendUnsignedLongLong) {
 TEST(Builder, AppendShort) {
     testStringBuilderIntegral<short>();
 }
+
+TEST(Builder, PooledBufBuilderRecyclesBuffer) {
+    BufBuilderPool pool;
+    const char* bufPtr;
+    {
+        PooledBufBuilder b(pool, 64);
+        b.appendStr("hello");
+        bufPtr = b.buf();
+    }  // Destruction returns the buffer to the pool.
+    {
+        PooledBufBuilder b(pool, 64);
+        ASSERT_EQ(bufPtr, b.buf());
+    }
+}
+
+TEST(Builder, PooledBufBuilderReleasedBufferDoesNotReturnToPool) {
+    BufBuilderPool pool;
+    SharedBuffer released;
+    const char* bufPtr;
+    {
+        PooledBufBuilder b(pool, 64);
+        b.appendStr("hello");
+        bufPtr = b.buf();
+        released = b.release();
+    }
+    {
+        PooledBufBuilder b(pool, 64);
+        ASSERT_NE(bufPtr, b.buf());
+    }
+    ASSERT_EQ(0, memcmp(released.get(), "hello", 6));
+}
 }  // namespace mongo
@@ -150,9 +150,10 @@ Message DBClientCursor::_assembleGetMore() {
     auto getMoreRequest = GetMoreCommandRequest(cursorId, ns.coll().toString());
     getMoreRequest.setBatchSize(
         boost::make_optional(batchSize != 0, static_cast<int64_t>(batchSize)));
-    getMoreRequest.setMaxTimeMS(boost::make_optional(
-        tailableAwaitData(),
-        static_cast<std::int64_t>(durationCount<Milliseconds>(_awaitDataTimeout))));
+    if (tailableAwaitData() && _awaitDataTimeout > Milliseconds::zero()) {
+        getMoreRequest.setMaxTimeMS(
+            static_cast<std::int64_t>(durationCount<Milliseconds>(_awaitDataTimeout)));
+    }
     if (_term) {
         getMoreRequest.setTerm(static_cast<std::int64_t>(*_term));
     }
@@ -511,13 +512,28 @@ StatusWith<std::unique_ptr<DBClientCursor>> DBClientCursor::fromAggregationReque
         operationTime = LogicalTime::fromOperationTime(ret).asTimestamp();
     }
 
-    return {std::make_unique<DBClientCursor>(client,
-                                             aggRequest.getNamespace(),
-                                             cursorId,
-                                             0,
-                                             useExhaust ? QueryOption_Exhaust : 0,
-                                             firstBatch,
-                                             operationTime)};
+    int opts = useExhaust ? QueryOption_Exhaust : 0;
+
+    // A $changeStream cursor is tailable awaitData on the server. Reflecting that in the client's
+    // query options lets callers give the cursor an awaitData timeout (see
+    // setAwaitDataTimeoutMS()), which subsequent getMores - including the synthetic ones in an
+    // exhaust stream - pass as maxTimeMS so the server blocks waiting for events rather than
+    // returning an empty batch per default wait period.
+    const auto& pipeline = aggRequest.getPipeline();
+    if (!pipeline.empty() &&
+        pipeline.front().firstElementFieldNameStringData() == "$changeStream"_sd) {
+        opts |= QueryOption_CursorTailable | QueryOption_AwaitData;
+    }
+
+    auto cursor = std::make_unique<DBClientCursor>(
+        client, aggRequest.getNamespace(), cursorId, 0, opts, firstBatch, operationTime);
+
+    // Carry the requested batchSize over to subsequent getMores.
+    if (auto batchSize = aggRequest.getCursor().getBatchSize()) {
+        cursor->setBatchSize(static_cast<int>(*batchSize));
+    }
+
+    return {std::move(cursor)};
 }
 
 DBClientCursor::~DBClientCursor() {
@@ -31,6 +31,7 @@
 
 #include "mongo/client/dbclient_connection.h"
 #include "mongo/client/dbclient_cursor.h"
+#include "mongo/db/pipeline/aggregate_command_gen.h"
 #include "mongo/db/query/cursor_response.h"
 #include "mongo/logv2/log.h"
 #include "mongo/unittest/unittest.h"
@@ -791,6 +792,45 @@ TEST_F(DBClientCursorTest, DBClientCursorTailableAwaitDataExhaust) {
     ASSERT_TRUE(conn.getLastSentMessage().empty());
 }
 
+TEST_F(DBClientCursorTest, DBClientCursorFromAggIsTailableAwaitDataForChangeStreams) {
+    // This tests a DBClientCursor built from an aggregation request over a $changeStream pipeline.
+    // Cases to test are:
+    // 1. The cursor is marked tailable awaitData, so an awaitData timeout may be set on it.
+    // 2. A subsequent getMore carries the awaitData timeout, the requested batchSize, and (since
+    //    the cursor was requested with 'useExhaust') the kExhaustSupported flag.
+
+    DBClientConnectionForTest conn;
+    const NamespaceString nss("test", "coll");
+
+    AggregateCommandRequest aggRequest(nss, {BSON("$changeStream" << BSONObj())});
+    SimpleCursorOptions cursorOpts;
+    cursorOpts.setBatchSize(10);
+    aggRequest.setCursor(cursorOpts);
+
+    const long long cursorId = 42;
+    conn.setCallResponse(mockFindResponse(nss, cursorId, {}));
+    auto cursor = unittest::assertGet(DBClientCursor::fromAggregationRequest(
+        &conn, aggRequest, false /*secondaryOk*/, true /*useExhaust*/));
+
+    // --- Test 1 ---
+    ASSERT_TRUE(cursor->tailableAwaitData());
+    cursor->setAwaitDataTimeoutMS(Milliseconds{5000});
+
+    // --- Test 2 ---
+    conn.clearLastSentMessage();
+    conn.setCallResponse(mockGetMoreResponse(nss, cursorId, {docObj(1)}));
+    ASSERT_TRUE(cursor->more());
+    auto m = conn.getLastSentMessage();
+    ASSERT_FALSE(m.empty());
+    auto msg = OpMsg::parse(m);
+    ASSERT_EQ(StringData(msg.body.firstElement().fieldName()), "getMore");
+    ASSERT_EQ(msg.body["getMore"].numberLong(), cursorId);
+    ASSERT_EQ(msg.body["maxTimeMS"].number(), 5000);
+    ASSERT_EQ(msg.body["batchSize"].number(), 10);
+    ASSERT_TRUE(OpMsg::isFlagSet(m, OpMsg::kExhaustSupported));
+    ASSERT_BSONOBJ_EQ(docObj(1), cursor->next());
+}
+
 TEST_F(DBClientCursorTest, DBClientCursorOplogQuery) {
     // This tests DBClientCursor supports oplog query with special fields in the command request.
     // 1. Initial find command has "filter", "tailable", "awaitData", "maxTimeMS", "batchSize",
@@ -0,0 +1,107 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/crypto/sha1_block.h"
+#include "mongo/crypto/sha256_block.h"
+#include "mongo/crypto/sha512_block.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Measures the hash throughput of the active sha_block backend (OpenSSL, CommonCrypto, CNG or
+ * tomcrypt, selected at build time). The library-backed backends dispatch internally to
+ * hardware SHA instructions where the CPU has them, so these numbers reflect what SCRAM
+ * authentication and oplog hashing actually see.
+ */
+template <typename HashBlock>
+void BM_computeHash(benchmark::State& state) {
+    size_t len = state.range(0);
+    size_t bytes = 0;
+    std::string in(len, 'x');
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            HashBlock::computeHash(reinterpret_cast<const uint8_t*>(in.data()), in.size()));
+        bytes += in.size();
+    }
+    state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK_TEMPLATE(BM_computeHash, SHA1Block)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1 << 10)
+    ->Arg(4 << 10);
+BENCHMARK_TEMPLATE(BM_computeHash, SHA256Block)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1 << 10)
+    ->Arg(4 << 10);
+BENCHMARK_TEMPLATE(BM_computeHash, SHA512Block)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1 << 10)
+    ->Arg(4 << 10);
+
+/**
+ * HMAC over inputs sized like a SCRAM PBKDF2 round (salt + block index, then a digest-sized
+ * block per iteration). The per-call fixed costs dominate here, not bulk throughput.
+ */
+template <typename HashBlock>
+void BM_computeHmac(benchmark::State& state) {
+    size_t len = state.range(0);
+    size_t items = 0;
+    const std::vector<uint8_t> key(HashBlock::kHashLength, 'k');
+    std::string in(len, 'x');
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(HashBlock::computeHmac(
+            key.data(), key.size(), reinterpret_cast<const uint8_t*>(in.data()), in.size()));
+        ++items;
+    }
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK_TEMPLATE(BM_computeHmac, SHA1Block)->Arg(SHA1Block::kHashLength);
+BENCHMARK_TEMPLATE(BM_computeHmac, SHA256Block)->Arg(SHA256Block::kHashLength);
+BENCHMARK_TEMPLATE(BM_computeHmac, SHA512Block)->Arg(SHA512Block::kHashLength);
+
+}  // namespace
+}  // namespace mongo
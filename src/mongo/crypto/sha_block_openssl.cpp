@@ -87,6 +87,25 @@ namespace mongo {
 
 namespace {
 
+/*
+ * Hash and HMAC contexts are reused across calls on each thread: EVP_DigestInit_ex and
+ * HMAC_Init_ex fully re-initialize them, and recycling saves an allocation and free per hash.
+ * That matters most for SCRAM's PBKDF2 loop, which computes thousands of HMACs per
+ * authentication. The contexts hold no more residual state than the last operation's key
+ * schedule, which HMAC_Init_ex overwrites on the next use.
+ */
+EVP_MD_CTX* threadDigestContext() {
+    thread_local std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx(EVP_MD_CTX_new(),
+                                                                             &EVP_MD_CTX_free);
+    return ctx.get();
+}
+
+HMAC_CTX* threadHmacContext() {
+    thread_local std::unique_ptr<HMAC_CTX, decltype(&HMAC_CTX_free)> ctx(HMAC_CTX_new(),
+                                                                         &HMAC_CTX_free);
+    return ctx.get();
+}
+
 /*
  * Computes a SHA hash of 'input'.
  */
@@ -94,17 +113,16 @@ template <typename HashType>
 void computeHashImpl(const EVP_MD* md,
                      std::initializer_list<ConstDataRange> input,
                      HashType* const output) {
-    std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> digestCtx(EVP_MD_CTX_new(),
-                                                                      EVP_MD_CTX_free);
+    EVP_MD_CTX* digestCtx = threadDigestContext();
 
     fassert(40379,
-            EVP_DigestInit_ex(digestCtx.get(), md, nullptr) == 1 &&
+            EVP_DigestInit_ex(digestCtx, md, nullptr) == 1 &&
                 std::all_of(begin(input),
                             end(input),
                             [&](const auto& i) {
-                                return EVP_DigestUpdate(digestCtx.get(), i.data(), i.length()) == 1;
+                                return EVP_DigestUpdate(digestCtx, i.data(), i.length()) == 1;
                             }) &&
-                EVP_DigestFinal_ex(digestCtx.get(), output->data(), nullptr) == 1);
+                EVP_DigestFinal_ex(digestCtx, output->data(), nullptr) == 1);
 }
 
 template <typename HashType>
@@ -113,18 +131,18 @@ void computeHmacImpl(const EVP_MD* md,
                      size_t keyLen,
                      std::initializer_list<ConstDataRange> input,
                      HashType* const output) {
-    std::unique_ptr<HMAC_CTX, decltype(&HMAC_CTX_free)> digestCtx(HMAC_CTX_new(), HMAC_CTX_free);
+    HMAC_CTX* digestCtx = threadHmacContext();
 
     fassert(40380,
-            HMAC_Init_ex(digestCtx.get(), key, keyLen, md, nullptr) == 1 &&
+            HMAC_Init_ex(digestCtx, key, keyLen, md, nullptr) == 1 &&
                 std::all_of(begin(input),
                             end(input),
                             [&](const auto& i) {
-                                return HMAC_Update(digestCtx.get(),
+                                return HMAC_Update(digestCtx,
                                                    reinterpret_cast<const unsigned char*>(i.data()),
                                                    i.length()) == 1;
                             }) &&
-                HMAC_Final(digestCtx.get(), output->data(), nullptr) == 1);
+                HMAC_Final(digestCtx, output->data(), nullptr) == 1);
 }
 
 }  // namespace
@@ -285,6 +285,15 @@ public:
 
     virtual void init(OperationContext* opCtx) {}
 
+    /**
+     * Initializes this collection if it was registered without being initialized, which happens
+     * for collections in databases above the 'lazyCollectionInitThreshold' (see
+     * DatabaseImpl::init()). Safe to call concurrently from multiple readers; only the first
+     * caller performs the work. A no-op for collection types that are always constructed fully
+     * initialized.
+     */
+    virtual void ensureInitialized(OperationContext* opCtx) const {}
+
     virtual bool isCommitted() const {
         return true;
     }
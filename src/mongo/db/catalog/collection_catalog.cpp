@@ -337,6 +337,7 @@ CollectionCatalog::iterator::value_type CollectionCatalog::iterator::operator*()
         return CollectionPtr();
     }
 
+    _mapIter->second->ensureInitialized(_opCtx);
     return {_opCtx, _mapIter->second.get(), LookupCollectionForYieldRestore()};
 }
 
@@ -597,7 +598,11 @@ std::shared_ptr<const Collection> CollectionCatalog::lookupCollectionByUUIDForRe
     }
 
     auto coll = _lookupCollectionByUUID(uuid);
-    return (coll && coll->isCommitted()) ? coll : nullptr;
+    if (!coll || !coll->isCommitted()) {
+        return nullptr;
+    }
+    coll->ensureInitialized(opCtx);
+    return coll;
 }
 
 Collection* CollectionCatalog::lookupCollectionByUUIDForMetadataWrite(OperationContext* opCtx,
@@ -630,6 +635,8 @@ Collection* CollectionCatalog::lookupCollectionByUUIDForMetadataWrite(OperationC
         return coll.get();
 
     invariant(opCtx->lockState()->isCollectionLockedForMode(coll->ns(), MODE_X));
+    // Initialize before cloning so the writable clone starts from a fully built collection.
+    coll->ensureInitialized(opCtx);
     auto cloned = coll->clone();
     auto ptr = cloned.get();
     uncommittedCatalogUpdates.writable(std::move(cloned));
@@ -655,9 +662,11 @@ CollectionPtr CollectionCatalog::lookupCollectionByUUID(OperationContext* opCtx,
     }
 
     auto coll = _lookupCollectionByUUID(uuid);
-    return (coll && coll->isCommitted())
-        ? CollectionPtr(opCtx, coll.get(), LookupCollectionForYieldRestore())
-        : CollectionPtr();
+    if (!coll || !coll->isCommitted()) {
+        return CollectionPtr();
+    }
+    coll->ensureInitialized(opCtx);
+    return CollectionPtr(opCtx, coll.get(), LookupCollectionForYieldRestore());
 }
 
 bool CollectionCatalog::isCollectionAwaitingVisibility(CollectionUUID uuid) const {
@@ -665,6 +674,14 @@ bool CollectionCatalog::isCollectionAwaitingVisibility(CollectionUUID uuid) cons
     return coll && !coll->isCommitted();
 }
 
+boost::optional<RecordId> CollectionCatalog::lookupCatalogIdByUUID(CollectionUUID uuid) const {
+    auto coll = _lookupCollectionByUUID(uuid);
+    if (!coll) {
+        return boost::none;
+    }
+    return coll->getCatalogId();
+}
+
 std::shared_ptr<Collection> CollectionCatalog::_lookupCollectionByUUID(CollectionUUID uuid) const {
     auto foundIt = _catalog.find(uuid);
     return foundIt == _catalog.end() ? nullptr : foundIt->second;
@@ -678,7 +695,11 @@ std::shared_ptr<const Collection> CollectionCatalog::lookupCollectionByNamespace
 
     auto it = _collections.find(nss);
     auto coll = (it == _collections.end() ? nullptr : it->second);
-    return (coll && coll->isCommitted()) ? coll : nullptr;
+    if (!coll || !coll->isCommitted()) {
+        return nullptr;
+    }
+    coll->ensureInitialized(opCtx);
+    return coll;
 }
 
 Collection* CollectionCatalog::lookupCollectionByNamespaceForMetadataWrite(
@@ -714,6 +735,8 @@ Collection* CollectionCatalog::lookupCollectionByNamespaceForMetadataWrite(
         return nullptr;
 
     invariant(opCtx->lockState()->isCollectionLockedForMode(nss, MODE_X));
+    // Initialize before cloning so the writable clone starts from a fully built collection.
+    coll->ensureInitialized(opCtx);
     auto cloned = coll->clone();
     auto ptr = cloned.get();
     uncommittedCatalogUpdates.writable(std::move(cloned));
@@ -746,9 +769,11 @@ CollectionPtr CollectionCatalog::lookupCollectionByNamespace(OperationContext* o
 
     auto it = _collections.find(nss);
     auto coll = (it == _collections.end() ? nullptr : it->second);
-    return (coll && coll->isCommitted())
-        ? CollectionPtr(opCtx, coll.get(), LookupCollectionForYieldRestore())
-        : nullptr;
+    if (!coll || !coll->isCommitted()) {
+        return nullptr;
+    }
+    coll->ensureInitialized(opCtx);
+    return CollectionPtr(opCtx, coll.get(), LookupCollectionForYieldRestore());
 }
 
 boost::optional<NamespaceString> CollectionCatalog::lookupNSSByUUID(OperationContext* opCtx,
@@ -900,6 +925,9 @@ std::vector<std::string> CollectionCatalog::getAllDbNames() const {
 
 void CollectionCatalog::setDatabaseProfileSettings(
     StringData dbName, CollectionCatalog::ProfileSettings newProfileSettings) {
+    if (newProfileSettings.filter) {
+        ProfileFilter::noteConfigured();
+    }
     _databaseProfileSettings[dbName] = newProfileSettings;
 }
 
@@ -236,6 +236,14 @@ public:
      */
     bool isCollectionAwaitingVisibility(CollectionUUID uuid) const;
 
+    /**
+     * Returns the durable catalog id for the collection with 'uuid', or boost::none if the uuid is
+     * not known. Unlike the lookup functions above this does not initialize a lazily registered
+     * collection, so DatabaseImpl::init() can inspect durable metadata without paying the
+     * initialization cost.
+     */
+    boost::optional<RecordId> lookupCatalogIdByUUID(CollectionUUID uuid) const;
+
     /**
      * This function gets the Collection pointer that corresponds to the NamespaceString.
      * The required locks must be obtained prior to calling this function, or else the found
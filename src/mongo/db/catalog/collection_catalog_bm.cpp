@@ -48,16 +48,45 @@ ServiceContext* setupServiceContext() {
     return serviceContextPtr;
 }
 
-void createCollectionsAndLocker(OperationContext* opCtx, int numCollections) {
+NamespaceString makeLookupNamespace(int numCollections) {
+    return NamespaceString("collection_catalog_bm", std::to_string(numCollections / 2));
+}
+
+UUID createCollectionsAndLocker(OperationContext* opCtx, int numCollections) {
+    boost::optional<UUID> lookupUUID;
     for (auto i = 0; i < numCollections; i++) {
         const NamespaceString nss("collection_catalog_bm", std::to_string(i));
+        const UUID uuid = UUID::gen();
+        if (nss == makeLookupNamespace(numCollections)) {
+            lookupUUID = uuid;
+        }
         CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
-            catalog.registerCollection(opCtx, UUID::gen(), std::make_shared<CollectionMock>(nss));
+            catalog.registerCollection(opCtx, uuid, std::make_shared<CollectionMock>(nss));
         });
     }
 
     stdx::lock_guard<Client> lk(cc());
     opCtx->swapLockState(std::make_unique<LockerImpl>(), lk);
+    return *lookupUUID;
+}
+
+/**
+ * Returns a vector of Clients of length 'k', each of which has an OperationContext with its
+ * lockState set to a LockerImpl.
+ */
+std::vector<std::pair<ServiceContext::UniqueClient, ServiceContext::UniqueOperationContext>>
+makeKClientsWithLockers(ServiceContext* serviceContext, int k) {
+    std::vector<std::pair<ServiceContext::UniqueClient, ServiceContext::UniqueOperationContext>>
+        clients;
+    clients.reserve(k);
+    for (int i = 0; i < k; ++i) {
+        auto client =
+            serviceContext->makeClient("collection_catalog_bm client " + std::to_string(i));
+        auto opCtx = client->makeOperationContext();
+        client->swapLockState(std::make_unique<LockerImpl>());
+        clients.emplace_back(std::move(client), std::move(opCtx));
+    }
+    return clients;
 }
 
 }  // namespace
@@ -90,7 +119,122 @@ void BM_CollectionCatalogWriteWithGlobalExclusiveLock(benchmark::State& state) {
     }
 }
 
+void BM_CollectionCatalogGet(benchmark::State& state) {
+    auto serviceContext = setupServiceContext();
+    ThreadClient threadClient(serviceContext);
+    ServiceContext::UniqueOperationContext opCtx = threadClient->makeOperationContext();
+
+    createCollectionsAndLocker(opCtx.get(), state.range(0));
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(CollectionCatalog::get(opCtx.get()));
+    }
+}
+
+void BM_CollectionCatalogLookupCollectionByNamespace(benchmark::State& state) {
+    auto serviceContext = setupServiceContext();
+    ThreadClient threadClient(serviceContext);
+    ServiceContext::UniqueOperationContext opCtx = threadClient->makeOperationContext();
+
+    createCollectionsAndLocker(opCtx.get(), state.range(0));
+    const NamespaceString nss = makeLookupNamespace(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(
+            CollectionCatalog::get(opCtx.get())->lookupCollectionByNamespace(opCtx.get(), nss));
+    }
+}
+
+void BM_CollectionCatalogLookupCollectionByUUID(benchmark::State& state) {
+    auto serviceContext = setupServiceContext();
+    ThreadClient threadClient(serviceContext);
+    ServiceContext::UniqueOperationContext opCtx = threadClient->makeOperationContext();
+
+    const UUID uuid = createCollectionsAndLocker(opCtx.get(), state.range(0));
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(
+            CollectionCatalog::get(opCtx.get())->lookupCollectionByUUID(opCtx.get(), uuid));
+    }
+}
+
+// Measures how namespace lookups scale across reader threads. Lookups run against an immutable
+// catalog snapshot obtained with a single atomic load, so throughput should scale near-linearly
+// with the thread count.
+void BM_CollectionCatalogConcurrentLookups(benchmark::State& state) {
+    static ServiceContext* serviceContext;
+    static std::vector<std::pair<ServiceContext::UniqueClient,
+                                 ServiceContext::UniqueOperationContext>>
+        clients;
+
+    if (state.thread_index == 0) {
+        serviceContext = setupServiceContext();
+        {
+            ThreadClient threadClient(serviceContext);
+            auto opCtx = threadClient->makeOperationContext();
+            createCollectionsAndLocker(opCtx.get(), state.range(0));
+        }
+        clients = makeKClientsWithLockers(serviceContext, state.threads);
+    }
+
+    const NamespaceString nss = makeLookupNamespace(state.range(0));
+
+    for (auto _ : state) {
+        auto opCtx = clients[state.thread_index].second.get();
+        benchmark::DoNotOptimize(
+            CollectionCatalog::get(opCtx)->lookupCollectionByNamespace(opCtx, nss));
+    }
+
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
+// Same as above, except thread 0 continuously publishes new catalog instances. Readers never block
+// on the writer; they keep resolving lookups against the snapshot loaded at the top of each
+// iteration.
+void BM_CollectionCatalogConcurrentLookupsWithWrites(benchmark::State& state) {
+    static ServiceContext* serviceContext;
+    static std::vector<std::pair<ServiceContext::UniqueClient,
+                                 ServiceContext::UniqueOperationContext>>
+        clients;
+
+    if (state.thread_index == 0) {
+        serviceContext = setupServiceContext();
+        {
+            ThreadClient threadClient(serviceContext);
+            auto opCtx = threadClient->makeOperationContext();
+            createCollectionsAndLocker(opCtx.get(), state.range(0));
+        }
+        clients = makeKClientsWithLockers(serviceContext, state.threads);
+    }
+
+    const NamespaceString nss = makeLookupNamespace(state.range(0));
+
+    for (auto _ : state) {
+        auto opCtx = clients[state.thread_index].second.get();
+        if (state.thread_index == 0) {
+            CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {});
+        } else {
+            benchmark::DoNotOptimize(
+                CollectionCatalog::get(opCtx)->lookupCollectionByNamespace(opCtx, nss));
+        }
+    }
+
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
 BENCHMARK(BM_CollectionCatalogWrite)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_CollectionCatalogWriteWithGlobalExclusiveLock)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_CollectionCatalogGet)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_CollectionCatalogLookupCollectionByNamespace)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_CollectionCatalogLookupCollectionByUUID)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_CollectionCatalogConcurrentLookups)->Arg(100'000)->ThreadRange(1, 16);
+BENCHMARK(BM_CollectionCatalogConcurrentLookupsWithWrites)->Arg(100'000)->ThreadRange(2, 16);
 
 }  // namespace mongo
@@ -436,6 +436,23 @@ void CollectionImpl::init(OperationContext* opCtx) {
     _initialized = true;
 }
 
+void CollectionImpl::ensureInitialized(OperationContext* opCtx) const {
+    if (_shared->_initializedSignal.load()) {
+        return;
+    }
+
+    stdx::lock_guard<Latch> lk(_shared->_initMutex);
+    if (!_initialized) {
+        // Reading '_initialized' under the mutex is safe: eager initialization at database open
+        // or collection creation happens before the collection is visible to other threads, and
+        // lazy initialization always happens here, on the instance registered in the catalog.
+        // Clones are only ever taken of initialized collections, so casting away const mutates
+        // state no concurrent reader can observe until the signal below is set.
+        const_cast<CollectionImpl*>(this)->init(opCtx);
+    }
+    _shared->_initializedSignal.store(true);
+}
+
 bool CollectionImpl::isInitialized() const {
     return _initialized;
 }
@@ -78,6 +78,7 @@ public:
     SharedCollectionDecorations* getSharedDecorations() const final;
 
     void init(OperationContext* opCtx) final;
+    void ensureInitialized(OperationContext* opCtx) const final;
     bool isInitialized() const final;
     bool isCommitted() const final;
     void setCommitted(bool val) final;
@@ -558,6 +559,13 @@ private:
         mutable Mutex _cappedFirstRecordMutex =
             MONGO_MAKE_LATCH("CollectionImpl::SharedState::_cappedFirstRecordMutex");
         RecordId _cappedFirstRecord;
+
+        // Serializes lazy initialization of collections registered uninitialized (see
+        // ensureInitialized()). The atomic is only set once the instance registered in the
+        // catalog is known to be initialized, and publishes the state written by init() to
+        // readers that take the fast path.
+        mutable Mutex _initMutex = MONGO_MAKE_LATCH("CollectionImpl::SharedState::_initMutex");
+        AtomicWord<bool> _initializedSignal{false};
     };
 
     NamespaceString _ns;
@@ -46,6 +46,7 @@
 #include "mongo/db/catalog/collection_impl.h"
 #include "mongo/db/catalog/collection_options.h"
 #include "mongo/db/catalog/database_holder.h"
+#include "mongo/db/catalog/database_impl_gen.h"
 #include "mongo/db/catalog/drop_indexes.h"
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/catalog/uncommitted_collections.h"
@@ -55,6 +56,7 @@
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/index/index_access_method.h"
+#include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index_builds_coordinator.h"
 #include "mongo/db/introspect.h"
 #include "mongo/db/op_observer.h"
@@ -127,6 +129,24 @@ void assertMovePrimaryInProgress(OperationContext* opCtx, NamespaceString const&
     }
 }
 
+/**
+ * Returns true if the durable metadata carries TTL state, either through a clustered collection
+ * with 'expireAfterSeconds' or through a TTL index. Such collections must be initialized eagerly
+ * so they register with the TTLCollectionCache and keep expiring documents even when they receive
+ * no user traffic.
+ */
+bool hasTTLState(const BSONCollectionCatalogEntry::MetaData& md) {
+    if (md.options.clusteredIndex && md.options.expireAfterSeconds) {
+        return true;
+    }
+    for (const auto& index : md.indexes) {
+        if (index.spec.hasField(IndexDescriptor::kExpireAfterSecondsFieldName)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 }  // namespace
 
 Status DatabaseImpl::validateDBName(StringData dbname) {
@@ -170,17 +190,52 @@ void DatabaseImpl::init(OperationContext* const opCtx) const {
     }
 
     auto catalog = CollectionCatalog::get(opCtx);
-    for (const auto& uuid : catalog->getAllCollectionUUIDsFromDb(_name)) {
-        CollectionWriter collection(
-            opCtx,
-            uuid,
-            opCtx->lockState()->isW() ? CollectionCatalog::LifetimeMode::kInplace
-                                      : CollectionCatalog::LifetimeMode::kManagedInWriteUnitOfWork);
+    auto uuids = catalog->getAllCollectionUUIDsFromDb(_name);
+
+    // Databases with many collections skip eager initialization: each collection's index catalog
+    // and related in-memory state is built on first access instead (see
+    // Collection::ensureInitialized()), which bounds both database open time and the memory
+    // carried for namespaces that are rarely touched. Repair requires fully initialized
+    // collections, so it always initializes eagerly.
+    const auto lazyInitThreshold = static_cast<size_t>(gLazyCollectionInitThreshold.load());
+    const bool initializeEagerly = storageGlobalParams.repair || lazyInitThreshold == 0 ||
+        uuids.size() <= lazyInitThreshold;
+
+    auto initCollection = [&](CollectionUUID uuid) {
+        const auto mode = opCtx->lockState()->isW()
+            ? CollectionCatalog::LifetimeMode::kInplace
+            : CollectionCatalog::LifetimeMode::kManagedInWriteUnitOfWork;
+        CollectionWriter collection(opCtx, uuid, mode);
         invariant(collection);
         // If this is called from the repair path, the collection is already initialized.
         if (!collection->isInitialized()) {
             collection.getWritableCollection()->init(opCtx);
         }
+    };
+
+    if (initializeEagerly) {
+        for (const auto& uuid : uuids) {
+            initCollection(uuid);
+        }
+    } else {
+        LOGV2(6174819,
+              "Deferring collection initialization to first access",
+              "db"_attr = _name,
+              "numCollections"_attr = uuids.size(),
+              "lazyCollectionInitThreshold"_attr = lazyInitThreshold);
+
+        // Collections with TTL state must still be initialized now: TTL expiry relies on
+        // registration with the TTLCollectionCache, which only happens during initialization.
+        // The metadata reads below are cheap as the durable catalog caches parsed metadata.
+        auto durableCatalog = DurableCatalog::get(opCtx);
+        for (const auto& uuid : uuids) {
+            auto catalogId = catalog->lookupCatalogIdByUUID(uuid);
+            invariant(catalogId);
+            auto md = durableCatalog->getMetaData(opCtx, *catalogId);
+            if (md && hasTTLState(*md)) {
+                initCollection(uuid);
+            }
+        }
     }
 
     // When in repair mode, record stores are not loaded. Thus the ViewsCatalog cannot be reloaded.
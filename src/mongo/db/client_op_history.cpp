@@ -0,0 +1,108 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kNetwork
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/client_op_history.h"
+
+#include "mongo/db/client.h"
+#include "mongo/logv2/log.h"
+#include "mongo/rpc/message.h"
+#include "mongo/util/hex.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+namespace {
+
+const auto getClientOpHistory = Client::declareDecoration<ClientOpHistory>();
+
+}  // namespace
+
+ClientOpHistory& ClientOpHistory::get(Client* client) {
+    return getClientOpHistory(client);
+}
+
+void ClientOpHistory::record(Client* client,
+                             long long endEpochMillis,
+                             int networkOp,
+                             StringData ns,
+                             long long durationMicros,
+                             long long responseLength,
+                             long long flowControlWaitMicros) {
+    auto& entry = _entries[_totalOps % kNumEntries];
+    entry.endEpochMillis = endEpochMillis;
+    entry.networkOp = networkOp;
+    entry.nsHash = static_cast<unsigned int>(StringMapHasher{}(ns));
+    entry.durationMicros = durationMicros;
+    entry.responseLength = responseLength;
+    entry.flowControlWaitMicros = flowControlWaitMicros;
+
+    _connectionId = client->getConnectionId();
+    // Publish the entry by bumping the count last; a concurrent reader that misses the increment
+    // simply does not report the new entry.
+    ++_totalOps;
+}
+
+void ClientOpHistory::append(BSONArrayBuilder* ops) const {
+    const auto totalOps = _totalOps;
+    const auto numEntries = std::min(totalOps, static_cast<long long>(kNumEntries));
+    for (auto i = totalOps - numEntries; i < totalOps; ++i) {
+        const auto& entry = _entries[i % kNumEntries];
+        BSONObjBuilder op(ops->subobjStart());
+        op.appendDate("end", Date_t::fromMillisSinceEpoch(entry.endEpochMillis));
+        op.append("op", networkOpToString(static_cast<NetworkOp>(entry.networkOp)));
+        op.append("nsHash", zeroPaddedHex(entry.nsHash));
+        op.appendNumber("durationMicros", entry.durationMicros);
+        op.appendNumber("responseLength", entry.responseLength);
+        op.appendNumber("flowControlWaitMicros", entry.flowControlWaitMicros);
+    }
+}
+
+ClientOpHistory::~ClientOpHistory() {
+    if (empty()) {
+        return;
+    }
+
+    // Gives support a trail of what a connection did right before it went away, without
+    // requiring profiling or verbose logging to have been enabled while it was alive.
+    if (shouldLog(MONGO_LOGV2_DEFAULT_COMPONENT, logv2::LogSeverity::Debug(1))) {
+        BSONArrayBuilder ops;
+        append(&ops);
+        LOGV2_DEBUG(6174816,
+                    1,
+                    "Recent operations for ended connection",
+                    "connectionId"_attr = _connectionId,
+                    "totalOps"_attr = _totalOps,
+                    "ops"_attr = ops.arr());
+    }
+}
+
+}  // namespace mongo
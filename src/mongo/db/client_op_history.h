@@ -0,0 +1,99 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+
+namespace mongo {
+
+class Client;
+
+/**
+ * A fixed-size ring of summaries of the most recent operations completed on a Client, so that
+ * when a driver reports a slow request we can reconstruct what its connection was doing without
+ * having had full logging enabled. Recording is a namespace hash plus a handful of plain stores
+ * into preallocated slots — no locking and no allocation — so it runs for every operation.
+ *
+ * Only the owning Client's thread writes. Readers (the connectionOpHistory command and the
+ * teardown log line) do not synchronize with a concurrent writer, so the entry currently being
+ * overwritten may be observed half-written; that is an accepted tradeoff for keeping the write
+ * path free of synchronization, and fine for a diagnostic aid.
+ */
+class ClientOpHistory {
+public:
+    static constexpr size_t kNumEntries = 16;
+
+    struct Entry {
+        long long endEpochMillis = 0;
+        int networkOp = 0;
+        unsigned int nsHash = 0;
+        long long durationMicros = 0;
+        long long responseLength = 0;
+        long long flowControlWaitMicros = 0;
+    };
+
+    static ClientOpHistory& get(Client* client);
+
+    /**
+     * Records a completed operation. Must only be called from the Client's own thread.
+     */
+    void record(Client* client,
+                long long endEpochMillis,
+                int networkOp,
+                StringData ns,
+                long long durationMicros,
+                long long responseLength,
+                long long flowControlWaitMicros);
+
+    /**
+     * Appends the recorded entries, oldest first, as documents in 'ops'.
+     */
+    void append(BSONArrayBuilder* ops) const;
+
+    bool empty() const {
+        return _totalOps == 0;
+    }
+
+    /**
+     * Dumps any recorded history at debug log level when the connection goes away.
+     */
+    ~ClientOpHistory();
+
+private:
+    std::array<Entry, kNumEntries> _entries;
+    long long _totalOps = 0;
+    long long _connectionId = 0;
+};
+
+}  // namespace mongo
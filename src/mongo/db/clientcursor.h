@@ -231,6 +231,23 @@ public:
         ++_nBatchesReturned;
     }
 
+    /**
+     * Records the size of the batch just produced and when it was handed back to the client, so
+     * the next getMore can size its batch to the observed drain rate.
+     */
+    void setLastBatchStats(int batchBytes, Date_t returnedAt) {
+        _lastBatchBytes = batchBytes;
+        _lastBatchReturnedAt = returnedAt;
+    }
+
+    int getLastBatchBytes() const {
+        return _lastBatchBytes;
+    }
+
+    Date_t getLastBatchReturnedAt() const {
+        return _lastBatchReturnedAt;
+    }
+
     Date_t getLastUseDate() const {
         return _lastUseDate;
     }
@@ -377,6 +394,11 @@ private:
     // Tracks the number of batches returned by this cursor so far.
     std::uint64_t _nBatchesReturned = 0;
 
+    // Size in bytes of the last batch returned and the time it was handed back to the client.
+    // Used by getMore to size batches to the client's observed drain rate.
+    int _lastBatchBytes = 0;
+    Date_t _lastBatchReturnedAt;
+
     // Holds an owned copy of the command specification received from the client.
     const BSONObj _originatingCommand;
 
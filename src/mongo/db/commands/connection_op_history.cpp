@@ -0,0 +1,107 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/auth/action_type.h"
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/client.h"
+#include "mongo/db/client_op_history.h"
+#include "mongo/db/commands.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+
+/**
+ * Admin command that dumps the ring of recent operation summaries kept on each connection. Lets
+ * support reconstruct what a connection did right before a reported slow request without full
+ * logging having been enabled. Pass 'connectionId' to restrict the output to one connection.
+ */
+class CmdConnectionOpHistory : public BasicCommand {
+public:
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kAlways;
+    }
+
+    virtual bool adminOnly() const {
+        return true;
+    }
+
+    virtual bool supportsWriteConcern(const BSONObj& cmd) const {
+        return false;
+    }
+
+    std::string help() const override {
+        return "show a summary of the most recent operations of each connection";
+    }
+
+    Status checkAuthForCommand(Client* client,
+                               const std::string& dbname,
+                               const BSONObj& cmdObj) const final {
+        bool isAuthorized = AuthorizationSession::get(client)->isAuthorizedForActionsOnResource(
+            ResourcePattern::forClusterResource(), ActionType::inprog);
+        return isAuthorized ? Status::OK() : Status(ErrorCodes::Unauthorized, "Unauthorized");
+    }
+
+    CmdConnectionOpHistory() : BasicCommand("connectionOpHistory") {}
+
+    bool run(OperationContext* opCtx,
+             const std::string& dbname,
+             const BSONObj& cmdObj,
+             BSONObjBuilder& result) {
+        boost::optional<long long> connectionIdFilter;
+        if (auto elem = cmdObj["connectionId"]; elem.isNumber()) {
+            connectionIdFilter = elem.numberLong();
+        }
+
+        BSONArrayBuilder connections(result.subarrayStart("connections"));
+        for (ServiceContext::LockedClientsCursor cursor(opCtx->getServiceContext());
+             Client* client = cursor.next();) {
+            invariant(client);
+            if (connectionIdFilter && client->getConnectionId() != *connectionIdFilter) {
+                continue;
+            }
+
+            auto& history = ClientOpHistory::get(client);
+            if (history.empty()) {
+                continue;
+            }
+
+            BSONObjBuilder connection(connections.subobjStart());
+            connection.append("desc", client->desc());
+            connection.appendNumber("connectionId", client->getConnectionId());
+            BSONArrayBuilder ops(connection.subarrayStart("ops"));
+            history.append(&ops);
+        }
+
+        return true;
+    }
+} cmdConnectionOpHistory;
+}  // namespace mongo
@@ -672,28 +672,32 @@ write_ops::FindAndModifyCommandReply CmdFindAndModify::Invocation::typedRun(
                     "hangBeforeFindAndModifyPerformsUpdate");
             }
 
+            auto updateRequest = UpdateRequest();
+            updateRequest.setNamespaceString(nsString);
+            const auto verbosity = boost::none;
+            makeUpdateRequest(opCtx, req, verbosity, &updateRequest);
+
+            if (opCtx->getTxnNumber()) {
+                updateRequest.setStmtIds({stmtId});
+            }
+
+            // Parse the update once, up front, so that duplicate-key retries below reuse the
+            // parsed update rather than parsing the request again on every attempt.
+            const ExtensionsCallbackReal extensionsCallback(opCtx,
+                                                            &updateRequest.getNamespaceString());
+            ParsedUpdate parsedUpdate(opCtx, &updateRequest, extensionsCallback);
+            uassertStatusOK(parsedUpdate.parseRequest());
+
             // Nested retry loop to handle concurrent conflicting upserts with equality
             // match.
             int retryAttempts = 0;
             for (;;) {
-                auto updateRequest = UpdateRequest();
-                updateRequest.setNamespaceString(nsString);
-                const auto verbosity = boost::none;
-                makeUpdateRequest(opCtx, req, verbosity, &updateRequest);
-
-                if (opCtx->getTxnNumber()) {
-                    updateRequest.setStmtIds({stmtId});
-                }
-
-                const ExtensionsCallbackReal extensionsCallback(
-                    opCtx, &updateRequest.getNamespaceString());
-                ParsedUpdate parsedUpdate(opCtx, &updateRequest, extensionsCallback);
-                uassertStatusOK(parsedUpdate.parseRequest());
-
                 try {
                     return CmdFindAndModify::Invocation::writeConflictRetryUpsert(
                         opCtx, nsString, req, curOp, opDebug, inTransaction, &parsedUpdate);
                 } catch (const ExceptionFor<ErrorCodes::DuplicateKey>& ex) {
+                    // The executor releases the canonical query after each attempt, so it must be
+                    // recreated here. The update portion of 'parsedUpdate' is still parsed.
                     if (!parsedUpdate.hasParsedQuery()) {
                         uassertStatusOK(parsedUpdate.parseQueryToCQ());
                     }
@@ -50,6 +50,7 @@
 #include "mongo/db/query/find.h"
 #include "mongo/db/query/find_common.h"
 #include "mongo/db/query/get_executor.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
@@ -445,6 +446,19 @@ public:
             // Fill out curop information.
             beginQueryOp(opCtx, nss, _request.body);
 
+            // If this find must run as an unbounded collection scan over a collection too large
+            // to usefully cache, declare read-once access intent to the storage engine so the
+            // scan does not displace the cached working set. Setting the option on the request
+            // itself lets getMore re-engage it for every subsequent batch of the cursor.
+            if (!findCommand->getReadOnce() && !opCtx->inMultiDocumentTransaction() &&
+                ctx->getCollection()) {
+                const auto minSizeBytes = internalQueryReadOnceCollectionScanMinSizeBytes.load();
+                if (minSizeBytes > 0 && FindCommon::isUnboundedCollectionScan(*findCommand) &&
+                    ctx->getCollection()->dataSize(opCtx) >= minSizeBytes) {
+                    findCommand->setReadOnce(true);
+                }
+            }
+
             // Finish the parsing step by using the FindCommandRequest to create a CanonicalQuery.
             const ExtensionsCallbackReal extensionsCallback(opCtx, &nss);
             auto expCtx = makeExpressionContext(opCtx, *findCommand, boost::none /* verbosity */);
@@ -47,6 +47,7 @@
 #include "mongo/db/curop.h"
 #include "mongo/db/curop_failpoint_helpers.h"
 #include "mongo/db/cursor_manager.h"
+#include "mongo/db/cursor_server_params.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/pipeline/change_stream_invalidation_info.h"
@@ -323,6 +324,8 @@ public:
                            ResourceConsumption::DocumentUnitCounter* docUnitsReturned) {
             PlanExecutor* exec = cursor->getExecutor();
 
+            const int batchByteLimit = _nextBatchByteLimit(opCtx, cursor, cmd, isTailable);
+
             // If an awaitData getMore is killed during this process due to our max time expiring at
             // an interrupt point, we just continue as normal and return rather than reporting a
             // timeout to the user.
@@ -333,7 +336,8 @@ public:
                        PlanExecutor::ADVANCED == (state = exec->getNext(&obj, nullptr))) {
                     // If adding this object will cause us to exceed the message size limit, then we
                     // stash it for later.
-                    if (!FindCommon::haveSpaceForNext(obj, *numResults, nextBatch->bytesUsed())) {
+                    if (!FindCommon::haveSpaceForNext(
+                            obj, *numResults, nextBatch->bytesUsed(), batchByteLimit)) {
                         exec->enqueue(obj);
                         break;
                     }
@@ -386,9 +390,46 @@ public:
                 nextBatch->setPostBatchResumeToken(exec->getPostBatchResumeToken());
             }
 
+            cursor->setLastBatchStats(nextBatch->bytesUsed(),
+                                      opCtx->getServiceContext()->getPreciseClockSource()->now());
+
             return shouldSaveCursorGetMore(exec, isTailable);
         }
 
+        /**
+         * Returns the byte budget for the batch about to be generated. Normally this is the full
+         * response size limit, but when adaptive batch sizing is enabled and the client left the
+         * batch size uncapped, the budget targets the configured drain time based on how quickly
+         * the client consumed the previous batch. Slow consumers then receive smaller batches
+         * instead of the maximum-size response. Tailable cursors are excluded because the time
+         * between their getMores is dominated by waiting for new data, not by client drain speed.
+         */
+        static int _nextBatchByteLimit(OperationContext* opCtx,
+                                       const ClientCursor* cursor,
+                                       const GetMoreCommandRequest& cmd,
+                                       bool isTailable) {
+            const auto targetMillis = getAdaptiveGetMoreBatchSizeTargetMillis();
+            if (targetMillis == 0 || cmd.getBatchSize() || isTailable ||
+                cursor->getLastBatchBytes() <= 0) {
+                return FindCommon::kMaxBytesToReturnToClientAtOnce;
+            }
+
+            const auto now = opCtx->getServiceContext()->getPreciseClockSource()->now();
+            const auto drainMillis = std::max(
+                1LL, durationCount<Milliseconds>(now - cursor->getLastBatchReturnedAt()));
+            const double bytesPerMilli =
+                static_cast<double>(cursor->getLastBatchBytes()) / drainMillis;
+            const double budget = bytesPerMilli * targetMillis;
+
+            // Clamp to [64KB, response size limit]. The floor keeps pathologically slow consumers
+            // from degenerating into one-document batches; a document larger than the budget is
+            // still returned on its own, as the first document of a batch always fits.
+            static constexpr int kMinAdaptiveBatchBytes = 64 * 1024;
+            return static_cast<int>(
+                std::min(static_cast<double>(FindCommon::kMaxBytesToReturnToClientAtOnce),
+                         std::max(budget, static_cast<double>(kMinAdaptiveBatchBytes))));
+        }
+
         void acquireLocksAndIterateCursor(OperationContext* opCtx,
                                           rpc::ReplyBuilderInterface* reply,
                                           CursorManager* cursorManager,
@@ -43,7 +43,13 @@ namespace mongo {
 
 namespace {
 auto kLogInterval = stdx::chrono::minutes(1);
-}
+
+// Bounds on the number of documents and bytes a single worker invocation will write in one
+// WriteUnitOfWork. Grouping amortizes the commit cost when the buffer is draining behind a burst
+// of writes, while the bounds keep the latency and size of any one transaction limited.
+constexpr size_t kMaxGroupDocuments = 100;
+constexpr int64_t kMaxGroupBytes = 256 * 1024;
+}  // namespace
 
 void DeferredWriter::_logFailure(const Status& status) {
     if (TimePoint::clock::now() - _lastLogged > kLogInterval) {
@@ -100,34 +106,57 @@ StatusWith<std::unique_ptr<AutoGetCollection>> DeferredWriter::_getCollection(
     return std::move(agc);
 }
 
-void DeferredWriter::_worker(InsertStatement stmt) {
+void DeferredWriter::_worker() {
+    // Pull a size-bounded group of documents off the queue. A group is written in one
+    // WriteUnitOfWork, so under a burst of writes the commit cost is paid once per group rather
+    // than once per document.
+    std::vector<InsertStatement> group;
+    int64_t groupBytes = 0;
+    {
+        stdx::lock_guard<Latch> lock(_mutex);
+        if (_queuedDocuments.empty()) {
+            // A previous invocation already wrote the document this task was scheduled for as
+            // part of a group.
+            return;
+        }
+
+        while (!_queuedDocuments.empty() && group.size() < kMaxGroupDocuments &&
+               groupBytes < kMaxGroupBytes) {
+            groupBytes += _queuedDocuments.front().doc.objsize();
+            group.push_back(std::move(_queuedDocuments.front()));
+            _queuedDocuments.pop_front();
+        }
+    }
+
     auto uniqueOpCtx = Client::getCurrent()->makeOperationContext();
     OperationContext* opCtx = uniqueOpCtx.get();
     auto result = _getCollection(opCtx);
 
-    if (!result.isOK()) {
-        _logFailure(result.getStatus());
-        return;
+    Status status = result.getStatus();
+    if (status.isOK()) {
+        auto agc = std::move(result.getValue());
+
+        const CollectionPtr& collection = agc->getCollection();
+
+        status = writeConflictRetry(opCtx, "deferred insert", _nss.ns(), [&] {
+            WriteUnitOfWork wuow(opCtx);
+            // Insert one document at a time; batched inserts are not permitted into indexed
+            // capped collections, which is what the health log uses this class for.
+            for (const auto& stmt : group) {
+                Status status = collection->insertDocument(opCtx, stmt, nullptr, false);
+                if (!status.isOK()) {
+                    return status;
+                }
+            }
+
+            wuow.commit();
+            return Status::OK();
+        });
     }
 
-    auto agc = std::move(result.getValue());
-
-    const CollectionPtr& collection = agc->getCollection();
-
-    Status status = writeConflictRetry(opCtx, "deferred insert", _nss.ns(), [&] {
-        WriteUnitOfWork wuow(opCtx);
-        Status status = collection->insertDocument(opCtx, stmt, nullptr, false);
-        if (!status.isOK()) {
-            return status;
-        }
-
-        wuow.commit();
-        return Status::OK();
-    });
-
     stdx::lock_guard<Latch> lock(_mutex);
 
-    _numBytes -= stmt.doc.objsize();
+    _numBytes -= groupBytes;
 
     // If a write to a deferred collection fails, periodically tell the log.
     if (!status.isOK()) {
@@ -185,10 +214,11 @@ bool DeferredWriter::insertDocument(BSONObj obj) {
 
     // Add the object to the buffer.
     _numBytes += obj.objsize();
-    _pool->schedule([this, obj](auto status) {
+    _queuedDocuments.push_back(InsertStatement(obj.getOwned()));
+    _pool->schedule([this](auto status) {
         fassert(40588, status);
 
-        _worker(InsertStatement(obj.getOwned()));
+        _worker();
     });
     return true;
 }
@@ -197,5 +227,10 @@ int64_t DeferredWriter::getDroppedEntries() {
     return _droppedEntries;
 }
 
+int64_t DeferredWriter::getPendingEntries() {
+    stdx::lock_guard<Latch> lock(_mutex);
+    return static_cast<int64_t>(_queuedDocuments.size());
+}
+
 
 }  // namespace mongo
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <deque>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
@@ -109,6 +111,12 @@ public:
      */
     int64_t getDroppedEntries();
 
+    /**
+     * Get the number of documents buffered in memory and not yet written to the backing
+     * collection. A persistently high value means the writer cannot keep up with its callers.
+     */
+    int64_t getPendingEntries();
+
 private:
     /**
      * Log failure, but only if a certain interval has passed since the last log.
@@ -134,9 +142,11 @@ private:
     StatusWith<std::unique_ptr<AutoGetCollection>> _getCollection(OperationContext* opCtx);
 
     /**
-     * The method that the worker thread will run.
+     * The method that the worker thread will run. Drains queued documents in size-bounded groups,
+     * writing each group in a single WriteUnitOfWork. May write nothing if a previous invocation
+     * already wrote the documents this one was scheduled for as part of a group.
      */
-    void _worker(InsertStatement stmt);
+    void _worker();
 
     /**
      * The options for the collection, in case we need to create it.
@@ -165,6 +175,12 @@ private:
      */
     int64_t _numBytes;
 
+    /**
+     * Documents that have been accepted by insertDocument() but not yet written by the worker
+     * thread.
+     */
+    std::deque<InsertStatement> _queuedDocuments;
+
     /**
      * The number of deffered entries that have been dropped. Resets when the
      * rate-limited system log is written out.
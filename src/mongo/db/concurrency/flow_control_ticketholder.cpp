@@ -41,6 +41,27 @@ namespace mongo {
 namespace {
 const auto getFlowControlTicketholder =
     ServiceContext::declareDecoration<std::unique_ptr<FlowControlTicketholder>>();
+
+// Number of tickets a thread takes at once when they are plentiful. The first ticket of the
+// chunk satisfies the current acquisition; the rest are cached so the thread's next
+// acquisitions are a thread-local decrement instead of a pass through the global mutex.
+constexpr int kTicketsPerChunk = 8;
+
+// A chunk is only taken when at least this many tickets remain, so chunking never lets one
+// thread hoard tickets other threads are waiting on.
+constexpr int kMinTicketsForChunking = kTicketsPerChunk * 4;
+
+/**
+ * Tickets this thread has taken from a FlowControlTicketholder but not yet spent. The cache is
+ * only honored while 'generation' matches the ticketholder's; tickets left over when the
+ * refresher starts a new period expire rather than being spent against the new allotment.
+ */
+struct TicketCache {
+    FlowControlTicketholder* owner = nullptr;
+    uint64_t generation = 0;
+    int available = 0;
+};
+thread_local TicketCache ticketCache;
 }  // namespace
 
 void FlowControlTicketholder::CurOp::writeToBuilder(BSONObjBuilder& infoBuilder) {
@@ -87,22 +108,34 @@ void FlowControlTicketholder::refreshTo(int numTickets) {
                 "tickets"_attr = _tickets,
                 "numTickets"_attr = numTickets);
     _tickets = numTickets;
+    _generation.fetchAndAdd(1);
     _cv.notify_all();
 }
 
 void FlowControlTicketholder::getTicket(OperationContext* opCtx,
                                         FlowControlTicketholder::CurOp* stats) {
+    // Common case: spend a ticket this thread already took as part of a chunk, without touching
+    // the global mutex.
+    if (ticketCache.owner == this && ticketCache.available > 0 &&
+        ticketCache.generation == _generation.load()) {
+        --ticketCache.available;
+        ++stats->ticketsAcquired;
+        return;
+    }
+
     stdx::unique_lock<Latch> lk(_mutex);
     if (_inShutdown) {
         return;
     }
 
     LOGV2_DEBUG(20519, 4, "Taking ticket.", "Available"_attr = _tickets);
-    if (_tickets == 0) {
+    const bool waited = _tickets == 0;
+    if (waited) {
         ++stats->acquireWaitCount;
     }
 
     auto currentWaitTime = curTimeMicros64();
+    const auto startWaitTime = currentWaitTime;
     auto updateTotalTime = [&]() {
         auto oldWaitTime = std::exchange(currentWaitTime, curTimeMicros64());
         auto waitTimeDelta = currentWaitTime - oldWaitTime;
@@ -115,6 +148,10 @@ void FlowControlTicketholder::getTicket(OperationContext* opCtx,
         // When this block exits, update the time one last time and note that getTicket() is no
         // longer waiting.
         updateTotalTime();
+        if (waited) {
+            _waitLatencies.record(
+                Microseconds(static_cast<std::int64_t>(currentWaitTime - startWaitTime)));
+        }
         stats->waiting = false;
     });
 
@@ -130,6 +167,14 @@ void FlowControlTicketholder::getTicket(OperationContext* opCtx,
 
     ++stats->ticketsAcquired;
     --_tickets;
+
+    // When tickets are plentiful, take a chunk for this thread so its next acquisitions stay off
+    // the mutex. Whatever it does not spend expires at the next refresh.
+    if (_tickets >= kMinTicketsForChunking) {
+        const int extra = kTicketsPerChunk - 1;
+        _tickets -= extra;
+        ticketCache = {this, _generation.load(), extra};
+    }
 }
 
 // Should only be called once, during shutdown.
@@ -33,6 +33,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/util/concurrency/wait_duration_histogram.h"
 
 namespace mongo {
 
@@ -87,12 +88,26 @@ public:
         return _totalTimeAcquiringMicros.load();
     }
 
+    /**
+     * Histogram of how long getTicket() calls blocked because the period's allotment was
+     * exhausted. Acquisitions that find a ticket available are not recorded.
+     */
+    const WaitDurationHistogram& waitLatencies() const {
+        return _waitLatencies;
+    }
+
     void setInShutdown();
 
 private:
     // Use an int64_t as this is serialized to bson which does not support unsigned 64-bit numbers.
     AtomicWord<std::int64_t> _totalTimeAcquiringMicros;
 
+    WaitDurationHistogram _waitLatencies;
+
+    // Incremented by refreshTo() so per-thread ticket caches from earlier refresh periods expire
+    // rather than letting their holders exceed the current period's allotment.
+    AtomicWord<std::uint64_t> _generation{0};
+
     Mutex _mutex = MONGO_MAKE_LATCH("FlowControlTicketHolder::_mutex");
     stdx::condition_variable _cv;
     int _tickets;
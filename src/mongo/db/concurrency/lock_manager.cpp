@@ -48,6 +48,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 #include "mongo/util/timer.h"
 
@@ -413,12 +414,33 @@ void LockHead::migratePartitionedLockHeads() {
 // LockManager
 //
 
-// Have more buckets than CPUs to reduce contention on lock and caches
-const unsigned LockManager::_numLockBuckets(128);
+namespace {
+
+unsigned nextPowerOfTwo(unsigned value) {
+    unsigned result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Have more buckets than CPUs to reduce contention on lock and caches. 128 buckets were
+// historically enough, but no longer are on machines with more cores than that.
+unsigned numLockBucketsForHardware() {
+    return std::max(128u,
+                    nextPowerOfTwo(static_cast<unsigned>(ProcessInfo::getNumAvailableCores())));
+}
 
 // Balance scalability of intent locks against potential added cost of conflicting locks.
-// The exact value doesn't appear very important, but should be power of two
-const unsigned LockManager::_numPartitions = 32;
+// Partitions are keyed by locker id, so the number of concurrently running operations that
+// share a partition mutex drops as the partition count grows; scale with the core count since
+// that bounds how many lockers can be acquiring intent locks at once.
+unsigned numPartitionsForHardware() {
+    return std::max(
+        32u, nextPowerOfTwo(static_cast<unsigned>(4 * ProcessInfo::getNumAvailableCores())));
+}
+
+}  // namespace
 
 // static
 LockManager* LockManager::get(ServiceContext* service) {
@@ -462,7 +484,8 @@ std::map<LockerId, BSONObj> LockManager::getLockToClientMap(ServiceContext* serv
     return lockToClientMap;
 }
 
-LockManager::LockManager() {
+LockManager::LockManager()
+    : _numLockBuckets(numLockBucketsForHardware()), _numPartitions(numPartitionsForHardware()) {
     _lockBuckets = new LockBucket[_numLockBuckets];
     _partitions = new Partition[_numPartitions];
 }
@@ -855,11 +878,13 @@ void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
 }
 
 LockManager::LockBucket* LockManager::_getBucket(ResourceId resId) const {
-    return &_lockBuckets[resId % _numLockBuckets];
+    // The bucket and partition counts are powers of two, so the modulo reduces to a mask. This
+    // runs on every lock and unlock, where a hardware divide is measurable.
+    return &_lockBuckets[resId & (_numLockBuckets - 1)];
 }
 
 LockManager::Partition* LockManager::_getPartition(LockRequest* request) const {
-    return &_partitions[request->locker->getId() % _numPartitions];
+    return &_partitions[request->locker->getId() & (_numPartitions - 1)];
 }
 
 void LockManager::dump() const {
@@ -232,10 +232,12 @@ private:
      */
     void _cleanupUnusedLocksInBucket(LockBucket* bucket);
 
-    static const unsigned _numLockBuckets;
+    // Sized for the host's core count at construction; always powers of two so that _getBucket
+    // and _getPartition can mask rather than divide.
+    const unsigned _numLockBuckets;
     LockBucket* _lockBuckets;
 
-    static const unsigned _numPartitions;
+    const unsigned _numPartitions;
     Partition* _partitions;
 };
 }  // namespace mongo
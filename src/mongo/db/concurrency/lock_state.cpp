@@ -33,6 +33,7 @@
 
 #include "mongo/db/concurrency/lock_state.h"
 
+#include <memory>
 #include <vector>
 
 #include "mongo/bson/bsonobjbuilder.h"
@@ -46,8 +47,10 @@
 #include "mongo/stdx/new.h"
 #include "mongo/util/background.h"
 #include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/concurrency/wait_duration_histogram.h"
 #include "mongo/util/debug_util.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 
@@ -62,39 +65,42 @@ namespace {
  * Tracks global (across all clients) lock acquisition statistics, partitioned into multiple
  * buckets to minimize concurrent access conflicts.
  *
- * Each client has a LockerId that monotonically increases across all client instances. The
- * LockerId % 8 is used to index into one of 8 LockStats instances. These LockStats objects must be
- * atomically accessed, so maintaining 8 that are indexed by LockerId reduces client conflicts and
- * improves concurrent write access. A reader, to collect global lock statics for reporting, will
- * sum the results of all 8 disjoint 'buckets' of stats.
+ * Writers are sharded by the executing thread rather than by LockerId: each thread is assigned a
+ * partition the first time it records a statistic and keeps it for its lifetime, so a thread's
+ * counter increments stay on cache lines no other core is writing. The partition count scales
+ * with the core count so that bookkeeping does not reintroduce the cross-core traffic the
+ * sharding exists to avoid. A reader, to collect global lock statistics for reporting, will sum
+ * the results of all disjoint 'buckets' of stats.
  */
 class PartitionedInstanceWideLockStats {
     PartitionedInstanceWideLockStats(const PartitionedInstanceWideLockStats&) = delete;
     PartitionedInstanceWideLockStats& operator=(const PartitionedInstanceWideLockStats&) = delete;
 
 public:
-    PartitionedInstanceWideLockStats() {}
+    PartitionedInstanceWideLockStats()
+        : _numPartitions(_numPartitionsForHardware()),
+          _partitions(std::make_unique<AlignedLockStats[]>(_numPartitions)) {}
 
-    void recordAcquisition(LockerId id, ResourceId resId, LockMode mode) {
-        _get(id).recordAcquisition(resId, mode);
+    void recordAcquisition(ResourceId resId, LockMode mode) {
+        _get().recordAcquisition(resId, mode);
     }
 
-    void recordWait(LockerId id, ResourceId resId, LockMode mode) {
-        _get(id).recordWait(resId, mode);
+    void recordWait(ResourceId resId, LockMode mode) {
+        _get().recordWait(resId, mode);
     }
 
-    void recordWaitTime(LockerId id, ResourceId resId, LockMode mode, uint64_t waitMicros) {
-        _get(id).recordWaitTime(resId, mode, waitMicros);
+    void recordWaitTime(ResourceId resId, LockMode mode, uint64_t waitMicros) {
+        _get().recordWaitTime(resId, mode, waitMicros);
     }
 
     void report(SingleThreadedLockStats* outStats) const {
-        for (int i = 0; i < NumPartitions; i++) {
+        for (unsigned i = 0; i < _numPartitions; i++) {
             outStats->append(_partitions[i].stats);
         }
     }
 
     void reset() {
-        for (int i = 0; i < NumPartitions; i++) {
+        for (unsigned i = 0; i < _numPartitions; i++) {
             _partitions[i].stats.reset();
         }
     }
@@ -106,15 +112,24 @@ private:
         AtomicLockStats stats;
     };
 
-    enum { NumPartitions = 8 };
-
-
-    AtomicLockStats& _get(LockerId id) {
-        return _partitions[id % NumPartitions].stats;
+    // A power of two at least the core count, so distinct cores get distinct partitions and
+    // _get() can mask instead of dividing.
+    static unsigned _numPartitionsForHardware() {
+        unsigned result = 8;
+        while (result < ProcessInfo::getNumAvailableCores()) {
+            result <<= 1;
+        }
+        return result;
     }
 
+    AtomicLockStats& _get() {
+        static AtomicWord<unsigned> nextPartition{0};
+        thread_local const unsigned partition = nextPartition.fetchAndAdd(1);
+        return _partitions[partition & (_numPartitions - 1)].stats;
+    }
 
-    AlignedLockStats _partitions[NumPartitions];
+    const unsigned _numPartitions;
+    std::unique_ptr<AlignedLockStats[]> _partitions;
 };
 
 // How often (in millis) to check for deadlock if a lock has not been granted for some time
@@ -127,6 +142,9 @@ AtomicWord<unsigned long long> idCounter(0);
 // indexed by LockerId in order to minimize concurrent access conflicts.
 PartitionedInstanceWideLockStats globalStats;
 
+// Tracks the distribution of lock wait durations across all Locker instances.
+WaitDurationHistogram globalLockWaitHistogram;
+
 }  // namespace
 
 bool LockerImpl::_shouldDelayUnlock(ResourceId resId, LockMode mode) const {
@@ -875,7 +893,7 @@ LockResult LockerImpl::_lockBegin(OperationContext* opCtx, ResourceId resId, Loc
     }
 
     // Making this call here will record lock re-acquisitions and conversions as well.
-    globalStats.recordAcquisition(_id, resId, mode);
+    globalStats.recordAcquisition(resId, mode);
     _stats.recordAcquisition(resId, mode);
 
     // Give priority to the full modes for Global, PBWM, and RSTL resources so we don't stall global
@@ -904,7 +922,7 @@ LockResult LockerImpl::_lockBegin(OperationContext* opCtx, ResourceId resId, Loc
                               : getGlobalLockManager()->convert(resId, request, mode);
 
     if (result == LOCK_WAITING) {
-        globalStats.recordWait(_id, resId, mode);
+        globalStats.recordWait(resId, mode);
         _stats.recordWait(resId, mode);
         _setWaitingResource(resId);
     } else if (result == LOCK_OK && opCtx && _uninterruptibleLocksRequested == 0) {
@@ -974,6 +992,13 @@ void LockerImpl::_lockComplete(OperationContext* opCtx,
     const uint64_t startOfTotalWaitTime = curTimeMicros64();
     uint64_t startOfCurrentWaitTime = startOfTotalWaitTime;
 
+    // Record the total time blocked whether the acquisition succeeds, times out or is
+    // interrupted; _lockComplete is only called when the lock was not granted immediately.
+    ON_BLOCK_EXIT([&] {
+        globalLockWaitHistogram.record(
+            Microseconds(static_cast<int64_t>(curTimeMicros64() - startOfTotalWaitTime)));
+    });
+
     while (true) {
         // It is OK if this call wakes up spuriously, because we re-evaluate the remaining
         // wait time anyways.
@@ -991,7 +1016,7 @@ void LockerImpl::_lockComplete(OperationContext* opCtx,
         const uint64_t elapsedTimeMicros = curTimeMicros - startOfCurrentWaitTime;
         startOfCurrentWaitTime = curTimeMicros;
 
-        globalStats.recordWaitTime(_id, resId, mode, elapsedTimeMicros);
+        globalStats.recordWaitTime(resId, mode, elapsedTimeMicros);
         _stats.recordWaitTime(resId, mode, elapsedTimeMicros);
 
         if (result == LOCK_OK)
@@ -1148,4 +1173,8 @@ void resetGlobalLockStats() {
     globalStats.reset();
 }
 
+WaitDurationHistogram& getGlobalLockWaitHistogram() {
+    return globalLockWaitHistogram;
+}
+
 }  // namespace mongo
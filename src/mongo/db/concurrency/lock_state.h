@@ -36,6 +36,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/concurrency/spin_lock.h"
+#include "mongo/util/per_thread_pooled.h"
 
 namespace mongo {
 
@@ -92,7 +93,9 @@ private:
  * All instances reference a single global lock manager.
  *
  */
-class LockerImpl : public Locker {
+// Lockers are built and torn down once per operation; recycle their memory through a per-thread
+// pool rather than paying the allocator for a multi-kilobyte block each time.
+class LockerImpl : public Locker, public PerThreadPooled<LockerImpl> {
 public:
     /**
      * Instantiates new locker. Must be given a unique identifier for disambiguation. Lockers
@@ -35,6 +35,7 @@
 namespace mongo {
 
 class BSONObjBuilder;
+class WaitDurationHistogram;
 
 
 /**
@@ -226,4 +227,10 @@ void reportGlobalLockingStats(SingleThreadedLockStats* outStats);
  */
 void resetGlobalLockStats();
 
+/**
+ * Instance-wide histogram of how long lock acquisitions blocked, across all resources and modes.
+ * Only contested acquisitions are recorded; uncontested ones never reach the wait path.
+ */
+WaitDurationHistogram& getGlobalLockWaitHistogram();
+
 }  // namespace mongo
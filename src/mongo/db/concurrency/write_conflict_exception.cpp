@@ -30,6 +30,14 @@
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kWrite
 
 #include "mongo/db/concurrency/write_conflict_exception.h"
+
+#include <array>
+
+#include "mongo/base/simple_string_data_comparator.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/log_and_backoff.h"
 #include "mongo/util/stacktrace.h"
 
@@ -37,6 +45,33 @@ namespace mongo {
 
 MONGO_FAIL_POINT_DEFINE(skipWriteConflictRetries);
 
+namespace {
+
+// Commit signals for conflict storms live in a small table hashed by namespace. Distinct hot
+// namespaces usually land in distinct slots; a collision merely wakes a few extra waiters, who
+// then retry as they would have anyway.
+constexpr size_t kNumConflictSlots = 64;
+
+// Upper bound on how long a storm loser waits for a commit signal before retrying regardless,
+// in case the winner errors out without ever committing.
+constexpr Milliseconds kMaxCommitWait{10};
+
+struct ConflictSlot {
+    Mutex mutex = MONGO_MAKE_LATCH("ConflictSlot::mutex");
+    stdx::condition_variable committed;
+
+    // Bumped on every signaled commit so a waiter can detect commits that land between its
+    // decision to wait and the wait itself.
+    uint64_t commits = 0;
+};
+
+ConflictSlot& slotForNs(StringData ns) {
+    static auto& slots = *new std::array<ConflictSlot, kNumConflictSlots>();
+    return slots[SimpleStringDataComparator::kInstance.hash(ns) % kNumConflictSlots];
+}
+
+}  // namespace
+
 AtomicWord<bool> WriteConflictException::trace(false);
 
 WriteConflictException::WriteConflictException()
@@ -57,4 +92,32 @@ void WriteConflictException::logAndBackoff(int attempt, StringData operation, St
                          "operation"_attr = operation,
                          "ns"_attr = ns);
 }
+
+void WriteConflictException::logAndWaitForCommit(int attempt, StringData operation, StringData ns) {
+    LOGV2_DEBUG(6174812,
+                1,
+                "Caught WriteConflictException in a conflict storm; waiting for a conflicting "
+                "operation to commit",
+                "attempt"_attr = attempt,
+                "operation"_attr = operation,
+                "ns"_attr = ns);
+
+    auto& slot = slotForNs(ns);
+    stdx::unique_lock<Latch> lk(slot.mutex);
+    const auto commitsSeen = slot.commits;
+    // Deliberately not interruptible, like the timed sleeps in logAndBackoff: this can run under
+    // internal threads that rely on the retry loop never throwing anything but what f() throws.
+    slot.committed.wait_for(lk, kMaxCommitWait.toSystemDuration(), [&] {
+        return slot.commits != commitsSeen;
+    });
+}
+
+void WriteConflictException::signalCommit(StringData ns) {
+    auto& slot = slotForNs(ns);
+    {
+        stdx::lock_guard<Latch> lk(slot.mutex);
+        ++slot.commits;
+    }
+    slot.committed.notify_all();
+}
 }  // namespace mongo
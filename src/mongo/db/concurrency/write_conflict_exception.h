@@ -35,6 +35,7 @@
 #include "mongo/db/curop.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 
@@ -57,6 +58,25 @@ public:
      */
     static void logAndBackoff(int attempt, StringData operation, StringData ns);
 
+    /**
+     * Like logAndBackoff, but instead of sleeping for a fixed interval, waits until an operation
+     * conflicting on the same namespace signals a commit via signalCommit(), or a short timeout
+     * elapses. Used once a retry loop has hit kConflictStormThreshold conflicts, at which point
+     * re-running the plan immediately mostly burns CPU losing the same race again.
+     */
+    static void logAndWaitForCommit(int attempt, StringData operation, StringData ns);
+
+    /**
+     * Wakes operations blocked in logAndWaitForCommit() on "ns". Called when a retry loop that
+     * previously conflicted completes.
+     */
+    static void signalCommit(StringData ns);
+
+    // Number of conflicts in a single retry loop after which further retries wait for a
+    // conflicting commit rather than backing off on a timer. Matches the attempt count at which
+    // logAndBackoff starts to sleep.
+    static constexpr int kConflictStormThreshold = 4;
+
     /**
      * If true, will call printStackTrace on every WriteConflictException created.
      * Can be set via setParameter named traceWriteConflictExceptions.
@@ -93,12 +113,24 @@ auto writeConflictRetry(OperationContext* opCtx, StringData opStr, StringData ns
     }
 
     int attempts = 0;
+    // If this retry loop lost at least one race, other operations may be queued in
+    // logAndWaitForCommit() behind it; wake them when the loop exits. Signaling on a non-conflict
+    // exception exit as well is harmless - woken waiters simply retry.
+    ON_BLOCK_EXIT([&] {
+        if (MONGO_unlikely(attempts > 0)) {
+            WriteConflictException::signalCommit(ns);
+        }
+    });
     while (true) {
         try {
             return f();
         } catch (WriteConflictException const&) {
             CurOp::get(opCtx)->debug().additiveMetrics.incrementWriteConflicts(1);
-            WriteConflictException::logAndBackoff(attempts, opStr, ns);
+            if (attempts < WriteConflictException::kConflictStormThreshold) {
+                WriteConflictException::logAndBackoff(attempts, opStr, ns);
+            } else {
+                WriteConflictException::logAndWaitForCommit(attempts, opStr, ns);
+            }
             ++attempts;
             opCtx->recoveryUnit()->abandonSnapshot();
         }
@@ -41,15 +41,19 @@
 #include "mongo/config.h"
 #include "mongo/db/auth/authorization_manager.h"
 #include "mongo/db/client.h"
+#include "mongo/db/client_op_history.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/locker.h"
 #include "mongo/db/json.h"
+#include "mongo/db/operation_trace.h"
 #include "mongo/db/prepare_conflict_tracker.h"
 #include "mongo/db/profile_filter.h"
 #include "mongo/db/query/getmore_command_gen.h"
 #include "mongo/db/query/plan_summary_stats.h"
+#include "mongo/db/slow_query_log_aggregator.h"
+#include "mongo/db/slow_query_log_aggregator_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/rpc/metadata/impersonated_user_metadata.h"
@@ -427,8 +431,14 @@ bool CurOp::completeAndLogOperation(OperationContext* opCtx,
 
     bool shouldLogSlowOp, shouldProfileAtLevel1;
 
-    if (auto filter =
-            CollectionCatalog::get(opCtx)->getDatabaseProfileSettings(getNSS().db()).filter) {
+    // Only consult the database profile settings when a filter may be configured. Fetching the
+    // settings requires acquiring the current collection catalog, which is too expensive to do
+    // on every operation when no filter has ever been set.
+    auto filter = ProfileFilter::anyConfigured()
+        ? CollectionCatalog::get(opCtx)->getDatabaseProfileSettings(getNSS().db()).filter
+        : nullptr;
+
+    if (filter) {
         bool passesFilter = filter->matches(opCtx, _debug, *this);
 
         shouldLogSlowOp = passesFilter;
@@ -444,7 +454,38 @@ bool CurOp::completeAndLogOperation(OperationContext* opCtx,
         shouldProfileAtLevel1 = shouldLogSlowOp && shouldSample;
     }
 
-    if (forceLog || shouldLogSlowOp) {
+    bool suppressRawLogLine = false;
+    if (shouldLogSlowOp && !forceLog) {
+        const auto rateLimit = gSlowOpLogRateLimitPerShape.load();
+        if (rateLimit > 0 && _debug.queryHash) {
+            // Rate-limit raw slow query lines per query shape so that an incident producing a
+            // flood of identical slow operations does not also flood the log. Suppressed
+            // operations still feed the per-shape digest, which is emitted from here once the
+            // digest interval has elapsed.
+            auto& aggregator = SlowQueryLogAggregator::get(opCtx->getServiceContext());
+            auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+            suppressRawLogLine = !aggregator.shouldLogRawLine(*_debug.queryHash,
+                                                              getPlanSummary(),
+                                                              Milliseconds(executionTimeMillis),
+                                                              now,
+                                                              rateLimit);
+            for (auto&& digest : aggregator.takeDigestsIfDue(
+                     now, Milliseconds(gSlowOpLogDigestIntervalMillis.load()))) {
+                LOGV2_OPTIONS(6174815,
+                              {component},
+                              "Slow query digest",
+                              "queryHash"_attr = zeroPaddedHex(digest.queryHash),
+                              "planSummary"_attr = digest.planSummary,
+                              "count"_attr = digest.count,
+                              "suppressed"_attr = digest.suppressed,
+                              "approximateP50Millis"_attr = digest.p50.count(),
+                              "approximateP99Millis"_attr = digest.p99.count(),
+                              "maxMillis"_attr = digest.max.count());
+            }
+        }
+    }
+
+    if (forceLog || (shouldLogSlowOp && !suppressRawLogLine)) {
         auto lockerInfo = opCtx->lockState()->getLockerInfo(_lockStatsBase);
         if (_debug.storageStats == nullptr && opCtx->lockState()->wasGlobalLockTaken() &&
             opCtx->getServiceContext()->getStorageEngine()) {
@@ -508,6 +549,17 @@ bool CurOp::completeAndLogOperation(OperationContext* opCtx,
         _checkForFailpointsAfterCommandLogged();
     }
 
+    // Leave a summary of this operation in the connection's recent-op ring so that a later
+    // complaint about this connection can be investigated without full logging.
+    ClientOpHistory::get(opCtx->getClient())
+        .record(opCtx->getClient(),
+                opCtx->getServiceContext()->getFastClockSource()->now().toMillisSinceEpoch(),
+                _debug.networkOp,
+                getNSS().ns(),
+                durationCount<Microseconds>(_debug.executionTime),
+                _debug.responseLength,
+                opCtx->lockState()->getFlowControlStats().timeAcquiringMicros);
+
     // Return 'true' if this operation should also be added to the profiler.
     if (_dbprofile >= 2)
         return true;
@@ -725,6 +777,14 @@ StringData getProtoString(int op) {
     }
     MONGO_UNREACHABLE;
 }
+
+BSONObj makeStageTimesObject(const std::map<std::string, long long>& stageTimesNanos) {
+    BSONObjBuilder builder;
+    for (auto&& entry : stageTimesNanos) {
+        builder.appendNumber(entry.first, entry.second);
+    }
+    return builder.obj();
+}
 }  // namespace
 
 #define OPDEBUG_TOSTRING_HELP(x) \
@@ -835,6 +895,9 @@ void OpDebug::report(OperationContext* opCtx,
     OPDEBUG_TOATTR_HELP_BOOL(hasSortStage);
     OPDEBUG_TOATTR_HELP_BOOL(usedDisk);
     OPDEBUG_TOATTR_HELP_BOOL(fromMultiPlanner);
+    if (!executionTimeByStageNanos.empty()) {
+        pAttrs->add("executionTimeByStageNanos", makeStageTimesObject(executionTimeByStageNanos));
+    }
     if (replanReason) {
         bool replanned = true;
         OPDEBUG_TOATTR_HELP_BOOL(replanned);
@@ -927,6 +990,15 @@ void OpDebug::report(OperationContext* opCtx,
         pAttrs->add("remoteOpWaitMillis", durationCount<Milliseconds>(*remoteOpWaitTime));
     }
 
+    {
+        auto& trace = OperationTrace::get(opCtx);
+        if (!trace.empty()) {
+            BSONObjBuilder traceBuilder;
+            trace.append(opCtx->getServiceContext()->getTickSource(), &traceBuilder);
+            pAttrs->add("trace", traceBuilder.obj());
+        }
+    }
+
     pAttrs->add("durationMillis", durationCount<Milliseconds>(executionTime));
 }
 
@@ -982,6 +1054,9 @@ void OpDebug::append(OperationContext* opCtx,
     OPDEBUG_APPEND_BOOL(b, hasSortStage);
     OPDEBUG_APPEND_BOOL(b, usedDisk);
     OPDEBUG_APPEND_BOOL(b, fromMultiPlanner);
+    if (!executionTimeByStageNanos.empty()) {
+        b.append("executionTimeByStageNanos", makeStageTimesObject(executionTimeByStageNanos));
+    }
     if (replanReason) {
         bool replanned = true;
         OPDEBUG_APPEND_BOOL(b, replanned);
@@ -1209,6 +1284,11 @@ std::function<BSONObj(ProfileFilter::Args)> OpDebug::appendStaged(StringSet requ
     addIfNeeded("fromMultiPlanner", [](auto field, auto args, auto& b) {
         OPDEBUG_APPEND_BOOL2(b, field, args.op.fromMultiPlanner);
     });
+    addIfNeeded("executionTimeByStageNanos", [](auto field, auto args, auto& b) {
+        if (!args.op.executionTimeByStageNanos.empty()) {
+            b.append(field, makeStageTimesObject(args.op.executionTimeByStageNanos));
+        }
+    });
     addIfNeeded("replanned", [](auto field, auto args, auto& b) {
         if (args.op.replanReason) {
             OPDEBUG_APPEND_BOOL2(b, field, true);
@@ -1404,6 +1484,7 @@ void OpDebug::setPlanSummaryMetrics(const PlanSummaryStats& planSummaryStats) {
     usedDisk = planSummaryStats.usedDisk;
     fromMultiPlanner = planSummaryStats.fromMultiPlanner;
     replanReason = planSummaryStats.replanReason;
+    executionTimeByStageNanos = planSummaryStats.executionTimeByStageNanos;
 }
 
 BSONObj OpDebug::makeFlowControlObject(FlowControlTicketholder::CurOp stats) {
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <map>
+
 #include "mongo/config.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/auth/user_cache_acquisition_stats.h"
@@ -238,6 +240,10 @@ public:
     // single solution).
     bool fromMultiPlanner{false};
 
+    // Time spent working inside each stage type of the plan, in nanoseconds, keyed by the stage
+    // type string. Collected for every execution of a classic plan; empty otherwise.
+    std::map<std::string, long long> executionTimeByStageNanos;
+
     // True if a replan was triggered during the execution of this operation.
     std::optional<std::string> replanReason;
 
@@ -475,7 +481,8 @@ public:
         if (_dbprofile <= 0)
             return false;
 
-        if (CollectionCatalog::get(opCtx)->getDatabaseProfileSettings(getNSS().db()).filter)
+        if (ProfileFilter::anyConfigured() &&
+            CollectionCatalog::get(opCtx)->getDatabaseProfileSettings(getNSS().db()).filter)
             return true;
 
         return elapsedTimeExcludingPauses() >= Milliseconds{serverGlobalParams.slowMS};
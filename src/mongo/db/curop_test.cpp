@@ -32,6 +32,7 @@
 #include <boost/optional/optional_io.hpp>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/client_op_history.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/query/query_test_service_context.h"
 #include "mongo/unittest/unittest.h"
@@ -269,5 +270,38 @@ TEST(CurOpTest, ElapsedTimeReflectsTickSource) {
     ASSERT_EQ(Milliseconds{20}, duration_cast<Milliseconds>(curop->elapsedTimeTotal()));
 }
 
+TEST(ClientOpHistoryTest, RingKeepsMostRecentOps) {
+    QueryTestServiceContext serviceContext;
+    auto client = serviceContext.getClient();
+
+    auto& history = ClientOpHistory::get(client);
+    ASSERT_TRUE(history.empty());
+
+    const auto numRecorded = ClientOpHistory::kNumEntries + 5;
+    for (size_t i = 0; i < numRecorded; ++i) {
+        history.record(client,
+                       1000 + i /* endEpochMillis */,
+                       dbMsg,
+                       "test.coll",
+                       i /* durationMicros */,
+                       100 /* responseLength */,
+                       0 /* flowControlWaitMicros */);
+    }
+    ASSERT_FALSE(history.empty());
+
+    BSONArrayBuilder opsBuilder;
+    history.append(&opsBuilder);
+    auto ops = opsBuilder.arr();
+
+    // Only the most recent kNumEntries operations survive, oldest first.
+    std::vector<BSONElement> elements = ops.Array();
+    ASSERT_EQ(elements.size(), ClientOpHistory::kNumEntries);
+    ASSERT_EQ(elements.front().Obj()["durationMicros"].numberLong(),
+              static_cast<long long>(numRecorded - ClientOpHistory::kNumEntries));
+    ASSERT_EQ(elements.back().Obj()["durationMicros"].numberLong(),
+              static_cast<long long>(numRecorded - 1));
+    ASSERT_EQ(elements.back().Obj()["op"].String(), "msg");
+}
+
 }  // namespace
 }  // namespace mongo
@@ -204,33 +204,44 @@ std::size_t CursorManager::timeoutCursors(OperationContext* opCtx, Date_t now) {
 StatusWith<ClientCursorPin> CursorManager::pinCursor(OperationContext* opCtx,
                                                      CursorId id,
                                                      AuthCheck checkSessionAuth) {
-    auto lockedPartition = _cursorMap->lockOnePartition(id);
-    auto it = lockedPartition->find(id);
-    if (it == lockedPartition->end()) {
-        return {ErrorCodes::CursorNotFound, str::stream() << "cursor id " << id << " not found"};
-    }
+    ClientCursor* cursor;
+    {
+        auto lockedPartition = _cursorMap->lockOnePartition(id);
+        auto it = lockedPartition->find(id);
+        if (it == lockedPartition->end()) {
+            return {ErrorCodes::CursorNotFound,
+                    str::stream() << "cursor id " << id << " not found"};
+        }
 
-    ClientCursor* cursor = it->second;
-    uassert(ErrorCodes::CursorInUse,
-            str::stream() << "cursor id " << id << " is already in use",
-            !cursor->_operationUsingCursor);
-    if (cursor->getExecutor()->isMarkedAsKilled()) {
-        // This cursor was killed while it was idle.
-        Status error = cursor->getExecutor()->getKillStatus();
-        deregisterAndDestroyCursor(std::move(lockedPartition),
-                                   opCtx,
-                                   std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
-        return error;
-    }
+        cursor = it->second;
+        uassert(ErrorCodes::CursorInUse,
+                str::stream() << "cursor id " << id << " is already in use",
+                !cursor->_operationUsingCursor);
+        if (cursor->getExecutor()->isMarkedAsKilled()) {
+            // This cursor was killed while it was idle.
+            Status error = cursor->getExecutor()->getKillStatus();
+            deregisterAndDestroyCursor(
+                std::move(lockedPartition),
+                opCtx,
+                std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
+            return error;
+        }
 
-    if (checkSessionAuth == kCheckSession) {
-        auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, cursor->getSessionId());
-        if (!cursorPrivilegeStatus.isOK()) {
-            return cursorPrivilegeStatus;
+        if (checkSessionAuth == kCheckSession) {
+            auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, cursor->getSessionId());
+            if (!cursorPrivilegeStatus.isOK()) {
+                return cursorPrivilegeStatus;
+            }
         }
+
+        cursor->_operationUsingCursor = opCtx;
     }
 
-    cursor->_operationUsingCursor = opCtx;
+    // Setting '_operationUsingCursor' above pins the cursor, so other threads can no longer destroy
+    // it; the rest of the pin setup can run without the partition lock. In particular the logical
+    // session cache has its own mutex and may block, and holding a '_cursorMap' partition lock
+    // while talking to it would stall every other cursor that hashes to this partition.
+    ClientCursorPin pin(opCtx, cursor, this);
 
     // We use pinning of a cursor as a proxy for active, user-initiated use of a cursor.  Therefore,
     // we pass down to the logical session cache and vivify the record (updating last use).
@@ -238,11 +249,12 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(OperationContext* opCtx,
         auto vivifyCursorStatus =
             LogicalSessionCache::get(opCtx)->vivify(opCtx, cursor->getSessionId().get());
         if (!vivifyCursorStatus.isOK()) {
+            // 'pin' goes out of scope here and checks the cursor back in.
             return vivifyCursorStatus;
         }
     }
 
-    return ClientCursorPin(opCtx, cursor, this);
+    return std::move(pin);
 }
 
 void CursorManager::unpin(OperationContext* opCtx,
@@ -281,9 +293,12 @@ void CursorManager::unpin(OperationContext* opCtx,
 }
 
 void CursorManager::appendActiveSessions(LogicalSessionIdSet* lsids) const {
-    auto allPartitions = _cursorMap->lockAllPartitions();
-    for (auto&& partition : allPartitions) {
-        for (auto&& entry : partition) {
+    // Walk the partitions one at a time rather than locking them all at once. The result was
+    // already stale by the time the caller could act on it; giving up the cross-partition snapshot
+    // costs nothing and means this report never stalls pin/unpin across the entire map.
+    for (size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
+        auto lockedPartition = _cursorMap->lockOnePartitionById(partitionId);
+        for (auto&& entry : *lockedPartition) {
             auto cursor = entry.second;
             if (auto id = cursor->getSessionId()) {
                 lsids->insert(id.value());
@@ -297,9 +312,11 @@ std::vector<GenericCursor> CursorManager::getIdleCursors(
     std::vector<GenericCursor> cursors;
     AuthorizationSession* ctxAuth = AuthorizationSession::get(opCtx->getClient());
 
-    auto allPartitions = _cursorMap->lockAllPartitions();
-    for (auto&& partition : allPartitions) {
-        for (auto&& entry : partition) {
+    // As in appendActiveSessions(), one partition at a time: the report is advisory and must not
+    // block concurrent pin/unpin on every partition for its duration.
+    for (size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
+        auto lockedPartition = _cursorMap->lockOnePartitionById(partitionId);
+        for (auto&& entry : *lockedPartition) {
             auto cursor = entry.second;
 
             // Exclude cursors that this user does not own if auth is enabled.
@@ -322,9 +339,9 @@ std::vector<GenericCursor> CursorManager::getIdleCursors(
 stdx::unordered_set<CursorId> CursorManager::getCursorsForSession(LogicalSessionId lsid) const {
     stdx::unordered_set<CursorId> cursors;
 
-    auto allPartitions = _cursorMap->lockAllPartitions();
-    for (auto&& partition : allPartitions) {
-        for (auto&& entry : partition) {
+    for (size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
+        auto lockedPartition = _cursorMap->lockOnePartitionById(partitionId);
+        for (auto&& entry : *lockedPartition) {
             auto cursor = entry.second;
             if (cursor->getSessionId() == lsid) {
                 cursors.insert(cursor->cursorid());
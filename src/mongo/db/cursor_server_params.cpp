@@ -39,6 +39,10 @@ int getClientCursorMonitorFrequencySecs() {
     return gClientCursorMonitorFrequencySecs.load();
 }
 
+int getAdaptiveGetMoreBatchSizeTargetMillis() {
+    return gAdaptiveGetMoreBatchSizeTargetMillis.load();
+}
+
 long long getCursorTimeoutMillis() {
     return gCursorTimeoutMillis.load();
 }
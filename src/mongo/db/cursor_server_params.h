@@ -35,6 +35,10 @@ namespace mongo {
 
 int getClientCursorMonitorFrequencySecs();
 
+// Target drain time for adaptively sized getMore batches, or zero when adaptive sizing is
+// disabled. Configurable with server parameter "adaptiveGetMoreBatchSizeTargetMillis".
+int getAdaptiveGetMoreBatchSizeTargetMillis();
+
 // Period of time after which mortal cursors are killed for inactivity. Configurable with server
 // parameter "cursorTimeoutMillis".
 long long getCursorTimeoutMillis();
@@ -137,7 +137,7 @@ void BucketUnpacker::reset(BSONObj&& bucket) {
         // Includes a field when '_unpackerBehavior' is 'kInclude' and it's found in 'fieldSet' or
         // _unpackerBehavior is 'kExclude' and it's not found in 'fieldSet'.
         if (determineIncludeField(colName, _unpackerBehavior, _spec)) {
-            _fieldIters.emplace_back(colName.toString(), BSONObjIterator{elem.Obj()});
+            _fieldIters.emplace_back(colName, BSONObjIterator{elem.Obj()});
         }
     }
 
@@ -182,7 +182,11 @@ Document BucketUnpacker::getNext() {
     tassert(5521503, "'getNext()' requires the bucket to be owned", _bucket.isOwned());
     tassert(5422100, "'getNext()' was called after the bucket has been exhausted", hasNext());
 
-    auto measurement = MutableDocument{};
+    // The maximum number of fields in the measurement is known up front, so presize the document's
+    // field storage rather than growing it per field.
+    auto measurement = MutableDocument{(_includeTimeField ? 1u : 0u) +
+                                       (_includeMetaField && _metaValue ? 1u : 0u) +
+                                       _fieldIters.size() + _spec.computedMetaProjFields.size()};
     auto&& timeElem = _timeFieldIter->next();
     if (_includeTimeField) {
         measurement.addField(_spec.timeField, Value{timeElem});
@@ -171,8 +171,10 @@ private:
     BSONElement _metaValue;
 
     // Iterators used to unpack the columns of the above bucket that are populated during the reset
-    // phase according to the provided 'Behavior' and 'BucketSpec'.
-    std::vector<std::pair<std::string, BSONObjIterator>> _fieldIters;
+    // phase according to the provided 'Behavior' and 'BucketSpec'. The column names point into
+    // '_bucket', which is owned and outlives the iterators, so no per-bucket string copies are
+    // needed.
+    std::vector<std::pair<StringData, BSONObjIterator>> _fieldIters;
 
     // Map <name, BSONElement> for the computed meta field projections. Updated for
     // every bucket upon reset().
@@ -62,6 +62,7 @@ CollectionScan::CollectionScan(ExpressionContext* expCtx,
     : RequiresCollectionStage(kStageType, expCtx, collection),
       _workingSet(workingSet),
       _filter((filter && !filter->isTriviallyTrue()) ? filter : nullptr),
+      _compiledFilter(_filter ? params.compiledFilter : nullptr),
       _params(params) {
     // Explain reports the direction of the collection scan.
     _specificStats.direction = params.direction;
@@ -97,11 +98,27 @@ CollectionScan::CollectionScan(ExpressionContext* expCtx,
     }
 }
 
+namespace {
+// Number of records pulled from the storage cursor per batch when batching is enabled. Sized so a
+// batch of typical documents stays well within a cache-friendly footprint while amortizing the
+// per-record cursor round trip.
+const size_t kScanBatchSize = 64;
+}  // namespace
+
 PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     if (_commonStats.isEOF) {
         return PlanStage::IS_EOF;
     }
 
+    // Drain any previously buffered records before touching the storage cursor again.
+    if (_batchPos < _batch.size()) {
+        return _returnBatchedRecord(out);
+    }
+    if (_cursorExhausted) {
+        _commonStats.isEOF = true;
+        return PlanStage::IS_EOF;
+    }
+
     boost::optional<Record> record;
     const bool needToMakeCursor = !_cursor;
     try {
@@ -181,6 +198,31 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
         if (!record) {
             record = _cursor->next();
         }
+
+        if (record && _batchingEnabled()) {
+            // Pull a batch of additional records in the same storage call sequence and buffer
+            // them as owned data. A write conflict while reading ahead is not an error: we keep
+            // what we have and let the next doWork() retry the cursor.
+            _batch.clear();
+            _batchPos = 0;
+            _batchSnapshotId = opCtx()->recoveryUnit()->getSnapshotId();
+            record->data.makeOwned();
+            _batch.push_back(std::move(*record));
+            try {
+                while (_batch.size() < kScanBatchSize) {
+                    auto next = _cursor->next();
+                    if (!next) {
+                        _cursorExhausted = true;
+                        break;
+                    }
+                    next->data.makeOwned();
+                    _batch.push_back(std::move(*next));
+                }
+            } catch (const WriteConflictException&) {
+                // Stop reading ahead; buffered records are still valid.
+            }
+            return _returnBatchedRecord(out);
+        }
     } catch (const WriteConflictException&) {
         // Leave us in a state to try again next time.
         if (needToMakeCursor)
@@ -261,6 +303,34 @@ bool atEndOfRangeInclusive(const CollectionScanParams& params, const WorkingSetM
 }
 }  // namespace
 
+bool CollectionScan::_batchingEnabled() const {
+    // Tailable scans, oplog timestamp tracking and resumable scans all need to interact with the
+    // storage cursor (or _lastSeenId) at single-record granularity, so they read one record per
+    // doWork() as before.
+    return !_params.tailable && !_params.shouldTrackLatestOplogTimestamp &&
+        !_params.assertTsHasNotFallenOffOplog && !_params.requestResumeToken &&
+        !_params.resumeAfterRecordId;
+}
+
+PlanStage::StageState CollectionScan::_returnBatchedRecord(WorkingSetID* out) {
+    invariant(_batchPos < _batch.size());
+    Record& record = _batch[_batchPos++];
+    _lastSeenId = record.id;
+
+    WorkingSetID id = _workingSet->allocate();
+    WorkingSetMember* member = _workingSet->get(id);
+    member->recordId = record.id;
+    member->resetDocument(_batchSnapshotId, record.data.releaseToBson());
+    _workingSet->transitionToRecordIdAndObj(id);
+
+    if (_batchPos == _batch.size()) {
+        _batch.clear();
+        _batchPos = 0;
+    }
+
+    return returnIfMatches(member, id, out);
+}
+
 PlanStage::StageState CollectionScan::returnIfMatches(WorkingSetMember* member,
                                                       WorkingSetID memberID,
                                                       WorkingSetID* out) {
@@ -275,9 +345,10 @@ PlanStage::StageState CollectionScan::returnIfMatches(WorkingSetMember* member,
         return PlanStage::IS_EOF;
     }
 
-    if (Filter::passes(member, _filter)) {
+    if (Filter::passes(member, _filter, _compiledFilter)) {
         if (_params.stopApplyingFilterAfterFirstMatch) {
             _filter = nullptr;
+            _compiledFilter = nullptr;
         }
         *out = memberID;
         return PlanStage::ADVANCED;
@@ -30,16 +30,18 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/collection_scan_common.h"
 #include "mongo/db/exec/requires_collection_stage.h"
 #include "mongo/db/matcher/expression_leaf.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/snapshot.h"
 #include "mongo/s/resharding/resume_token_gen.h"
 
 namespace mongo {
 
-struct Record;
 class SeekableRecordCursor;
 class WorkingSet;
 class OperationContext;
@@ -117,18 +119,47 @@ private:
      */
     void assertTsHasNotFallenOffOplog(const Record& record);
 
+    /**
+     * Whether this scan may buffer batches of records per storage-cursor call. Disabled for scan
+     * modes that need per-record cursor interaction (tailable scans, oplog timestamp tracking,
+     * resumable scans).
+     */
+    bool _batchingEnabled() const;
+
+    /**
+     * Pops the next buffered record and hands it through the usual working-set path.
+     */
+    StageState _returnBatchedRecord(WorkingSetID* out);
+
     // WorkingSet is not owned by us.
     WorkingSet* _workingSet;
 
     // The filter is not owned by us.
     const MatchExpression* _filter;
 
+    // Flattened form of '_filter', evaluated in its place for members that carry a document.
+    // Null when the filter's shape couldn't be compiled. Not owned by us.
+    const CompiledMatchExpression* _compiledFilter;
+
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
     CollectionScanParams _params;
 
     RecordId _lastSeenId;  // Null if nothing has been returned from _cursor yet.
 
+    // Records buffered ahead of consumption, so eligible scans pay the storage-cursor round trip
+    // once per batch instead of once per document. Buffered data is owned, so it stays valid
+    // across yields. '_batchPos' indexes the next record to return.
+    std::vector<Record> _batch;
+    size_t _batchPos = 0;
+
+    // Snapshot the batch was read under; recorded on the working-set members so downstream
+    // stages can tell the data may predate the current snapshot after a yield.
+    SnapshotId _batchSnapshotId;
+
+    // Set when the storage cursor hit EOF while filling '_batch'; reported once it is drained.
+    bool _cursorExhausted = false;
+
     // If _params.shouldTrackLatestOplogTimestamp is set and the collection is the oplog, the latest
     // timestamp seen in the collection.  Otherwise, this is a null timestamp.
     Timestamp _latestOplogEntryTimestamp;
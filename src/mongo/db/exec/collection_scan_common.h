@@ -34,6 +34,8 @@
 
 namespace mongo {
 
+class CompiledMatchExpression;
+
 struct CollectionScanParams {
     enum Direction {
         FORWARD = 1,
@@ -85,6 +87,11 @@ struct CollectionScanParams {
 
     // Whether or not to wait for oplog visibility on oplog collection scans.
     bool shouldWaitForOplogVisibility = false;
+
+    // Flattened form of the scan's filter, used instead of interpreting the MatchExpression when
+    // set. Must have been compiled from an expression equivalent to the filter passed to the
+    // CollectionScan stage, and must outlive the stage. Not owned here.
+    const CompiledMatchExpression* compiledFilter = nullptr;
 };
 
 }  // namespace mongo
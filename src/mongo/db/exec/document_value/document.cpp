@@ -258,13 +258,16 @@ void DocumentStorage::alloc(unsigned newSize) {
 
     uassert(16490, "Tried to make oversized document", capacity <= size_t(BufferMaxSize));
 
-    std::unique_ptr<char[]> oldBuf(_cache);
-    _cache = new char[capacity];
+    // The inline buffer is part of this object, so it must not be handed to the deleter when the
+    // cache grows out of it.
+    std::unique_ptr<char[]> oldBuf(usingInlineCache() ? nullptr : _cache);
+    const char* oldCache = _cache;
+    _cache = firstAlloc && capacity <= sizeof(_inlineCache) ? _inlineCache : new char[capacity];
     _cacheEnd = _cache + capacity - hashTabBytes();
 
     if (!firstAlloc) {
         // This just copies the elements
-        memcpy(_cache, oldBuf.get(), _usedBytes);
+        memcpy(_cache, oldCache, _usedBytes);
 
         if (_numFields >= HASH_TAB_MIN) {
             // if we were hashing, deal with the hash table
@@ -272,7 +275,7 @@ void DocumentStorage::alloc(unsigned newSize) {
                 rehash();
             } else {
                 // no rehash needed so just slide table down to new position
-                memcpy(_hashTab, oldBuf.get() + oldCapacity, hashTabBytes());
+                memcpy(_hashTab, oldCache + oldCapacity, hashTabBytes());
             }
         }
     }
@@ -291,7 +294,8 @@ void DocumentStorage::reserveFields(size_t expectedFields) {
 
     uassert(16491, "Tried to make oversized document", newSize <= size_t(BufferMaxSize));
 
-    _cache = new char[newSize + hashTabBytes()];
+    const size_t capacity = newSize + hashTabBytes();
+    _cache = capacity <= sizeof(_inlineCache) ? _inlineCache : new char[capacity];
     _cacheEnd = _cache + newSize;
 }
 
@@ -303,7 +307,8 @@ intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
         // Make a copy of the buffer with the fields.
         // It is very important that the positions of each field are the same after cloning.
         const size_t bufferBytes = allocatedBytes();
-        out->_cache = new char[bufferBytes];
+        out->_cache =
+            bufferBytes <= sizeof(out->_inlineCache) ? out->_inlineCache : new char[bufferBytes];
         out->_cacheEnd = out->_cache + (_cacheEnd - _cache);
         memcpy(out->_cache, _cache, bufferBytes);
 
@@ -335,7 +340,7 @@ size_t DocumentStorage::getMetadataApproximateSize() const {
 }
 
 DocumentStorage::~DocumentStorage() {
-    std::unique_ptr<char[]> deleteBufferAtScopeEnd(_cache);
+    std::unique_ptr<char[]> deleteBufferAtScopeEnd(usingInlineCache() ? nullptr : _cache);
 
     for (auto it = iteratorCacheOnly(); !it.atEnd(); it.advance()) {
         it->val.~Value();  // explicit destructor call
@@ -524,6 +524,11 @@ private:
     /// Allocates space in _cache. Copies existing data if there is any.
     void alloc(unsigned newSize);
 
+    /// True when '_cache' points at '_inlineCache' rather than a heap buffer.
+    bool usingInlineCache() const {
+        return _cache == _inlineCache;
+    }
+
     /// Call after adding field to _cache and increasing _numFields
     void addFieldToHashTable(Position pos);
 
@@ -584,6 +589,11 @@ private:
         Position* _hashTab;  // table lazily initialized once _numFields == HASH_TAB_MIN
     };
 
+    // The first cache allocation is serviced from this buffer when it fits, so documents with a
+    // handful of fields never heap-allocate; alloc() switches to a heap buffer on growth. Sized
+    // to match the minimum heap allocation.
+    alignas(alignof(void*)) char _inlineCache[128];
+
     unsigned _usedBytes;    // position where next field would start
     unsigned _numFields;    // this includes removed fields
     unsigned _hashTabMask;  // equal to hashTabBuckets()-1 but used more often
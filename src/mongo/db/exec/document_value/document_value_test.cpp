@@ -126,6 +126,23 @@ TEST(DocumentConstruction, FromEmptyDocumentClone) {
     ASSERT_DOCUMENT_EQ(document, documentClone3);
 }
 
+TEST(DocumentConstruction, GrowFieldCachePastInlineBuffer) {
+    // Add enough fields to push the field cache through several buffer growths, starting from the
+    // inline buffer, and verify nothing is lost in the copies.
+    MutableDocument md;
+    for (int idx = 0; idx < 100; ++idx) {
+        md.addField("field" + std::to_string(idx), Value(idx));
+    }
+    Document document = md.freeze();
+    ASSERT_EQUALS(100ULL, document.computeSize());
+
+    Document documentClone = document.clone();
+    ASSERT_DOCUMENT_EQ(document, documentClone);
+    for (int idx = 0; idx < 100; ++idx) {
+        ASSERT_VALUE_EQ(Value(idx), documentClone["field" + std::to_string(idx)]);
+    }
+}
+
 TEST(DocumentConstruction, FromBsonReset) {
     auto document = Document{{"a", 1}, {"b", "q"_sd}};
     auto bson = toBson(document);
@@ -1102,6 +1119,21 @@ public:
     }
 };
 
+/** Strings straddling the short-string optimization boundary. */
+class StringAtShortStringBoundary {
+public:
+    void run() {
+        // ValueStorage stores strings of up to 14 bytes inline; check the lengths around that
+        // limit so both representations round trip.
+        for (size_t len = 13; len <= 15; ++len) {
+            const string str(len, 'x');
+            Value value = Value(StringData(str));
+            ASSERT_EQUALS(str, value.getString());
+            assertRoundTrips(value);
+        }
+    }
+};
+
 /**
  * SERVER-43205: Constructing a Value with a very large BSONElement string causes the Value
  * constructor to throw before it can completely initialize its ValueStorage member, which has the
@@ -2351,6 +2383,7 @@ public:
         add<Value::Double>();
         add<Value::String>();
         add<Value::StringWithNull>();
+        add<Value::StringAtShortStringBoundary>();
         add<Value::LongString>();
         add<Value::Date>();
         add<Value::JSTimestamp>();
@@ -117,11 +117,6 @@ void ValueStorage::putString(StringData s) {
         shortStr = true;
         shortStrSize = s.size();
         s.copyTo(shortStrStorage, false);  // no NUL
-
-        // All memory is zeroed before this is called, so we know that
-        // the nulTerminator field will definitely contain a NUL byte.
-        dassert(((sizeNoNUL < sizeof(shortStrStorage)) && (shortStrStorage[sizeNoNUL] == '\0')) ||
-                (((shortStrStorage + sizeNoNUL) == &nulTerminator) && (nulTerminator == '\0')));
     } else {
         putRefCountable(RCString::create(s));
     }
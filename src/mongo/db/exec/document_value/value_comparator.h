@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <absl/container/flat_hash_map.h>
 #include <map>
 #include <set>
 
@@ -200,6 +201,20 @@ public:
         return stdx::unordered_map<Value, T, Hasher, EqualTo>(0, Hasher(this), EqualTo(this));
     }
 
+    /**
+     * Construct an empty unordered map from Value to type T whose equivalence classes are given by
+     * this comparator, backed by an open-addressing table which stores its entries inline rather
+     * than in separately allocated nodes. More cache-friendly than 'makeUnorderedValueMap' for
+     * bulk inserts and lookups, but rehashing invalidates pointers and references into the map,
+     * not just iterators. This comparator must outlive the returned map.
+     */
+    template <typename T>
+    absl::flat_hash_map<Value, T, EnsureTrustedHasher<Hasher, Value>, EqualTo>
+    makeFlatUnorderedValueMap() const {
+        return absl::flat_hash_map<Value, T, EnsureTrustedHasher<Hasher, Value>, EqualTo>(
+            0, Hasher(this), EqualTo(this));
+    }
+
 private:
     const StringData::ComparatorInterface* _stringComparator = nullptr;
 };
@@ -224,4 +239,11 @@ template <typename T>
 using ValueUnorderedMap =
     stdx::unordered_map<Value, T, ValueComparator::Hasher, ValueComparator::EqualTo>;
 
+template <typename T>
+using ValueFlatUnorderedMap =
+    absl::flat_hash_map<Value,
+                        T,
+                        EnsureTrustedHasher<ValueComparator::Hasher, Value>,
+                        ValueComparator::EqualTo>;
+
 }  // namespace mongo
@@ -325,20 +325,16 @@ public:
             struct {
                 uint8_t refCounter : 1;  // bit 0: true if we need to refCount
                 uint8_t shortStr : 1;    // bit 1: true if we are using short strings
-                uint8_t reservedFlags : 6;
+                uint8_t reservedFlags : 2;
+                uint8_t shortStrSize : 4;  // bits 4-7: size when 'shortStr' is set
             };
 
             // bytes[2:15]
             union {
                 unsigned char oid[12];
 
-                struct {
-                    char shortStrSize;  // TODO Consider moving into flags union (4 bits)
-                    char shortStrStorage[sizeof(bytes) - 3 /*offset*/ - 1 /*NUL byte*/];
-                    union {
-                        char nulTerminator;
-                    };
-                };
+                // Not NUL-terminated; 'shortStrSize' in the flags above holds the length.
+                char shortStrStorage[sizeof(bytes) - 2 /*type and flags*/];
 
                 struct {
                     union {
@@ -192,6 +192,19 @@ TEST(ExclusionProjectionExecutionTest,
 // Tests of execution of exclusions at the top level.
 //
 
+TEST(ExclusionProjectionExecutionTest, ShouldApplySameProjectionAfterOptimize) {
+    auto exclusion =
+        makeExclusionProjectionWithDefaultPolicies(BSON("a.b" << false << "c" << false));
+
+    auto inputDoc = Document{{"a", Document{{"b", 1}, {"z", 2}}}, {"c", 3}, {"x", 4}};
+    auto expectedResult = exclusion->applyTransformation(inputDoc);
+
+    // Optimizing compiles the projection into its pre-resolved execution plan; the applied
+    // projection must be unchanged.
+    exclusion->optimize();
+    ASSERT_DOCUMENT_EQ(expectedResult, exclusion->applyTransformation(inputDoc));
+}
+
 TEST(ExclusionProjectionExecutionTest, ShouldExcludeTopLevelField) {
     auto exclusion = makeExclusionProjectionWithDefaultPolicies(BSON("a" << false));
 
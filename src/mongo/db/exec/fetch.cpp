@@ -43,6 +43,13 @@
 
 namespace mongo {
 
+namespace {
+// How many RecordIds to gather from the child per prefetch hint. Small enough that the extra
+// child work per doWork() call stays bounded, large enough to give the storage engine several
+// reads to overlap.
+const size_t kFetchPrefetchBatchSize = 8;
+}  // namespace
+
 using std::unique_ptr;
 using std::vector;
 
@@ -69,23 +76,81 @@ bool FetchStage::isEOF() {
         return false;
     }
 
+    if (_bufferedPos < _buffered.size()) {
+        // We have members buffered from a prefetch lookahead that haven't been returned yet.
+        return false;
+    }
+
     return child()->isEOF();
 }
 
+bool FetchStage::_prefetchEnabled() {
+    if (!_prefetchSupported) {
+        _prefetchSupported = collection()->getRecordStore()->supportsPrefetchHint();
+    }
+    return *_prefetchSupported;
+}
+
 PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     if (isEOF()) {
         return PlanStage::IS_EOF;
     }
 
-    // Either retry the last WSM we worked on or get a new one from our child.
+    // Either retry the last WSM we worked on, return the next member buffered by a prefetch
+    // lookahead, or get a new one from our child.
     WorkingSetID id;
     StageState status;
-    if (_idRetrying == WorkingSet::INVALID_ID) {
-        status = child()->work(&id);
-    } else {
+    if (_idRetrying != WorkingSet::INVALID_ID) {
         status = ADVANCED;
         id = _idRetrying;
         _idRetrying = WorkingSet::INVALID_ID;
+    } else if (_bufferedPos < _buffered.size()) {
+        status = ADVANCED;
+        id = _buffered[_bufferedPos++];
+        if (_bufferedPos == _buffered.size()) {
+            _buffered.clear();
+            _bufferedPos = 0;
+        }
+    } else {
+        status = child()->work(&id);
+
+        if (PlanStage::ADVANCED == status && _prefetchEnabled()) {
+            WorkingSetMember* member = _ws->get(id);
+            if (!member->hasObj() && member->hasRecordId()) {
+                // Look ahead at the next few members and hand the storage engine the RecordIds
+                // we're about to fetch, so it can start bringing their pages into cache while we
+                // do the blocking reads. Members pulled during the lookahead are queued up and
+                // returned in order on subsequent calls.
+                std::vector<RecordId> upcoming;
+                upcoming.push_back(member->recordId);
+                while (_buffered.size() + 1 < kFetchPrefetchBatchSize) {
+                    WorkingSetID lookaheadId;
+                    StageState lookaheadState = child()->work(&lookaheadId);
+                    if (PlanStage::ADVANCED == lookaheadState) {
+                        WorkingSetMember* lookahead = _ws->get(lookaheadId);
+                        // The buffered member may outlive a yield, so its data must be owned.
+                        lookahead->makeObjOwnedIfNeeded();
+                        _buffered.push_back(lookaheadId);
+                        if (!lookahead->hasObj() && lookahead->hasRecordId()) {
+                            upcoming.push_back(lookahead->recordId);
+                        }
+                    } else if (PlanStage::NEED_YIELD == lookaheadState) {
+                        // Propagate the yield request now; the current member joins the front of
+                        // the queue and everything is returned in order once we resume.
+                        member->makeObjOwnedIfNeeded();
+                        _buffered.insert(_buffered.begin(), id);
+                        *out = lookaheadId;
+                        return lookaheadState;
+                    } else {
+                        // NEED_TIME or IS_EOF: stop looking ahead.
+                        break;
+                    }
+                }
+                if (upcoming.size() > 1) {
+                    collection()->getRecordStore()->prefetchRecords(opCtx(), upcoming);
+                }
+            }
+        }
     }
 
     if (PlanStage::ADVANCED == status) {
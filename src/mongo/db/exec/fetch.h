@@ -29,7 +29,9 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/requires_collection_stage.h"
 #include "mongo/db/jsobj.h"
@@ -86,6 +88,12 @@ private:
      */
     StageState returnIfMatches(WorkingSetMember* member, WorkingSetID memberID, WorkingSetID* out);
 
+    /**
+     * Whether the record store backing the collection can act on prefetch hints. Cached after the
+     * first call.
+     */
+    bool _prefetchEnabled();
+
     // Used to fetch Records from _collection.
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
@@ -98,6 +106,15 @@ private:
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
+    // Members pulled from our child while looking ahead for a prefetch hint, queued up to be
+    // returned in order. '_bufferedPos' indexes the next one. Only populated when the record
+    // store supports prefetch hints.
+    std::vector<WorkingSetID> _buffered;
+    size_t _bufferedPos = 0;
+
+    // Lazily cached result of RecordStore::supportsPrefetchHint().
+    boost::optional<bool> _prefetchSupported;
+
     // Stats
     FetchStats _specificStats;
 };
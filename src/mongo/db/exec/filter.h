@@ -30,6 +30,7 @@
 #pragma once
 
 #include "mongo/db/exec/working_set.h"
+#include "mongo/db/matcher/compiled_match_expression.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/matcher/matchable.h"
 
@@ -159,6 +160,20 @@ public:
         return filter->matches(&doc, nullptr);
     }
 
+    /**
+     * As above, but evaluates the compiled form of the filter when one is provided and 'wsm'
+     * carries a document. Members without a document (e.g. index-key-only data) fall back to
+     * interpreting 'filter', which knows how to match against index key data.
+     */
+    static bool passes(WorkingSetMember* wsm,
+                       const MatchExpression* filter,
+                       const CompiledMatchExpression* compiled) {
+        if (compiled && wsm->hasObj()) {
+            return compiled->matches(wsm->doc.value().toBson());
+        }
+        return passes(wsm, filter);
+    }
+
     static bool passes(const BSONObj& keyData,
                        const BSONObj& keyPattern,
                        const MatchExpression* filter) {
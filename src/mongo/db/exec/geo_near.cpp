@@ -77,18 +77,16 @@ namespace {
  * TODO: Merge with 2D/2DSphere key extraction?
  */
 struct StoredGeometry {
-    static StoredGeometry* parseFrom(const BSONElement& element) {
+    static bool parseFrom(const BSONElement& element, StoredGeometry* stored) {
         if (!element.isABSONObj())
-            return nullptr;
-
-        unique_ptr<StoredGeometry> stored(new StoredGeometry);
+            return false;
 
         // GeoNear stage can only be run with an existing index
         // Therefore, it is always safe to skip geometry validation
         if (!stored->geometry.parseFromStorage(element, true).isOK())
-            return nullptr;
+            return false;
         stored->element = element;
-        return stored.release();
+        return true;
     }
 
     BSONElement element;
@@ -101,7 +99,7 @@ struct StoredGeometry {
  */
 static void extractGeometries(const BSONObj& doc,
                               const string& path,
-                              std::vector<std::unique_ptr<StoredGeometry>>* geometries) {
+                              std::vector<StoredGeometry>* geometries) {
     BSONElementSet geomElements;
     // NOTE: Annoyingly, we cannot just expand arrays b/c single 2d points are arrays, we need
     // to manually expand all results to check if they are geometries
@@ -109,9 +107,9 @@ static void extractGeometries(const BSONObj& doc,
 
     for (BSONElementSet::iterator it = geomElements.begin(); it != geomElements.end(); ++it) {
         const BSONElement& el = *it;
-        unique_ptr<StoredGeometry> stored(StoredGeometry::parseFrom(el));
+        StoredGeometry stored;
 
-        if (stored.get()) {
+        if (StoredGeometry::parseFrom(el, &stored)) {
             // Valid geometry element
             geometries->push_back(std::move(stored));
         } else if (el.type() == Array) {
@@ -119,11 +117,11 @@ static void extractGeometries(const BSONObj& doc,
             BSONObjIterator arrIt(el.Obj());
             while (arrIt.more()) {
                 const BSONElement nextEl = arrIt.next();
-                stored.reset(StoredGeometry::parseFrom(nextEl));
+                StoredGeometry arrayStored;
 
-                if (stored.get()) {
+                if (StoredGeometry::parseFrom(nextEl, &arrayStored)) {
                     // Valid geometry element
-                    geometries->push_back(std::move(stored));
+                    geometries->push_back(std::move(arrayStored));
                 } else {
                     LOGV2_WARNING(23760,
                                   "geoNear stage read non-geometry element in array",
@@ -151,14 +149,14 @@ static double computeGeoNearDistance(const GeoNearParams& nearParams, WorkingSet
     CRS queryCRS = nearParams.nearQuery->centroid->crs;
 
     // Extract all the geometries out of this document for the near query
-    std::vector<std::unique_ptr<StoredGeometry>> geometries;
+    std::vector<StoredGeometry> geometries;
     extractGeometries(member->doc.value().toBson(), nearParams.nearQuery->field, &geometries);
 
     // Compute the minimum distance of all the geometries in the document
     double minDistance = -1;
     Value minDistanceMetadata;
     for (auto it = geometries.begin(); it != geometries.end(); ++it) {
-        StoredGeometry& stored = **it;
+        StoredGeometry& stored = *it;
 
         // NOTE: A stored document with STRICT_SPHERE CRS is treated as a malformed document
         // and ignored. Since GeoNear requires an index, there's no stored STRICT_SPHERE shape.
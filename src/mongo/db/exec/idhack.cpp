@@ -31,8 +31,10 @@
 
 #include "mongo/db/exec/idhack.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/exec/index_scan.h"
@@ -54,9 +56,20 @@ IDHackStage::IDHackStage(ExpressionContext* expCtx,
                          WorkingSet* ws,
                          const CollectionPtr& collection,
                          const IndexDescriptor* descriptor)
-    : RequiresIndexStage(kStageType, expCtx, collection, descriptor, ws),
-      _workingSet(ws),
-      _key(query->getQueryObj()["_id"].wrap()) {
+    : RequiresIndexStage(kStageType, expCtx, collection, descriptor, ws), _workingSet(ws) {
+    const BSONElement idElt = query->getQueryObj()["_id"];
+    if (idElt.type() == Object && idElt.Obj().firstElementFieldNameStringData() == "$in") {
+        // A batched point lookup, {_id: {$in: [...]}}. Extract each requested value as its own
+        // key, then sort them so the lookups proceed in index key order.
+        for (auto&& valueElt : idElt.Obj().firstElement().Obj()) {
+            _keys.push_back(valueElt.wrap("_id"));
+        }
+        sortAndDedupKeys();
+        // An empty $in matches nothing.
+        _done = _keys.empty();
+    } else {
+        _keys.push_back(idElt.wrap());
+    }
     _specificStats.indexName = descriptor->indexName();
     _addKeyMetadata = query->getFindCommandRequest().getReturnKey();
 }
@@ -68,10 +81,21 @@ IDHackStage::IDHackStage(ExpressionContext* expCtx,
                          const IndexDescriptor* descriptor)
     : RequiresIndexStage(kStageType, expCtx, collection, descriptor, ws),
       _workingSet(ws),
-      _key(key) {
+      _keys{key} {
     _specificStats.indexName = descriptor->indexName();
 }
 
+void IDHackStage::sortAndDedupKeys() {
+    // Sorting by the simple BSON ordering matches the _id index's key order when the collection
+    // has the simple collation. With a non-simple default collation the resulting order is merely
+    // a locality heuristic, which is all the sort is for; each key is still looked up exactly.
+    std::sort(_keys.begin(), _keys.end(), SimpleBSONObjComparator::kInstance.makeLessThan());
+    _keys.erase(std::unique(_keys.begin(),
+                            _keys.end(),
+                            SimpleBSONObjComparator::kInstance.makeEqualTo()),
+                _keys.end());
+}
+
 IDHackStage::~IDHackStage() {}
 
 bool IDHackStage::isEOF() {
@@ -85,13 +109,18 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
 
     WorkingSetID id = WorkingSet::INVALID_ID;
     try {
+        const BSONObj& key = _keys[_keyIndex];
+
         // Look up the key by going directly to the index.
-        auto recordId = indexAccessMethod()->findSingle(opCtx(), collection(), _key);
+        auto recordId = indexAccessMethod()->findSingle(opCtx(), collection(), key);
 
-        // Key not found.
+        // Key not found. Move on to the next requested key, if any.
         if (recordId.isNull()) {
-            _done = true;
-            return PlanStage::IS_EOF;
+            if (++_keyIndex == _keys.size()) {
+                _done = true;
+                return PlanStage::IS_EOF;
+            }
+            return PlanStage::NEED_TIME;
         }
 
         ++_specificStats.keysExamined;
@@ -112,14 +141,18 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
                 opCtx(), _workingSet, id, _recordCursor.get(), coll, coll->ns())) {
             // We didn't find a document with RecordId 'id'.
             _workingSet->free(id);
-            _commonStats.isEOF = true;
-            _done = true;
-            return IS_EOF;
+            if (++_keyIndex == _keys.size()) {
+                _commonStats.isEOF = true;
+                _done = true;
+                return IS_EOF;
+            }
+            return PlanStage::NEED_TIME;
         }
 
-        return advance(id, member, out);
+        ++_keyIndex;
+        return advance(id, member, out, key);
     } catch (const WriteConflictException&) {
-        // Restart at the beginning on retry.
+        // Retry the current key on restart.
         _recordCursor.reset();
         if (id != WorkingSet::INVALID_ID)
             _workingSet->free(id);
@@ -131,15 +164,16 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
 
 PlanStage::StageState IDHackStage::advance(WorkingSetID id,
                                            WorkingSetMember* member,
-                                           WorkingSetID* out) {
+                                           WorkingSetID* out,
+                                           const BSONObj& key) {
     invariant(member->hasObj());
 
     if (_addKeyMetadata) {
         BSONObj ownedKeyObj = member->doc.value().toBson()["_id"].wrap().getOwned();
-        member->metadata().setIndexKey(IndexKeyEntry::rehydrateKey(_key, ownedKeyObj));
+        member->metadata().setIndexKey(IndexKeyEntry::rehydrateKey(key, ownedKeyObj));
     }
 
-    _done = true;
+    _done = (_keyIndex == _keys.size());
     *out = id;
     return PlanStage::ADVANCED;
 }
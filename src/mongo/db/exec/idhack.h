@@ -30,6 +30,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/requires_index_stage.h"
 #include "mongo/db/query/canonical_query.h"
@@ -44,6 +45,11 @@ class RecordCursor;
  * A standalone stage implementing the fast path for key-value retrievals via the _id index. Since
  * the _id index always has the collection default collation, the IDHackStage can only be used when
  * the query's collation is equal to the collection default.
+ *
+ * In addition to a single _id equality, the stage supports a batch of point lookups extracted from
+ * an {_id: {$in: [...]}} predicate. The requested keys are sorted into index key order up front so
+ * that the lookups walk the _id index and record store in one ordered pass rather than performing
+ * random descents.
  */
 class IDHackStage final : public RequiresIndexStage {
 public:
@@ -85,21 +91,35 @@ protected:
 
 private:
     /**
-     * Marks this stage as done, optionally adds key metadata, and returns PlanStage::ADVANCED.
+     * Optionally adds key metadata for 'key', marks this stage as done if all keys have been
+     * processed, and returns PlanStage::ADVANCED.
      *
      * Called whenever we have a WSM containing the matching obj.
      */
-    StageState advance(WorkingSetID id, WorkingSetMember* member, WorkingSetID* out);
+    StageState advance(WorkingSetID id,
+                       WorkingSetMember* member,
+                       WorkingSetID* out,
+                       const BSONObj& key);
+
+    /**
+     * Sorts '_keys' into index key order and removes duplicates. Called once at construction when
+     * more than one key was requested.
+     */
+    void sortAndDedupKeys();
 
     std::unique_ptr<SeekableRecordCursor> _recordCursor;
 
     // The WorkingSet we annotate with results.  Not owned by us.
     WorkingSet* _workingSet;
 
-    // The value to match against the _id field.
-    BSONObj _key;
+    // The values to match against the _id field, in index key order. Contains a single entry for
+    // an _id equality and one entry per requested point for a batched $in lookup.
+    std::vector<BSONObj> _keys;
+
+    // Index into '_keys' of the next key to look up.
+    size_t _keyIndex = 0;
 
-    // Have we returned our one document?
+    // Have we returned all matching documents?
     bool _done = false;
 
     // Do we need to add index key metadata for returnKey?
@@ -383,6 +383,21 @@ TEST_F(InclusionProjectionExecutionTestWithFallBackToDefault, ShouldOptimizeNest
         inclusion->serializeTransformation(ExplainOptions::Verbosity::kExecAllPlans));
 }
 
+TEST_F(InclusionProjectionExecutionTestWithFallBackToDefault,
+       ShouldApplySameProjectionAfterOptimize) {
+    auto inclusion = makeInclusionProjectionWithDefaultPolicies(
+        BSON("a.b" << true << "c" << true << "d" << wrapInLiteral("computedVal") << "e.f"
+                   << wrapInLiteral("nestedComputedVal")));
+
+    auto inputDoc = Document{{"a", Document{{"b", 1}, {"z", 2}}}, {"c", 3}, {"x", 4}};
+    auto expectedResult = inclusion->applyTransformation(inputDoc);
+
+    // Optimizing compiles the projection into its pre-resolved execution plan; the applied
+    // projection must be unchanged.
+    inclusion->optimize();
+    ASSERT_DOCUMENT_EQ(expectedResult, inclusion->applyTransformation(inputDoc));
+}
+
 TEST_F(InclusionProjectionExecutionTestWithFallBackToDefault,
        ShouldReportThatAllExceptIncludedFieldsAreModified) {
     auto inclusion = makeInclusionProjectionWithDefaultPolicies(
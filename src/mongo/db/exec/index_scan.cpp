@@ -137,16 +137,33 @@ boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
     }
 }
 
+namespace {
+// Number of index entries pulled per storage-cursor call in GETTING_NEXT. Keys are owned copies,
+// so the batch is kept small enough to stay cache-friendly while amortizing cursor overhead on
+// large range scans.
+const size_t kIndexScanBatchSize = 64;
+}  // namespace
+
 PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
     // Get the next kv pair from the index, if any.
     boost::optional<IndexKeyEntry> kv;
+    bool fromBatch = false;
     try {
         switch (_scanState) {
             case INITIALIZING:
                 kv = initIndexScan();
                 break;
             case GETTING_NEXT:
-                kv = _indexCursor->next();
+                if (_batchPos == _batch.size()) {
+                    _batch.clear();
+                    _batchPos = 0;
+                    _batchSnapshotId = opCtx()->recoveryUnit()->getSnapshotId();
+                    _indexCursor->nextBatch(kIndexScanBatchSize, &_batch);
+                }
+                if (_batchPos < _batch.size()) {
+                    kv = std::move(_batch[_batchPos++]);
+                    fromBatch = true;
+                }
                 break;
             case NEED_SEEK:
                 ++_specificStats.seeks;
@@ -197,6 +214,9 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
                 break;
 
             case IndexBoundsChecker::MUST_ADVANCE:
+                // Any buffered entries are behind the seek point; drop them.
+                _batch.clear();
+                _batchPos = 0;
                 _scanState = NEED_SEEK;
                 return PlanStage::NEED_TIME;
         }
@@ -231,8 +251,11 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
     WorkingSetID id = _workingSet->allocate();
     WorkingSetMember* member = _workingSet->get(id);
     member->recordId = kv->loc;
-    member->keyData.push_back(IndexKeyDatum(
-        _keyPattern, kv->key, workingSetIndexId(), opCtx()->recoveryUnit()->getSnapshotId()));
+    member->keyData.push_back(
+        IndexKeyDatum(_keyPattern,
+                      kv->key,
+                      workingSetIndexId(),
+                      fromBatch ? _batchSnapshotId : opCtx()->recoveryUnit()->getSnapshotId()));
     _workingSet->transitionToRecordIdAndIdx(id);
 
     if (_addKeyMetadata) {
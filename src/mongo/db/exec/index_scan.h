@@ -36,6 +36,7 @@
 #include "mongo/db/query/index_bounds.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/index_entry_comparison.h"
+#include "mongo/db/storage/snapshot.h"
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/stdx/unordered_set.h"
 
@@ -169,6 +170,15 @@ private:
     // Keeps track of what work we need to do next.
     ScanState _scanState = ScanState::INITIALIZING;
 
+    // Entries buffered from a batched cursor advance; '_batchPos' is the next one to hand out.
+    // Keys are owned, so the buffer stays valid across yields. Invalidated whenever the scan
+    // needs to seek, since buffered entries would then be on the wrong side of the seek point.
+    std::vector<IndexKeyEntry> _batch;
+    size_t _batchPos = 0;
+
+    // Snapshot under which '_batch' was read, recorded on returned working-set members.
+    SnapshotId _batchSnapshotId;
+
     // Could our index have duplicates?  If so, we use _returned to dedup.
     stdx::unordered_set<RecordId, RecordId::Hasher> _returned;
 
@@ -54,6 +54,7 @@ MergeSortStage::MergeSortStage(ExpressionContext* expCtx,
     : PlanStage(kStageType, expCtx),
       _ws(ws),
       _pattern(params.pattern),
+      _ordering(Ordering::make(params.pattern)),
       _collator(params.collator),
       _dedup(params.dedup),
       _merging(StageWithValueComparison(ws, params.pattern, params.collator)) {}
@@ -120,6 +121,9 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
             value.stage = child;
             // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we yield.
             member->makeObjOwnedIfNeeded();
+            // Compute the normalized sort key once, so the O(log n) comparisons this result
+            // participates in while in the priority queue are each a single memcmp.
+            value.normalizedKey = _computeNormalizedKey(member);
             _mergingData.push_front(value);
 
             // Insert the result (indirectly) into our priority queue.
@@ -162,8 +166,38 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
 
 // Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
 // the return from the expected value.
+KeyString::Value MergeSortStage::_computeNormalizedKey(WorkingSetMember* member) const {
+    // Sort key parts extracted from fetched documents are not collation-encoded yet, while parts
+    // coming from index keys already are; encoding the former with the collator makes all
+    // normalized keys directly comparable, mirroring the pairwise comparison logic below.
+    const bool needsCollationEncoding = _collator && member->hasObj();
+
+    KeyString::HeapBuilder builder(KeyString::Version::kLatestVersion, _ordering);
+    BSONObjIterator it(_pattern);
+    while (it.more()) {
+        BSONElement patternElt = it.next();
+        BSONElement elt;
+        if (!member->getFieldDotted(patternElt.fieldName(), &elt))
+            return {};
+
+        if (needsCollationEncoding) {
+            BSONObjBuilder encoded;
+            CollationIndexKey::collationAwareIndexKeyAppend(elt, _collator, &encoded);
+            builder.appendBSONElement(encoded.obj().firstElement());
+        } else {
+            builder.appendBSONElement(elt);
+        }
+    }
+    return builder.release();
+}
+
 bool MergeSortStage::StageWithValueComparison::operator()(const MergingRef& lhs,
                                                           const MergingRef& rhs) {
+    // Fast path: both results have precomputed normalized keys, so the comparison is a memcmp.
+    // The keys encode the pattern's directions, collation and type ordering.
+    if (!lhs->normalizedKey.isEmpty() && !rhs->normalizedKey.isEmpty())
+        return lhs->normalizedKey.compare(rhs->normalizedKey) > 0;
+
     WorkingSetMember* lhsMember = _ws->get(lhs->id);
     WorkingSetMember* rhsMember = _ws->get(rhs->id);
 
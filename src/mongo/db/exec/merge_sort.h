@@ -37,6 +37,7 @@
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/key_string.h"
 
 namespace mongo {
 
@@ -79,6 +80,10 @@ private:
         StageWithValue() : id(WorkingSet::INVALID_ID), stage(nullptr) {}
         WorkingSetID id;
         PlanStage* stage;
+        // The member's sort key in KeyString form, so repeated comparisons of the same buffered
+        // result during heap sifts reduce to memcmp. Empty if the key could not be computed,
+        // in which case the comparator falls back to element-wise comparison.
+        KeyString::Value normalizedKey;
     };
 
     // This stage maintains a priority queue of results from each child stage so that it can quickly
@@ -105,12 +110,20 @@ private:
         const CollatorInterface* _collator;
     };
 
+    // Computes the KeyString-normalized sort key for 'member', encoding collation-aware parts
+    // the same way index keys are encoded so keys from fetched documents and index keys compare
+    // consistently. Returns an empty Value if any sort key part is missing.
+    KeyString::Value _computeNormalizedKey(WorkingSetMember* member) const;
+
     // Not owned by us.
     WorkingSet* _ws;
 
     // The pattern that we're sorting by.
     BSONObj _pattern;
 
+    // The pattern's directions in Ordering form, used for KeyString encoding of sort keys.
+    const Ordering _ordering;
+
     // Null if this merge sort stage orders strings according to simple binary compare. If non-null,
     // represents the collator used to compare strings.
     const CollatorInterface* _collator;
@@ -50,6 +50,7 @@
 #include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/plan_ranker.h"
 #include "mongo/db/query/plan_ranker_util.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/str.h"
 
@@ -167,6 +168,14 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
     size_t numWorks = trial_period::getTrialPeriodMaxWorks(opCtx(), collection());
     size_t numResults = trial_period::getTrialPeriodNumToReturn(*_query);
 
+    // When enabled, clearly losing candidates are parked partway through the trial so the trial
+    // cost approaches that of the winning plan rather than the sum over all candidates. Each plan
+    // gets a quarter of the trial as warm-up before it can be parked.
+    const bool prune = internalQueryPlanEvaluationPruneLaggingPlans.load();
+    const size_t pruneWarmupWorks = numWorks / 4;
+    const size_t pruneInterval = std::max(static_cast<size_t>(1), numWorks / 8);
+    _prunedDuringTrial.assign(_candidates.size(), false);
+
     try {
         // Work the plans, stopping when a plan hits EOF or returns some fixed number of results.
         for (size_t ix = 0; ix < numWorks; ++ix) {
@@ -174,6 +183,9 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
             if (!moreToDo) {
                 break;
             }
+            if (prune && ix >= pruneWarmupWorks && (ix - pruneWarmupWorks) % pruneInterval == 0) {
+                pruneLaggingCandidates();
+            }
         }
     } catch (DBException& e) {
         return e.toStatus().withContext("error while multiplanner was selecting best plan");
@@ -231,6 +243,9 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
         if (!candidate.status.isOK()) {
             continue;
         }
+        if (!_prunedDuringTrial.empty() && _prunedDuringTrial[ix]) {
+            continue;
+        }
 
         // Might need to yield between calls to work due to the timer elapsing.
         tryYield(yieldPolicy);
@@ -289,6 +304,37 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
     return !doneWorking;
 }
 
+void MultiPlanStage::pruneLaggingCandidates() {
+    // Productivity so far, by results produced. The leader is never pruned, and pruning only
+    // kicks in once the leader has produced enough results for the gap to be meaningful.
+    const size_t kMinLeaderResults = 16;
+    size_t leaderResults = 0;
+    for (size_t ix = 0; ix < _candidates.size(); ++ix) {
+        if (_candidates[ix].status.isOK() && !_prunedDuringTrial[ix]) {
+            leaderResults = std::max(leaderResults, _candidates[ix].results.size());
+        }
+    }
+    if (leaderResults < kMinLeaderResults) {
+        return;
+    }
+
+    for (size_t ix = 0; ix < _candidates.size(); ++ix) {
+        if (!_candidates[ix].status.isOK() || _prunedDuringTrial[ix]) {
+            continue;
+        }
+        // Park candidates at less than a quarter of the leader's output.
+        if (_candidates[ix].results.size() * 4 < leaderResults) {
+            LOGV2_DEBUG(5958300,
+                        2,
+                        "Pruning lagging candidate plan for remainder of trial period",
+                        "candidateIdx"_attr = ix,
+                        "candidateResults"_attr = _candidates[ix].results.size(),
+                        "leaderResults"_attr = leaderResults);
+            _prunedDuringTrial[ix] = true;
+        }
+    }
+}
+
 bool MultiPlanStage::hasBackupPlan() const {
     return kNoSuchPlan != _backupPlanIdx;
 }
@@ -163,6 +163,14 @@ private:
      */
     void tryYield(PlanYieldPolicy* yieldPolicy);
 
+    /**
+     * Stops working candidates that have produced far fewer results than the current leader.
+     * Pruned candidates keep the statistics gathered so far and still participate in ranking;
+     * they just receive no further work() calls during the trial. Only called when
+     * 'internalQueryPlanEvaluationPruneLaggingPlans' is enabled.
+     */
+    void pruneLaggingCandidates();
+
     static const int kNoSuchPlan = -1;
 
     // Describes the cases in which we should write an entry for the winning plan to the plan cache.
@@ -186,6 +194,10 @@ private:
     // uses -1 / kNoSuchPlan when best plan is not (yet) known
     int _backupPlanIdx;
 
+    // Flags candidates parked by pruneLaggingCandidates(). Parallel to _candidates; empty until
+    // pickBestPlan() runs with pruning enabled.
+    std::vector<bool> _prunedDuringTrial;
+
     // Count of the number of candidate plans that have failed during the trial period. The
     // multi-planner swallows resource exhaustion errors (QueryExceededMemoryLimitNoDiskUseAllowed).
     // This means that if one candidate involves a blocking sort, and the other does not, the entire
@@ -45,6 +45,7 @@ class Collection;
 class CollectionPtr;
 class OperationContext;
 class RecordId;
+class TickSource;
 
 /**
  * A PlanStage ("stage") is the basic building block of a "Query Execution Plan."  A stage is
@@ -199,6 +200,7 @@ public:
      */
     StageState work(WorkingSetID* out) {
         auto optTimer(getOptTimer());
+        ScopedTickTimer workTimer(getTickSource(), &_commonStats.executionTimeNanos);
 
         ++_commonStats.works;
 
@@ -390,6 +392,8 @@ protected:
 
     ClockSource* getClock() const;
 
+    TickSource* getTickSource() const;
+
     OperationContext* opCtx() const {
         return _opCtx;
     }
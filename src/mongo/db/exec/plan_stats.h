@@ -72,6 +72,7 @@ struct CommonStats {
           advanced(0),
           needTime(0),
           needYield(0),
+          executionTimeNanos(0),
           failed(false),
           isEOF(false) {}
 
@@ -103,6 +104,12 @@ struct CommonStats {
     // cache.
     boost::optional<long long> executionTimeMillis;
 
+    // Time elapsed while working inside this stage, measured with the tick source. Unlike
+    // 'executionTimeMillis' this is always collected: tick reads are cheap enough to leave on
+    // for every work() call, so non-explain consumers (the profiler and the slow query log) can
+    // attribute execution time to stage types without rerunning the query under explain.
+    long long executionTimeNanos;
+
     // TODO: have some way of tracking WSM sizes (or really any series of #s).  We can measure
     // the size of our inputs and the size of our outputs.  We can do a lot with the WS here.
 
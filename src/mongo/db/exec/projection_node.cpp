@@ -138,6 +138,31 @@ void ProjectionNode::applyProjections(const Document& inputDoc, MutableDocument*
     auto it = inputDoc.fieldIterator();
     size_t projectedFields = 0;
 
+    if (!_compiledProjections.empty()) {
+        // Compiled path: a single hash lookup per input field resolves both leaf projected fields
+        // and child nodes.
+        while (it.more()) {
+            auto fieldName = it.fieldName();
+
+            if (auto entryIt = _compiledProjections.find(fieldName);
+                entryIt != _compiledProjections.end()) {
+                auto value = entryIt->second
+                    ? entryIt->second->applyProjectionsToValue(it.next().second)
+                    : applyLeafProjectionToValue(it.next().second);
+                outputProjectedField(fieldName, std::move(value), outputDoc);
+                ++projectedFields;
+            } else {
+                it.advance();
+            }
+
+            // Check if we can avoid reading from the document any further.
+            if (_maxFieldsToProject && _maxFieldsToProject <= projectedFields) {
+                break;
+            }
+        }
+        return;
+    }
+
     while (it.more()) {
         auto fieldName = it.fieldName();
 
@@ -188,6 +213,23 @@ void ProjectionNode::outputProjectedField(StringData field, Value val, MutableDo
 }
 
 void ProjectionNode::applyExpressions(const Document& root, MutableDocument* outputDoc) const {
+    if (!_compiledAdditions.empty()) {
+        // Compiled path: each step has already been resolved to the responsible child node or
+        // expression, so no hash lookups are needed here.
+        for (auto&& step : _compiledAdditions) {
+            if (step.child) {
+                outputDoc->setField(
+                    step.field, step.child->applyExpressionsToValue(root, outputDoc->peek()[step.field]));
+            } else {
+                outputDoc->setField(
+                    step.field,
+                    step.expression->evaluate(
+                        root, &step.expression->getExpressionContext()->variables));
+            }
+        }
+        return;
+    }
+
     for (auto&& field : _orderToProcessAdditionsAndChildren) {
         auto childIt = _children.find(field);
         if (childIt != _children.end()) {
@@ -266,6 +308,35 @@ void ProjectionNode::optimize() {
     }
 
     _maxFieldsToProject = maxFieldsToProject();
+
+    // Compile after expression optimization, since the compiled plan points at the optimized
+    // expressions.
+    compileExecutionPlan();
+}
+
+void ProjectionNode::compileExecutionPlan() {
+    _compiledProjections.clear();
+    for (auto&& projectedField : _projectedFields) {
+        _compiledProjections[projectedField] = nullptr;
+    }
+    for (auto&& childPair : _children) {
+        _compiledProjections[childPair.first] = childPair.second.get();
+    }
+
+    _compiledAdditions.clear();
+    _compiledAdditions.reserve(_orderToProcessAdditionsAndChildren.size());
+    for (auto&& field : _orderToProcessAdditionsAndChildren) {
+        CompiledAddition step;
+        step.field = field;
+        if (auto childIt = _children.find(field); childIt != _children.end()) {
+            step.child = childIt->second.get();
+        } else {
+            auto expressionIt = _expressions.find(field);
+            invariant(expressionIt != _expressions.end());
+            step.expression = expressionIt->second.get();
+        }
+        _compiledAdditions.push_back(step);
+    }
 }
 
 Document ProjectionNode::serialize(boost::optional<ExplainOptions::Verbosity> explain) const {
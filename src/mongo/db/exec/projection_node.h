@@ -210,8 +210,18 @@ private:
      */
     void makeOptimizationsStale() {
         _maxFieldsToProject = boost::none;
+        _compiledProjections.clear();
+        _compiledAdditions.clear();
     }
 
+    /**
+     * Builds the compiled per-document execution plan for this node from '_projectedFields',
+     * '_children', '_expressions' and '_orderToProcessAdditionsAndChildren'. Called by optimize()
+     * after expression optimization, since the compiled plan holds raw pointers into those
+     * containers.
+     */
+    void compileExecutionPlan();
+
     /**
      * Internal helper function for addExpressionForPath().
      */
@@ -226,5 +236,27 @@ private:
     // optimization which means we don't have to iterate over an entire document. The value is
     // stored here to avoid re-computation for each document.
     boost::optional<size_t> _maxFieldsToProject;
+
+    // A single pre-resolved step of the additions pass performed by applyExpressions(). Exactly
+    // one of 'child' and 'expression' is set. 'field' points into
+    // '_orderToProcessAdditionsAndChildren', and the raw pointers are into '_children' and
+    // '_expressions'; all are invalidated by tree mutation, which clears the compiled plan via
+    // makeOptimizationsStale().
+    struct CompiledAddition {
+        StringData field;
+        const ProjectionNode* child = nullptr;
+        Expression* expression = nullptr;
+    };
+
+    // Compiled per-document execution plan, built by optimize() via compileExecutionPlan().
+    //
+    // '_compiledProjections' collapses the separate '_projectedFields' and '_children' hash
+    // lookups performed per input field by applyProjections() into a single table whose mapped
+    // value is the child node responsible for the field, or nullptr for a leaf projected field.
+    // '_compiledAdditions' pre-resolves each entry of '_orderToProcessAdditionsAndChildren' so
+    // that the additions pass performs no hash lookups per document. Both are empty until
+    // optimize() runs, in which case the un-compiled fallback paths are used.
+    StringMap<const ProjectionNode*> _compiledProjections;
+    std::vector<CompiledAddition> _compiledAdditions;
 };
 }  // namespace mongo::projection_executor
@@ -62,14 +62,14 @@ std::unique_ptr<vm::CodeFragment> wrapNothingTest(std::unique_ptr<vm::CodeFragme
 }
 
 std::unique_ptr<EExpression> EConstant::clone() const {
-    auto [tag, val] = value::copyValue(_tag, _val);
-    return std::make_unique<EConstant>(tag, val);
+    // Share the immutable value with the clone instead of deep-copying it.
+    return std::unique_ptr<EConstant>(new EConstant(_value));
 }
 
 std::unique_ptr<vm::CodeFragment> EConstant::compile(CompileCtx& ctx) const {
     auto code = std::make_unique<vm::CodeFragment>();
 
-    code->appendConstVal(_tag, _val);
+    code->appendConstVal(_value->tag, _value->val);
 
     return code;
 }
@@ -77,7 +77,7 @@ std::unique_ptr<vm::CodeFragment> EConstant::compile(CompileCtx& ctx) const {
 std::vector<DebugPrinter::Block> EConstant::debugPrint() const {
     std::vector<DebugPrinter::Block> ret;
     std::stringstream ss;
-    ss << std::make_pair(_tag, _val);
+    ss << std::make_pair(_value->tag, _value->val);
 
     ret.emplace_back(ss.str());
 
@@ -131,6 +131,20 @@ std::unique_ptr<vm::CodeFragment> EPrimBinary::compile(CompileCtx& ctx) const {
 
     invariant(!hasCollatorArg || isComparisonOp(_op));
 
+    // A plain (no collator) equality comparison against a constant fuses the constant push and the
+    // comparison into a single 'eqImm' instruction with the constant embedded in the instruction
+    // stream. Equality against a constant is by far the most common comparison produced by filter
+    // translation, so only 'eq' is fused for now. The embedded value is a view owned by the
+    // EConstant node, exactly like the view a 'pushConstVal' instruction would have pushed.
+    if (_op == EPrimBinary::eq && !hasCollatorArg) {
+        if (auto rhsConst = dynamic_cast<EConstant*>(_nodes[1].get()); rhsConst) {
+            auto [rhsTag, rhsVal] = rhsConst->getConstant();
+            code->append(_nodes[0]->compile(ctx));
+            code->appendEqImm(rhsTag, rhsVal);
+            return code;
+        }
+    }
+
     auto lhs = _nodes[0]->compile(ctx);
     auto rhs = _nodes[1]->compile(ctx);
 
@@ -556,6 +570,21 @@ std::unique_ptr<vm::CodeFragment> EFunction::compile(CompileCtx& ctx) const {
         }
         auto code = std::make_unique<vm::CodeFragment>();
 
+        // getField with a constant field name - the overwhelmingly common case - fuses the field
+        // name push and the field access into a single 'getFieldImm' instruction. The embedded
+        // field name is a view owned by the EConstant node, exactly like the view a 'pushConstVal'
+        // instruction would have pushed.
+        if (_name == "getField") {
+            if (auto fieldConst = dynamic_cast<EConstant*>(_nodes[1].get()); fieldConst) {
+                auto [fieldTag, fieldVal] = fieldConst->getConstant();
+                if (value::isString(fieldTag)) {
+                    code->append(_nodes[0]->compile(ctx));
+                    code->appendGetFieldImm(fieldTag, fieldVal);
+                    return code;
+                }
+            }
+        }
+
         if (it->second.aggregate) {
             uassert(4822846,
                     str::stream() << "aggregate function call: " << _name
@@ -333,18 +333,18 @@ auto makeSV(Args&&... args) {
 }
 
 /**
- * This is a constant expression. It assumes the ownership of the input constant.
+ * This is a constant expression. It assumes the ownership of the input constant. The constant is
+ * immutable and held by a holder shared between all clones of the expression, so cloning a plan
+ * never deep-copies constants (which may be large, e.g. the array of values of an $in query).
  */
 class EConstant final : public EExpression {
 public:
-    EConstant(value::TypeTags tag, value::Value val) : _tag(tag), _val(val) {}
+    EConstant(value::TypeTags tag, value::Value val)
+        : _value(std::make_shared<ValueHolder>(tag, val)) {}
     EConstant(StringData str) {
         // Views are non-owning so we have to make a copy.
-        std::tie(_tag, _val) = value::makeNewString(str);
-    }
-
-    ~EConstant() override {
-        value::releaseValue(_tag, _val);
+        auto [tag, val] = value::makeNewString(str);
+        _value = std::make_shared<ValueHolder>(tag, val);
     }
 
     std::unique_ptr<EExpression> clone() const override;
@@ -353,9 +353,28 @@ public:
 
     std::vector<DebugPrinter::Block> debugPrint() const override;
 
+    // Returns a view of the constant value. The value is shared by all clones of this expression,
+    // so it stays valid as long as any one of them is alive.
+    std::pair<value::TypeTags, value::Value> getConstant() const {
+        return {_value->tag, _value->val};
+    }
+
 private:
-    value::TypeTags _tag;
-    value::Value _val;
+    struct ValueHolder {
+        ValueHolder(value::TypeTags tag, value::Value val) : tag(tag), val(val) {}
+        ValueHolder(const ValueHolder&) = delete;
+        ValueHolder& operator=(const ValueHolder&) = delete;
+        ~ValueHolder() {
+            value::releaseValue(tag, val);
+        }
+
+        const value::TypeTags tag;
+        const value::Value val;
+    };
+
+    explicit EConstant(std::shared_ptr<const ValueHolder> value) : _value(std::move(value)) {}
+
+    std::shared_ptr<const ValueHolder> _value;
 };
 
 /**
@@ -474,6 +493,10 @@ public:
         validateNodes();
     }
 
+    const std::string& name() const {
+        return _name;
+    }
+
     std::unique_ptr<EExpression> clone() const override;
 
     std::unique_ptr<vm::CodeFragment> compile(CompileCtx& ctx) const override;
@@ -1133,6 +1133,7 @@ void Parser::walkGroup(AstQuery& ast) {
         true,
         collatorSlotPos ? lookupSlot(std::move(ast.nodes[collatorSlotPos]->identifier))
                         : boost::none,
+        false /* allowDiskUse */,
         getCurrentPlanNodeId());
 }
 
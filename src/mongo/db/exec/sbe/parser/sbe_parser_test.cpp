@@ -361,6 +361,7 @@ protected:
                 sbe::makeSV(),
                 true,
                 boost::none, /* optional collator slot */
+                false /* allowDiskUse */,
                 planNodeId),
             // GROUP with a collator slot.
             sbe::makeS<sbe::HashAggStage>(
@@ -375,6 +376,7 @@ protected:
                 sbe::makeSV(),
                 true,
                 sbe::value::SlotId{4}, /* optional collator slot */
+                false /* allowDiskUse */,
                 planNodeId),
             // LIMIT
             sbe::makeS<sbe::LimitSkipStage>(
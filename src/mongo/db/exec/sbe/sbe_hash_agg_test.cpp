@@ -37,6 +37,10 @@
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
 #include "mongo/db/exec/sbe/stages/hash_agg.h"
 #include "mongo/db/query/collation/collator_interface_mock.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo::sbe {
 
@@ -84,6 +88,7 @@ TEST_F(HashAggStageTest, HashAggMinMaxTest) {
             makeSV(),
             true,
             boost::none,
+            false /* allowDiskUse */,
             kEmptyPlanNodeId);
 
         auto outSlot = generateSlotId();
@@ -140,6 +145,7 @@ TEST_F(HashAggStageTest, HashAggAddToSetTest) {
             makeSV(),
             true,
             boost::none,
+            false /* allowDiskUse */,
             kEmptyPlanNodeId);
 
         return std::make_pair(hashAggSlot, std::move(hashAggStage));
@@ -226,6 +232,7 @@ TEST_F(HashAggStageTest, HashAggCollationTest) {
                                     makeSV(),
                                     true,
                                     boost::optional<value::SlotId>{useCollator, collatorSlot},
+                                    false /* allowDiskUse */,
                                     kEmptyPlanNodeId);
 
             return std::make_pair(countsSlot, std::move(hashAggStage));
@@ -288,6 +295,67 @@ TEST_F(HashAggStageTest, HashAggCollationTest) {
     }
 }
 
+TEST_F(HashAggStageTest, HashAggSpillTest) {
+    // Point the spill directory at a temporary directory and force a spill after (nearly) every
+    // input row by dropping the memory budget to a single byte.
+    unittest::TempDir tempDir("HashAggSpillTest");
+    auto savedDbPath = storageGlobalParams.dbpath;
+    auto savedMemoryLimit = internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.load();
+    storageGlobalParams.dbpath = tempDir.path();
+    internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.store(1);
+    ON_BLOCK_EXIT([&] {
+        storageGlobalParams.dbpath = savedDbPath;
+        internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.store(savedMemoryLimit);
+    });
+
+    auto ctx = makeCompileCtx();
+
+    // Build a scan of the [5,6,7,5,6,7,6,7,7] input array.
+    auto [inputTag, inputVal] =
+        stage_builder::makeValue(BSON_ARRAY(5 << 6 << 7 << 5 << 6 << 7 << 6 << 7 << 7));
+    auto [scanSlot, scanStage] = generateVirtualScan(inputTag, inputVal);
+
+    // Build a HashAggStage which groups by the scanSlot and computes a simple count. The merge of
+    // the spilled runs returns the groups in key order, so the expected output is deterministic.
+    auto countsSlot = generateSlotId();
+    auto hashAggStage = makeS<HashAggStage>(
+        std::move(scanStage),
+        makeSV(scanSlot),
+        makeEM(countsSlot,
+               stage_builder::makeFunction("sum",
+                                           makeE<EConstant>(value::TypeTags::NumberInt64,
+                                                            value::bitcastFrom<int64_t>(1)))),
+        makeSV(),
+        true,
+        boost::none,
+        true /* allowDiskUse */,
+        kEmptyPlanNodeId);
+    auto hashAggStagePtr = hashAggStage.get();
+
+    auto outSlot = generateSlotId();
+    auto stage = makeProjectStage(
+        std::move(hashAggStage),
+        kEmptyPlanNodeId,
+        outSlot,
+        stage_builder::makeFunction(
+            "newArray", makeE<EVariable>(scanSlot), makeE<EVariable>(countsSlot)));
+
+    auto resultAccessor = prepareTree(ctx.get(), stage.get(), outSlot);
+
+    auto [resultsTag, resultsVal] = getAllResults(stage.get(), resultAccessor);
+    value::ValueGuard resultsGuard{resultsTag, resultsVal};
+
+    auto [expectedTag, expectedVal] = stage_builder::makeValue(
+        BSON_ARRAY(BSON_ARRAY(5 << 2) << BSON_ARRAY(6 << 3) << BSON_ARRAY(7 << 4)));
+    value::ValueGuard expectedGuard{expectedTag, expectedVal};
+    assertValuesEqual(resultsTag, resultsVal, expectedTag, expectedVal);
+
+    // The stage must have actually spilled to produce the results above.
+    auto stats = hashAggStagePtr->getStats(true /* includeDebugInfo */);
+    ASSERT_TRUE(stats->debugInfo["usedDisk"].Bool());
+    ASSERT_GT(stats->debugInfo["spills"].Long(), 0);
+}
+
 TEST_F(HashAggStageTest, HashAggSeekKeysTest) {
     auto ctx = makeCompileCtx();
 
@@ -317,6 +385,7 @@ TEST_F(HashAggStageTest, HashAggSeekKeysTest) {
             makeSV(seekSlot),
             true,
             boost::none,
+            false /* allowDiskUse */,
             kEmptyPlanNodeId);
 
         return std::make_pair(countsSlot, std::move(hashAggStage));
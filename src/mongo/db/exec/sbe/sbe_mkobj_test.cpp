@@ -261,6 +261,48 @@ public:
         expectedGuard.reset();
         runTest(inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
     }
+
+    template <class MkObjStageType>
+    void testPassthrough() {
+        auto objOutSlotId = generateSlotId();
+        auto makeStageFn = [objOutSlotId](value::SlotId scanSlot,
+                                          std::unique_ptr<PlanStage> scanStage) {
+            // 'drop' behavior with no fields to drop and no projected fields, which takes the
+            // pass-through fast path for roots matching the stage's output type.
+            auto mkobj = makeS<MkObjStageType>(std::move(scanStage),
+                                               objOutSlotId,
+                                               scanSlot,
+                                               MkObjStageType::FieldBehavior::drop,
+                                               std::vector<std::string>{},
+                                               std::vector<std::string>{},
+                                               value::SlotVector{},
+                                               false,  // force new
+                                               false,  // return old
+                                               kEmptyPlanNodeId);
+
+            return std::make_pair(objOutSlotId, std::move(mkobj));
+        };
+
+        auto [inputTag, inputVal] = value::makeNewArray();
+        value::ValueGuard inputGuard{inputTag, inputVal};
+        {
+            auto inputView = value::getArrayView(inputVal);
+            addBsonObjToArray(inputView, BSON("a" << 1 << "b" << 2 << "c" << 3));
+            addBsonObjToArray(inputView, BSONObj());
+
+            addObjectToArray(inputView, BSON("a" << 1 << "b" << 2 << "c" << 3));
+            addObjectToArray(inputView, BSONObj());
+        }
+
+        auto [expectedTag, expectedVal] = stage_builder::makeValue(
+            BSON_ARRAY(BSON("a" << 1 << "b" << 2 << "c" << 3)
+                       << BSONObj() << BSON("a" << 1 << "b" << 2 << "c" << 3) << BSONObj()));
+        value::ValueGuard expectedGuard{expectedTag, expectedVal};
+
+        inputGuard.reset();
+        expectedGuard.reset();
+        runTest(inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
+    }
 };
 
 TEST_F(MkObjStageTest, MakeObjKeep) {
@@ -279,6 +321,14 @@ TEST_F(MkObjStageTest, MakeBsonObjDrop) {
     testDrop<MakeBsonObjStage>();
 }
 
+TEST_F(MkObjStageTest, MakeObjPassthrough) {
+    testPassthrough<MakeObjStage>();
+}
+
+TEST_F(MkObjStageTest, MakeBsonObjPassthrough) {
+    testPassthrough<MakeBsonObjStage>();
+}
+
 TEST_F(MkObjStageTest, MakeObjProject) {
     testProjectWithoutRoot<MakeObjStage>();
 }
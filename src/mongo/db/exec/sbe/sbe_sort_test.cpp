@@ -68,4 +68,41 @@ TEST_F(SortStageTest, SortNumbersTest) {
     runTestMulti(2, inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
 }
 
+TEST_F(SortStageTest, SortMixedTypesDescendingTest) {
+    // Mix keys which can take the KeyString-encoded comparison fast path (numbers, strings) with
+    // an object key which cannot, so both the encoded and the generic comparison paths are
+    // exercised within one sort.
+    auto [inputTag, inputVal] = stage_builder::makeValue(
+        BSON_ARRAY(BSON_ARRAY(2 << "A") << BSON_ARRAY("abc"
+                                                      << "B")
+                                        << BSON_ARRAY(BSON("a" << 1) << "C") << BSON_ARRAY(7 << "D")));
+    value::ValueGuard inputGuard{inputTag, inputVal};
+
+    // Descending order: objects sort after strings, which sort after numbers.
+    auto [expectedTag, expectedVal] = stage_builder::makeValue(
+        BSON_ARRAY(BSON_ARRAY(BSON("a" << 1) << "C") << BSON_ARRAY("abc"
+                                                                   << "B")
+                                                     << BSON_ARRAY(7 << "D") << BSON_ARRAY(2 << "A")));
+    value::ValueGuard expectedGuard{expectedTag, expectedVal};
+
+    auto makeStageFn = [](value::SlotVector scanSlots, std::unique_ptr<PlanStage> scanStage) {
+        // Create a SortStage that sorts by slot0 in descending order.
+        auto sortStage =
+            makeS<SortStage>(std::move(scanStage),
+                             makeSV(scanSlots[0]),
+                             std::vector<value::SortDirection>{value::SortDirection::Descending},
+                             makeSV(scanSlots[1]),
+                             std::numeric_limits<std::size_t>::max(),
+                             204857600,
+                             false,
+                             kEmptyPlanNodeId);
+
+        return std::make_pair(scanSlots, std::move(sortStage));
+    };
+
+    inputGuard.reset();
+    expectedGuard.reset();
+    runTestMulti(2, inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
+}
+
 }  // namespace mongo::sbe
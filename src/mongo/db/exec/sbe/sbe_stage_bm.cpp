@@ -0,0 +1,235 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * Micro-benchmarks for individual SBE plan stages. Each benchmark builds a small stage tree over
+ * an in-memory buffer of BSON documents (via BSONScanStage, so no storage engine is involved) and
+ * measures the cost of draining it.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+#include <boost/filesystem/operations.hpp>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/exec/sbe/expressions/expression.h"
+#include "mongo/db/exec/sbe/stages/bson_scan.h"
+#include "mongo/db/exec/sbe/stages/filter.h"
+#include "mongo/db/exec/sbe/stages/hash_agg.h"
+#include "mongo/db/exec/sbe/stages/hash_join.h"
+#include "mongo/db/exec/sbe/stages/project.h"
+#include "mongo/db/exec/sbe/stages/sort.h"
+#include "mongo/db/query/query_test_service_context.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo::sbe {
+namespace {
+
+const std::vector<std::string> kScanFields = {"key", "payload"};
+
+constexpr value::SlotId kKeySlot = 1;
+constexpr value::SlotId kPayloadSlot = 2;
+constexpr value::SlotId kOutputSlot = 3;
+constexpr value::SlotId kProbeKeySlot = 4;
+constexpr value::SlotId kProbePayloadSlot = 5;
+
+/**
+ * Generates a buffer of 'count' concatenated BSON documents of the form {key: <int32>, payload:
+ * <int64>}. The 'key' values cover [0, cardinality) in a scrambled order so that sorting and
+ * grouping do not benefit from presorted input.
+ */
+std::vector<char> generateDocs(size_t count, size_t cardinality) {
+    BufBuilder buf;
+    for (size_t idx = 0; idx < count; ++idx) {
+        BSONObjBuilder bob;
+        bob.append("key", static_cast<int>((idx * 2654435761u) % cardinality));
+        bob.append("payload", static_cast<long long>(idx));
+        auto obj = bob.done();
+        buf.appendBuf(obj.objdata(), obj.objsize());
+    }
+    return {buf.buf(), buf.buf() + buf.len()};
+}
+
+std::unique_ptr<PlanStage> makeScanStage(const std::vector<char>& docs,
+                                         value::SlotId keySlot = kKeySlot,
+                                         value::SlotId payloadSlot = kPayloadSlot) {
+    return makeS<BSONScanStage>(docs.data(),
+                                docs.data() + docs.size(),
+                                boost::none,
+                                kScanFields,
+                                makeSV(keySlot, payloadSlot),
+                                kEmptyPlanNodeId);
+}
+
+/**
+ * Prepares 'root', attaches it to an operation context and repeatedly drains it, reporting the
+ * number of input documents consumed per iteration.
+ */
+void runBenchmark(benchmark::State& state,
+                  PlanStage* root,
+                  size_t inputSize,
+                  value::SlotId outSlot) {
+    QueryTestServiceContext serviceContext;
+    auto opCtx = serviceContext.makeOperationContext();
+
+    CompileCtx ctx{std::make_unique<RuntimeEnvironment>()};
+    root->prepare(ctx);
+    root->attachToOperationContext(opCtx.get());
+    auto accessor = root->getAccessor(ctx, outSlot);
+
+    for (auto keepRunning : state) {
+        root->open(false);
+        while (root->getNext() == PlanState::ADVANCED) {
+            benchmark::DoNotOptimize(accessor->getViewOfValue());
+        }
+        root->close();
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * inputSize);
+}
+
+void BM_Scan(benchmark::State& state) {
+    const size_t numDocs = state.range(0);
+    auto docs = generateDocs(numDocs, numDocs);
+
+    auto root = makeScanStage(docs);
+    runBenchmark(state, root.get(), numDocs, kKeySlot);
+}
+
+void BM_FilterProject(benchmark::State& state) {
+    const size_t numDocs = state.range(0);
+    auto docs = generateDocs(numDocs, numDocs);
+
+    // Select half of the input and evaluate a small arithmetic projection over it, so the
+    // benchmark covers both the filter and project bytecode paths.
+    auto filter = makeS<FilterStage<false>>(
+        makeScanStage(docs),
+        makeE<EPrimBinary>(
+            EPrimBinary::less,
+            makeE<EVariable>(kKeySlot),
+            makeE<EConstant>(value::TypeTags::NumberInt32,
+                             value::bitcastFrom<int32_t>(static_cast<int32_t>(numDocs / 2)))),
+        kEmptyPlanNodeId);
+
+    auto root = makeProjectStage(
+        std::move(filter),
+        kEmptyPlanNodeId,
+        kOutputSlot,
+        makeE<EPrimBinary>(EPrimBinary::add,
+                           makeE<EVariable>(kKeySlot),
+                           makeE<EConstant>(value::TypeTags::NumberInt32,
+                                            value::bitcastFrom<int32_t>(1))));
+    runBenchmark(state, root.get(), numDocs, kOutputSlot);
+}
+
+void BM_HashAgg(benchmark::State& state) {
+    const size_t numDocs = state.range(0);
+    const size_t cardinality = state.range(1);
+    auto docs = generateDocs(numDocs, cardinality);
+
+    value::SlotMap<std::unique_ptr<EExpression>> aggs;
+    aggs.emplace(kOutputSlot,
+                 makeE<EFunction>("sum",
+                                  makeEs(makeE<EConstant>(value::TypeTags::NumberInt32,
+                                                          value::bitcastFrom<int32_t>(1)))));
+
+    auto root = makeS<HashAggStage>(makeScanStage(docs),
+                                    makeSV(kKeySlot),
+                                    std::move(aggs),
+                                    makeSV(),
+                                    true /* optimizedClose */,
+                                    boost::none /* collatorSlot */,
+                                    false /* allowDiskUse */,
+                                    kEmptyPlanNodeId);
+    runBenchmark(state, root.get(), numDocs, kOutputSlot);
+}
+
+void BM_HashJoin(benchmark::State& state) {
+    const size_t numProbeDocs = state.range(0);
+    const size_t numBuildDocs = state.range(1);
+    auto buildDocs = generateDocs(numBuildDocs, numBuildDocs);
+    auto probeDocs = generateDocs(numProbeDocs, numBuildDocs);
+
+    auto root = makeS<HashJoinStage>(makeScanStage(buildDocs),
+                                     makeScanStage(probeDocs, kProbeKeySlot, kProbePayloadSlot),
+                                     makeSV(kKeySlot),
+                                     makeSV(kPayloadSlot),
+                                     makeSV(kProbeKeySlot),
+                                     makeSV(kProbePayloadSlot),
+                                     boost::none /* collatorSlot */,
+                                     kEmptyPlanNodeId);
+    runBenchmark(state, root.get(), numProbeDocs, kPayloadSlot);
+}
+
+void BM_Sort(benchmark::State& state) {
+    const size_t numDocs = state.range(0);
+    const size_t memoryLimit = state.range(1);
+    auto docs = generateDocs(numDocs, numDocs);
+
+    // Spilling runs need a temporary directory to stand in for the data directory; the sorter
+    // creates its '_tmp' subdirectory underneath it on demand.
+    auto tempDir = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("sbe_stage_bm_%%%%%%%%");
+    boost::filesystem::create_directories(tempDir);
+    auto savedDbpath = std::exchange(storageGlobalParams.dbpath, tempDir.string());
+    ON_BLOCK_EXIT([&] {
+        storageGlobalParams.dbpath = std::move(savedDbpath);
+        boost::filesystem::remove_all(tempDir);
+    });
+
+    auto root = makeS<SortStage>(makeScanStage(docs),
+                                 makeSV(kKeySlot),
+                                 std::vector<value::SortDirection>{value::SortDirection::Ascending},
+                                 makeSV(kPayloadSlot),
+                                 std::numeric_limits<size_t>::max(),
+                                 memoryLimit,
+                                 true /* allowDiskUse */,
+                                 kEmptyPlanNodeId);
+    runBenchmark(state, root.get(), numDocs, kKeySlot);
+}
+
+BENCHMARK(BM_Scan)->Arg(10'000)->Arg(100'000);
+BENCHMARK(BM_FilterProject)->Arg(10'000)->Arg(100'000);
+// {number of documents, number of distinct group-by keys}.
+BENCHMARK(BM_HashAgg)
+    ->Args({100'000, 10})
+    ->Args({100'000, 1'000})
+    ->Args({100'000, 100'000});
+// {number of probe-side documents, number of build-side documents}.
+BENCHMARK(BM_HashJoin)->Args({100'000, 1'000})->Args({100'000, 100'000});
+// {number of documents, memory limit}; the 1MB limit forces the sorter to spill.
+BENCHMARK(BM_Sort)
+    ->Args({100'000, 100 * 1024 * 1024})
+    ->Args({100'000, 1024 * 1024});
+
+}  // namespace
+}  // namespace mongo::sbe
@@ -402,6 +402,76 @@ TEST(SBEVM, CompareBinData) {
     }
 }
 
+TEST(SBEVM, GetFieldImm) {
+    auto obj = BSON("field" << 42 << "other" << 1);
+
+    {
+        auto [strTag, strVal] = value::makeNewString("field"_sd);
+        value::ValueGuard strGuard{strTag, strVal};
+
+        vm::CodeFragment code;
+        code.appendConstVal(value::TypeTags::bsonObject,
+                            value::bitcastFrom<const char*>(obj.objdata()));
+        code.appendGetFieldImm(strTag, strVal);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQUALS(tag, value::TypeTags::NumberInt32);
+        ASSERT_EQUALS(value::bitcastTo<int32_t>(val), 42);
+    }
+    {
+        auto [strTag, strVal] = value::makeNewString("missing"_sd);
+        value::ValueGuard strGuard{strTag, strVal};
+
+        vm::CodeFragment code;
+        code.appendConstVal(value::TypeTags::bsonObject,
+                            value::bitcastFrom<const char*>(obj.objdata()));
+        code.appendGetFieldImm(strTag, strVal);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQUALS(tag, value::TypeTags::Nothing);
+    }
+}
+
+TEST(SBEVM, EqImm) {
+    {
+        vm::CodeFragment code;
+        code.appendConstVal(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(42));
+        code.appendEqImm(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(42));
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQUALS(tag, value::TypeTags::Boolean);
+        ASSERT_TRUE(value::bitcastTo<bool>(val));
+    }
+    {
+        vm::CodeFragment code;
+        code.appendConstVal(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(42));
+        code.appendEqImm(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(43));
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQUALS(tag, value::TypeTags::Boolean);
+        ASSERT_FALSE(value::bitcastTo<bool>(val));
+    }
+    {
+        // Nothing on the left-hand side compares as Nothing, same as the unfused 'eq'.
+        vm::CodeFragment code;
+        code.appendConstVal(value::TypeTags::Nothing, 0);
+        code.appendEqImm(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(42));
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQUALS(tag, value::TypeTags::Nothing);
+    }
+}
+
 TEST(SBEVM, ConvertBinDataToBsonObj) {
     uint8_t byteArray[] = {1, 2, 3, 4, 5, 6, 7, 8};
     auto originalBinData =
@@ -66,6 +66,7 @@ void BSONScanStage::prepare(CompileCtx& ctx) {
         uassert(4822841, str::stream() << "duplicate field: " << _fields[idx], inserted);
         auto [itRename, insertedRename] = _varAccessors.emplace(_vars[idx], it->second.get());
         uassert(4822842, str::stream() << "duplicate field: " << _vars[idx], insertedRename);
+        _fieldsBloomFilter |= bson::fieldNameBloomMask(_fields[idx]);
     }
 }
 
@@ -107,15 +108,20 @@ PlanState BSONScanStage::getNext() {
             }
             while (*be != 0) {
                 auto sv = bson::fieldNameView(be);
-                if (auto it = _fieldAccessors.find(sv); it != _fieldAccessors.end()) {
-                    // Found the field so convert it to Value.
-                    auto [tag, val] = bson::convertFrom<true>(be, end, sv.size());
-
-                    it->second->reset(tag, val);
-
-                    if ((--fieldsToMatch) == 0) {
-                        // No need to scan any further so bail out early.
-                        break;
+                // Check the Bloom filter first to avoid the hash lookup for most unrequested
+                // fields.
+                if (auto nameMask = bson::fieldNameBloomMask(sv);
+                    (_fieldsBloomFilter & nameMask) == nameMask) {
+                    if (auto it = _fieldAccessors.find(sv); it != _fieldAccessors.end()) {
+                        // Found the field so convert it to Value.
+                        auto [tag, val] = bson::convertFrom<true>(be, end, sv.size());
+
+                        it->second->reset(tag, val);
+
+                        if ((--fieldsToMatch) == 0) {
+                            // No need to scan any further so bail out early.
+                            break;
+                        }
                     }
                 }
 
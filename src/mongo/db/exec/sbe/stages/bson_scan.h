@@ -79,6 +79,10 @@ private:
     value::FieldViewAccessorMap _fieldAccessors;
     value::SlotAccessorMap _varAccessors;
 
+    // Bloom filter over '_fields' used to skip the '_fieldAccessors' lookup for most fields we are
+    // not interested in; see bson::fieldNameBloomMask().
+    uint64_t _fieldsBloomFilter{0};
+
     const char* _bsonCurrent;
 
     ScanStats _specificStats;
@@ -31,8 +31,20 @@
 
 #include "mongo/db/exec/sbe/stages/hash_agg.h"
 
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/stats/resource_consumption_metrics.h"
+#include "mongo/db/storage/storage_options.h"
 #include "mongo/util/str.h"
 
+namespace {
+std::string nextFileName() {
+    static mongo::AtomicWord<unsigned> hashAggFileCounter;
+    return "extsort-hash-agg-sbe." + std::to_string(hashAggFileCounter.fetchAndAdd(1));
+}
+}  // namespace
+
+#include "mongo/db/sorter/sorter.cpp"
+
 namespace mongo {
 namespace sbe {
 HashAggStage::HashAggStage(std::unique_ptr<PlanStage> input,
@@ -41,13 +53,18 @@ HashAggStage::HashAggStage(std::unique_ptr<PlanStage> input,
                            value::SlotVector seekKeysSlots,
                            bool optimizedClose,
                            boost::optional<value::SlotId> collatorSlot,
+                           bool allowDiskUse,
                            PlanNodeId planNodeId)
     : PlanStage("group"_sd, planNodeId),
       _gbs(std::move(gbs)),
       _aggs(std::move(aggs)),
       _collatorSlot(collatorSlot),
       _seekKeysSlots(std::move(seekKeysSlots)),
-      _optimizedClose(optimizedClose) {
+      _optimizedClose(optimizedClose),
+      _allowDiskUse(allowDiskUse),
+      _probeKey(0),
+      _recoveredRow({0, 0}),
+      _spilledNextRow({0, 0}) {
     _children.emplace_back(std::move(input));
     invariant(_seekKeysSlots.empty() || _seekKeysSlots.size() == _gbs.size());
     tassert(5843100,
@@ -55,6 +72,8 @@ HashAggStage::HashAggStage(std::unique_ptr<PlanStage> input,
             _seekKeysSlots.empty() || _optimizedClose);
 }
 
+HashAggStage::~HashAggStage() {}
+
 std::unique_ptr<PlanStage> HashAggStage::clone() const {
     value::SlotMap<std::unique_ptr<EExpression>> aggs;
     for (auto& [k, v] : _aggs) {
@@ -66,9 +85,44 @@ std::unique_ptr<PlanStage> HashAggStage::clone() const {
                                           _seekKeysSlots,
                                           _optimizedClose,
                                           _collatorSlot,
+                                          _allowDiskUse,
                                           _commonStats.nodeId);
 }
 
+std::unique_ptr<vm::CodeFragment> HashAggStage::makeMergeCode(const EExpression* expr,
+                                                              size_t counter) {
+    // Partial states of the value-at-a-time instruction aggregates can be folded together simply
+    // by re-running the same aggregate instruction with one partial state as the accumulator and
+    // the other as the input: a sum of partial sums, a min of partial mins and so on. Aggregates
+    // whose state is a container (addToArray, addToSet, doubleDoubleSum, ...) would treat the
+    // other state as a single input value, so they have no fold here and inhibit spilling.
+    auto fn = dynamic_cast<const EFunction*>(expr);
+    if (!fn) {
+        return nullptr;
+    }
+
+    void (vm::CodeFragment::*appendAgg)() = nullptr;
+    if (fn->name() == "sum") {
+        appendAgg = &vm::CodeFragment::appendSum;
+    } else if (fn->name() == "min") {
+        appendAgg = &vm::CodeFragment::appendMin;
+    } else if (fn->name() == "max") {
+        appendAgg = &vm::CodeFragment::appendMax;
+    } else if (fn->name() == "first") {
+        appendAgg = &vm::CodeFragment::appendFirst;
+    } else if (fn->name() == "last") {
+        appendAgg = &vm::CodeFragment::appendLast;
+    } else {
+        return nullptr;
+    }
+
+    auto code = std::make_unique<vm::CodeFragment>();
+    code->appendAccessVal(_spillAggAccessors[counter].get());
+    code->appendAccessVal(_spillNextAggAccessors[counter].get());
+    (*code.*appendAgg)();
+    return code;
+}
+
 void HashAggStage::prepare(CompileCtx& ctx) {
     _children[0]->prepare(ctx);
 
@@ -87,8 +141,14 @@ void HashAggStage::prepare(CompileCtx& ctx) {
         uassert(4822827, str::stream() << "duplicate field: " << slot, inserted);
 
         _inKeyAccessors.emplace_back(_children[0]->getAccessor(ctx, slot));
-        _outKeyAccessors.emplace_back(std::make_unique<HashKeyAccessor>(_htIt, counter++));
-        _outAccessors[slot] = _outKeyAccessors.back().get();
+        _outKeyAccessors.emplace_back(std::make_unique<HashKeyAccessor>(_htIt, counter));
+        _spillKeyAccessors.emplace_back(std::make_unique<SpillKeyAccessor>(_recoveredRowIt,
+                                                                           counter));
+        _outSwitchAccessors.emplace_back(
+            std::make_unique<value::SwitchAccessor>(std::vector<value::SlotAccessor*>{
+                _outKeyAccessors.back().get(), _spillKeyAccessors.back().get()}));
+        ++counter;
+        _outAccessors[slot] = _outSwitchAccessors.back().get();
     }
 
     // Process seek keys (if any). The keys must come from outside of the subtree (by definition) so
@@ -97,6 +157,9 @@ void HashAggStage::prepare(CompileCtx& ctx) {
         _seekKeysAccessors.emplace_back(ctx.getAccessor(slot));
     }
 
+    // Spilling is only engaged when every aggregate's partial states can be folded back together.
+    bool allAggsFoldable = _allowDiskUse && _seekKeysSlots.empty();
+
     counter = 0;
     for (auto& [slot, expr] : _aggs) {
         auto [it, inserted] = dupCheck.emplace(slot);
@@ -106,8 +169,15 @@ void HashAggStage::prepare(CompileCtx& ctx) {
         const auto slotId = slot;
         uassert(4822828, str::stream() << "duplicate field: " << slotId, inserted);
 
-        _outAggAccessors.emplace_back(std::make_unique<HashAggAccessor>(_htIt, counter++));
-        _outAccessors[slot] = _outAggAccessors.back().get();
+        _outAggAccessors.emplace_back(std::make_unique<HashAggAccessor>(_htIt, counter));
+        _spillAggAccessors.emplace_back(std::make_unique<SpillAggAccessor>(_recoveredRowIt,
+                                                                           counter));
+        _spillNextAggAccessors.emplace_back(std::make_unique<SpillAggAccessor>(_spilledNextRowIt,
+                                                                               counter));
+        _outSwitchAccessors.emplace_back(
+            std::make_unique<value::SwitchAccessor>(std::vector<value::SlotAccessor*>{
+                _outAggAccessors.back().get(), _spillAggAccessors.back().get()}));
+        _outAccessors[slot] = _outSwitchAccessors.back().get();
 
         ctx.root = this;
         ctx.aggExpression = true;
@@ -115,7 +185,22 @@ void HashAggStage::prepare(CompileCtx& ctx) {
 
         _aggCodes.emplace_back(expr->compile(ctx));
         ctx.aggExpression = false;
+
+        if (allAggsFoldable) {
+            if (auto mergeCode = makeMergeCode(expr.get(), counter)) {
+                _mergeCodes.emplace_back(std::move(mergeCode));
+            } else {
+                allAggsFoldable = false;
+            }
+        }
+        ++counter;
+    }
+
+    _spillable = allAggsFoldable;
+    if (!_spillable) {
+        _mergeCodes.clear();
     }
+
     _compiled = true;
 }
 
@@ -131,6 +216,79 @@ value::SlotAccessor* HashAggStage::getAccessor(CompileCtx& ctx, value::SlotId sl
     return ctx.getAccessor(slot);
 }
 
+void HashAggStage::makeSorter() {
+    SortOptions opts;
+    opts.tempDir = storageGlobalParams.dbpath + "/_tmp";
+    opts.maxMemoryUsageBytes = _memoryLimit;
+    opts.extSortAllowed = true;
+    opts.moveSortedDataIntoIterator = true;
+
+    // Runs with equal keys must come out adjacent from the merge iterator, so the comparator has
+    // to use the same notion of equality as the hash table, i.e. it must be collation aware.
+    auto comp = [this](const SorterData& lhs, const SorterData& rhs) {
+        auto size = lhs.first.size();
+        auto& left = lhs.first;
+        auto& right = rhs.first;
+        for (size_t idx = 0; idx < size; ++idx) {
+            auto [lhsTag, lhsVal] = left.getViewOfValue(idx);
+            auto [rhsTag, rhsVal] = right.getViewOfValue(idx);
+            auto [tag, val] = value::compareValue(lhsTag, lhsVal, rhsTag, rhsVal, _collator);
+
+            auto result = value::bitcastTo<int32_t>(val);
+            if (result) {
+                return result;
+            }
+        }
+
+        return 0;
+    };
+
+    _sorter.reset(Sorter<value::MaterializedRow, value::MaterializedRow>::make(opts, comp, {}));
+}
+
+void HashAggStage::spill() {
+    if (!_sorter) {
+        makeSorter();
+    }
+
+    for (auto it = _ht->begin(); it != _ht->end(); ++it) {
+        _sorter->emplace(std::move(const_cast<value::MaterializedRow&>(it->first)),
+                         std::move(it->second));
+    }
+    _ht->clear();
+    _htApproxMemUsage = 0;
+    ++_spills;
+}
+
+PlanState HashAggStage::getNextSpilled() {
+    if (!_stashedNextRow) {
+        if (!_mergeIt->more()) {
+            return trackPlanState(PlanState::IS_EOF);
+        }
+        _stashedNextRow = _mergeIt->next();
+    }
+    _recoveredRow = std::move(*_stashedNextRow);
+    _stashedNextRow = boost::none;
+
+    // Fold all subsequent partial states with the same key into '_recoveredRow'. The first row
+    // carrying a different key starts the next group and is stashed for the following call.
+    while (_mergeIt->more()) {
+        auto next = _mergeIt->next();
+        if (!(*_rowEq)(_recoveredRow.first, next.first)) {
+            _stashedNextRow = std::move(next);
+            break;
+        }
+
+        _spilledNextRow = std::move(next);
+        for (size_t idx = 0; idx < _mergeCodes.size(); ++idx) {
+            auto [owned, tag, val] = _bytecode.run(_mergeCodes[idx].get());
+            _spillAggAccessors[idx]->reset(owned, tag, val);
+        }
+    }
+
+    return trackPlanState(PlanState::ADVANCED);
+}
+
 void HashAggStage::open(bool reOpen) {
     auto optTimer(getOptTimer(_opCtx));
 
@@ -148,35 +306,82 @@ void HashAggStage::open(bool reOpen) {
             const value::MaterializedRowHasher hasher(collatorView);
             const value::MaterializedRowEq equator(collatorView);
             _ht.emplace(0, hasher, equator);
+            _collator = collatorView;
         } else {
             _ht.emplace();
+            _collator = nullptr;
         }
 
+        // Reset any state left over from a previous open when spilling was engaged.
+        _sorter.reset();
+        _mergeIt.reset();
+        _stashedNextRow = boost::none;
+        _spilled = false;
+        _htApproxMemUsage = 0;
+        _rowEq.emplace(_collator);
+        for (auto& accessor : _outSwitchAccessors) {
+            accessor->setIndex(0);
+        }
+        _memoryLimit = internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.load();
+
         _seekKeys.resize(_seekKeysAccessors.size());
+        _probeKey.resize(_inKeyAccessors.size());
 
         while (_children[0]->getNext() == PlanState::ADVANCED) {
-            value::MaterializedRow key{_inKeyAccessors.size()};
             // Copy keys in order to do the lookup.
             size_t idx = 0;
             for (auto& p : _inKeyAccessors) {
                 auto [tag, val] = p->getViewOfValue();
-                key.reset(idx++, false, tag, val);
+                _probeKey.reset(idx++, false, tag, val);
             }
 
-            auto [it, inserted] = _ht->try_emplace(std::move(key), value::MaterializedRow{0});
+            // On a hit '_probeKey' is left untouched and can be reused for the next input row; it
+            // is only consumed when the lookup starts a new group.
+            auto [it, inserted] = _ht->try_emplace(std::move(_probeKey), value::MaterializedRow{0});
             if (inserted) {
                 // Copy keys.
                 const_cast<value::MaterializedRow&>(it->first).makeOwned();
                 // Initialize accumulators.
                 it->second.resize(_outAggAccessors.size());
+                _probeKey.resize(_inKeyAccessors.size());
+
+                if (_spillable) {
+                    _htApproxMemUsage +=
+                        it->first.memUsageForSorter() + sizeof(TableType::value_type);
+                }
             }
 
             // Accumulate.
             _htIt = it;
+            size_t aggMemUsageBefore = 0;
+            if (_spillable && !inserted) {
+                aggMemUsageBefore = _htIt->second.memUsageForSorter();
+            }
             for (size_t idx = 0; idx < _outAggAccessors.size(); ++idx) {
                 auto [owned, tag, val] = _bytecode.run(_aggCodes[idx].get());
                 _outAggAccessors[idx]->reset(owned, tag, val);
             }
+
+            if (_spillable) {
+                _htApproxMemUsage += _htIt->second.memUsageForSorter() - aggMemUsageBefore;
+                if (_htApproxMemUsage > _memoryLimit) {
+                    spill();
+                }
+            }
+        }
+
+        if (_sorter) {
+            // Some of the table was spilled. Spill the rest and return the aggregated output by
+            // merging the spilled runs instead of reading the table.
+            spill();
+            _mergeIt.reset(_sorter->done());
+            _spilled = true;
+            for (auto& accessor : _outSwitchAccessors) {
+                accessor->setIndex(1);
+            }
+
+            auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
+            metricsCollector.incrementSorterSpills(_sorter->numSpills());
         }
 
         if (_optimizedClose) {
@@ -200,6 +405,10 @@ void HashAggStage::open(bool reOpen) {
 PlanState HashAggStage::getNext() {
     auto optTimer(getOptTimer(_opCtx));
 
+    if (_spilled) {
+        return getNextSpilled();
+    }
+
     if (_htIt == _ht->end()) {
         // First invocation of getNext() after open().
         if (!_seekKeysAccessors.empty()) {
@@ -235,6 +444,8 @@ std::unique_ptr<PlanStageStats> HashAggStage::getStats(bool includeDebugInfo) co
                 childrenBob.append(str::stream() << slot, printer.print(expr->debugPrint()));
             }
         }
+        bob.appendBool("usedDisk", _spilled);
+        bob.appendNumber("spills", static_cast<long long>(_spills));
         ret->debugInfo = bob.obj();
     }
 
@@ -252,6 +463,12 @@ void HashAggStage::close() {
     trackClose();
     _ht = boost::none;
 
+    _sorter.reset();
+    _mergeIt.reset();
+    _stashedNextRow = boost::none;
+    _spilled = false;
+    _htApproxMemUsage = 0;
+
     if (_childOpened) {
         _children[0]->close();
         _childOpened = false;
@@ -36,6 +36,13 @@
 #include "mongo/db/exec/sbe/vm/vm.h"
 #include "mongo/stdx/unordered_map.h"
 
+namespace mongo {
+template <typename Key, typename Value>
+class SortIteratorInterface;
+template <typename Key, typename Value>
+class Sorter;
+}  // namespace mongo
+
 namespace mongo {
 namespace sbe {
 /**
@@ -59,6 +66,15 @@ namespace sbe {
  * determining whether two group-by keys are equal. For instance, the plan may require us to do a
  * case-insensitive group on a string field.
  *
+ * If 'allowDiskUse' is true and the estimated size of the hash table exceeds the memory budget
+ * given by the 'internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill' knob, the partially
+ * aggregated table contents are flushed into a 'Sorter' keyed by the group-by row and the table is
+ * rebuilt from scratch. After the input is exhausted, runs of spilled rows with equal keys are
+ * merged back together by folding each aggregate's partial states into one another. Spilling is
+ * only engaged when every aggregate expression has such a fold (currently the sum/min/max/
+ * first/last instruction aggregates) and no seek keys are provided; otherwise the stage falls back
+ * to fully in-memory aggregation.
+ *
  * Debug string representation:
  *
  *  group [<group by slots>] [slot_1 = expr_1, ..., slot_n = expr_n] [<seek slots>]? reopen?
@@ -72,8 +88,11 @@ public:
                  value::SlotVector seekKeysSlots,
                  bool optimizedClose,
                  boost::optional<value::SlotId> collatorSlot,
+                 bool allowDiskUse,
                  PlanNodeId planNodeId);
 
+    ~HashAggStage();
+
     std::unique_ptr<PlanStage> clone() const final;
 
     void prepare(CompileCtx& ctx) final;
@@ -95,6 +114,28 @@ private:
     using HashKeyAccessor = value::MaterializedRowKeyAccessor<TableType::iterator>;
     using HashAggAccessor = value::MaterializedRowValueAccessor<TableType::iterator>;
 
+    using SorterIterator = SortIteratorInterface<value::MaterializedRow, value::MaterializedRow>;
+    using SorterData = std::pair<value::MaterializedRow, value::MaterializedRow>;
+
+    using SpillKeyAccessor = value::MaterializedRowKeyAccessor<SorterData*>;
+    using SpillAggAccessor = value::MaterializedRowValueAccessor<SorterData*>;
+
+    /**
+     * Assembles the bytecode which folds a spilled partial aggregate state into the current merged
+     * state for the given aggregate expression, or returns nullptr if the aggregate has no such
+     * fold and therefore inhibits spilling.
+     */
+    std::unique_ptr<vm::CodeFragment> makeMergeCode(const EExpression* expr, size_t counter);
+
+    void makeSorter();
+
+    /**
+     * Moves the entire contents of the hash table into the sorter and clears the table.
+     */
+    void spill();
+
+    PlanState getNextSpilled();
+
     const value::SlotVector _gbs;
     const value::SlotMap<std::unique_ptr<EExpression>> _aggs;
     const boost::optional<value::SlotId> _collatorSlot;
@@ -102,6 +143,7 @@ private:
     // When this operator does not expect to be reopened (almost always) then it can close the child
     // early.
     const bool _optimizedClose{true};
+    const bool _allowDiskUse{false};
 
     value::SlotAccessorMap _outAccessors;
     std::vector<value::SlotAccessor*> _inKeyAccessors;
@@ -110,6 +152,10 @@ private:
     std::vector<value::SlotAccessor*> _seekKeysAccessors;
     value::MaterializedRow _seekKeys;
 
+    // Key row reused to look up every input row; it only gets consumed (and reallocated) when the
+    // lookup inserts a new group.
+    value::MaterializedRow _probeKey;
+
     std::vector<std::unique_ptr<HashAggAccessor>> _outAggAccessors;
     std::vector<std::unique_ptr<vm::CodeFragment>> _aggCodes;
 
@@ -119,6 +165,37 @@ private:
     boost::optional<TableType> _ht;
     TableType::iterator _htIt;
 
+    // The rest of the output machinery exists to support spilling. The results visible through
+    // '_outAccessors' are switched between the hash table accessors above and accessors over the
+    // current merged spilled row, '_recoveredRow'.
+    std::vector<std::unique_ptr<SpillKeyAccessor>> _spillKeyAccessors;
+    std::vector<std::unique_ptr<SpillAggAccessor>> _spillAggAccessors;
+    std::vector<std::unique_ptr<SpillAggAccessor>> _spillNextAggAccessors;
+    std::vector<std::unique_ptr<value::SwitchAccessor>> _outSwitchAccessors;
+
+    // Bytecode folding a partial aggregate state from '_spilledNextRow' into '_recoveredRow',
+    // aligned with '_outAggAccessors'. Non-empty only when every aggregate is foldable.
+    std::vector<std::unique_ptr<vm::CodeFragment>> _mergeCodes;
+
+    // True when the stage is allowed to spill: disk use is enabled, all aggregates are foldable
+    // and there are no seek keys.
+    bool _spillable{false};
+
+    std::unique_ptr<Sorter<value::MaterializedRow, value::MaterializedRow>> _sorter;
+    std::unique_ptr<SorterIterator> _mergeIt;
+    SorterData _recoveredRow;
+    SorterData* _recoveredRowIt{&_recoveredRow};
+    SorterData _spilledNextRow;
+    SorterData* _spilledNextRowIt{&_spilledNextRow};
+    boost::optional<SorterData> _stashedNextRow;
+    boost::optional<value::MaterializedRowEq> _rowEq;
+    CollatorInterface* _collator{nullptr};
+
+    size_t _htApproxMemUsage{0};
+    size_t _memoryLimit{0};
+    size_t _spills{0};
+    bool _spilled{false};
+
     vm::ByteCode _bytecode;
 
     bool _compiled{false};
@@ -70,6 +70,30 @@ std::unique_ptr<PlanStage> HashJoinStage::clone() const {
                                            _commonStats.nodeId);
 }
 
+void HashJoinStage::buildBloomFilter() {
+    // About 8 bits per key with two probes gives a false positive rate of a few percent. The size
+    // is rounded up to a power of two so a bit position is just a mask of the hash, and capped at
+    // 8MB so the filter stays cache and TLB friendly even for huge builds.
+    constexpr size_t kBitsPerKey = 8;
+    constexpr uint64_t kMinBits = 1024;
+    constexpr uint64_t kMaxBits = uint64_t{1} << 26;
+
+    uint64_t bits = kMinBits;
+    while (bits < _ht->size() * kBitsPerKey && bits < kMaxBits) {
+        bits <<= 1;
+    }
+
+    _bloomFilter.assign(bits / 64, 0);
+    _bloomFilterMask = bits - 1;
+
+    for (auto&& [key, project] : *_ht) {
+        auto hash = (*_hasher)(key);
+        _bloomFilter[(hash & _bloomFilterMask) >> 6] |= uint64_t{1} << (hash & 63);
+        auto pos = (hash >> 32) & _bloomFilterMask;
+        _bloomFilter[pos >> 6] |= uint64_t{1} << (pos & 63);
+    }
+}
+
 void HashJoinStage::prepare(CompileCtx& ctx) {
     _children[0]->prepare(ctx);
     _children[1]->prepare(ctx);
@@ -138,8 +162,10 @@ void HashJoinStage::open(bool reOpen) {
         const value::MaterializedRowHasher hasher(collatorView);
         const value::MaterializedRowEq equator(collatorView);
         _ht.emplace(0, hasher, equator);
+        _hasher.emplace(collatorView);
     } else {
         _ht.emplace();
+        _hasher.emplace();
     }
 
     _commonStats.opens++;
@@ -168,6 +194,8 @@ void HashJoinStage::open(bool reOpen) {
 
     _children[0]->close();
 
+    buildBloomFilter();
+
     _children[1]->open(reOpen);
 
     _htIt = _ht->end();
@@ -196,6 +224,12 @@ PlanState HashJoinStage::getNext() {
                 _probeKey.reset(idx++, false, tag, val);
             }
 
+            // Consult the Bloom filter first; a miss proves there is no match so the hash table
+            // probe can be skipped entirely.
+            if (!bloomFilterMayContain((*_hasher)(_probeKey))) {
+                continue;
+            }
+
             auto [low, hi] = _ht->equal_range(_probeKey);
             _htIt = low;
             _htItEnd = hi;
@@ -213,6 +247,8 @@ void HashJoinStage::close() {
     trackClose();
     _children[1]->close();
     _ht = boost::none;
+    _bloomFilter.clear();
+    _bloomFilterMask = 0;
 }
 
 std::unique_ptr<PlanStageStats> HashJoinStage::getStats(bool includeDebugInfo) const {
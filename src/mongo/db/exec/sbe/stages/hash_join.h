@@ -89,6 +89,20 @@ private:
     using HashKeyAccessor = value::MaterializedRowKeyAccessor<TableType::iterator>;
     using HashProjectAccessor = value::MaterializedRowValueAccessor<TableType::iterator>;
 
+    /**
+     * Populates '_bloomFilter' with the hashes of all keys in '_ht'. Called once the build side
+     * has been fully consumed.
+     */
+    void buildBloomFilter();
+
+    bool bloomFilterMayContain(size_t hash) const {
+        auto testBit = [&](uint64_t pos) {
+            return (_bloomFilter[pos >> 6] & (uint64_t{1} << (pos & 63))) != 0;
+        };
+        // Two probes derived from the two halves of the key hash.
+        return testBit(hash & _bloomFilterMask) && testBit((hash >> 32) & _bloomFilterMask);
+    }
+
     const value::SlotVector _outerCond;
     const value::SlotVector _outerProjects;
     const value::SlotVector _innerCond;
@@ -123,6 +137,15 @@ private:
     TableType::iterator _htIt;
     TableType::iterator _htItEnd;
 
+    // Compact Bloom filter over the hashes of the keys in '_ht', consulted before every probe. A
+    // negative answer is definite, so the common non-matching probe costs two bit tests in a small
+    // cache-resident array instead of a walk over a hash table bucket.
+    std::vector<uint64_t> _bloomFilter;
+    uint64_t _bloomFilterMask{0};
+
+    // Hasher matching the one used by '_ht'; set when the table is created in open().
+    boost::optional<value::MaterializedRowHasher> _hasher;
+
     vm::ByteCode _bytecode;
 
     bool _compiled{false};
@@ -95,6 +95,9 @@ void MakeObjStageBase<O>::prepare(CompileCtx& ctx) {
         _projects.emplace_back(p, _children[0]->getAccessor(ctx, _projectVars[idx]));
     }
 
+    _rootPassthrough = _rootSlot && *_fieldBehavior == FieldBehavior::drop &&
+        _allFieldsMap.empty() && _projects.empty();
+
     _compiled = true;
 }
 
@@ -136,6 +139,15 @@ void MakeObjStageBase<O>::open(bool reOpen) {
 
 template <>
 void MakeObjStageBase<MakeObjOutputType::object>::produceObject() {
+    // Structural sharing fast path: every root field is passed through unchanged and there is
+    // nothing to add, so an Object root can be returned as is without copying its fields.
+    if (_rootPassthrough) {
+        if (auto [tag, val] = _root->getViewOfValue(); tag == value::TypeTags::Object) {
+            _obj.reset(false, tag, val);
+            return;
+        }
+    }
+
     auto [tag, val] = value::makeNewObject();
     auto obj = value::getObjectView(val);
 
@@ -246,10 +258,30 @@ void MakeObjStageBase<MakeObjOutputType::bsonObject>::produceObject() {
 
         size_t nFieldsNeededIfInclusion = _fields.size();
         if (tag == value::TypeTags::bsonObject) {
+            // Structural sharing fast path: every root field is passed through unchanged and there
+            // is nothing to add, so the output is the input document and no bytes need to move.
+            if (_rootPassthrough) {
+                _obj.reset(false, tag, val);
+                return;
+            }
+
             if (!(nFieldsNeededIfInclusion == 0 && _fieldBehavior == FieldBehavior::keep)) {
                 auto be = value::bitcastTo<const char*>(val);
                 // Skip document length.
                 be += 4;
+
+                // Rather than appending retained fields one element at a time, maximal runs of
+                // consecutive retained fields are spliced from the root document with a single
+                // buffer copy each. Projections that keep most of the document this way copy a
+                // handful of large spans instead of one span per field.
+                const char* runBegin = nullptr;
+                auto flushRun = [&](const char* runEnd) {
+                    if (runBegin) {
+                        bob.bb().appendBuf(runBegin, runEnd - runBegin);
+                        runBegin = nullptr;
+                    }
+                };
+
                 while (*be != 0) {
                     auto sv = bson::fieldNameView(be);
                     auto key = StringMapHasher{}.hashed_key(StringData(sv));
@@ -257,17 +289,21 @@ void MakeObjStageBase<MakeObjOutputType::bsonObject>::produceObject() {
                     auto nextBe = bson::advance(be, sv.size());
 
                     if (!isFieldProjectedOrRestricted(key)) {
-                        bob.append(BSONElement(
-                            be, sv.size() + 1, nextBe - be, BSONElement::CachedSizeTag{}));
+                        if (!runBegin) {
+                            runBegin = be;
+                        }
                         --nFieldsNeededIfInclusion;
+                    } else {
+                        flushRun(be);
                     }
 
+                    be = nextBe;
+
                     if (nFieldsNeededIfInclusion == 0 && _fieldBehavior == FieldBehavior::keep) {
                         break;
                     }
-
-                    be = nextBe;
                 }
+                flushRun(be);
             }
         } else if (tag == value::TypeTags::Object) {
             if (!(nFieldsNeededIfInclusion == 0 && _fieldBehavior == FieldBehavior::keep)) {
@@ -140,6 +140,11 @@ private:
 
     StringMap<size_t> _allFieldsMap;
 
+    // Set during prepare() when the stage provably copies every root field through unchanged and
+    // computes nothing, i.e. 'drop' behavior with no fields to drop and no projected fields. A
+    // bsonObject root can then be passed through without rebuilding it.
+    bool _rootPassthrough{false};
+
     std::vector<std::pair<std::string, value::SlotAccessor*>> _projects;
 
     value::OwnedValueAccessor _obj;
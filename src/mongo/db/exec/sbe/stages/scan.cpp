@@ -39,6 +39,19 @@
 
 namespace mongo {
 namespace sbe {
+namespace {
+// Tuning of the parallel scan morsel scheduler. A scanner claims one range at a time, so the
+// number of records in a range bounds how long an otherwise idle scanner may wait for a straggler
+// to finish its current range.
+constexpr size_t kMinRecordsPerRange = 10240;
+constexpr size_t kMaxRanges = 4096;
+
+// How many random split point candidates to draw per range. The gaps between consecutive samples
+// of a random cursor vary wildly, so carving a range per sample produces ranges of very uneven
+// size. Summing several gaps per range evens the sizes out.
+constexpr size_t kSplitPointOversample = 8;
+}  // namespace
+
 ScanStage::ScanStage(CollectionUUID collectionUuid,
                      boost::optional<value::SlotId> recordSlot,
                      boost::optional<value::SlotId> recordIdSlot,
@@ -110,6 +123,7 @@ void ScanStage::prepare(CompileCtx& ctx) {
         uassert(4822814, str::stream() << "duplicate field: " << _fields[idx], inserted);
         auto [itRename, insertedRename] = _varAccessors.emplace(_vars[idx], it->second.get());
         uassert(4822815, str::stream() << "duplicate field: " << _vars[idx], insertedRename);
+        _fieldsBloomFilter |= bson::fieldNameBloomMask(_fields[idx]);
     }
 
     if (_seekKeySlot) {
@@ -334,20 +348,24 @@ PlanState ScanStage::getNext() {
         }
         while (*be != 0) {
             auto sv = bson::fieldNameView(be);
-            if (auto it = _fieldAccessors.find(sv); it != _fieldAccessors.end()) {
-                // Found the field so convert it to Value.
-                auto [tag, val] = bson::convertFrom<true>(be, end, sv.size());
-
-                if (_oplogTsAccessor && it->first == repl::OpTime::kTimestampFieldName) {
-                    auto&& [ownedTag, ownedVal] = value::copyValue(tag, val);
-                    _oplogTsAccessor->reset(false, ownedTag, ownedVal);
-                }
+            // Check the Bloom filter first to avoid the hash lookup for most unrequested fields.
+            if (auto nameMask = bson::fieldNameBloomMask(sv);
+                (_fieldsBloomFilter & nameMask) == nameMask) {
+                if (auto it = _fieldAccessors.find(sv); it != _fieldAccessors.end()) {
+                    // Found the field so convert it to Value.
+                    auto [tag, val] = bson::convertFrom<true>(be, end, sv.size());
+
+                    if (_oplogTsAccessor && it->first == repl::OpTime::kTimestampFieldName) {
+                        auto&& [ownedTag, ownedVal] = value::copyValue(tag, val);
+                        _oplogTsAccessor->reset(false, ownedTag, ownedVal);
+                    }
 
-                it->second->reset(false, tag, val);
+                    it->second->reset(false, tag, val);
 
-                if ((--fieldsToMatch) == 0) {
-                    // No need to scan any further so bail out early.
-                    break;
+                    if ((--fieldsToMatch) == 0) {
+                        // No need to scan any further so bail out early.
+                        break;
+                    }
                 }
             }
 
@@ -570,6 +588,7 @@ void ParallelScanStage::prepare(CompileCtx& ctx) {
         uassert(4822816, str::stream() << "duplicate field: " << _fields[idx], inserted);
         auto [itRename, insertedRename] = _varAccessors.emplace(_vars[idx], it->second.get());
         uassert(4822817, str::stream() << "duplicate field: " << _vars[idx], insertedRename);
+        _fieldsBloomFilter |= bson::fieldNameBloomMask(_fields[idx]);
     }
 
     if (_snapshotIdSlot) {
@@ -680,26 +699,34 @@ void ParallelScanStage::open(bool reOpen) {
         {
             stdx::unique_lock lock(_state->mutex);
             if (_state->ranges.empty()) {
-                auto ranges = _coll->getRecordStore()->numRecords(_opCtx) / 10240;
+                auto ranges = static_cast<size_t>(_coll->getRecordStore()->numRecords(_opCtx)) /
+                    kMinRecordsPerRange;
                 if (ranges < 2) {
                     _state->ranges.emplace_back(Range{RecordId{}, RecordId{}});
                 } else {
-                    if (ranges > 1024) {
-                        ranges = 1024;
+                    if (ranges > kMaxRanges) {
+                        ranges = kMaxRanges;
                     }
+                    auto samples = ranges * kSplitPointOversample;
                     auto randomCursor = _coll->getRecordStore()->getRandomCursor(_opCtx);
                     invariant(randomCursor);
                     std::set<RecordId> rids;
-                    while (ranges--) {
+                    while (samples--) {
                         auto nextRecord = randomCursor->next();
                         if (nextRecord) {
                             rids.emplace(nextRecord->id);
                         }
                     }
+                    // Use every n-th sample as a range boundary so that every range covers roughly
+                    // the same number of records; one oversized range at the end of the scan would
+                    // otherwise serialize its tail.
                     RecordId lastid{};
+                    size_t idx = 0;
                     for (auto id : rids) {
-                        _state->ranges.emplace_back(Range{lastid, id});
-                        lastid = id;
+                        if (++idx % kSplitPointOversample == 0) {
+                            _state->ranges.emplace_back(Range{lastid, id});
+                            lastid = id;
+                        }
                     }
                     _state->ranges.emplace_back(Range{lastid, RecordId{}});
                 }
@@ -801,15 +828,19 @@ PlanState ParallelScanStage::getNext() {
         }
         while (*be != 0) {
             auto sv = bson::fieldNameView(be);
-            if (auto it = _fieldAccessors.find(sv); it != _fieldAccessors.end()) {
-                // Found the field so convert it to Value.
-                auto [tag, val] = bson::convertFrom<true>(be, end, sv.size());
-
-                it->second->reset(false, tag, val);
-
-                if ((--fieldsToMatch) == 0) {
-                    // No need to scan any further so bail out early.
-                    break;
+            // Check the Bloom filter first to avoid the hash lookup for most unrequested fields.
+            if (auto nameMask = bson::fieldNameBloomMask(sv);
+                (_fieldsBloomFilter & nameMask) == nameMask) {
+                if (auto it = _fieldAccessors.find(sv); it != _fieldAccessors.end()) {
+                    // Found the field so convert it to Value.
+                    auto [tag, val] = bson::convertFrom<true>(be, end, sv.size());
+
+                    it->second->reset(false, tag, val);
+
+                    if ((--fieldsToMatch) == 0) {
+                        // No need to scan any further so bail out early.
+                        break;
+                    }
                 }
             }
 
@@ -167,6 +167,10 @@ private:
 
     value::FieldAccessorMap _fieldAccessors;
     value::SlotAccessorMap _varAccessors;
+
+    // Bloom filter over '_fields' used to skip the '_fieldAccessors' lookup for most fields we are
+    // not interested in; see bson::fieldNameBloomMask().
+    uint64_t _fieldsBloomFilter{0};
     value::SlotAccessor* _seekKeyAccessor{nullptr};
 
     bool _open{false};
@@ -178,6 +182,15 @@ private:
     ScanStats _specificStats;
 };
 
+/**
+ * Scans a collection in parallel with sibling clones of itself, e.g. underneath the producers of an
+ * exchange. The record store is carved up front into many small ranges ("morsels") which are kept
+ * in the shared 'ParallelState'. Scanners do not own any particular range; instead each one
+ * repeatedly claims the next unclaimed range via an atomic counter and scans it to completion, so
+ * an idle scanner automatically takes over work that would otherwise queue up behind a slower
+ * sibling. For that self-scheduling to absorb skew there must be many more ranges than scanners
+ * and the ranges must be of comparable size; see 'open()' for how the ranges are computed.
+ */
 class ParallelScanStage final : public PlanStage {
     struct Range {
         RecordId begin;
@@ -275,6 +288,10 @@ private:
     value::FieldAccessorMap _fieldAccessors;
     value::SlotAccessorMap _varAccessors;
 
+    // Bloom filter over '_fields' used to skip the '_fieldAccessors' lookup for most fields we are
+    // not interested in; see bson::fieldNameBloomMask().
+    uint64_t _fieldsBloomFilter{0};
+
     size_t _currentRange{std::numeric_limits<std::size_t>::max()};
     Range _range;
 
@@ -32,8 +32,10 @@
 #include "mongo/db/exec/sbe/stages/sort.h"
 
 #include "mongo/db/exec/sbe/expressions/expression.h"
+#include "mongo/db/exec/sbe/values/bson.h"
 #include "mongo/db/exec/trial_run_tracker.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/util/str.h"
 
 namespace {
@@ -47,6 +49,71 @@ std::string nextFileName() {
 
 namespace mongo {
 namespace sbe {
+namespace {
+/**
+ * Returns true if values of the given type can be encoded into a KeyString buffer whose byte-wise
+ * ordering is identical to the ordering implemented by value::compareValue(). Objects are notably
+ * absent: compareValue() orders their fields name-first while KeyString orders them type-first.
+ * Likewise excluded are CodeWScope (its scope is an object), ArraySet (its elements have no
+ * deterministic order) and the SBE-specific tags which either have no BSON image or order
+ * differently from it. Note that cross-representation numeric comparisons in compareValue() can
+ * lose precision and declare distinct values equal where KeyString orders them exactly; the fast
+ * path then merely refines a tie, which any sort order is free to do.
+ */
+bool isKeyStringComparable(value::TypeTags tag, value::Value val) {
+    switch (tag) {
+        case value::TypeTags::Nothing:
+        case value::TypeTags::NumberInt32:
+        case value::TypeTags::NumberInt64:
+        case value::TypeTags::NumberDouble:
+        case value::TypeTags::NumberDecimal:
+        case value::TypeTags::Date:
+        case value::TypeTags::Timestamp:
+        case value::TypeTags::Boolean:
+        case value::TypeTags::Null:
+        case value::TypeTags::StringSmall:
+        case value::TypeTags::StringBig:
+        case value::TypeTags::bsonString:
+        case value::TypeTags::bsonSymbol:
+        case value::TypeTags::ObjectId:
+        case value::TypeTags::bsonObjectId:
+        case value::TypeTags::bsonBinData:
+        case value::TypeTags::bsonUndefined:
+        case value::TypeTags::bsonRegex:
+        case value::TypeTags::bsonJavascript:
+        case value::TypeTags::bsonDBPointer:
+        case value::TypeTags::MinKey:
+        case value::TypeTags::MaxKey:
+            return true;
+        case value::TypeTags::Array:
+        case value::TypeTags::bsonArray: {
+            for (value::ArrayEnumerator enumerator{tag, val}; !enumerator.atEnd();
+                 enumerator.advance()) {
+                auto [elemTag, elemVal] = enumerator.getViewOfValue();
+                if (!isKeyStringComparable(elemTag, elemVal)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+boost::optional<Ordering> makeOrdering(const std::vector<value::SortDirection>& dirs) {
+    if (dirs.size() > Ordering::kMaxCompoundIndexKeys) {
+        return boost::none;
+    }
+
+    BSONObjBuilder bob;
+    for (auto dir : dirs) {
+        bob.append(""_sd, dir == value::SortDirection::Ascending ? 1 : -1);
+    }
+    return Ordering::make(bob.done());
+}
+}  // namespace
+
 SortStage::SortStage(std::unique_ptr<PlanStage> input,
                      value::SlotVector obs,
                      std::vector<value::SortDirection> dirs,
@@ -60,6 +127,7 @@ SortStage::SortStage(std::unique_ptr<PlanStage> input,
       _dirs(std::move(dirs)),
       _vals(std::move(vals)),
       _allowDiskUse(allowDiskUse),
+      _ordering(makeOrdering(_dirs)),
       _mergeData({0, 0}) {
     _children.emplace_back(std::move(input));
 
@@ -127,10 +195,22 @@ void SortStage::makeSorter() {
         _specificStats.limit != std::numeric_limits<size_t>::max() ? _specificStats.limit : 0;
     opts.moveSortedDataIntoIterator = true;
 
-    auto comp = [&](const SorterData& lhs, const SorterData& rhs) {
-        auto size = lhs.first.size();
+    auto comp = [this](const SorterData& lhs, const SorterData& rhs) {
+        auto size = _obs.size();
         auto& left = lhs.first;
         auto& right = rhs.first;
+
+        if (_ordering) {
+            // When both rows carry a KeyString image of their sort key, the comparison collapses
+            // into one byte-wise buffer comparison covering all key components and directions.
+            auto [lhsKsTag, lhsKsVal] = left.getViewOfValue(size);
+            auto [rhsKsTag, rhsKsVal] = right.getViewOfValue(size);
+            if (lhsKsTag == value::TypeTags::ksValue && rhsKsTag == value::TypeTags::ksValue) {
+                return value::getKeyStringView(lhsKsVal)->compare(
+                    *value::getKeyStringView(rhsKsVal));
+            }
+        }
+
         for (size_t idx = 0; idx < size; ++idx) {
             auto [lhsTag, lhsVal] = left.getViewOfValue(idx);
             auto [rhsTag, rhsVal] = right.getViewOfValue(idx);
@@ -149,6 +229,29 @@ void SortStage::makeSorter() {
     _mergeIt.reset();
 }
 
+void SortStage::tryEncodeKeyString(value::MaterializedRow& keys) const {
+    BSONObjBuilder bob;
+    for (size_t idx = 0; idx < _obs.size(); ++idx) {
+        auto [tag, val] = keys.getViewOfValue(idx);
+        if (!isKeyStringComparable(tag, val)) {
+            return;
+        }
+
+        if (tag == value::TypeTags::Nothing) {
+            // 'Nothing' has no BSON representation, but compareValue() orders it exactly as
+            // Undefined (both canonicalize to the same type), so encoding it as Undefined
+            // preserves the sort order.
+            bob.appendUndefined(""_sd);
+        } else {
+            bson::appendValueToBsonObj(bob, ""_sd, tag, val);
+        }
+    }
+
+    KeyString::Builder kb{KeyString::Version::kLatestVersion, bob.done(), *_ordering};
+    auto [ksTag, ksVal] = value::makeCopyKeyString(kb.getValueCopy());
+    keys.reset(_obs.size(), true, ksTag, ksVal);
+}
+
 void SortStage::doDetachFromTrialRunTracker() {
     _tracker = nullptr;
 }
@@ -167,7 +270,9 @@ void SortStage::open(bool reOpen) {
     makeSorter();
 
     while (_children[0]->getNext() == PlanState::ADVANCED) {
-        value::MaterializedRow keys{_inKeyAccessors.size()};
+        // The extra key component holds the KeyString image of the key when the fast comparison
+        // path is enabled and the key is encodable; it stays Nothing otherwise.
+        value::MaterializedRow keys{_inKeyAccessors.size() + (_ordering ? 1 : 0)};
         value::MaterializedRow vals{_inValueAccessors.size()};
 
         size_t idx = 0;
@@ -177,6 +282,10 @@ void SortStage::open(bool reOpen) {
             keys.reset(idx++, true, cTag, cVal);
         }
 
+        if (_ordering) {
+            tryEncodeKeyString(keys);
+        }
+
         idx = 0;
         for (auto accessor : _inValueAccessors) {
             auto [tag, val] = accessor->getViewOfValue();
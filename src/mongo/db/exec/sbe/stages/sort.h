@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include "mongo/bson/ordering.h"
 #include "mongo/db/exec/sbe/stages/stages.h"
 
 namespace mongo {
@@ -54,6 +55,13 @@ namespace mongo::sbe {
  * If 'limit' is not std::numeric_limits<size_t>::max(), then this is a top-k sort that should only
  * return the number of rows given by the limit.
  *
+ * As rows are inserted, the stage attempts to normalize each sort key into a KeyString buffer
+ * whose byte-wise ordering coincides with the ordering defined by 'value::compareValue()'. When
+ * both rows being compared carry such a buffer, the comparator reduces to a single memcmp-style
+ * byte comparison instead of a per-component typed comparison. Rows whose keys contain types for
+ * which the two orderings are not provably identical skip the normalization and are compared with
+ * the generic comparator.
+ *
  * This stage is a binding reflector, meaning that only the 'obs' and 'vals' slots are visible to
  * nodes higher in the tree.
  *
@@ -93,6 +101,14 @@ protected:
 private:
     void makeSorter();
 
+    /**
+     * Appends a KeyString image of the sort key to 'keys' at position '_obs.size()' when all key
+     * components belong to types whose KeyString encoding orders byte-wise exactly as
+     * 'value::compareValue()' does. Leaves the extra component set to Nothing otherwise, which
+     * makes the comparator fall back to the generic per-component comparison for this row.
+     */
+    void tryEncodeKeyString(value::MaterializedRow& keys) const;
+
     using SorterIterator = SortIteratorInterface<value::MaterializedRow, value::MaterializedRow>;
     using SorterData = std::pair<value::MaterializedRow, value::MaterializedRow>;
 
@@ -100,6 +116,11 @@ private:
     const std::vector<value::SortDirection> _dirs;
     const value::SlotVector _vals;
     const bool _allowDiskUse;
+
+    // Set when the sort directions can be represented as an 'Ordering' (at most 32 components), in
+    // which case the KeyString fast path is enabled and each key row carries one extra component
+    // holding the encoded key.
+    const boost::optional<Ordering> _ordering;
     SortStats _specificStats;
 
     std::vector<value::SlotAccessor*> _inKeyAccessors;
@@ -46,6 +46,19 @@ inline auto fieldNameView(const char* be) noexcept {
     return StringData{be + 1};
 }
 
+/**
+ * Computes a one-word Bloom filter mask for a field name, hashing the name's first character and
+ * its length into one bit each. OR together the masks of a set of names to get a filter for the
+ * set; a name whose own mask bits are not all present in the filter is definitely not in the set.
+ * This lets scan stages reject the majority of unrequested fields without a hash table lookup.
+ * Reading 'name.data()[0]' is safe even for an empty name because BSON field names are
+ * NUL-terminated.
+ */
+inline uint64_t fieldNameBloomMask(StringData name) noexcept {
+    return (uint64_t{1} << (static_cast<uint8_t>(name.data()[0]) & 63)) |
+        (uint64_t{1} << (name.size() & 63));
+}
+
 template <class ArrayBuilder>
 void convertToBsonObj(ArrayBuilder& builder, value::Array* arr);
 
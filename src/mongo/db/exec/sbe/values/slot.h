@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <type_traits>
 
 #include <boost/container/small_vector.hpp>
@@ -384,18 +385,26 @@ public:
     }
 
     MaterializedRow(MaterializedRow&& other) noexcept {
-        swap(*this, other);
+        moveFrom(std::move(other));
     }
 
     ~MaterializedRow() noexcept {
-        if (_data) {
-            release();
-            delete[] _data;
+        destroy();
+    }
+
+    MaterializedRow& operator=(const MaterializedRow& other) {
+        if (this != &other) {
+            resize(other.size());
+            copy(other);
         }
+        return *this;
     }
 
-    MaterializedRow& operator=(MaterializedRow other) noexcept {
-        swap(*this, other);
+    MaterializedRow& operator=(MaterializedRow&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            moveFrom(std::move(other));
+        }
         return *this;
     }
 
@@ -445,14 +454,9 @@ public:
     }
 
     void resize(size_t count) {
-        if (_data) {
-            release();
-            delete[] _data;
-            _data = nullptr;
-            _count = 0;
-        }
+        destroy();
         if (count) {
-            _data = new char[sizeInBytes(count)];
+            _data = count <= kInlineCount ? _buffer : new char[sizeInBytes(count)];
             _count = count;
             auto valuePtr = values();
             auto tagPtr = tags();
@@ -477,7 +481,12 @@ public:
     }
 
 private:
-    static size_t sizeInBytes(size_t count) {
+    // Rows this narrow live in the inline '_buffer' and never touch the heap allocator. Most rows
+    // flowing through hash join and hash agg tables are group-by or join keys of just a few slots,
+    // and the per-row malloc/free used to dominate those stages.
+    static constexpr size_t kInlineCount = 3;
+
+    static constexpr size_t sizeInBytes(size_t count) {
         return count * (sizeof(value::Value) + sizeof(value::TypeTags) + sizeof(bool));
     }
 
@@ -494,6 +503,10 @@ private:
                                        _count * (sizeof(value::Value) + sizeof(value::TypeTags)));
     }
 
+    bool isInline() const {
+        return _data == _buffer;
+    }
+
     void release() {
         for (size_t idx = 0; idx < _count; ++idx) {
             if (owned()[idx]) {
@@ -503,6 +516,35 @@ private:
         }
     }
 
+    void destroy() noexcept {
+        if (_data) {
+            release();
+            if (!isInline()) {
+                delete[] _data;
+            }
+            _data = nullptr;
+            _count = 0;
+        }
+    }
+
+    /**
+     * Takes over the values of 'other' and leaves it empty. Values of heap-allocated types are
+     * stored as pointers to external memory, so moving the inline buffer by copying its bytes
+     * transfers their ownership without invalidating them.
+     */
+    void moveFrom(MaterializedRow&& other) noexcept {
+        if (other.isInline()) {
+            _data = _buffer;
+            _count = other._count;
+            memcpy(_buffer, other._buffer, sizeInBytes(_count));
+        } else {
+            _data = other._data;
+            _count = other._count;
+        }
+        other._data = nullptr;
+        other._count = 0;
+    }
+
     /**
      * Makes a deep copy on the incoming row.
      */
@@ -523,13 +565,9 @@ private:
         }
     }
 
-    friend void swap(MaterializedRow& lhs, MaterializedRow& rhs) noexcept {
-        std::swap(lhs._data, rhs._data);
-        std::swap(lhs._count, rhs._count);
-    }
-
     char* _data{nullptr};
     size_t _count{0};
+    alignas(value::Value) char _buffer[sizeInBytes(kInlineCount)];
 };
 
 // This check is needed to ensure that 'std::vector<MaterializedRow>' uses move constructor of
@@ -104,6 +104,9 @@ int Instruction::stackOffset[Instruction::Tags::lastInstruction] = {
     -1,  // getElement
     -1,  // collComparisonKey
 
+    0,  // getFieldImm
+    0,  // eqImm
+
     -1,  // aggSum
     -1,  // aggMin
     -1,  // aggMax
@@ -313,6 +316,30 @@ void CodeFragment::appendGetField() {
     appendSimpleInstruction(Instruction::getField);
 }
 
+void CodeFragment::appendGetFieldImm(value::TypeTags fieldTag, value::Value fieldVal) {
+    Instruction i;
+    i.tag = Instruction::getFieldImm;
+    adjustStackSimple(i);
+
+    auto offset = allocateSpace(sizeof(Instruction) + sizeof(fieldTag) + sizeof(fieldVal));
+
+    offset += writeToMemory(offset, i);
+    offset += writeToMemory(offset, fieldTag);
+    offset += writeToMemory(offset, fieldVal);
+}
+
+void CodeFragment::appendEqImm(value::TypeTags rhsTag, value::Value rhsVal) {
+    Instruction i;
+    i.tag = Instruction::eqImm;
+    adjustStackSimple(i);
+
+    auto offset = allocateSpace(sizeof(Instruction) + sizeof(rhsTag) + sizeof(rhsVal));
+
+    offset += writeToMemory(offset, i);
+    offset += writeToMemory(offset, rhsTag);
+    offset += writeToMemory(offset, rhsVal);
+}
+
 void CodeFragment::appendGetElement() {
     appendSimpleInstruction(Instruction::getElement);
 }
@@ -3728,6 +3755,24 @@ std::tuple<uint8_t, value::TypeTags, value::Value> ByteCode::run(const CodeFragm
                     }
                     break;
                 }
+                case Instruction::eqImm: {
+                    auto rhsTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(rhsTag);
+                    auto rhsVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(rhsVal);
+
+                    auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
+
+                    auto [tag, val] =
+                        genericCompare<std::equal_to<>>(lhsTag, lhsVal, rhsTag, rhsVal);
+
+                    topStack(false, tag, val);
+
+                    if (lhsOwned) {
+                        value::releaseValue(lhsTag, lhsVal);
+                    }
+                    break;
+                }
                 case Instruction::collEq: {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
@@ -3868,6 +3913,23 @@ std::tuple<uint8_t, value::TypeTags, value::Value> ByteCode::run(const CodeFragm
                     }
                     break;
                 }
+                case Instruction::getFieldImm: {
+                    auto fieldTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(fieldTag);
+                    auto fieldVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(fieldVal);
+
+                    auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
+
+                    auto [owned, tag, val] = getField(lhsTag, lhsVal, fieldTag, fieldVal);
+
+                    topStack(owned, tag, val);
+
+                    if (lhsOwned) {
+                        value::releaseValue(lhsTag, lhsVal);
+                    }
+                    break;
+                }
                 case Instruction::getElement: {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
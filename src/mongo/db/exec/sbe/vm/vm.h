@@ -239,6 +239,13 @@ struct Instruction {
         getElement,
         collComparisonKey,
 
+        // Fused "superinstructions". These combine a pushConstVal with the instruction consuming
+        // the constant, with the constant embedded directly in the instruction stream. They are
+        // selected at assembly time when an operand is known to be a compile-time constant and cut
+        // down on dispatch and value stack traffic in hot filter loops.
+        getFieldImm,
+        eqImm,
+
         aggSum,
         aggMin,
         aggMax,
@@ -451,6 +458,8 @@ public:
         appendSimpleInstruction(Instruction::fillEmpty);
     }
     void appendGetField();
+    void appendGetFieldImm(value::TypeTags fieldTag, value::Value fieldVal);
+    void appendEqImm(value::TypeTags rhsTag, value::Value rhsVal);
     void appendGetElement();
     void appendCollComparisonKey();
     void appendSum();
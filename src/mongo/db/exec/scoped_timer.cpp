@@ -42,4 +42,12 @@ ScopedTimer::~ScopedTimer() {
     *_counter += elapsed;
 }
 
+ScopedTickTimer::ScopedTickTimer(TickSource* ts, long long* counterNanos)
+    : _tickSource(ts), _counterNanos(counterNanos), _start(ts->getTicks()) {}
+
+ScopedTickTimer::~ScopedTickTimer() {
+    *_counterNanos += durationCount<Nanoseconds>(
+        _tickSource->ticksTo<Nanoseconds>(_tickSource->getTicks() - _start));
+}
+
 }  // namespace mongo
@@ -30,6 +30,7 @@
 #pragma once
 
 
+#include "mongo/util/tick_source.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -59,4 +60,29 @@ private:
     const Date_t _start;
 };
 
+/**
+ * Adds the time elapsed since its construction, in nanoseconds, to a counter when it goes out of
+ * scope. Unlike ScopedTimer this reads the tick source (a raw TSC read where the hardware
+ * supports it) rather than a clock, which makes it cheap enough to leave enabled on per-work()
+ * hot paths rather than only under explain.
+ */
+class ScopedTickTimer {
+    ScopedTickTimer(const ScopedTickTimer&) = delete;
+    ScopedTickTimer& operator=(const ScopedTickTimer&) = delete;
+
+public:
+    ScopedTickTimer(ScopedTickTimer&& other) = default;
+    ScopedTickTimer(TickSource* ts, long long* counterNanos);
+
+    ~ScopedTickTimer();
+
+private:
+    TickSource* const _tickSource;
+    // Reference to the counter that we are incrementing with the elapsed time.
+    long long* _counterNanos;
+
+    // Tick count at which the timer was constructed.
+    const TickSource::Tick _start;
+};
+
 }  // namespace mongo
@@ -33,6 +33,9 @@
 #include "mongo/db/exec/sort.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
+#include "mongo/util/str.h"
+
+#include <algorithm>
 
 namespace mongo {
 
@@ -86,8 +89,20 @@ void SortStageDefault::loadingDone() {
 }
 
 void SortStageSimple::loadingDone() {
-    _sortExecutor.loadingDone();
     auto& metricsCollector = ResourceConsumption::MetricsCollector::get(expCtx()->opCtx);
+
+    if (_topKLimit > 0) {
+        // Pops the heap repeatedly, leaving the retained documents in sorted order. The top-k path
+        // never spills.
+        std::sort_heap(_topK.begin(), _topK.end(), [](const TopKEntry& lhs, const TopKEntry& rhs) {
+            return lhs.key.compare(rhs.key) < 0;
+        });
+        _topKDone = true;
+        metricsCollector.incrementKeysSorted(_topKStats.keysSorted);
+        return;
+    }
+
+    _sortExecutor.loadingDone();
     metricsCollector.incrementKeysSorted(_sortExecutor.stats().keysSorted);
     metricsCollector.incrementSorterSpills(_sortExecutor.stats().spills);
 }
@@ -149,7 +164,22 @@ SortStageSimple::SortStageSimple(boost::intrusive_ptr<ExpressionContext> expCtx,
                     limit,
                     maxMemoryUsageBytes,
                     expCtx->tempDir,
-                    expCtx->allowDiskUse) {}
+                    expCtx->allowDiskUse) {
+    // Engage the bounded-heap top-k fast path when a limit is present and spilling is not an
+    // option. The KeyString path sorts on document fields only; $meta components would require
+    // metadata that this stage forbids anyway, but we check defensively.
+    const auto& pattern = _sortExecutor.sortPattern();
+    if (limit > 0 && !expCtx->allowDiskUse &&
+        std::all_of(pattern.begin(), pattern.end(), [](auto&& part) {
+            return static_cast<bool>(part.fieldPath);
+        })) {
+        _topKLimit = limit;
+        _topKStats.sortPattern =
+            pattern.serialize(SortPattern::SortKeySerialization::kForExplain).toBson();
+        _topKStats.limit = limit;
+        _topKStats.maxMemoryUsageBytes = maxMemoryUsageBytes;
+    }
+}
 
 void SortStageSimple::spool(WorkingSetID wsid) {
     auto member = _ws->get(wsid);
@@ -157,13 +187,82 @@ void SortStageSimple::spool(WorkingSetID wsid) {
     invariant(!member->doc.value().metadata());
     invariant(member->hasObj());
 
+    if (_topKLimit > 0) {
+        spoolTopK(member->doc.value().toBson());
+        _ws->free(wsid);
+        return;
+    }
+
     auto sortKey = _sortKeyGen.computeSortKeyFromDocument(member->doc.value());
 
     _sortExecutor.add(std::move(sortKey), member->doc.value().toBson());
     _ws->free(wsid);
 }
 
+void SortStageSimple::spoolTopK(const BSONObj& obj) {
+    auto key = uassertStatusOK(_sortKeyGen.computeSortKeyString(obj));
+
+    ++_topKStats.keysSorted;
+
+    // Because the KeyString encoding already incorporates the sort directions and the collation,
+    // ascending KeyString order is exactly the requested sort order, so a max-heap under this
+    // comparator keeps the worst retained document at the front.
+    auto worseFirst = [](const TopKEntry& lhs, const TopKEntry& rhs) {
+        return lhs.key.compare(rhs.key) < 0;
+    };
+
+    if (_topK.size() == _topKLimit) {
+        // The candidate must strictly beat the current worst entry to be retained. Rejected
+        // documents are dropped here without having been copied or materialized.
+        if (key.compare(_topK.front().key) >= 0) {
+            return;
+        }
+        std::pop_heap(_topK.begin(), _topK.end(), worseFirst);
+        auto& evicted = _topK.back();
+        _topKMemUsage -= evicted.key.getSize() + evicted.obj.objsize();
+        evicted.key = std::move(key);
+        evicted.obj = obj.getOwned();
+        _topKMemUsage += evicted.key.getSize() + evicted.obj.objsize();
+        _topKStats.totalDataSizeBytes += evicted.key.getSize() + evicted.obj.objsize();
+        std::push_heap(_topK.begin(), _topK.end(), worseFirst);
+    } else {
+        _topK.push_back({std::move(key), obj.getOwned()});
+        const auto& added = _topK.back();
+        _topKMemUsage += added.key.getSize() + added.obj.objsize();
+        _topKStats.totalDataSizeBytes += added.key.getSize() + added.obj.objsize();
+        std::push_heap(_topK.begin(), _topK.end(), worseFirst);
+    }
+
+    uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
+            str::stream() << "Sort exceeded memory limit of " << _topKStats.maxMemoryUsageBytes
+                          << " bytes, but did not opt in to external sorting.",
+            _topKMemUsage <= _topKStats.maxMemoryUsageBytes);
+}
+
 PlanStage::StageState SortStageSimple::unspool(WorkingSetID* out) {
+    if (_topKLimit > 0) {
+        if (_topKIndex == _topK.size()) {
+            return PlanStage::IS_EOF;
+        }
+
+        auto& entry = _topK[_topKIndex++];
+
+        *out = _ws->allocate();
+        auto member = _ws->get(*out);
+        member->resetDocument(SnapshotId{}, entry.obj);
+        member->transitionToOwnedObj();
+
+        if (_addSortKeyMetadata) {
+            // Only the k winners ever pay for a materialized sort key.
+            auto sortKey = _sortKeyGen.computeSortKeyFromDocument(Document{entry.obj});
+            member->metadata().setSortKey(std::move(sortKey), _sortKeyGen.isSingleElementKey());
+        }
+
+        // Release our reference to the document's data as results stream out.
+        entry = TopKEntry{};
+        return PlanStage::ADVANCED;
+    }
+
     if (!_sortExecutor.hasNext()) {
         return PlanStage::IS_EOF;
     }
@@ -38,6 +38,7 @@
 #include "mongo/db/exec/sort_key_generator.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/key_string.h"
 
 namespace mongo {
 
@@ -166,15 +167,41 @@ public:
     }
 
     bool isEOF() final {
+        if (_topKLimit > 0) {
+            return _topKDone && _topKIndex == _topK.size();
+        }
         return _sortExecutor.isEOF();
     }
 
     const SpecificStats* getSpecificStats() const final {
-        return &_sortExecutor.stats();
+        return _topKLimit > 0 ? &_topKStats : &_sortExecutor.stats();
     }
 
 private:
+    /**
+     * Adds 'obj' to the bounded top-k heap, taking ownership of its data only if it ranks among
+     * the best 'limit' documents seen so far. Used in place of '_sortExecutor' when the top-k fast
+     * path is engaged.
+     */
+    void spoolTopK(const BSONObj& obj);
+
     SortExecutor<BSONObj> _sortExecutor;
+
+    // When a limit is present, disk use is disallowed, and the sort pattern has no $meta
+    // components, we bypass '_sortExecutor' and instead keep a fixed-size binary heap of
+    // KeyString-normalized sort keys alongside the owned documents. Candidates that fail to beat
+    // the current worst entry are rejected with a single KeyString comparison and never own or
+    // materialize anything. Set to zero when the fast path is not in use.
+    struct TopKEntry {
+        KeyString::Value key;
+        BSONObj obj;
+    };
+    uint64_t _topKLimit = 0;
+    std::vector<TopKEntry> _topK;
+    size_t _topKIndex = 0;
+    uint64_t _topKMemUsage = 0;
+    bool _topKDone = false;
+    SortStats _topKStats;
 };
 
 }  // namespace mongo
@@ -304,4 +304,146 @@ TEST_F(SortStageDefaultTest, SortDescendingWithCollation) {
              "{input: [{a: 'ba'}, {a: 'aa'}, {a: 'ab'}]}",
              "{output: [{a: 'ab'}, {a: 'ba'}, {a: 'aa'}]}");
 }
+
+class SortStageSimpleTest : public ServiceContextMongoDTest {
+public:
+    static constexpr uint64_t kMaxMemoryUsageBytes = 1024u * 1024u;
+
+    SortStageSimpleTest() {
+        getServiceContext()->setFastClockSource(std::make_unique<ClockSourceMock>());
+        _opCtx = makeOperationContext();
+        CollatorFactoryInterface::set(getServiceContext(), std::make_unique<CollatorFactoryMock>());
+    }
+
+    OperationContext* opCtx() {
+        return _opCtx.get();
+    }
+
+    /**
+     * Same shape as SortStageDefaultTest::testWork(), but runs the input through SortStageSimple.
+     * A nonzero 'limit' exercises the bounded-heap top-k path, since the test ExpressionContext
+     * does not allow disk use.
+     */
+    void testWork(const char* patternStr,
+                  CollatorInterface* collator,
+                  int limit,
+                  const char* inputStr,
+                  const char* expectedStr) {
+        WorkingSet ws;
+
+        auto expCtx = make_intrusive<ExpressionContext>(
+            opCtx(), CollatorInterface::cloneCollator(collator), kNss);
+
+        // SortStageSimple computes its own sort keys, so no SortKeyGeneratorStage is needed.
+        auto queuedDataStage = std::make_unique<QueuedDataStage>(expCtx.get(), &ws);
+        BSONObj inputObj = fromjson(inputStr);
+        BSONElement inputElt = inputObj.getField("input");
+        ASSERT(inputElt.isABSONObj());
+        BSONObjIterator inputIt(inputElt.embeddedObject());
+        while (inputIt.more()) {
+            BSONElement elt = inputIt.next();
+            ASSERT(elt.isABSONObj());
+            BSONObj obj = elt.embeddedObject().getOwned();
+
+            WorkingSetID id = ws.allocate();
+            WorkingSetMember* wsm = ws.get(id);
+            wsm->doc = {SnapshotId(), Document{obj}};
+            wsm->transitionToOwnedObj();
+            queuedDataStage->pushBack(id);
+        }
+
+        auto sortPattern = fromjson(patternStr);
+
+        SortStageSimple sort(expCtx,
+                             &ws,
+                             SortPattern{sortPattern, expCtx},
+                             limit,
+                             kMaxMemoryUsageBytes,
+                             false,  // addSortKeyMetadata
+                             std::move(queuedDataStage));
+
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state = PlanStage::NEED_TIME;
+
+        while (state == PlanStage::NEED_TIME) {
+            state = sort.work(&id);
+        }
+
+        ASSERT_TRUE(sort.child()->isEOF());
+
+        BSONObjBuilder bob;
+        BSONArrayBuilder arr(bob.subarrayStart("output"));
+        while (state == PlanStage::ADVANCED) {
+            WorkingSetMember* member = ws.get(id);
+            BSONObj obj = member->doc.value().toBson();
+            arr.append(obj);
+            state = sort.work(&id);
+        }
+        arr.doneFast();
+        BSONObj outputObj = bob.obj();
+
+        ASSERT_EQUALS(state, PlanStage::IS_EOF);
+        ASSERT_TRUE(sort.isEOF());
+
+        BSONObj expectedObj = fromjson(expectedStr);
+        if (SimpleBSONObjComparator::kInstance.evaluate(outputObj != expectedObj)) {
+            str::stream ss;
+            ss << "Unexpected sort result with pattern=" << patternStr << "; limit=" << limit
+               << ":\n"
+               << "Expected: " << expectedObj.toString() << "\n"
+               << "Actual:   " << outputObj.toString() << "\n";
+            FAIL(ss);
+        }
+    }
+
+private:
+    ServiceContext::UniqueOperationContext _opCtx;
+};
+
+TEST_F(SortStageSimpleTest, SortAscendingWithoutLimit) {
+    testWork("{a: 1}",
+             nullptr,
+             0,
+             "{input: [{a: 2}, {a: 1}, {a: 3}]}",
+             "{output: [{a: 1}, {a: 2}, {a: 3}]}");
+}
+
+TEST_F(SortStageSimpleTest, SortAscendingWithLimit) {
+    testWork(
+        "{a: 1}", nullptr, 2, "{input: [{a: 2}, {a: 1}, {a: 3}]}", "{output: [{a: 1}, {a: 2}]}");
+}
+
+TEST_F(SortStageSimpleTest, SortDescendingWithLimit) {
+    testWork(
+        "{a: -1}", nullptr, 2, "{input: [{a: 2}, {a: 1}, {a: 3}]}", "{output: [{a: 3}, {a: 2}]}");
+}
+
+TEST_F(SortStageSimpleTest, SortWithLimitGreaterThanInputSize) {
+    testWork("{a: 1}",
+             nullptr,
+             10,
+             "{input: [{a: 2}, {a: 1}, {a: 3}]}",
+             "{output: [{a: 1}, {a: 2}, {a: 3}]}");
+}
+
+TEST_F(SortStageSimpleTest, SortWithLimitOfOne) {
+    testWork("{a: -1}", nullptr, 1, "{input: [{a: 2}, {a: 1}, {a: 3}]}", "{output: [{a: 3}]}");
+}
+
+TEST_F(SortStageSimpleTest, SortCompoundPatternWithLimit) {
+    testWork("{a: 1, b: -1}",
+             nullptr,
+             2,
+             "{input: [{a: 1, b: 1}, {a: 2, b: 1}, {a: 1, b: 2}]}",
+             "{output: [{a: 1, b: 2}, {a: 1, b: 1}]}");
+}
+
+TEST_F(SortStageSimpleTest, SortAscendingWithCollationAndLimit) {
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
+    testWork("{a: 1}",
+             &collator,
+             2,
+             "{input: [{a: 'ba'}, {a: 'aa'}, {a: 'ab'}]}",
+             "{output: [{a: 'aa'}, {a: 'ba'}]}");
+}
 }  // namespace
@@ -54,6 +54,7 @@
 #include "mongo/db/storage/duplicate_key_error_info.h"
 #include "mongo/db/update/path_support.h"
 #include "mongo/db/update/storage_validation.h"
+#include "mongo/db/update/update_oplog_entry_serialization.h"
 #include "mongo/logv2/log.h"
 #include "mongo/s/shard_key_pattern.h"
 #include "mongo/s/would_change_owning_shard_exception.h"
@@ -293,6 +294,36 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
                 newObj = uassertStatusOK(std::move(newRecStatus)).releaseToBson();
             }
 
+            newRecordId = recordId;
+        } else if (auto damagesFromDiff = _computeDamagesFromDiff(oldObj, logObj)) {
+            // The mods could not be applied as same-size in-place writes, but the $v: 2 delta
+            // produced for the oplog describes them exactly. Replay the delta against the raw
+            // pre-image as damage events and let the storage engine splice the changed bytes in,
+            // instead of serializing the whole post-image for a full document rewrite.
+            if (!request->explain()) {
+                const RecordData oldRec(oldObj.value().objdata(), oldObj.value().objsize());
+
+                Snapshotted<RecordData> snap(oldObj.snapshotId(), oldRec);
+
+                if (_isUserInitiatedWrite &&
+                    checkUpdateChangesShardKeyFields(boost::none, oldObj) && !args.preImageDoc) {
+                    args.preImageDoc = oldObj.value().getOwned();
+                }
+
+                WriteUnitOfWork wunit(opCtx());
+                StatusWith<RecordData> newRecStatus =
+                    collection()->updateDocumentWithDamages(opCtx(),
+                                                            recordId,
+                                                            std::move(snap),
+                                                            damagesFromDiff->damageSource.get(),
+                                                            damagesFromDiff->damages,
+                                                            &args);
+                invariant(oldObj.snapshotId() == opCtx()->recoveryUnit()->getSnapshotId());
+                wunit.commit();
+
+                newObj = uassertStatusOK(std::move(newRecStatus)).releaseToBson();
+            }
+
             newRecordId = recordId;
         } else {
             // The updates were not in place. Apply them through the file manager.
@@ -570,6 +601,52 @@ const SpecificStats* UpdateStage::getSpecificStats() const {
     return &_specificStats;
 }
 
+boost::optional<doc_diff::DamagesOutput> UpdateStage::_computeDamagesFromDiff(
+    const Snapshotted<BSONObj>& oldObj, const BSONObj& logObj) const {
+    // Explain keeps the full-rewrite path, which materializes the post-image it reports.
+    if (_params.request->explain()) {
+        return boost::none;
+    }
+
+    // Index maintenance compares pre- and post-image keys document-wide, which only the full
+    // updateDocument path performs.
+    if (_params.driver->modsAffectIndices()) {
+        return boost::none;
+    }
+
+    if (!collection()->updateWithDamagesSupported()) {
+        return boost::none;
+    }
+
+    if (logObj.isEmpty() ||
+        update_oplog_entry::extractUpdateType(logObj) != update_oplog_entry::UpdateType::kV2Delta) {
+        return boost::none;
+    }
+
+    // _ensureIdFieldIsFirst() may have added or repositioned _id in the updated document; the
+    // delta knows nothing about that, so only proceed when it was a no-op.
+    if (oldObj.value().firstElementFieldNameStringData() != idFieldName) {
+        return boost::none;
+    }
+
+    // This node produced the delta against this exact pre-image, so inserted fields are known not
+    // to exist and the applier's existence checks can be skipped.
+    auto damagesOutput = doc_diff::computeDamages(
+        oldObj.value(), logObj[update_oplog_entry::kDiffObjectFieldName].embeddedObject(), false);
+
+    // Let oversized results take the full-rewrite path, which fails with the canonical error.
+    int64_t newSize = oldObj.value().objsize();
+    for (const auto& damage : damagesOutput.damages) {
+        newSize +=
+            static_cast<int64_t>(damage.sourceSize) - static_cast<int64_t>(damage.targetSize);
+    }
+    if (newSize > BSONObjMaxUserSize) {
+        return boost::none;
+    }
+
+    return damagesOutput;
+}
+
 PlanStage::StageState UpdateStage::prepareToRetryWSM(WorkingSetID idToRetry, WorkingSetID* out) {
     _idRetrying = idToRetry;
     *out = WorkingSet::INVALID_ID;
@@ -37,6 +37,7 @@
 #include "mongo/db/ops/update_request.h"
 #include "mongo/db/ops/update_result.h"
 #include "mongo/db/s/collection_sharding_state.h"
+#include "mongo/db/update/document_diff_applier.h"
 #include "mongo/db/update/update_driver.h"
 
 namespace mongo {
@@ -151,6 +152,17 @@ private:
      */
     StageState prepareToRetryWSM(WorkingSetID idToRetry, WorkingSetID* out);
 
+    /**
+     * When the mods could not be applied as same-size in-place writes, translates the $v: 2 delta
+     * oplog entry 'logObj' into damage events against the raw pre-image 'oldObj', so that the
+     * storage engine can splice the changed bytes in without a full document rewrite. Returns
+     * boost::none when the update is ineligible (no delta was produced, indexed fields are
+     * affected, the storage engine lacks damage support, _id needed fixing up, or the result would
+     * exceed the size limit), in which case the caller falls back to the full rewrite.
+     */
+    boost::optional<doc_diff::DamagesOutput> _computeDamagesFromDiff(
+        const Snapshotted<BSONObj>& oldObj, const BSONObj& logObj) const;
+
     /**
      * Returns true if the owning shard under the current key pattern would change as a result of
      * the update, or if the destined recipient under the new shard key pattern from resharding
@@ -58,25 +58,29 @@ WorkingSet::WorkingSet() : _freeList(INVALID_ID) {}
 
 WorkingSetID WorkingSet::allocate() {
     if (_freeList == INVALID_ID) {
-        // The free list is empty so we need to make a single new WSM to return. This relies on
-        // vector::resize being amortized O(1) for efficient allocation. Note that the free list
-        // remains empty until something is returned by a call to free().
-        WorkingSetID id = _data.size();
-        _data.resize(_data.size() + 1);
-        _data.back().nextFreeOrSelf = id;
+        // The free list is empty so we need to hand out a fresh WSM. A new slab of members is
+        // constructed whenever the current one fills up, so allocation is amortized O(1) and never
+        // moves existing members. Note that the free list remains empty until something is
+        // returned by a call to free().
+        WorkingSetID id = _size;
+        if (id == _slabs.size() * kSlabSize) {
+            _slabs.push_back(std::make_unique<MemberHolder[]>(kSlabSize));
+        }
+        ++_size;
+        _holder(id).nextFreeOrSelf = id;
         return id;
     }
 
     // Pop the head off the free list and return it.
     WorkingSetID id = _freeList;
-    _freeList = _data[id].nextFreeOrSelf;
-    _data[id].nextFreeOrSelf = id;  // set to self to mark as in-use
+    _freeList = _holder(id).nextFreeOrSelf;
+    _holder(id).nextFreeOrSelf = id;  // set to self to mark as in-use
     return id;
 }
 
 void WorkingSet::free(WorkingSetID i) {
-    MemberHolder& holder = _data[i];
-    verify(i < _data.size());            // ID has been allocated.
+    verify(i < _size);  // ID has been allocated.
+    MemberHolder& holder = _holder(i);
     verify(holder.nextFreeOrSelf == i);  // ID currently in use.
 
     // Free resources and push this WSM to the head of the freelist.
@@ -86,7 +90,9 @@ void WorkingSet::free(WorkingSetID i) {
 }
 
 void WorkingSet::clear() {
-    _data.clear();
+    // Release every slab in bulk rather than clearing members individually.
+    _slabs.clear();
+    _size = 0;
 
     // Since working set is now empty, the free list pointer should
     // point to nothing.
@@ -109,8 +115,8 @@ void WorkingSet::transitionToOwnedObj(WorkingSetID id) {
 }
 
 WorkingSetMember WorkingSet::extract(WorkingSetID wsid) {
-    invariant(wsid < _data.size());
-    WorkingSetMember ret = std::move(_data[wsid].member);
+    invariant(wsid < _size);
+    WorkingSetMember ret = std::move(_holder(wsid).member);
     free(wsid);
     return ret;
 }
@@ -30,6 +30,7 @@
 #pragma once
 
 #include "boost/optional.hpp"
+#include <memory>
 #include <vector>
 
 #include "mongo/db/exec/document_value/document.h"
@@ -316,27 +317,27 @@ public:
     WorkingSetID allocate();
 
     /**
-     * Get the i-th mutable query result. The pointer will be valid for this id until freed.
-     * Do not delete the returned pointer as the WorkingSet retains ownership. Call free() to
-     * release it.
+     * Get the i-th mutable query result. Members are stored in fixed-size slabs, so the pointer
+     * remains valid for this id until freed, even as the working set grows. Do not delete the
+     * returned pointer as the WorkingSet retains ownership. Call free() to release it.
      */
     WorkingSetMember* get(WorkingSetID i) {
-        dassert(i < _data.size());              // ID has been allocated.
-        dassert(_data[i].nextFreeOrSelf == i);  // ID currently in use.
-        return &_data[i].member;
+        dassert(i < _size);                       // ID has been allocated.
+        dassert(_holder(i).nextFreeOrSelf == i);  // ID currently in use.
+        return &_holder(i).member;
     }
 
     const WorkingSetMember* get(WorkingSetID i) const {
-        dassert(i < _data.size());              // ID has been allocated.
-        dassert(_data[i].nextFreeOrSelf == i);  // ID currently in use.
-        return &_data[i].member;
+        dassert(i < _size);                       // ID has been allocated.
+        dassert(_holder(i).nextFreeOrSelf == i);  // ID currently in use.
+        return &_holder(i).member;
     }
 
     /**
      * Returns true if WorkingSetMember with id 'i' is free.
      */
     bool isFree(WorkingSetID i) const {
-        return _data[i].nextFreeOrSelf != i;
+        return _holder(i).nextFreeOrSelf != i;
     }
 
     /**
@@ -397,9 +398,29 @@ private:
         WorkingSetMember member;
     };
 
-    // All WorkingSetIDs are indexes into this, except for INVALID_ID.
-    // Elements are added to _freeList rather than removed when freed.
-    std::vector<MemberHolder> _data;
+    // The number of MemberHolders in each slab. Must be a power of two so that id-to-slab
+    // arithmetic compiles down to shifts and masks.
+    static constexpr size_t kSlabSize = 128;
+
+    MemberHolder& _holder(WorkingSetID i) {
+        return _slabs[i / kSlabSize][i % kSlabSize];
+    }
+
+    const MemberHolder& _holder(WorkingSetID i) const {
+        return _slabs[i / kSlabSize][i % kSlabSize];
+    }
+
+    // All WorkingSetIDs are indexes into this slab list, except for INVALID_ID. Members are
+    // allocated a slab at a time rather than individually, slabs are never resized or removed
+    // while the working set is in use (elements are added to _freeList rather than removed when
+    // freed), and all slabs are freed in bulk when the working set is destroyed or cleared. This
+    // also guarantees that a member's address is stable for its id's lifetime, unlike a single
+    // contiguous array which would relocate every member as it grows.
+    std::vector<std::unique_ptr<MemberHolder[]>> _slabs;
+
+    // The number of ids handed out so far, i.e. the number of constructed MemberHolders across all
+    // slabs (whether in use or on the free list).
+    size_t _size = 0;
 
     // Index into _data, forming a linked-list using MemberHolder::nextFreeOrSelf as the next
     // link. INVALID_ID is the list terminator since 0 is a valid index.
@@ -330,4 +330,24 @@ TEST_F(WorkingSetFixture, WsmCanBeExtractedAndReinserted) {
     ASSERT_FALSE(emplacedWsm->metadata());
 }
 
+TEST_F(WorkingSetFixture, MemberPointersRemainValidAsWorkingSetGrows) {
+    member->recordId = RecordId{1};
+    ws->transitionToRecordIdAndObj(id);
+
+    // Allocate enough members to force the working set to grow through several slabs. The pointer
+    // previously returned for 'id' must remain valid throughout.
+    std::vector<WorkingSetID> ids;
+    for (int i = 0; i < 1000; ++i) {
+        auto newId = ws->allocate();
+        ws->get(newId)->recordId = RecordId{2 + i};
+        ids.push_back(newId);
+    }
+
+    ASSERT_EQ(member, ws->get(id));
+    ASSERT_EQ(member->recordId.getLong(), 1);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(ws->get(ids[i])->recordId.getLong(), 2 + i);
+    }
+}
+
 }  // namespace mongo
@@ -49,6 +49,11 @@ public:
 
     // FcvOpObserver overrides.
 
+    // The FCV document lives in admin.system.version.
+    NamespaceFilter getNamespaceFilter() const final {
+        return NamespaceFilter::kSystem;
+    }
+
     void onInserts(OperationContext* opCtx,
                    const NamespaceString& nss,
                    OptionalCollectionUUID uuid,
@@ -45,6 +45,11 @@ public:
     FreeMonOpObserver();
     ~FreeMonOpObserver();
 
+    // The free monitoring state document lives in admin.system.version.
+    NamespaceFilter getNamespaceFilter() const final {
+        return NamespaceFilter::kSystem;
+    }
+
     void onCreateIndex(OperationContext* opCtx,
                        const NamespaceString& nss,
                        CollectionUUID uuid,
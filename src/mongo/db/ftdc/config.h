@@ -46,6 +46,7 @@ struct FTDCConfig {
           maxDirectorySizeBytes(kMaxDirectorySizeBytesDefault),
           maxFileSizeBytes(kMaxFileSizeBytesDefault),
           period(kPeriodMillisDefault),
+          periodRapid(kPeriodRapidMillisDefault),
           maxSamplesPerArchiveMetricChunk(kMaxSamplesPerArchiveMetricChunkDefault),
           maxSamplesPerInterimMetricChunk(kMaxSamplesPerInterimMetricChunkDefault) {}
 
@@ -73,6 +74,14 @@ struct FTDCConfig {
      */
     Milliseconds period;
 
+    /**
+     * Period at which to sample the rapid (sub-period) collectors between full collections.
+     *
+     * Zero disables the rapid tier. Rapid samples are buffered in memory and folded into the next
+     * full sample so they flow through the regular chunk compression and file format.
+     */
+    Milliseconds periodRapid;
+
     /**
      * Maximum number of samples to collect in an archive metric chunk for long term storage.
      */
@@ -87,6 +96,7 @@ struct FTDCConfig {
     static const bool kEnabledDefault = true;
 
     static const std::int64_t kPeriodMillisDefault;
+    static const std::int64_t kPeriodRapidMillisDefault;
     static const std::uint64_t kMaxDirectorySizeBytesDefault = 200 * 1024 * 1024;
     static const std::uint64_t kMaxFileSizeBytesDefault = 10 * 1024 * 1024;
 
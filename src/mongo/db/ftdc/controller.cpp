@@ -33,6 +33,7 @@
 
 #include "mongo/db/ftdc/controller.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/db/client.h"
@@ -49,6 +50,42 @@
 
 namespace mongo {
 
+namespace {
+
+// Upper bound on rapid samples buffered between two full collections. Guards against unbounded
+// memory growth if the full period is configured to be much larger than the rapid period.
+constexpr size_t kMaxBufferedRapidSamples = 600;
+
+/**
+ * Surfaces the rapid-tier samples buffered by the controller since the previous full collection as
+ * a section of the periodic sample, so that sub-period data flows through the existing chunk
+ * compression and file format unmodified.
+ */
+class RapidSampleBufferCollector final : public FTDCCollectorInterface {
+public:
+    explicit RapidSampleBufferCollector(std::vector<BSONObj>* buffer) : _buffer(buffer) {}
+
+    std::string name() const final {
+        return "rapidMetrics";
+    }
+
+    void collect(OperationContext* opCtx, BSONObjBuilder& builder) final {
+        BSONArrayBuilder samples(builder.subarrayStart("samples"_sd));
+        for (const auto& sample : *_buffer) {
+            samples.append(sample);
+        }
+        samples.done();
+        _buffer->clear();
+    }
+
+private:
+    // Owned by FTDCController and only touched on its background thread, which is also the thread
+    // that runs the periodic collectors.
+    std::vector<BSONObj>* _buffer;
+};
+
+}  // namespace
+
 Status FTDCController::setEnabled(bool enabled) {
     stdx::lock_guard<Latch> lock(_mutex);
 
@@ -70,6 +107,12 @@ void FTDCController::setPeriod(Milliseconds millis) {
     _condvar.notify_one();
 }
 
+void FTDCController::setPeriodRapid(Milliseconds millis) {
+    stdx::lock_guard<Latch> lock(_mutex);
+    _configTemp.periodRapid = millis;
+    _condvar.notify_one();
+}
+
 void FTDCController::setMaxDirectorySizeBytes(std::uint64_t size) {
     stdx::lock_guard<Latch> lock(_mutex);
     _configTemp.maxDirectorySizeBytes = size;
@@ -120,6 +163,22 @@ void FTDCController::addPeriodicCollector(std::unique_ptr<FTDCCollectorInterface
     }
 }
 
+void FTDCController::addRapidCollector(std::unique_ptr<FTDCCollectorInterface> collector) {
+    {
+        stdx::lock_guard<Latch> lock(_mutex);
+        invariant(_state == State::kNotStarted);
+
+        if (_rapidCollectors.empty()) {
+            // The buffered rapid samples reach the output stream by being appended to each
+            // periodic sample.
+            _periodicCollectors.add(
+                std::make_unique<RapidSampleBufferCollector>(&_rapidSampleBuffer));
+        }
+
+        _rapidCollectors.add(std::move(collector));
+    }
+}
+
 void FTDCController::addOnRotateCollector(std::unique_ptr<FTDCCollectorInterface> collector) {
     {
         stdx::lock_guard<Latch> lock(_mutex);
@@ -205,8 +264,17 @@ void FTDCController::doLoop() noexcept {
         // Skipping an interval due to a race condition with a config signal is harmless.
         auto now = getGlobalServiceContext()->getPreciseClockSource()->now();
 
-        // Get next time to run at
-        auto next_time = FTDCUtil::roundTime(now, _config.period);
+        // When the rapid tier is active, also wake at the rapid period so that cheap sub-period
+        // samples can be taken between full collections.
+        bool rapidActive = _config.enabled && _config.periodRapid > Milliseconds(0) &&
+            _config.periodRapid < _config.period && !_rapidCollectors.empty();
+
+        // Get next time to run at. A wakeup that does not fall on a full-period boundary only
+        // samples the rapid collectors.
+        auto next_full_time = FTDCUtil::roundTime(now, _config.period);
+        auto next_time = rapidActive
+            ? std::min(next_full_time, FTDCUtil::roundTime(now, _config.periodRapid))
+            : next_full_time;
 
         // Wait for the next run or signal to shutdown
         {
@@ -246,6 +314,17 @@ void FTDCController::doLoop() noexcept {
                 _mgr = uassertStatusOK(std::move(swMgr));
             }
 
+            if (rapidActive && next_time != next_full_time) {
+                // This wakeup falls between full-period boundaries: sample only the rapid
+                // collectors and buffer the result until the next full collection drains it.
+                if (_rapidSampleBuffer.size() < kMaxBufferedRapidSamples) {
+                    auto rapidSample = _rapidCollectors.collect(client);
+                    _rapidSampleBuffer.emplace_back(std::get<0>(rapidSample));
+                }
+
+                continue;
+            }
+
             auto collectSample = _periodicCollectors.collect(client);
 
             Status s = _mgr->writeSampleAndRotateIfNeeded(
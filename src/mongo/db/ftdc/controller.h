@@ -75,6 +75,11 @@ public:
      */
     void setPeriod(Milliseconds millis);
 
+    /**
+     * Set the period for the rapid (sub-period) collectors. Zero disables the rapid tier.
+     */
+    void setPeriodRapid(Milliseconds millis);
+
     /**
      * Set the maximum directory size in bytes.
      */
@@ -111,6 +116,14 @@ public:
      */
     void addPeriodicCollector(std::unique_ptr<FTDCCollectorInterface> collector);
 
+    /**
+     * Add a metric collector to sample at the rapid period between full collections. Rapid
+     * collectors must be cheap (e.g. direct reads of atomic counters) since they run an order of
+     * magnitude more often than the periodic collectors. Their samples are buffered and emitted
+     * as part of the next periodic sample.
+     */
+    void addRapidCollector(std::unique_ptr<FTDCCollectorInterface> collector);
+
     /**
      * Add a collector to collect on server start, and file rotation. i.e. hostInfo
      *
@@ -200,6 +213,13 @@ private:
     // Set of periodic collectors
     FTDCCollectorCollection _periodicCollectors;
 
+    // Set of rapid (sub-period) collectors
+    FTDCCollectorCollection _rapidCollectors;
+
+    // Rapid samples taken since the last full collection, waiting to be folded into the next
+    // periodic sample. Only accessed from the background thread.
+    std::vector<BSONObj> _rapidSampleBuffer;
+
     // Last seen sample document from periodic collectors
     // Owned
     BSONObj _mostRecentPeriodicDocument;
@@ -211,6 +211,53 @@ TEST_F(FTDCControllerTest, TestFull) {
     ValidateDocumentList(alog, allDocs, FTDCValidationMode::kStrict);
 }
 
+// Test that rapid collectors are sampled between full collections and that their buffered samples
+// are folded into the periodic sample document
+TEST_F(FTDCControllerTest, TestRapidCollectors) {
+    unittest::TempDir tempdir("metrics_testpath");
+    boost::filesystem::path dir(tempdir.path());
+
+    createDirectoryClean(dir);
+
+    FTDCConfig config;
+    config.enabled = true;
+    config.period = Milliseconds(100);
+    config.periodRapid = Milliseconds(1);
+    config.maxFileSizeBytes = FTDCConfig::kMaxFileSizeBytesDefault;
+    config.maxDirectorySizeBytes = FTDCConfig::kMaxDirectorySizeBytesDefault;
+
+    FTDCController c(dir, config);
+
+    auto c1 = std::make_unique<FTDCMetricsCollectorMock2>();
+    auto cr = std::make_unique<FTDCMetricsCollectorMock2>();
+
+    auto c1Ptr = c1.get();
+    auto crPtr = cr.get();
+
+    c1Ptr->setSignalOnCount(2);
+    crPtr->setSignalOnCount(50);
+
+    c.addPeriodicCollector(std::move(c1));
+    c.addRapidCollector(std::move(cr));
+
+    c.start();
+
+    // Wait for the rapid collector to be sampled many times while the periodic collector runs at
+    // a much coarser period.
+    crPtr->wait();
+    c1Ptr->wait();
+
+    c.stop();
+
+    ASSERT_GREATER_THAN_OR_EQUALS(crPtr->getDocs().size(), 50UL);
+    ASSERT_GREATER_THAN(crPtr->getDocs().size(), c1Ptr->getDocs().size());
+
+    // The periodic sample document carries the buffered rapid samples as an array section.
+    auto doc = c.getMostRecentPeriodicDocument();
+    ASSERT_TRUE(doc.hasField("rapidMetrics"));
+    ASSERT_EQUALS(doc["rapidMetrics"]["samples"].type(), Array);
+}
+
 // Test we can start and stop the controller in quick succession, make sure it succeeds without
 // assert or fault
 TEST_F(FTDCControllerTest, TestStartStop) {
@@ -46,6 +46,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/mirror_maestro.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/stats/counters.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/util/synchronized_value.h"
 
@@ -117,6 +118,15 @@ Status onUpdateFTDCPeriod(const std::int32_t potentialNewValue) {
     return Status::OK();
 }
 
+Status onUpdateFTDCPeriodRapid(const std::int32_t potentialNewValue) {
+    auto controller = getGlobalFTDCController();
+    if (controller) {
+        controller->setPeriodRapid(Milliseconds(potentialNewValue));
+    }
+
+    return Status::OK();
+}
+
 Status onUpdateFTDCDirectorySize(const std::int32_t potentialNewValue) {
     if (potentialNewValue < ftdcStartupParams.maxFileSizeMB.load()) {
         return Status(
@@ -268,6 +278,27 @@ private:
     bool _serverShuttingDown;
 };
 
+/**
+ * A rapid-tier collector that reads a curated set of atomic counters directly. Unlike the
+ * serverStatus collector it involves no command dispatch, so it is cheap enough to sample an order
+ * of magnitude more often than the full periodic collection.
+ */
+class FTDCRapidCounterCollector : public FTDCCollectorInterface {
+public:
+    void collect(OperationContext* opCtx, BSONObjBuilder& builder) final {
+        builder.append("opcounters", globalOpCounters.getObj());
+
+        {
+            BSONObjBuilder network(builder.subobjStart("network"_sd));
+            networkCounter.append(network);
+        }
+    }
+
+    std::string name() const final {
+        return "counters";
+    }
+};
+
 // Register the FTDC system
 // Note: This must be run before the server parameters are parsed during startup
 // so that the FTDCController is initialized.
@@ -277,6 +308,7 @@ void startFTDC(boost::filesystem::path& path,
                RegisterCollectorsFunction registerCollectors) {
     FTDCConfig config;
     config.period = Milliseconds(ftdcStartupParams.periodMillis.load());
+    config.periodRapid = Milliseconds(ftdcStartupParams.periodRapidMillis.load());
     // Only enable FTDC if our caller says to enable FTDC, MongoS may not have a valid path to write
     // files to so update the diagnosticDataCollectionEnabled set parameter to reflect that.
     ftdcStartupParams.enabled.store(startupMode == FTDCStartMode::kStart &&
@@ -299,6 +331,11 @@ void startFTDC(boost::filesystem::path& path,
     // GetDiagnosticDataCommand
     controller->addPeriodicCollector(std::make_unique<FTDCServerStatusCommandCollector>());
 
+    // Install rapid collectors
+    // These are sampled at the rapid period between full collections and must stay cheap; their
+    // samples are folded into the periodic sample document.
+    controller->addRapidCollector(std::make_unique<FTDCRapidCounterCollector>());
+
     registerCollectors(controller.get());
 
     // Install System Metric Collector as a periodic collector
@@ -177,9 +177,18 @@ void FTSSpec::scoreDocument(const BSONObj& obj, TermFrequencyMap* term_freqs) co
 
     FTSElementIterator it(*this, obj);
 
+    // Most documents are single-language, so reuse one tokenizer across the indexed values and
+    // rebuild it only when the language changes. Creating a tokenizer allocates a stemmer and
+    // working buffers, which dominates tokenization cost for specs with many text fields.
+    std::unique_ptr<FTSTokenizer> tokenizer;
+    const FTSLanguage* tokenizerLanguage = nullptr;
+
     while (it.more()) {
         FTSIteratorValue val = it.next();
-        std::unique_ptr<FTSTokenizer> tokenizer(val._language->createTokenizer());
+        if (val._language != tokenizerLanguage) {
+            tokenizer = val._language->createTokenizer();
+            tokenizerLanguage = val._language;
+        }
         _scoreStringV2(tokenizer.get(), val._text, term_freqs, val._weight);
     }
 }
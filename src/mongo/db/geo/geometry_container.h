@@ -46,6 +46,9 @@ public:
      */
     GeometryContainer() = default;
 
+    GeometryContainer(GeometryContainer&&) = default;
+    GeometryContainer& operator=(GeometryContainer&&) = default;
+
     /**
      * Loads an empty GeometryContainer from query.
      */
@@ -0,0 +1,114 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/index/column_key_generator.h"
+
+#include <map>
+
+namespace mongo {
+namespace {
+
+// Ordered so that cells are emitted in ascending path order, which is the order a column-aware
+// storage format would write them in.
+using CellMap = std::map<std::string, ColumnKeyGenerator::Cell>;
+
+ColumnKeyGenerator::Cell& getCell(const std::string& path, CellMap* cells) {
+    auto& cell = (*cells)[path];
+    if (cell.path.empty()) {
+        cell.path = path;
+    }
+    return cell;
+}
+
+/**
+ * Records one value found at 'path'. 'insideArray' is true if any enclosing container on the way
+ * here was an array; 'directlyInArray' is true only when 'elem' is itself an element of an array,
+ * which is what distinguishes a nested array from a traversable one.
+ */
+void shredValue(BSONElement elem,
+                const std::string& path,
+                bool insideArray,
+                bool directlyInArray,
+                CellMap* cells) {
+    auto& cell = getCell(path, cells);
+    if (insideArray) {
+        cell.isInsideArray = true;
+    }
+
+    switch (elem.type()) {
+        case BSONType::Object: {
+            BSONObj obj = elem.embeddedObject();
+            if (obj.isEmpty()) {
+                cell.values.push_back(elem);
+                return;
+            }
+            cell.hasSubPaths = true;
+            for (auto&& field : obj) {
+                shredValue(field, path + "." + field.fieldName(), insideArray, false, cells);
+            }
+            return;
+        }
+        case BSONType::Array: {
+            BSONObj arr = elem.embeddedObject();
+            if (arr.isEmpty()) {
+                cell.values.push_back(elem);
+                return;
+            }
+            if (directlyInArray) {
+                cell.hasNestedArrays = true;
+                cell.values.push_back(elem);
+                return;
+            }
+            for (auto&& arrElem : arr) {
+                shredValue(arrElem, path, true, true, cells);
+            }
+            return;
+        }
+        default:
+            cell.values.push_back(elem);
+            return;
+    }
+}
+
+}  // namespace
+
+void ColumnKeyGenerator::visitCellsForDocument(const BSONObj& doc,
+                                               const std::function<void(const Cell&)>& cb) {
+    CellMap cells;
+    for (auto&& field : doc) {
+        shredValue(field, field.fieldName(), false, false, &cells);
+    }
+    for (auto&& entry : cells) {
+        cb(entry.second);
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,83 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "mongo/db/jsobj.h"
+
+namespace mongo {
+
+/**
+ * Decomposes ("shreds") a document into one cell per distinct dotted path, the per-column unit of
+ * storage for a columnar projection index. Each cell carries every value reachable at its path
+ * together with the structural flags a reader needs to answer a projection of that path without
+ * fetching the document.
+ *
+ * This is the key-generation half of such an index; maintenance through the IndexAccessMethod
+ * framework and a column-aware storage format layer on top of it.
+ */
+class ColumnKeyGenerator {
+public:
+    struct Cell {
+        // Dotted path of this column. Array traversal does not contribute path components.
+        std::string path;
+
+        // Every value reachable at 'path', in document order, excluding non-empty objects (which
+        // instead set 'hasSubPaths' and contribute cells at longer paths). Elements point into the
+        // document passed to visitCellsForDocument() and must not outlive it.
+        std::vector<BSONElement> values;
+
+        // At least one non-empty object lies at 'path', so longer paths descend from this cell.
+        bool hasSubPaths = false;
+
+        // 'path' is reached through at least one array, so the cell may hold multiple values for
+        // one document.
+        bool isInsideArray = false;
+
+        // At least one value is an array nested directly inside another array. A reader cannot
+        // reconstruct the shape of such a path from the cell alone and must fetch the document.
+        bool hasNestedArrays = false;
+    };
+
+    /**
+     * Shreds 'doc' and invokes 'cb' once per cell, in ascending path order.
+     *
+     * Arrays are traversed transparently: their elements contribute values at the enclosing path,
+     * and objects inside them extend the path as usual. Empty objects and empty arrays are leaf
+     * values. The BSONElements handed to 'cb' point into 'doc'.
+     */
+    static void visitCellsForDocument(const BSONObj& doc,
+                                      const std::function<void(const Cell&)>& cb);
+};
+
+}  // namespace mongo
@@ -0,0 +1,172 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/index/column_key_generator.h"
+
+#include "mongo/db/json.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+std::vector<ColumnKeyGenerator::Cell> shred(const BSONObj& doc) {
+    std::vector<ColumnKeyGenerator::Cell> cells;
+    ColumnKeyGenerator::visitCellsForDocument(
+        doc, [&](const ColumnKeyGenerator::Cell& cell) { cells.push_back(cell); });
+    return cells;
+}
+
+void assertValues(const ColumnKeyGenerator::Cell& cell, const std::vector<BSONObj>& expected) {
+    ASSERT_EQ(cell.values.size(), expected.size()) << "path: " << cell.path;
+    for (size_t i = 0; i < expected.size(); i++) {
+        // Field names are path components or array indexes, not part of the cell value.
+        ASSERT_EQ(cell.values[i].woCompare(expected[i].firstElement(), false), 0)
+            << "path: " << cell.path << ", value " << i;
+    }
+}
+
+TEST(ColumnKeyGeneratorTest, ShredsFlatDocument) {
+    auto cells = shred(fromjson("{a: 1, b: 'x'}"));
+    ASSERT_EQ(cells.size(), 2U);
+
+    ASSERT_EQ(cells[0].path, "a");
+    assertValues(cells[0], {fromjson("{'': 1}")});
+    ASSERT_FALSE(cells[0].hasSubPaths);
+    ASSERT_FALSE(cells[0].isInsideArray);
+    ASSERT_FALSE(cells[0].hasNestedArrays);
+
+    ASSERT_EQ(cells[1].path, "b");
+    assertValues(cells[1], {fromjson("{'': 'x'}")});
+}
+
+TEST(ColumnKeyGeneratorTest, EmitsCellForIntermediatePath) {
+    auto cells = shred(fromjson("{a: {b: 1}}"));
+    ASSERT_EQ(cells.size(), 2U);
+
+    ASSERT_EQ(cells[0].path, "a");
+    assertValues(cells[0], {});
+    ASSERT_TRUE(cells[0].hasSubPaths);
+
+    ASSERT_EQ(cells[1].path, "a.b");
+    assertValues(cells[1], {fromjson("{'': 1}")});
+    ASSERT_FALSE(cells[1].hasSubPaths);
+}
+
+TEST(ColumnKeyGeneratorTest, UnwindsArraysWithoutPathComponents) {
+    auto cells = shred(fromjson("{a: [1, 2]}"));
+    ASSERT_EQ(cells.size(), 1U);
+
+    ASSERT_EQ(cells[0].path, "a");
+    assertValues(cells[0], {fromjson("{'': 1}"), fromjson("{'': 2}")});
+    ASSERT_TRUE(cells[0].isInsideArray);
+    ASSERT_FALSE(cells[0].hasNestedArrays);
+}
+
+TEST(ColumnKeyGeneratorTest, ObjectsInsideArraysExtendThePath) {
+    auto cells = shred(fromjson("{a: [{b: 1}, {b: 2}]}"));
+    ASSERT_EQ(cells.size(), 2U);
+
+    ASSERT_EQ(cells[0].path, "a");
+    assertValues(cells[0], {});
+    ASSERT_TRUE(cells[0].hasSubPaths);
+    ASSERT_TRUE(cells[0].isInsideArray);
+
+    ASSERT_EQ(cells[1].path, "a.b");
+    assertValues(cells[1], {fromjson("{'': 1}"), fromjson("{'': 2}")});
+    ASSERT_TRUE(cells[1].isInsideArray);
+}
+
+TEST(ColumnKeyGeneratorTest, MixedScalarAndObjectInArray) {
+    auto cells = shred(fromjson("{a: [1, {b: 2}]}"));
+    ASSERT_EQ(cells.size(), 2U);
+
+    ASSERT_EQ(cells[0].path, "a");
+    assertValues(cells[0], {fromjson("{'': 1}")});
+    ASSERT_TRUE(cells[0].hasSubPaths);
+    ASSERT_TRUE(cells[0].isInsideArray);
+
+    ASSERT_EQ(cells[1].path, "a.b");
+    assertValues(cells[1], {fromjson("{'': 2}")});
+    ASSERT_TRUE(cells[1].isInsideArray);
+}
+
+TEST(ColumnKeyGeneratorTest, FlagsNestedArraysAsValues) {
+    auto cells = shred(fromjson("{a: [[1, 2], 3]}"));
+    ASSERT_EQ(cells.size(), 1U);
+
+    ASSERT_EQ(cells[0].path, "a");
+    ASSERT_TRUE(cells[0].hasNestedArrays);
+    ASSERT_TRUE(cells[0].isInsideArray);
+    assertValues(cells[0], {fromjson("{'': [1, 2]}"), fromjson("{'': 3}")});
+}
+
+TEST(ColumnKeyGeneratorTest, EmptyObjectAndArrayAreLeafValues) {
+    auto cells = shred(fromjson("{a: {}, b: []}"));
+    ASSERT_EQ(cells.size(), 2U);
+
+    ASSERT_EQ(cells[0].path, "a");
+    assertValues(cells[0], {fromjson("{'': {}}")});
+    ASSERT_FALSE(cells[0].hasSubPaths);
+
+    ASSERT_EQ(cells[1].path, "b");
+    assertValues(cells[1], {fromjson("{'': []}")});
+    ASSERT_FALSE(cells[1].isInsideArray);
+}
+
+TEST(ColumnKeyGeneratorTest, CellsAreEmittedInAscendingPathOrder) {
+    auto cells = shred(fromjson("{b: 1, a: {z: 1, c: 1}}"));
+    ASSERT_EQ(cells.size(), 4U);
+    ASSERT_EQ(cells[0].path, "a");
+    ASSERT_EQ(cells[1].path, "a.c");
+    ASSERT_EQ(cells[2].path, "a.z");
+    ASSERT_EQ(cells[3].path, "b");
+}
+
+TEST(ColumnKeyGeneratorTest, DeepNestingThroughArraysAndObjects) {
+    auto cells = shred(fromjson("{a: [{b: [{c: 1}, {c: 2}]}]}"));
+    ASSERT_EQ(cells.size(), 3U);
+
+    ASSERT_EQ(cells[0].path, "a");
+    ASSERT_TRUE(cells[0].hasSubPaths);
+    ASSERT_TRUE(cells[0].isInsideArray);
+
+    ASSERT_EQ(cells[1].path, "a.b");
+    ASSERT_TRUE(cells[1].hasSubPaths);
+    ASSERT_TRUE(cells[1].isInsideArray);
+    assertValues(cells[1], {});
+
+    ASSERT_EQ(cells[2].path, "a.b.c");
+    ASSERT_TRUE(cells[2].isInsideArray);
+    assertValues(cells[2], {fromjson("{'': 1}"), fromjson("{'': 2}")});
+}
+
+}  // namespace
+}  // namespace mongo
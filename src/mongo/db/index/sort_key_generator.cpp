@@ -153,6 +153,21 @@ StatusWith<BSONObj> SortKeyGenerator::computeSortKeyFromDocumentWithoutMetadata(
         return BSONObj();
     }
 
+    auto keyString = computeSortKeyString(obj);
+    if (!keyString.isOK()) {
+        return keyString.getStatus();
+    }
+
+    // The sort key is the first index key, ordered according to the pattern '_sortSpecWithoutMeta'.
+    return KeyString::toBson(keyString.getValue(), Ordering::make(_sortSpecWithoutMeta));
+}
+
+StatusWith<KeyString::Value> SortKeyGenerator::computeSortKeyString(const BSONObj& obj) const {
+    // Not sorting by anything in the key; every document gets the same (empty) key.
+    if (_sortSpecWithoutMeta.isEmpty()) {
+        return KeyString::Value{};
+    }
+
     // We will sort 'obj' in the same order an index over '_sortSpecWithoutMeta' would have. This is
     // tricky. Consider the sort pattern {a:1} and the document {a: [1, 10]}. We have potentially
     // two keys we could use to sort on. Here we extract these keys.
@@ -184,7 +199,9 @@ StatusWith<BSONObj> SortKeyGenerator::computeSortKeyFromDocumentWithoutMetadata(
     invariant(!keys.empty());
 
     // The sort key is the first index key, ordered according to the pattern '_sortSpecWithoutMeta'.
-    return KeyString::toBson(*keys.begin(), Ordering::make(_sortSpecWithoutMeta));
+    // The KeyString::Value shares ownership of the underlying buffer, so it remains valid after
+    // 'allocator' goes out of scope.
+    return *keys.begin();
 }
 
 Value SortKeyGenerator::getCollationComparisonKey(const Value& val) const {
@@ -71,6 +71,15 @@ public:
         return computeSortKeyFromDocument(doc, doc.metadata());
     }
 
+    /**
+     * Returns the sort key for 'obj' in KeyString form, ignoring any $meta components of the sort
+     * pattern. The returned values order the corresponding documents when compared with
+     * KeyString::Value::compare(), and incorporate the collation, so no further collation-aware
+     * comparison is necessary. Useful for callers that only need to rank documents against one
+     * another and want to avoid materializing the sort key as BSON or Value.
+     */
+    StatusWith<KeyString::Value> computeSortKeyString(const BSONObj& obj) const;
+
     bool isSingleElementKey() const {
         return _sortPattern.isSingleElementKey();
     }
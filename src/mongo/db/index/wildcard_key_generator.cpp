@@ -62,19 +62,16 @@ void popPathComponent(BSONElement elem, bool enclosingObjIsArray, FieldRef* path
         pathToElem->removeLastPart();
     }
 }
-}  // namespace
-
-constexpr StringData WildcardKeyGenerator::kSubtreeSuffix;
 
-WildcardProjection WildcardKeyGenerator::createProjectionExecutor(BSONObj keyPattern,
-                                                                  BSONObj pathProjection) {
+// Computes the projection spec described by the keyPattern and pathProjection arguments. The
+// _keyPattern is either { "$**": ±1 } for all paths or { "path.$**": ±1 } for a single subtree.
+// If we are indexing a single subtree, then we will project just that path.
+BSONObj makeProjectionSpec(BSONObj keyPattern, BSONObj pathProjection) {
     // We should never have a key pattern that contains more than a single element.
     invariant(keyPattern.nFields() == 1);
 
-    // The _keyPattern is either { "$**": ±1 } for all paths or { "path.$**": ±1 } for a single
-    // subtree. If we are indexing a single subtree, then we will project just that path.
     auto indexRoot = keyPattern.firstElement().fieldNameStringData();
-    auto suffixPos = indexRoot.find(kSubtreeSuffix);
+    auto suffixPos = indexRoot.find(WildcardKeyGenerator::kSubtreeSuffix);
 
     // If we're indexing a single subtree, we can't also specify a path projection.
     invariant(suffixPos == std::string::npos || pathProjection.isEmpty());
@@ -82,9 +79,17 @@ WildcardProjection WildcardKeyGenerator::createProjectionExecutor(BSONObj keyPat
     // If this is a subtree projection, the projection spec is { "path.to.subtree": 1 }. Otherwise,
     // we use the path projection from the original command object. If the path projection is empty
     // we default to {_id: 0}, since empty projections are illegal and will be rejected when parsed.
-    auto projSpec = (suffixPos != std::string::npos
-                         ? BSON(indexRoot.substr(0, suffixPos) << 1)
-                         : pathProjection.isEmpty() ? kDefaultProjection : pathProjection);
+    return (suffixPos != std::string::npos
+                ? BSON(indexRoot.substr(0, suffixPos) << 1)
+                : pathProjection.isEmpty() ? kDefaultProjection : pathProjection.getOwned());
+}
+}  // namespace
+
+constexpr StringData WildcardKeyGenerator::kSubtreeSuffix;
+
+WildcardProjection WildcardKeyGenerator::createProjectionExecutor(BSONObj keyPattern,
+                                                                  BSONObj pathProjection) {
+    auto projSpec = makeProjectionSpec(keyPattern, pathProjection);
 
     // Construct a dummy ExpressionContext for ProjectionExecutor. It's OK to set the
     // ExpressionContext's OperationContext and CollatorInterface to 'nullptr' and the namespace
@@ -97,6 +102,47 @@ WildcardProjection WildcardKeyGenerator::createProjectionExecutor(BSONObj keyPat
         expCtx, &projection, policies, projection_executor::kDefaultBuilderParams)};
 }
 
+boost::optional<WildcardKeyGenerator::TopLevelFieldFilter>
+WildcardKeyGenerator::_compileTopLevelFilter(BSONObj projSpec) {
+    boost::optional<bool> isInclusion;
+    StringSet fields;
+    boost::optional<bool> idIncluded;
+
+    for (auto&& elt : projSpec) {
+        if (!elt.isNumber() && !elt.isBoolean()) {
+            return boost::none;
+        }
+        const bool included = elt.trueValue();
+        const auto path = elt.fieldNameStringData();
+        if (path == "_id"_sd) {
+            idIncluded = included;
+            continue;
+        }
+        if (path.find('.') != std::string::npos) {
+            // Dotted path; partial descent into subdocuments needs the executor.
+            return boost::none;
+        }
+        if (isInclusion && *isInclusion != included) {
+            // Mixed specs are rejected when the projection is parsed; be defensive here.
+            return boost::none;
+        }
+        isInclusion = included;
+        fields.insert(std::string{path});
+    }
+
+    // Per DefaultIdPolicy::kExcludeId, _id is excluded unless the spec says otherwise.
+    const bool includeId = idIncluded.value_or(false);
+    if (!isInclusion) {
+        // The spec mentions only _id; it behaves as an inclusion or exclusion of just that field.
+        isInclusion = includeId;
+    }
+
+    if (*isInclusion == includeId) {
+        fields.insert("_id");
+    }
+    return TopLevelFieldFilter{*isInclusion, std::move(fields)};
+}
+
 WildcardKeyGenerator::WildcardKeyGenerator(BSONObj keyPattern,
                                            BSONObj pathProjection,
                                            const CollatorInterface* collator,
@@ -104,6 +150,7 @@ WildcardKeyGenerator::WildcardKeyGenerator(BSONObj keyPattern,
                                            Ordering ordering,
                                            KeyFormat rsKeyFormat)
     : _proj(createProjectionExecutor(keyPattern, pathProjection)),
+      _topLevelFilter(_compileTopLevelFilter(makeProjectionSpec(keyPattern, pathProjection))),
       _collator(collator),
       _keyPattern(keyPattern),
       _keyStringVersion(keyStringVersion),
@@ -121,13 +168,40 @@ void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBuffe
     KeyStringSet::sequence_type multikeyPathsSequence;
     if (multikeyPaths)
         multikeyPathsSequence = multikeyPaths->extract_sequence();
-    _traverseWildcard(pooledBufferBuilder,
-                      _proj.exec()->applyTransformation(Document{inputDoc}).toBson(),
-                      false,
-                      &rootPath,
-                      &keysSequence,
-                      multikeyPaths ? &multikeyPathsSequence : nullptr,
-                      id);
+
+    if (_topLevelFilter) {
+        // The projection only names top-level fields, so we can filter them while traversing the
+        // original document instead of materializing the post-projection document first.
+        for (const auto& elem : inputDoc) {
+            const auto fieldName = elem.fieldNameStringData();
+            // If the element's fieldName contains a ".", fast-path skip it because it's not
+            // queryable.
+            if (fieldName.find('.', 0) != std::string::npos)
+                continue;
+
+            if (!_topLevelFilter->shouldTraverse(fieldName))
+                continue;
+
+            pushPathComponent(elem, false, &rootPath);
+            _traverseElement(pooledBufferBuilder,
+                             elem,
+                             false,
+                             &rootPath,
+                             &keysSequence,
+                             multikeyPaths ? &multikeyPathsSequence : nullptr,
+                             id);
+            popPathComponent(elem, false, &rootPath);
+        }
+    } else {
+        _traverseWildcard(pooledBufferBuilder,
+                          _proj.exec()->applyTransformation(Document{inputDoc}).toBson(),
+                          false,
+                          &rootPath,
+                          &keysSequence,
+                          multikeyPaths ? &multikeyPathsSequence : nullptr,
+                          id);
+    }
+
     if (multikeyPaths)
         multikeyPaths->adopt_sequence(std::move(multikeyPathsSequence));
     keys->adopt_sequence(std::move(keysSequence));
@@ -148,37 +222,47 @@ void WildcardKeyGenerator::_traverseWildcard(SharedBufferFragmentBuilder& pooled
         // Append the element's fieldname to the path, if the enclosing object is not an array.
         pushPathComponent(elem, objIsArray, path);
 
-        switch (elem.type()) {
-            case BSONType::Array:
-                // If this is a nested array, we don't descend it but instead index it as a value.
-                if (_addKeyForNestedArray(pooledBufferBuilder, elem, *path, objIsArray, keys, id))
-                    break;
-
-                // Add an entry for the multi-key path, and then fall through to BSONType::Object.
-                _addMultiKey(pooledBufferBuilder, *path, multikeyPaths);
-
-            case BSONType::Object:
-                if (_addKeyForEmptyLeaf(pooledBufferBuilder, elem, *path, keys, id))
-                    break;
-
-                _traverseWildcard(pooledBufferBuilder,
-                                  elem.Obj(),
-                                  elem.type() == BSONType::Array,
-                                  path,
-                                  keys,
-                                  multikeyPaths,
-                                  id);
-                break;
-
-            default:
-                _addKey(pooledBufferBuilder, elem, *path, keys, id);
-        }
+        _traverseElement(pooledBufferBuilder, elem, objIsArray, path, keys, multikeyPaths, id);
 
         // Remove the element's fieldname from the path, if it was pushed onto it earlier.
         popPathComponent(elem, objIsArray, path);
     }
 }
 
+void WildcardKeyGenerator::_traverseElement(SharedBufferFragmentBuilder& pooledBufferBuilder,
+                                            BSONElement elem,
+                                            bool objIsArray,
+                                            FieldRef* path,
+                                            KeyStringSet::sequence_type* keys,
+                                            KeyStringSet::sequence_type* multikeyPaths,
+                                            boost::optional<RecordId> id) const {
+    switch (elem.type()) {
+        case BSONType::Array:
+            // If this is a nested array, we don't descend it but instead index it as a value.
+            if (_addKeyForNestedArray(pooledBufferBuilder, elem, *path, objIsArray, keys, id))
+                break;
+
+            // Add an entry for the multi-key path, and then fall through to BSONType::Object.
+            _addMultiKey(pooledBufferBuilder, *path, multikeyPaths);
+
+        case BSONType::Object:
+            if (_addKeyForEmptyLeaf(pooledBufferBuilder, elem, *path, keys, id))
+                break;
+
+            _traverseWildcard(pooledBufferBuilder,
+                              elem.Obj(),
+                              elem.type() == BSONType::Array,
+                              path,
+                              keys,
+                              multikeyPaths,
+                              id);
+            break;
+
+        default:
+            _addKey(pooledBufferBuilder, elem, *path, keys, id);
+    }
+}
+
 bool WildcardKeyGenerator::_addKeyForNestedArray(SharedBufferFragmentBuilder& pooledBufferBuilder,
                                                  BSONElement elem,
                                                  const FieldRef& fullPath,
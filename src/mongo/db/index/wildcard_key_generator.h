@@ -34,6 +34,7 @@
 #include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/storage/key_string.h"
 #include "mongo/db/storage/sorted_data_interface.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -82,6 +83,26 @@ public:
                       boost::optional<RecordId> id = boost::none) const;
 
 private:
+    /**
+     * A precompiled top-level field filter, used in place of the ProjectionExecutor when the
+     * projection only includes or excludes top-level fields. Filtering during the traversal of the
+     * original document avoids materializing a Document, running the executor and serializing the
+     * transformed result back to BSON for every document indexed. Projections with dotted paths
+     * fall back to the executor, since partial descent can leave behind empty objects and arrays
+     * whose semantics the executor defines.
+     */
+    struct TopLevelFieldFilter {
+        // True if 'fields' enumerates the fields to keep; false if it enumerates those to drop.
+        bool isInclusion;
+        StringSet fields;
+
+        bool shouldTraverse(StringData fieldName) const {
+            return (fields.count(fieldName) > 0) == isInclusion;
+        }
+    };
+
+    static boost::optional<TopLevelFieldFilter> _compileTopLevelFilter(BSONObj projSpec);
+
     // Traverses every path of the post-projection document, adding keys to the set as it goes.
     void _traverseWildcard(SharedBufferFragmentBuilder& pooledBufferBuilder,
                            BSONObj obj,
@@ -91,6 +112,15 @@ private:
                            KeyStringSet::sequence_type* multikeyPaths,
                            boost::optional<RecordId> id) const;
 
+    // Applies the switch over a single element's type during the traversal above.
+    void _traverseElement(SharedBufferFragmentBuilder& pooledBufferBuilder,
+                          BSONElement elem,
+                          bool objIsArray,
+                          FieldRef* path,
+                          KeyStringSet::sequence_type* keys,
+                          KeyStringSet::sequence_type* multikeyPaths,
+                          boost::optional<RecordId> id) const;
+
     // Helper functions to format the entry appropriately before adding it to the key/path tracker.
     void _addMultiKey(SharedBufferFragmentBuilder& pooledBufferBuilder,
                       const FieldRef& fullPath,
@@ -115,6 +145,10 @@ private:
                              boost::optional<RecordId> id) const;
 
     WildcardProjection _proj;
+
+    // Engaged when the projection spec only names top-level fields; see TopLevelFieldFilter.
+    boost::optional<TopLevelFieldFilter> _topLevelFilter;
+
     const CollatorInterface* _collator;
     const BSONObj _keyPattern;
     const KeyString::Version _keyStringVersion;
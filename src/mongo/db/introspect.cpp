@@ -39,14 +39,18 @@
 #include "mongo/db/auth/user_set.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/client.h"
+#include "mongo/db/concurrency/deferred_writer.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/introspect_gen.h"
 #include "mongo/db/jsobj.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -54,6 +58,82 @@ using std::endl;
 using std::string;
 using std::unique_ptr;
 
+namespace {
+
+// Maximum number of bytes of profile entries buffered in memory per database before further
+// entries are dropped. Sized so that a short write stall on 'system.profile' does not stall the
+// operations being profiled.
+constexpr int64_t kMaxAsyncProfileBufferBytes = 10 * 1024 * 1024;
+
+CollectionOptions profileCollectionOptions() {
+    CollectionOptions options;
+    options.capped = true;
+    options.cappedSize = 1024 * 1024;
+    return options;
+}
+
+/**
+ * Holds one DeferredWriter per profiled database, created lazily the first time a profile entry
+ * for that database is written asynchronously. Writers persist until shutdown; a database that
+ * stops being profiled simply leaves an idle writer behind.
+ */
+class ProfileWriterSet {
+public:
+    ~ProfileWriterSet() {
+        // Normal shutdown goes through shutdownProfileWriters(). This handles ServiceContext
+        // teardown paths (e.g. tests) that never call it.
+        shutdown();
+    }
+
+    /**
+     * Returns the writer for 'dbName', creating and starting it if necessary. Returns nullptr
+     * after shutdown.
+     */
+    DeferredWriter* getWriter(StringData dbName) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_shutdown) {
+            return nullptr;
+        }
+        auto it = _writers.find(dbName);
+        if (it == _writers.end()) {
+            auto writer =
+                std::make_unique<DeferredWriter>(NamespaceString(dbName, "system.profile"),
+                                                 profileCollectionOptions(),
+                                                 kMaxAsyncProfileBufferBytes);
+            writer->startup(str::stream() << "ProfileWriter-" << dbName);
+            it = _writers.emplace(dbName.toString(), std::move(writer)).first;
+        }
+        return it->second.get();
+    }
+
+    /**
+     * Flushes and joins all writers. Entries handed off after this point are dropped.
+     */
+    void shutdown() {
+        decltype(_writers) writers;
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            if (_shutdown) {
+                return;
+            }
+            _shutdown = true;
+            writers = std::move(_writers);
+        }
+        for (auto&& entry : writers) {
+            entry.second->shutdown();
+        }
+    }
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("ProfileWriterSet::_mutex");
+    bool _shutdown = false;
+    StringMap<std::unique_ptr<DeferredWriter>> _writers;
+};
+
+const auto getProfileWriterSet = ServiceContext::declareDecoration<ProfileWriterSet>();
+
+}  // namespace
+
 void profile(OperationContext* opCtx, NetworkOp op) {
     // Initialize with 1kb at start in order to avoid realloc later
     BufBuilder profileBufBuilder(1024);
@@ -92,6 +172,17 @@ void profile(OperationContext* opCtx, NetworkOp op) {
 
     const string dbName(nsToDatabase(CurOp::get(opCtx)->getNS()));
 
+    if (gOperationProfilingAsyncWrites.load()) {
+        // Hand the entry to the background writer rather than reacquiring the database and
+        // writing on the profiled operation's own thread. The writer drops the entry if its
+        // buffer is full and logs how many entries were dropped; during shutdown new entries are
+        // silently discarded.
+        if (auto* writer = getProfileWriterSet(opCtx->getServiceContext()).getWriter(dbName)) {
+            writer->insertDocument(p);
+        }
+        return;
+    }
+
     auto origFlowControl = opCtx->shouldParticipateInFlowControl();
 
     // The system.profile collection is non-replicated, so writes to it do not cause
@@ -196,4 +287,8 @@ Status createProfileCollection(OperationContext* opCtx, Database* db) {
     });
 }
 
+void shutdownProfileWriters(ServiceContext* serviceContext) {
+    getProfileWriterSet(serviceContext).shutdown();
+}
+
 }  // namespace mongo
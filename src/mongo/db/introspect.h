@@ -36,6 +36,7 @@ namespace mongo {
 
 class Database;
 class OperationContext;
+class ServiceContext;
 
 /**
  * Invoked when database profile is enabled.
@@ -47,4 +48,11 @@ void profile(OperationContext* opCtx, NetworkOp op);
  */
 Status createProfileCollection(OperationContext* opCtx, Database* db);
 
+/**
+ * Flushes and joins the background profile entry writers created when
+ * 'operationProfilingAsyncWrites' is enabled. Must be called during clean shutdown while the
+ * storage engine is still available.
+ */
+void shutdownProfileWriters(ServiceContext* serviceContext);
+
 }  // namespace mongo
@@ -88,15 +88,16 @@ void LogicalSessionCacheImpl::joinOnShutDown() {
 
 Status LogicalSessionCacheImpl::startSession(OperationContext* opCtx,
                                              const LogicalSessionRecord& record) {
-    stdx::lock_guard lg(_mutex);
-    return _addToCacheIfNotFull(lg, record);
+    auto partition = _activeSessions.lockOnePartition(record.getId());
+    return _addToCacheIfNotFull(partition, record);
 }
 
 Status LogicalSessionCacheImpl::vivify(OperationContext* opCtx, const LogicalSessionId& lsid) {
-    stdx::lock_guard lg(_mutex);
-    auto it = _activeSessions.find(lsid);
-    if (it == _activeSessions.end())
-        return _addToCacheIfNotFull(lg, makeLogicalSessionRecord(opCtx, lsid, _service->now()));
+    auto partition = _activeSessions.lockOnePartition(lsid);
+    auto it = partition->find(lsid);
+    if (it == partition->end())
+        return _addToCacheIfNotFull(partition,
+                                    makeLogicalSessionRecord(opCtx, lsid, _service->now()));
 
     auto& cacheEntry = it->second;
     cacheEntry.setLastUse(_service->now());
@@ -118,8 +119,7 @@ void LogicalSessionCacheImpl::reapNow(OperationContext* opCtx) {
 }
 
 size_t LogicalSessionCacheImpl::size() {
-    stdx::lock_guard<Latch> lock(_mutex);
-    return _activeSessions.size();
+    return static_cast<size_t>(_numActiveSessions.load());
 }
 
 void LogicalSessionCacheImpl::_periodicRefresh(Client* client) {
@@ -227,8 +227,9 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
 
     const auto replCoord = repl::ReplicationCoordinator::get(opCtx);
     if (replCoord && replCoord->isReplEnabled() && replCoord->getMemberState().arbiter()) {
-        stdx::lock_guard<Latch> lk(_mutex);
-        _activeSessions.clear();
+        auto allPartitions = _activeSessions.lockAllPartitions();
+        allPartitions.clear();
+        _numActiveSessions.store(0);
         return;
     }
 
@@ -275,23 +276,35 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         using std::swap;
         stdx::lock_guard<Latch> lk(_mutex);
         swap(explicitlyEndingSessions, _endingSessions);
-        swap(activeSessions, _activeSessions);
+    }
+
+    {
+        auto allPartitions = _activeSessions.lockAllPartitions();
+        for (auto&& partition : allPartitions) {
+            for (auto&& entry : partition) {
+                activeSessions.insert(std::move(entry));
+            }
+            partition.clear();
+        }
+        _numActiveSessions.store(0);
     }
 
     // Create guards that in the case of a exception replace the ending or active sessions that
     // swapped out of LogicalSessionCache, and merges in any records that had been added since we
     // swapped them out.
-    auto backSwap = [this](auto& member, auto& temp) {
+    auto activeSessionsBackSwapper = makeGuard([&] {
+        auto allPartitions = _activeSessions.lockAllPartitions();
+        for (const auto& it : activeSessions) {
+            allPartitions.insert(it);
+        }
+        _numActiveSessions.store(allPartitions.size());
+    });
+    auto explicitlyEndingBackSwaper = makeGuard([&] {
         stdx::lock_guard<Latch> lk(_mutex);
-        using std::swap;
-        swap(member, temp);
-        for (const auto& it : temp) {
-            member.emplace(it);
+        for (const auto& it : explicitlyEndingSessions) {
+            _endingSessions.emplace(it);
         }
-    };
-    auto activeSessionsBackSwapper = makeGuard([&] { backSwap(_activeSessions, activeSessions); });
-    auto explicitlyEndingBackSwaper =
-        makeGuard([&] { backSwap(_endingSessions, explicitlyEndingSessions); });
+    });
 
     // remove all explicitlyEndingSessions from activeSessions
     for (const auto& lsid : explicitlyEndingSessions) {
@@ -339,12 +352,14 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     // Exclude sessions added to _activeSessions from the openCursorSession to avoid race between
     // killing cursors on the removed sessions and creating sessions.
     {
-        stdx::lock_guard<Latch> lk(_mutex);
-
-        for (const auto& it : _activeSessions) {
-            auto newSessionIt = openCursorSessions.find(it.first);
-            if (newSessionIt != openCursorSessions.end()) {
-                openCursorSessions.erase(newSessionIt);
+        auto allPartitions = _activeSessions.lockAllPartitions();
+
+        for (auto&& partition : allPartitions) {
+            for (const auto& it : partition) {
+                auto newSessionIt = openCursorSessions.find(it.first);
+                if (newSessionIt != openCursorSessions.end()) {
+                    openCursorSessions.erase(newSessionIt);
+                }
             }
         }
     }
@@ -380,12 +395,13 @@ void LogicalSessionCacheImpl::endSessions(const LogicalSessionIdSet& sessions) {
 
 LogicalSessionCacheStats LogicalSessionCacheImpl::getStats() {
     stdx::lock_guard<Latch> lk(_mutex);
-    _stats.setActiveSessionsCount(_activeSessions.size());
+    _stats.setActiveSessionsCount(static_cast<size_t>(_numActiveSessions.load()));
     return _stats;
 }
 
-Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRecord record) {
-    if (_activeSessions.size() >= size_t(maxSessions)) {
+Status LogicalSessionCacheImpl::_addToCacheIfNotFull(ActiveSessionsMap::OnePartition& partition,
+                                                     LogicalSessionRecord record) {
+    if (static_cast<size_t>(_numActiveSessions.load()) >= size_t(maxSessions)) {
         Status status = {ErrorCodes::TooManyLogicalSessions,
                          str::stream()
                              << "Unable to add session ID " << record.getId()
@@ -401,34 +417,40 @@ Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRec
                     "{sessionCount}, maximum: {maxSessions}",
                     "Unable to add session into the cache, too many active sessions",
                     "sessionId"_attr = record.getId(),
-                    "sessionCount"_attr = _activeSessions.size(),
+                    "sessionCount"_attr = _numActiveSessions.load(),
                     "maxSessions"_attr = maxSessions);
         return status;
     }
 
-    _activeSessions.insert(std::make_pair(record.getId(), std::move(record)));
+    if (partition->insert(std::make_pair(record.getId(), std::move(record))).second) {
+        _numActiveSessions.fetchAndAdd(1);
+    }
 
     return Status::OK();
 }
 
 std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds() const {
-    stdx::lock_guard<Latch> lk(_mutex);
     std::vector<LogicalSessionId> ret;
-    ret.reserve(_activeSessions.size());
-    for (const auto& id : _activeSessions) {
-        ret.push_back(id.first);
+    ret.reserve(static_cast<size_t>(_numActiveSessions.load()));
+    auto allPartitions = _activeSessions.lockAllPartitions();
+    for (auto&& partition : allPartitions) {
+        for (const auto& id : partition) {
+            ret.push_back(id.first);
+        }
     }
     return ret;
 }
 
 std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds(
     const std::vector<SHA256Block>& userDigests) const {
-    stdx::lock_guard<Latch> lk(_mutex);
     std::vector<LogicalSessionId> ret;
-    for (const auto& it : _activeSessions) {
-        if (std::find(userDigests.cbegin(), userDigests.cend(), it.first.getUid()) !=
-            userDigests.cend()) {
-            ret.push_back(it.first);
+    auto allPartitions = _activeSessions.lockAllPartitions();
+    for (auto&& partition : allPartitions) {
+        for (const auto& it : partition) {
+            if (std::find(userDigests.cbegin(), userDigests.cend(), it.first.getUid()) !=
+                userDigests.cend()) {
+                ret.push_back(it.first);
+            }
         }
     }
     return ret;
@@ -436,9 +458,9 @@ std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds(
 
 boost::optional<LogicalSessionRecord> LogicalSessionCacheImpl::peekCached(
     const LogicalSessionId& id) const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    const auto it = _activeSessions.find(id);
-    if (it == _activeSessions.end()) {
+    auto partition = _activeSessions.lockOnePartition(id);
+    const auto it = partition->find(id);
+    if (it == partition->end()) {
         return boost::none;
     }
     return it->second;
@@ -29,10 +29,11 @@
 
 #pragma once
 
+#include "mongo/db/catalog/util/partitioned.h"
 #include "mongo/db/logical_session_cache.h"
 #include "mongo/db/service_liaison.h"
 #include "mongo/db/sessions_collection.h"
-#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/functional.h"
 #include "mongo/util/hierarchical_acquisition.h"
 
@@ -90,6 +91,21 @@ public:
     LogicalSessionCacheStats getStats() override;
 
 private:
+    static constexpr int kNumPartitions = 16;
+
+    /**
+     * Assigns each logical session id to one of the active-session partitions based on its hash.
+     */
+    struct LogicalSessionIdPartitioner {
+        std::size_t operator()(const LogicalSessionId& lsid, std::size_t nPartitions) const {
+            return LogicalSessionIdHash()(lsid) % nPartitions;
+        }
+    };
+
+    using ActiveSessionsMap = Partitioned<LogicalSessionIdMap<LogicalSessionRecord>,
+                                          kNumPartitions,
+                                          LogicalSessionIdPartitioner>;
+
     void _periodicRefresh(Client* client);
     void _refresh(Client* client);
 
@@ -101,16 +117,26 @@ private:
      */
     bool _isDead(const LogicalSessionRecord& record, Date_t now) const;
 
-    Status _addToCacheIfNotFull(WithLock, LogicalSessionRecord record);
+    Status _addToCacheIfNotFull(ActiveSessionsMap::OnePartition& partition,
+                                LogicalSessionRecord record);
 
     const std::unique_ptr<ServiceLiaison> _service;
     const std::shared_ptr<SessionsCollection> _sessionsColl;
     const ReapSessionsOlderThanFn _reapSessionsOlderThanFn;
 
+    // Protects _endingSessions and _stats. The active sessions are guarded by the per-partition
+    // locks of '_activeSessions' instead, so that vivification does not serialize on it.
     mutable Mutex _mutex =
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "LogicalSessionCacheImpl::_mutex");
 
-    LogicalSessionIdMap<LogicalSessionRecord> _activeSessions;
+    // The set of sessions known to be active on this node, partitioned by lsid hash so that
+    // operations vivifying different sessions do not contend on a single mutex.
+    mutable ActiveSessionsMap _activeSessions;
+
+    // Tracks the total number of entries in '_activeSessions' without having to lock every
+    // partition. Modified under the affected partition's lock (or with all partitions locked for
+    // wholesale updates), so it stays exact.
+    AtomicWord<long long> _numActiveSessions{0};
 
     LogicalSessionIdSet _endingSessions;
 
@@ -0,0 +1,169 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/matcher/compiled_match_expression.h"
+
+#include <algorithm>
+
+#include "mongo/bson/bsonobjiterator.h"
+
+namespace mongo {
+
+namespace {
+
+// The evaluation loop tracks which predicates have seen their field with a 64-bit mask, so
+// expressions with more predicates than that are left to the interpreter.
+constexpr size_t kMaxPredicates = 64;
+
+/**
+ * Whether 'leaf' can be evaluated through matchesSingleElement() with the compiled traversal.
+ * All accepted types use ElementPath::LeafArrayBehavior::kTraverse on a single-part path, which
+ * the evaluation loop reproduces: array elements first, then the array itself, and a missing
+ * field evaluated as an EOO element.
+ */
+bool isCompilableLeaf(const MatchExpression* leaf) {
+    switch (leaf->matchType()) {
+        case MatchExpression::EQ:
+        case MatchExpression::LT:
+        case MatchExpression::LTE:
+        case MatchExpression::GT:
+        case MatchExpression::GTE:
+        case MatchExpression::MATCH_IN:
+            break;
+        default:
+            return false;
+    }
+
+    // Dotted paths involve non-leaf array traversal, which the single-pass loop does not
+    // reproduce.
+    auto fieldRef = leaf->fieldRef();
+    return fieldRef && fieldRef->numParts() == 1;
+}
+
+/**
+ * Evaluates 'leaf' against the element found at its path, reproducing leaf-array traversal:
+ * each array element is tried before the array as a whole. 'elt' is EOO when the field is
+ * missing.
+ */
+bool evalLeaf(const MatchExpression* leaf, const BSONElement& elt) {
+    if (elt.type() == Array) {
+        BSONObjIterator it(elt.embeddedObject());
+        while (it.more()) {
+            if (leaf->matchesSingleElement(it.next())) {
+                return true;
+            }
+        }
+    }
+    return leaf->matchesSingleElement(elt);
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<CompiledMatchExpression> CompiledMatchExpression::tryCompile(
+    const MatchExpression* expr) {
+    if (!expr) {
+        return nullptr;
+    }
+
+    std::vector<Predicate> predicates;
+    if (isCompilableLeaf(expr)) {
+        predicates.push_back({expr->fieldRef()->dottedField(), expr});
+    } else if (expr->matchType() == MatchExpression::AND) {
+        for (size_t i = 0; i < expr->numChildren(); ++i) {
+            auto child = expr->getChild(i);
+            if (!isCompilableLeaf(child)) {
+                return nullptr;
+            }
+            predicates.push_back({child->fieldRef()->dottedField(), child});
+        }
+    } else {
+        return nullptr;
+    }
+
+    if (predicates.empty() || predicates.size() > kMaxPredicates) {
+        return nullptr;
+    }
+
+    std::sort(predicates.begin(), predicates.end(), [](const Predicate& a, const Predicate& b) {
+        return a.path < b.path;
+    });
+    return std::unique_ptr<CompiledMatchExpression>(
+        new CompiledMatchExpression(std::move(predicates)));
+}
+
+CompiledMatchExpression::CompiledMatchExpression(std::vector<Predicate> predicates)
+    : _predicates(std::move(predicates)) {}
+
+bool CompiledMatchExpression::matches(const BSONObj& obj) const {
+    // Bit i set means predicate i has been evaluated against the first occurrence of its field.
+    // Matching only the first occurrence mirrors BSONObj::getField(), which the interpreted path
+    // uses through ElementPath.
+    uint64_t evaluated = 0;
+    const uint64_t all = (_predicates.size() == 64) ? ~uint64_t(0)
+                                                    : ((uint64_t(1) << _predicates.size()) - 1);
+
+    for (auto&& elt : obj) {
+        StringData name = elt.fieldNameStringData();
+
+        // Find the range of predicates on this field.
+        auto first = std::lower_bound(
+            _predicates.begin(),
+            _predicates.end(),
+            name,
+            [](const Predicate& pred, StringData fieldName) { return pred.path < fieldName; });
+        for (auto it = first; it != _predicates.end() && it->path == name; ++it) {
+            const uint64_t bit = uint64_t(1) << (it - _predicates.begin());
+            if (evaluated & bit) {
+                continue;
+            }
+            evaluated |= bit;
+            if (!evalLeaf(it->leaf, elt)) {
+                return false;
+            }
+        }
+
+        if (evaluated == all) {
+            return true;
+        }
+    }
+
+    // Predicates whose field is absent see an EOO element, matching ElementPath's behavior for
+    // missing paths ({$eq: null} and $in with null accept it; everything else rejects).
+    for (size_t i = 0; i < _predicates.size(); ++i) {
+        if (!(evaluated & (uint64_t(1) << i)) && !_predicates[i].leaf->matchesSingleElement({})) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace mongo
@@ -0,0 +1,90 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/matcher/expression.h"
+
+namespace mongo {
+
+/**
+ * A flattened, non-recursive evaluator for the filter shapes that dominate collection scans.
+ *
+ * Evaluating a MatchExpression costs a virtual matches() call per tree node per document, and each
+ * leaf walks the document again through a heap-allocated ElementIterator. For a single top-level
+ * comparison, a $in, or an $and of such predicates, the same answer can be computed with one pass
+ * over the document's fields, dispatching each element directly to the relevant leaves'
+ * matchesSingleElement().
+ *
+ * tryCompile() returns nullptr for any shape outside that subset (dotted paths, $or, $nor, $not,
+ * $elemMatch, etc.), so callers always keep the original expression around as the fallback.
+ *
+ * A compiled filter holds pointers to the leaves of the MatchExpression tree it was built from and
+ * is valid only as long as that tree is alive. Tagging the tree or reordering its children during
+ * planning does not invalidate it; destroying or rebuilding the tree does.
+ */
+class CompiledMatchExpression {
+public:
+    /**
+     * Attempts to flatten 'expr'. Returns nullptr if 'expr' contains any construct the compiled
+     * form cannot evaluate with identical semantics. 'expr' may be null.
+     */
+    static std::unique_ptr<CompiledMatchExpression> tryCompile(const MatchExpression* expr);
+
+    /**
+     * Returns whether 'obj' satisfies the expression this was compiled from. Must produce the
+     * same answer as MatchExpression::matchesBSON() on the source expression.
+     */
+    bool matches(const BSONObj& obj) const;
+
+    size_t numPredicates() const {
+        return _predicates.size();
+    }
+
+private:
+    struct Predicate {
+        // Top-level field the leaf applies to. Points into the leaf's own storage.
+        StringData path;
+
+        // The leaf to evaluate, via matchesSingleElement(). Not owned.
+        const MatchExpression* leaf;
+    };
+
+    explicit CompiledMatchExpression(std::vector<Predicate> predicates);
+
+    // Sorted by 'path' so one pass over the document can binary search the predicates that apply
+    // to each field. Multiple predicates may share a path ($and of range checks).
+    std::vector<Predicate> _predicates;
+};
+
+}  // namespace mongo
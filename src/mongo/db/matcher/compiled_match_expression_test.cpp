@@ -0,0 +1,142 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/json.h"
+#include "mongo/db/matcher/compiled_match_expression.h"
+#include "mongo/db/matcher/expression_parser.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+std::unique_ptr<MatchExpression> parse(const BSONObj& query) {
+    boost::intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    auto result = MatchExpressionParser::parse(query, std::move(expCtx));
+    ASSERT_OK(result.getStatus());
+    return std::move(result.getValue());
+}
+
+void assertAgreesWithInterpreter(const MatchExpression* expr,
+                                 const CompiledMatchExpression* compiled,
+                                 const BSONObj& doc) {
+    ASSERT_EQ(compiled->matches(doc), expr->matchesBSON(doc))
+        << "filter: " << expr->debugString() << " doc: " << doc;
+}
+
+TEST(CompiledMatchExpression, SingleComparisonAgreesWithInterpreter) {
+    auto expr = parse(fromjson("{a: {$eq: 2}}"));
+    auto compiled = CompiledMatchExpression::tryCompile(expr.get());
+    ASSERT(compiled);
+
+    for (auto&& doc : {fromjson("{a: 2}"),
+                       fromjson("{a: 3}"),
+                       fromjson("{b: 2}"),
+                       fromjson("{a: [1, 2, 3]}"),
+                       fromjson("{a: [3, 4]}"),
+                       fromjson("{a: null}"),
+                       fromjson("{a: 'x'}")}) {
+        assertAgreesWithInterpreter(expr.get(), compiled.get(), doc);
+    }
+}
+
+TEST(CompiledMatchExpression, AndOfRangeChecksAgreesWithInterpreter) {
+    auto expr = parse(fromjson("{a: {$gt: 1, $lt: 5}, b: {$gte: 'm'}}"));
+    auto compiled = CompiledMatchExpression::tryCompile(expr.get());
+    ASSERT(compiled);
+    ASSERT_EQ(3U, compiled->numPredicates());
+
+    for (auto&& doc : {fromjson("{a: 3, b: 'z'}"),
+                       fromjson("{a: 3, b: 'a'}"),
+                       fromjson("{a: 7, b: 'z'}"),
+                       fromjson("{a: 3}"),
+                       fromjson("{b: 'z'}"),
+                       fromjson("{a: [0, 2], b: 'z'}"),
+                       fromjson("{a: [0, 9], b: 'z'}")}) {
+        assertAgreesWithInterpreter(expr.get(), compiled.get(), doc);
+    }
+}
+
+TEST(CompiledMatchExpression, InWithNullMatchesMissingField) {
+    auto expr = parse(fromjson("{a: {$in: [null, 5]}}"));
+    auto compiled = CompiledMatchExpression::tryCompile(expr.get());
+    ASSERT(compiled);
+
+    for (auto&& doc : {fromjson("{a: 5}"),
+                       fromjson("{a: null}"),
+                       fromjson("{}"),
+                       fromjson("{a: 6}"),
+                       fromjson("{a: [1, 5]}")}) {
+        assertAgreesWithInterpreter(expr.get(), compiled.get(), doc);
+    }
+}
+
+TEST(CompiledMatchExpression, EqualityToWholeArrayAgreesWithInterpreter) {
+    auto expr = parse(fromjson("{a: {$eq: [1, 2]}}"));
+    auto compiled = CompiledMatchExpression::tryCompile(expr.get());
+    ASSERT(compiled);
+
+    for (auto&& doc : {fromjson("{a: [1, 2]}"),
+                       fromjson("{a: [[1, 2]]}"),
+                       fromjson("{a: [2, 1]}"),
+                       fromjson("{a: 1}")}) {
+        assertAgreesWithInterpreter(expr.get(), compiled.get(), doc);
+    }
+}
+
+TEST(CompiledMatchExpression, OnlyFirstOccurrenceOfDuplicateFieldIsMatched) {
+    auto expr = parse(fromjson("{a: {$eq: 2}}"));
+    auto compiled = CompiledMatchExpression::tryCompile(expr.get());
+    ASSERT(compiled);
+
+    BSONObjBuilder bob;
+    bob.append("a", 1);
+    bob.append("a", 2);
+    BSONObj doc = bob.obj();
+    assertAgreesWithInterpreter(expr.get(), compiled.get(), doc);
+    ASSERT_FALSE(compiled->matches(doc));
+}
+
+TEST(CompiledMatchExpression, RefusesUnsupportedShapes) {
+    ASSERT_FALSE(CompiledMatchExpression::tryCompile(nullptr));
+    ASSERT_FALSE(CompiledMatchExpression::tryCompile(parse(fromjson("{'a.b': 1}")).get()));
+    ASSERT_FALSE(CompiledMatchExpression::tryCompile(
+        parse(fromjson("{$or: [{a: 1}, {b: 1}]}")).get()));
+    ASSERT_FALSE(CompiledMatchExpression::tryCompile(
+        parse(fromjson("{a: {$elemMatch: {$gt: 1}}}")).get()));
+    ASSERT_FALSE(CompiledMatchExpression::tryCompile(
+        parse(fromjson("{a: {$not: {$gt: 1}}}")).get()));
+    ASSERT_FALSE(
+        CompiledMatchExpression::tryCompile(parse(fromjson("{a: 1, 'b.c': 2}")).get()));
+}
+
+}  // namespace
+}  // namespace mongo
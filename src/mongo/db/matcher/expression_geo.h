@@ -112,6 +112,10 @@ public:
         return *_query;
     }
 
+    const BSONObj& getRawObj() const {
+        return _rawObj;
+    }
+
     void acceptVisitor(MatchExpressionMutableVisitor* visitor) final {
         visitor->visit(this);
     }
@@ -417,6 +417,8 @@ std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
     next->_equalitySet = _equalitySet;
     next->_originalEqualityVector = _originalEqualityVector;
     next->_equalityStorage = _equalityStorage;
+    // The hash set references the clone's own comparator, so it cannot be copied from 'this'.
+    next->_rebuildEqualityHashSet();
     for (auto&& regex : _regexes) {
         std::unique_ptr<RegexMatchExpression> clonedRegex(
             static_cast<RegexMatchExpression*>(regex->shallowClone().release()));
@@ -426,9 +428,25 @@ std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
 }
 
 bool InMatchExpression::contains(const BSONElement& e) const {
+    if (_equalityHashSet) {
+        return _equalityHashSet->count(e) > 0;
+    }
     return std::binary_search(_equalitySet.begin(), _equalitySet.end(), e, _eltCmp.makeLessThan());
 }
 
+void InMatchExpression::_rebuildEqualityHashSet() {
+    // Below this size, the O(log n) binary search over '_equalitySet' costs less per probe than
+    // hashing the probe element, so the hash set is not engaged.
+    static constexpr size_t kMinEqualitiesForHashSet = 100;
+
+    _equalityHashSet = boost::none;
+    if (_equalitySet.size() < kMinEqualitiesForHashSet) {
+        return;
+    }
+    _equalityHashSet.emplace(_eltCmp.makeBSONEltUnorderedSet());
+    _equalityHashSet->insert(_equalitySet.begin(), _equalitySet.end());
+}
+
 bool InMatchExpression::matchesSingleElement(const BSONElement& e, MatchDetails* details) const {
     // When an $in has a null, it adopts the same semantics as {$eq:null}. Namely, in addition to
     // matching literal null values, the $in should match missing and undefined.
@@ -539,6 +557,8 @@ void InMatchExpression::_doSetCollator(const CollatorInterface* collator) {
                      _originalEqualityVector.end(),
                      std::back_inserter(_equalitySet),
                      _eltCmp.makeEqualTo());
+
+    _rebuildEqualityHashSet();
 }
 
 Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
@@ -573,6 +593,8 @@ Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
                      std::back_inserter(_equalitySet),
                      _eltCmp.makeEqualTo());
 
+    _rebuildEqualityHashSet();
+
     return Status::OK();
 }
 
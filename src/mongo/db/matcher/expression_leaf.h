@@ -614,6 +614,12 @@ public:
 private:
     ExpressionOptimizerFunc getOptimizer() const final;
 
+    /**
+     * Recreates '_equalityHashSet' from '_equalitySet' and '_eltCmp'. Must be called after either
+     * changes.
+     */
+    void _rebuildEqualityHashSet();
+
     // Whether or not '_equalities' has a jstNULL element in it.
     bool _hasNull = false;
 
@@ -637,10 +643,15 @@ private:
     // support std::binary_search. Because we need to sort the elements anyway for things like index
     // bounds building, using binary search avoids the overhead of inserting into a hash table which
     // doesn't pay for itself in the common case where lookups are done a few times if ever.
-    // TODO It may be worth dynamically creating a hashset after matchesSingleElement() has been
-    // called "many" times.
     std::vector<BSONElement> _equalitySet;
 
+    // For large $in lists, a hash table over the same elements as '_equalitySet', used by
+    // contains() instead of binary search: one hash beats O(log n) collator-aware comparisons per
+    // probe once n is big enough. Disengaged (boost::none) below the size threshold. The hasher
+    // and equality functor hold a pointer to '_eltCmp', so this must be rebuilt whenever the
+    // comparator or the equalities change; see '_rebuildEqualityHashSet()'.
+    boost::optional<BSONEltUnorderedSet> _equalityHashSet;
+
     // Container of regex elements this object owns.
     std::vector<std::unique_ptr<RegexMatchExpression>> _regexes;
 
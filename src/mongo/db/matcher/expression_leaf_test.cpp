@@ -1372,6 +1372,52 @@ TEST(InMatchExpression, ChangingCollationAfterAddingEqualitiesPreservesEqualitie
     ASSERT(in.contains(obj2.firstElement()));
 }
 
+TEST(InMatchExpression, LargeEqualityListMatchesUsingHashSet) {
+    // Large enough to engage the hash-set lookup path in contains().
+    BSONArrayBuilder bab;
+    for (int i = 0; i < 250; ++i) {
+        bab.append(i * 2);
+    }
+    BSONArray operand = bab.arr();
+    InMatchExpression in("a");
+    std::vector<BSONElement> equalities;
+    for (const auto& elt : operand) {
+        equalities.push_back(elt);
+    }
+    ASSERT_OK(in.setEqualities(std::move(equalities)));
+    ASSERT(in.matchesBSON(BSON("a" << 0)));
+    ASSERT(in.matchesBSON(BSON("a" << 498)));
+    // Numeric equality must remain type-bracketed across int/long/double.
+    ASSERT(in.matchesBSON(BSON("a" << 42LL)));
+    ASSERT(in.matchesBSON(BSON("a" << 42.0)));
+    ASSERT(!in.matchesBSON(BSON("a" << 1)));
+    ASSERT(!in.matchesBSON(BSON("a" << 500)));
+}
+
+TEST(InMatchExpression, LargeEqualityListRespectsCollationAfterCollatorChange) {
+    BSONArrayBuilder bab;
+    for (int i = 0; i < 250; ++i) {
+        bab.append("string" + std::to_string(i));
+    }
+    BSONArray operand = bab.arr();
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kToLowerString);
+    InMatchExpression in("a");
+    std::vector<BSONElement> equalities;
+    for (const auto& elt : operand) {
+        equalities.push_back(elt);
+    }
+    ASSERT_OK(in.setEqualities(std::move(equalities)));
+    ASSERT(!in.matchesBSON(BSON("a"
+                                << "STRING7")));
+    // Setting the collator after the equalities must rebuild the hash set with
+    // collation-aware hashing and equality.
+    in.setCollator(&collator);
+    ASSERT(in.matchesBSON(BSON("a"
+                               << "STRING7")));
+    ASSERT(!in.matchesBSON(BSON("a"
+                                << "STRING250")));
+}
+
 std::vector<uint32_t> bsonArrayToBitPositions(const BSONArray& ba) {
     std::vector<uint32_t> bitPositions;
 
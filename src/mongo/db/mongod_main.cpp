@@ -1362,6 +1362,9 @@ void shutdownTask(const ShutdownTaskArgs& shutdownArgs) {
     LOGV2(4784927, "Shutting down the HealthLog");
     HealthLog::get(serviceContext).shutdown();
 
+    LOGV2(6174814, "Shutting down the profile entry writers");
+    shutdownProfileWriters(serviceContext);
+
     LOGV2(4784928, "Shutting down the TTL monitor");
     shutdownTTLMonitor(serviceContext);
 
@@ -88,8 +88,31 @@ public:
         kTwoPhase,
     };
 
+    /**
+     * Coarse namespace interest used by the OpObserverRegistry to skip observers on the hot
+     * document-level paths (onInserts, onUpdate, aboutToDelete, onDelete). An observer that only
+     * reacts to writes to the config database or to system collections can declare that here and
+     * will not be called for plain user writes. DDL and transaction events are always fanned out
+     * to every observer.
+     */
+    enum class NamespaceFilter {
+        kConfig,           // Only writes to the config database.
+        kSystem,           // Only writes to system collections, in any database.
+        kConfigAndSystem,  // Writes to either of the above.
+        kAll,              // All writes.
+    };
+
     virtual ~OpObserver() = default;
 
+    /**
+     * Returns this observer's namespace interest for document-level events. Defaults to kAll;
+     * observers must only narrow this when every document-level handler ignores all other
+     * namespaces.
+     */
+    virtual NamespaceFilter getNamespaceFilter() const {
+        return NamespaceFilter::kAll;
+    }
+
     virtual void onCreateIndex(OperationContext* opCtx,
                                const NamespaceString& nss,
                                CollectionUUID uuid,
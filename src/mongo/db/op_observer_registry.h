@@ -30,6 +30,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -56,6 +57,7 @@ public:
     // Registration must be done while no calls to observers are made.
     void addObserver(std::unique_ptr<OpObserver> observer) {
         _observers.push_back(std::move(observer));
+        _rebuildDocumentDispatchLists();
     }
 
     void onCreateIndex(OperationContext* const opCtx,
@@ -120,13 +122,13 @@ public:
                    std::vector<InsertStatement>::const_iterator end,
                    bool fromMigrate) override {
         ReservedTimes times{opCtx};
-        for (auto& o : _observers)
+        for (auto* o : _documentObserversFor(nss))
             o->onInserts(opCtx, nss, uuid, begin, end, fromMigrate);
     }
 
     void onUpdate(OperationContext* const opCtx, const OplogUpdateEntryArgs& args) override {
         ReservedTimes times{opCtx};
-        for (auto& o : _observers)
+        for (auto* o : _documentObserversFor(args.nss))
             o->onUpdate(opCtx, args);
     }
 
@@ -134,7 +136,7 @@ public:
                        const NamespaceString& nss,
                        const BSONObj& doc) override {
         ReservedTimes times{opCtx};
-        for (auto& o : _observers)
+        for (auto* o : _documentObserversFor(nss))
             o->aboutToDelete(opCtx, nss, doc);
     }
 
@@ -144,7 +146,7 @@ public:
                   StmtId stmtId,
                   const OplogDeleteEntryArgs& args) override {
         ReservedTimes times{opCtx};
-        for (auto& o : _observers)
+        for (auto* o : _documentObserversFor(nss))
             o->onDelete(opCtx, nss, uuid, stmtId, args);
     }
 
@@ -414,6 +416,36 @@ private:
         return times.front();
     }
 
+    // Returns the precomputed observer list for document-level events on 'nss'. Index bit 0 is
+    // set for system collections and bit 1 for the config database.
+    const std::vector<OpObserver*>& _documentObserversFor(const NamespaceString& nss) const {
+        return _documentDispatch[(nss.isConfigDB() ? 2 : 0) | (nss.isSystem() ? 1 : 0)];
+    }
+
+    // Rebuilds '_documentDispatch' so each namespace class only pays for the observers whose
+    // NamespaceFilter matches it. Observers stay in registration order within each list.
+    void _rebuildDocumentDispatchLists() {
+        for (auto& list : _documentDispatch) {
+            list.clear();
+        }
+        for (auto& o : _observers) {
+            const auto filter = o->getNamespaceFilter();
+            for (size_t i = 0; i < _documentDispatch.size(); i++) {
+                const bool isSystem = i & 1;
+                const bool isConfig = i & 2;
+                const bool matches = filter == OpObserver::NamespaceFilter::kAll ||
+                    (filter == OpObserver::NamespaceFilter::kConfig && isConfig) ||
+                    (filter == OpObserver::NamespaceFilter::kSystem && isSystem) ||
+                    (filter == OpObserver::NamespaceFilter::kConfigAndSystem &&
+                     (isConfig || isSystem));
+                if (matches) {
+                    _documentDispatch[i].push_back(o.get());
+                }
+            }
+        }
+    }
+
     std::vector<std::unique_ptr<OpObserver>> _observers;
+    std::array<std::vector<OpObserver*>, 4> _documentDispatch;
 };
 }  // namespace mongo
@@ -95,6 +95,20 @@ struct TestObserver : public OpObserverNoop {
                               bool stayTemp) {}
 };
 
+struct FilteredObserver : public OpObserverNoop {
+    NamespaceFilter filter = NamespaceFilter::kAll;
+    int documentEvents = 0;
+
+    NamespaceFilter getNamespaceFilter() const final {
+        return filter;
+    }
+    void aboutToDelete(OperationContext* opCtx,
+                       const NamespaceString& nss,
+                       const BSONObj& doc) final {
+        documentEvents++;
+    }
+};
+
 struct ThrowingObserver : public TestObserver {
     void onDropDatabase(OperationContext* opCtx, const std::string& dbName) {
         drops++;
@@ -151,6 +165,28 @@ TEST_F(OpObserverRegistryTest, TwoObservers) {
     ASSERT_EQUALS(observer2->drops, 1);
 }
 
+TEST_F(OpObserverRegistryTest, NamespaceFilterSkipsUninterestedObservers) {
+    OperationContextNoop opCtx;
+    auto uniqueFiltered = std::make_unique<FilteredObserver>();
+    uniqueFiltered->filter = OpObserver::NamespaceFilter::kConfigAndSystem;
+    auto uniqueUnfiltered = std::make_unique<FilteredObserver>();
+    auto* filtered = uniqueFiltered.get();
+    auto* unfiltered = uniqueUnfiltered.get();
+    registry.addObserver(std::move(uniqueFiltered));
+    registry.addObserver(std::move(uniqueUnfiltered));
+
+    // A plain user namespace only reaches the unfiltered observer.
+    registry.aboutToDelete(&opCtx, testNss, BSONObj());
+    ASSERT_EQUALS(filtered->documentEvents, 0);
+    ASSERT_EQUALS(unfiltered->documentEvents, 1);
+
+    // Config database and system collection namespaces reach both.
+    registry.aboutToDelete(&opCtx, NamespaceString("config", "chunks"), BSONObj());
+    registry.aboutToDelete(&opCtx, NamespaceString("admin", "system.version"), BSONObj());
+    ASSERT_EQUALS(filtered->documentEvents, 2);
+    ASSERT_EQUALS(unfiltered->documentEvents, 3);
+}
+
 TEST_F(OpObserverRegistryTest, ThrowingObserver1) {
     OperationContextNoop opCtx;
     unique1 = std::make_unique<ThrowingObserver>();
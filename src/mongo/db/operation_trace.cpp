@@ -0,0 +1,81 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/operation_trace.h"
+
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+
+const OperationContext::Decoration<OperationTrace> OperationTrace::get =
+    OperationContext::declareDecoration<OperationTrace>();
+
+OperationTrace::Span::Span(OperationContext* opCtx, StringData name) {
+    auto& trace = OperationTrace::get(opCtx);
+    if (trace._numSpans >= kMaxSpans) {
+        return;
+    }
+
+    _trace = &trace;
+    _tickSource = opCtx->getServiceContext()->getTickSource();
+    _index = trace._numSpans++;
+
+    auto& entry = trace._spans[_index];
+    entry.name = name;
+    entry.start = _tickSource->getTicks();
+    entry.depth = trace._depth++;
+}
+
+OperationTrace::Span::~Span() {
+    if (!_trace) {
+        return;
+    }
+
+    auto& entry = _trace->_spans[_index];
+    entry.duration = _tickSource->getTicks() - entry.start;
+    --_trace->_depth;
+}
+
+void OperationTrace::append(TickSource* tickSource, BSONObjBuilder* builder) const {
+    BSONArrayBuilder spans(builder->subarrayStart("spans"));
+    const auto base = _spans[0].start;
+    for (size_t i = 0; i < _numSpans; ++i) {
+        const auto& entry = _spans[i];
+        BSONObjBuilder span(spans.subobjStart());
+        span.append("name", entry.name);
+        span.append("startMicros",
+                    durationCount<Microseconds>(
+                        tickSource->ticksTo<Microseconds>(entry.start - base)));
+        span.append("durationMicros",
+                    durationCount<Microseconds>(tickSource->ticksTo<Microseconds>(entry.duration)));
+        span.append("depth", static_cast<int>(entry.depth));
+    }
+}
+
+}  // namespace mongo
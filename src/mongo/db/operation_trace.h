@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/util/tick_source.h"
+
+namespace mongo {
+
+/**
+ * Records a small fixed-size trace of named, hierarchical spans for a single operation.
+ *
+ * Spans are cheap enough to place on hot boundaries such as query planning, storage waits and
+ * replication waits: entering and leaving a span reads the tick source and writes to a
+ * preallocated per-operation buffer. The recorded trace is attached to the slow query log line
+ * by OpDebug::report, showing where inside the operation the time was spent.
+ *
+ * Spans must be entered and left in LIFO order on the thread executing the operation, which the
+ * RAII Span guard enforces. Span names must outlive the operation; string literals are expected.
+ */
+class OperationTrace {
+public:
+    static const OperationContext::Decoration<OperationTrace> get;
+
+    static constexpr size_t kMaxSpans = 32;
+
+    /**
+     * Decoration requires a default constructor.
+     */
+    OperationTrace() = default;
+
+    /**
+     * RAII guard recording one span. Becomes a no-op once the operation has recorded kMaxSpans
+     * spans.
+     */
+    class Span {
+    public:
+        Span(OperationContext* opCtx, StringData name);
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+        ~Span();
+
+    private:
+        OperationTrace* _trace = nullptr;
+        TickSource* _tickSource = nullptr;
+        size_t _index = 0;
+    };
+
+    bool empty() const {
+        return _numSpans == 0;
+    }
+
+    /**
+     * Appends the recorded spans as an array of {name, startMicros, durationMicros, depth}
+     * documents, with start offsets relative to the first recorded span.
+     */
+    void append(TickSource* tickSource, BSONObjBuilder* builder) const;
+
+private:
+    struct Entry {
+        StringData name;
+        TickSource::Tick start = 0;
+        TickSource::Tick duration = 0;
+        uint32_t depth = 0;
+    };
+
+    size_t _numSpans = 0;
+    uint32_t _depth = 0;
+    std::array<Entry, kMaxSpans> _spans;
+};
+
+}  // namespace mongo
@@ -632,7 +632,7 @@ WriteResult performInserts(OperationContext* opCtx,
     size_t bytesInBatch = 0;
     std::vector<InsertStatement> batch;
     const size_t maxBatchSize = internalInsertMaxBatchSize.load();
-    const size_t maxBatchBytes = write_ops::insertVectorMaxBytes;
+    const size_t maxBatchBytes = internalInsertMaxBatchBytes.load();
     batch.reserve(std::min(wholeOp.getDocuments().size(), maxBatchSize));
 
     for (auto&& doc : wholeOp.getDocuments()) {
@@ -715,6 +715,7 @@ WriteResult performInserts(OperationContext* opCtx,
 static SingleWriteResult performSingleUpdateOp(OperationContext* opCtx,
                                                const NamespaceString& ns,
                                                UpdateRequest* updateRequest,
+                                               ParsedUpdate* parsedUpdate,
                                                OperationSource source,
                                                bool* containsDotsAndDollarsField) {
     CurOpFailpointHelpers::waitWhileFailPointEnabled(
@@ -803,9 +804,17 @@ static SingleWriteResult performSingleUpdateOp(OperationContext* opCtx,
         uassertStatusOK(checkIfTransactionOnCappedColl(opCtx, coll));
     }
 
+    // Time-series updates cannot be parsed before this point, because the request is rewritten
+    // against the buckets collection once its options are known. All other updates are parsed once
+    // by the caller so that duplicate-key retries do not parse the same request again.
     const ExtensionsCallbackReal extensionsCallback(opCtx, &updateRequest->getNamespaceString());
-    ParsedUpdate parsedUpdate(opCtx, updateRequest, extensionsCallback);
-    uassertStatusOK(parsedUpdate.parseRequest());
+    boost::optional<ParsedUpdate> translatedParsedUpdate;
+    if (!parsedUpdate) {
+        invariant(source == OperationSource::kTimeseriesUpdate);
+        translatedParsedUpdate.emplace(opCtx, updateRequest, extensionsCallback);
+        uassertStatusOK(translatedParsedUpdate->parseRequest());
+        parsedUpdate = translatedParsedUpdate.get_ptr();
+    }
 
     CurOpFailpointHelpers::waitWhileFailPointEnabled(
         &hangWithLockDuringBatchUpdate, opCtx, "hangWithLockDuringBatchUpdate");
@@ -821,7 +830,7 @@ static SingleWriteResult performSingleUpdateOp(OperationContext* opCtx,
     auto exec = uassertStatusOK(
         getExecutorUpdate(&curOp.debug(),
                           collection ? &collection->getCollection() : &CollectionPtr::null,
-                          &parsedUpdate,
+                          parsedUpdate,
                           boost::none /* verbosity */));
 
     {
@@ -904,14 +913,29 @@ static SingleWriteResult performSingleUpdateOpWithDupKeyRetry(
                                : PlanYieldPolicy::YieldPolicy::YIELD_AUTO);
     request.setSource(source);
 
+    // Parse the update once, up front, so that retries of eligible duplicate-key failures reuse
+    // the parsed update rather than parsing the request again on every attempt. Time-series
+    // updates are the exception: their requests are rewritten against the buckets collection by
+    // performSingleUpdateOp, which parses them after the rewrite.
+    const ExtensionsCallbackReal extensionsCallback(opCtx, &request.getNamespaceString());
+    boost::optional<ParsedUpdate> parsedUpdate;
+    if (source != OperationSource::kTimeseriesUpdate) {
+        parsedUpdate.emplace(opCtx, &request, extensionsCallback);
+        uassertStatusOK(parsedUpdate->parseRequest());
+    }
+
     size_t numAttempts = 0;
     while (true) {
         ++numAttempts;
 
         try {
             bool containsDotsAndDollarsField = false;
-            const auto ret =
-                performSingleUpdateOp(opCtx, ns, &request, source, &containsDotsAndDollarsField);
+            const auto ret = performSingleUpdateOp(opCtx,
+                                                   ns,
+                                                   &request,
+                                                   parsedUpdate ? parsedUpdate.get_ptr() : nullptr,
+                                                   source,
+                                                   &containsDotsAndDollarsField);
 
             if (containsDotsAndDollarsField) {
                 // If it's an upsert, increment 'inserts' metric, otherwise increment 'updates'.
@@ -920,15 +944,23 @@ static SingleWriteResult performSingleUpdateOpWithDupKeyRetry(
 
             return ret;
         } catch (ExceptionFor<ErrorCodes::DuplicateKey>& ex) {
-            const ExtensionsCallbackReal extensionsCallback(opCtx, &request.getNamespaceString());
-            ParsedUpdate parsedUpdate(opCtx, &request, extensionsCallback);
-            uassertStatusOK(parsedUpdate.parseRequest());
+            // Time-series updates were parsed against the rewritten request, so parse a fresh copy
+            // of it here to evaluate retry eligibility.
+            boost::optional<ParsedUpdate> translatedParsedUpdate;
+            if (!parsedUpdate) {
+                translatedParsedUpdate.emplace(opCtx, &request, extensionsCallback);
+                uassertStatusOK(translatedParsedUpdate->parseRequest());
+            }
+            auto& parsedUpdateForRetryCheck =
+                parsedUpdate ? *parsedUpdate : *translatedParsedUpdate;
 
-            if (!parsedUpdate.hasParsedQuery()) {
-                uassertStatusOK(parsedUpdate.parseQueryToCQ());
+            // The executor releases the canonical query after each attempt, so it must be
+            // recreated here. The update portion of 'parsedUpdateForRetryCheck' is still parsed.
+            if (!parsedUpdateForRetryCheck.hasParsedQuery()) {
+                uassertStatusOK(parsedUpdateForRetryCheck.parseQueryToCQ());
             }
 
-            if (!shouldRetryDuplicateKeyException(parsedUpdate,
+            if (!shouldRetryDuplicateKeyException(parsedUpdateForRetryCheck,
                                                   *ex.extraInfo<DuplicateKeyErrorInfo>())) {
                 throw;
             }
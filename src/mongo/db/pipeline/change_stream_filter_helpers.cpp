@@ -61,6 +61,43 @@ std::unique_ptr<MatchExpression> buildOperationFilter(
 
     auto streamType = DocumentSourceChangeStream::getChangeStreamType(expCtx->ns);
 
+    // For a single-collection stream the namespace and collection "regexes" are anchored literals,
+    // and the command namespace is exact for single-database streams as well. Match those fields
+    // with a plain string comparison: this filter runs against every scanned oplog entry, and an
+    // equality check is considerably cheaper than the regex engine.
+    const bool exactNsMatch =
+        streamType == DocumentSourceChangeStream::ChangeStreamType::kSingleCollection;
+    const bool exactCmdNsMatch =
+        streamType != DocumentSourceChangeStream::ChangeStreamType::kAllChangesForCluster;
+
+    auto matchNs = [&](StringData field) {
+        BSONObjBuilder bob;
+        if (exactNsMatch) {
+            bob.append(field, expCtx->ns.ns());
+        } else {
+            bob.appendRegex(field, nsRegex);
+        }
+        return bob.obj();
+    };
+    auto matchColl = [&](StringData field) {
+        BSONObjBuilder bob;
+        if (exactNsMatch) {
+            bob.append(field, expCtx->ns.coll());
+        } else {
+            bob.appendRegex(field, collRegex);
+        }
+        return bob.obj();
+    };
+    auto matchCmdNs = [&](StringData field) {
+        BSONObjBuilder bob;
+        if (exactCmdNsMatch) {
+            bob.append(field, expCtx->ns.getCommandNS().ns());
+        } else {
+            bob.appendRegex(field, cmdNsRegex);
+        }
+        return bob.obj();
+    };
+
     // The standard event filter, before it is combined with the user filter, is as follows:
     //    {
     //      $or: [
@@ -79,23 +116,29 @@ std::unique_ptr<MatchExpression> buildOperationFilter(
     std::unique_ptr<ListOfMatchExpression> operationFilter = std::make_unique<OrMatchExpression>();
 
     // (1) CRUD events on a monitored namespace.
-    auto crudEvents = BSON("ns" << BSONRegEx(nsRegex) << "$nor"
-                                << BSON_ARRAY(BSON("op"
-                                                   << "n")
-                                              << BSON("op"
-                                                      << "c")));
+    BSONObjBuilder crudEventsBuilder;
+    crudEventsBuilder.appendElements(matchNs("ns"));
+    crudEventsBuilder.append("$nor",
+                             BSON_ARRAY(BSON("op"
+                                             << "n")
+                                        << BSON("op"
+                                                << "c")));
+    auto crudEvents = crudEventsBuilder.obj();
 
     // (2.1) The namespace for matching relevant commands.
-    auto cmdNsMatch = BSON("op"
-                           << "c"
-                           << "ns" << BSONRegEx(cmdNsRegex));
+    BSONObjBuilder cmdNsMatchBuilder;
+    cmdNsMatchBuilder.append("op", "c");
+    cmdNsMatchBuilder.appendElements(matchCmdNs("ns"));
+    auto cmdNsMatch = cmdNsMatchBuilder.obj();
 
     // (2.2) Commands that are run on a monitored database and/or collection.
-    auto dropEvent = BSON("o.drop" << BSONRegEx(collRegex));
+    auto dropEvent = matchColl("o.drop");
     auto dropDbEvent = BSON("o.dropDatabase" << BSON("$exists" << true));
-    auto renameFromEvent = BSON("o.renameCollection" << BSONRegEx(nsRegex));
-    auto renameToEvent =
-        BSON("o.renameCollection" << BSON("$exists" << true) << "o.to" << BSONRegEx(nsRegex));
+    auto renameFromEvent = matchNs("o.renameCollection");
+    BSONObjBuilder renameToEventBuilder;
+    renameToEventBuilder.append("o.renameCollection", BSON("$exists" << true));
+    renameToEventBuilder.appendElements(matchNs("o.to"));
+    auto renameToEvent = renameToEventBuilder.obj();
 
     auto orCmdEvents = std::make_unique<OrMatchExpression>();
     orCmdEvents->add(MatchExpressionParser::parseAndNormalize(dropEvent, expCtx));
@@ -175,10 +218,17 @@ std::unique_ptr<MatchExpression> buildTransactionFilter(
         BSONArrayBuilder orBuilder(applyOpsBuilder.subarrayStart("$or"));
         {
             {
+                // As in buildOperationFilter(), a single-collection stream can match the exact
+                // namespace string rather than paying for the regex engine per scanned entry.
                 BSONObjBuilder nsMatchBuilder(orBuilder.subobjStart());
-                nsMatchBuilder.append(
-                    "o.applyOps.ns"_sd,
-                    BSONRegEx(DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx->ns)));
+                if (DocumentSourceChangeStream::getChangeStreamType(expCtx->ns) ==
+                    DocumentSourceChangeStream::ChangeStreamType::kSingleCollection) {
+                    nsMatchBuilder.append("o.applyOps.ns"_sd, expCtx->ns.ns());
+                } else {
+                    nsMatchBuilder.appendRegex(
+                        "o.applyOps.ns"_sd,
+                        DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx->ns));
+                }
             }
             // The default repl::OpTime is the value used to indicate a null "prevOpTime" link.
             orBuilder.append(BSON(repl::OplogEntry::kPrevWriteOpTimeInTransactionFieldName
@@ -41,6 +41,15 @@
 
 namespace mongo {
 
+/**
+ * A producer-side operator that partitions the output of 'pipeline' into per-consumer buffers.
+ * Each consumer is a separate DocumentSourceExchange cursor, and every consumer must be driven by
+ * its own thread of control with its own ExpressionContext; today those threads belong to the
+ * merging node (e.g. mongos writing out a sharded $merge), which sends the ExchangeSpec with the
+ * aggregate request. The pipeline optimizer deliberately never plants an exchange on its own:
+ * a plan containing one is not executable by a single PlanExecutor, so the decision to exchange
+ * belongs to whoever will drive the consumers.
+ */
 class Exchange : public RefCountable {
     static constexpr size_t kInvalidThreadId{std::numeric_limits<size_t>::max()};
     static constexpr size_t kMaxBufferSize = 100 * 1024 * 1024;  // 100 MB
@@ -247,7 +247,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextStandard() {
 
 void DocumentSourceGroup::doDispose() {
     // Free our resources.
-    _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+    _groups = pExpCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>();
     _sorterIterator.reset();
 
     // Make us look done.
@@ -405,7 +405,7 @@ DocumentSourceGroup::DocumentSourceGroup(const intrusive_ptr<ExpressionContext>&
               ? std::make_shared<Sorter<Value, Value>::File>(expCtx->tempDir + "/" + nextFileName())
               : nullptr),
       _initialized(false),
-      _groups(expCtx->getValueComparator().makeUnorderedValueMap<Accumulators>()),
+      _groups(expCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>()),
       _spilled(false) {}
 
 void DocumentSourceGroup::addAccumulator(AccumulationStatement accumulationStatement) {
@@ -547,7 +547,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
         // accumulator. This is done in a somewhat odd way in order to avoid hashing 'id' and
         // looking it up in '_groups' multiple times.
         const size_t oldSize = _groups->size();
-        vector<intrusive_ptr<AccumulatorState>>& group = (*_groups)[id];
+        Accumulators& group = (*_groups)[id];
         const bool inserted = _groups->size() != oldSize;
 
         vector<uint64_t> oldAccumMemUsage(numAccumulators, 0);
@@ -613,7 +613,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
                 }
 
                 // We won't be using groups again so free its memory.
-                _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+                _groups = pExpCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>();
 
                 _sorterIterator.reset(Sorter<Value, Value>::Iterator::merge(
                     _sortedFiles, SortOptions(), SorterComparator(pExpCtx->getValueComparator())));
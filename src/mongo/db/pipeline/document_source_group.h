@@ -29,9 +29,11 @@
 
 #pragma once
 
+#include <boost/container/small_vector.hpp>
 #include <memory>
 #include <utility>
 
+#include "mongo/db/exec/document_value/value_comparator.h"
 #include "mongo/db/pipeline/accumulation_statement.h"
 #include "mongo/db/pipeline/accumulator.h"
 #include "mongo/db/pipeline/document_source.h"
@@ -89,8 +91,13 @@ private:
 
 class DocumentSourceGroup final : public DocumentSource {
 public:
-    using Accumulators = std::vector<boost::intrusive_ptr<AccumulatorState>>;
-    using GroupsMap = ValueUnorderedMap<Accumulators>;
+    // Most groups have only a handful of accumulators, so their states are stored inline in the
+    // hash table entry; this avoids a heap allocation and a pointer chase per group.
+    using Accumulators = boost::container::small_vector<boost::intrusive_ptr<AccumulatorState>, 4>;
+
+    // An open-addressing table is used so that looking up and updating a group touches a single
+    // contiguous table slot instead of a separately allocated node.
+    using GroupsMap = ValueFlatUnorderedMap<Accumulators>;
 
     static constexpr StringData kStageName = "$group"_sd;
 
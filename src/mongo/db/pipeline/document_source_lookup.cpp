@@ -40,6 +40,7 @@
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression_algo.h"
+#include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/pipeline/aggregation_request_helper.h"
 #include "mongo/db/pipeline/document_path_support.h"
 #include "mongo/db/pipeline/document_source_merge_gen.h"
@@ -354,27 +355,44 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
         return unwindResult();
     }
 
+    // Return any results left over from a previous batched lookup before consuming more input.
+    if (!_batchedResults.empty()) {
+        auto next = std::move(_batchedResults.front());
+        _batchedResults.pop_front();
+        return next;
+    }
+
     auto nextInput = pSource->getNext();
     if (!nextInput.isAdvanced()) {
         return nextInput;
     }
 
-    auto inputDoc = nextInput.releaseDocument();
-
     // If we have not absorbed a $unwind, we cannot absorb a $match. If we have absorbed a $unwind,
     // '_unwindSrc' would be non-null, and we would not have made it here.
     invariant(!_matchSrc);
 
-    if (hasLocalFieldForeignFieldJoin()) {
-        auto matchStage =
-            makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
-        // We've already allocated space for the trailing $match stage in '_resolvedPipeline'.
-        _resolvedPipeline[*_fieldMatchPipelineIdx] = matchStage;
+    const auto batchSize = internalDocumentSourceLookupBatchSize.load();
+    if (batchSize > 1 && canBatchLocalFieldForeignFieldJoin()) {
+        performBatchedLookup(nextInput.releaseDocument(), batchSize);
+        invariant(!_batchedResults.empty());
+        auto next = std::move(_batchedResults.front());
+        _batchedResults.pop_front();
+        return next;
     }
 
-    std::unique_ptr<Pipeline, PipelineDeleter> pipeline;
+    return performSingleLookup(nextInput.releaseDocument());
+}
+
+bool DocumentSourceLookUp::canBatchLocalFieldForeignFieldJoin() const {
+    return hasLocalFieldForeignFieldJoin() && !wasConstructedWithPipelineSyntax() &&
+        _letVariables.empty() && !_additionalFilter &&
+        *_fieldMatchPipelineIdx == _resolvedPipeline.size() - 1;
+}
+
+std::unique_ptr<Pipeline, PipelineDeleter> DocumentSourceLookUp::buildPipelineForInput(
+    const Document& inputDoc) {
     try {
-        pipeline = buildPipeline(inputDoc);
+        return buildPipeline(inputDoc);
     } catch (const ExceptionForCat<ErrorCategory::StaleShardVersionError>& ex) {
         // If lookup on a sharded collection is disallowed and the foreign collection is sharded,
         // throw a custom exception.
@@ -392,6 +410,17 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
         }
         throw;
     }
+}
+
+Document DocumentSourceLookUp::performSingleLookup(Document inputDoc) {
+    if (hasLocalFieldForeignFieldJoin()) {
+        auto matchStage =
+            makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
+        // We've already allocated space for the trailing $match stage in '_resolvedPipeline'.
+        _resolvedPipeline[*_fieldMatchPipelineIdx] = matchStage;
+    }
+
+    auto pipeline = buildPipelineForInput(inputDoc);
 
     std::vector<Value> results;
     long long objsize = 0;
@@ -416,6 +445,127 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     return output.freeze();
 }
 
+void DocumentSourceLookUp::performBatchedLookup(Document firstInput, long long batchSize) {
+    std::vector<Document> inputs;
+    inputs.push_back(std::move(firstInput));
+
+    // A pause observed while gathering the batch is queued up behind the batch's results. EOF is
+    // not remembered; the next doGetNext() call will rediscover it from the source.
+    boost::optional<GetNextResult> pendingPause;
+    while (static_cast<long long>(inputs.size()) < batchSize) {
+        auto next = pSource->getNext();
+        if (!next.isAdvanced()) {
+            if (next.isPaused()) {
+                pendingPause.emplace(std::move(next));
+            }
+            break;
+        }
+        inputs.push_back(next.releaseDocument());
+    }
+
+    // Gather the union of the batch's join keys, deduplicated under the foreign collation. Regular
+    // expression keys must be matched with equality predicates rather than $in, so a batch
+    // containing one falls back to one query per input document.
+    auto keys = _fromExpCtx->getValueComparator().makeUnorderedValueSet();
+    bool containsRegex = false;
+    for (auto&& input : inputs) {
+        size_t keysForInput = 0;
+        document_path_support::visitAllValuesAtPath(input, *_localField, [&](const Value& val) {
+            containsRegex = containsRegex || val.getType() == BSONType::RegEx;
+            keys.insert(val);
+            ++keysForInput;
+        });
+        if (keysForInput == 0) {
+            // Missing values are treated as null.
+            keys.insert(Value(BSONNULL));
+        }
+    }
+
+    if (containsRegex) {
+        for (auto&& input : inputs) {
+            _batchedResults.emplace_back(performSingleLookup(std::move(input)));
+        }
+        if (pendingPause) {
+            _batchedResults.push_back(std::move(*pendingPause));
+        }
+        return;
+    }
+
+    // Issue one query of the shape {$match: {$and: [{<foreignField>: {$in: [<key>, ...]}}, {}]}}
+    // covering the whole batch. This mirrors the shape built by makeMatchStageFromInput() so that
+    // replacing the stage at '_fieldMatchPipelineIdx' behaves identically.
+    BSONArrayBuilder keyArr;
+    for (auto&& key : keys) {
+        keyArr << key;
+    }
+    BSONObjBuilder match;
+    {
+        BSONObjBuilder query(match.subobjStart("$match"));
+        BSONArrayBuilder andObj(query.subarrayStart("$and"));
+        BSONObjBuilder joiningObj(andObj.subobjStart());
+        BSONObjBuilder subObj(joiningObj.subobjStart(_foreignField->fullPath()));
+        subObj << "$in" << keyArr.arr();
+        subObj.doneFast();
+        joiningObj.doneFast();
+        BSONObjBuilder emptyFilterObj(andObj.subobjStart());
+        emptyFilterObj.doneFast();
+        andObj.doneFast();
+        query.doneFast();
+    }
+    _resolvedPipeline[*_fieldMatchPipelineIdx] = match.obj();
+
+    // There are no 'let' variables to resolve (see canBatchLocalFieldForeignFieldJoin()), so the
+    // built pipeline does not otherwise depend on which input document is passed here.
+    auto pipeline = buildPipelineForInput(inputs.front());
+
+    // Drain the union of the batch's matches. Only the foreign field is needed to decide which
+    // input documents a foreign document joins with, so a projection of it is kept for the
+    // re-matching below.
+    std::vector<std::pair<BSONObj, Value>> foreignResults;
+    while (auto result = pipeline->getNext()) {
+        auto matchable =
+            document_path_support::documentToBsonWithPaths(*result, {_foreignField->fullPath()});
+        foreignResults.emplace_back(std::move(matchable), Value(std::move(*result)));
+    }
+    recordPlanSummaryStats(*pipeline);
+
+    // Distribute the results. Re-evaluating each input document's single-document predicate
+    // against the foreign field gives every input exactly the documents its own query would have
+    // selected, in the same relative order.
+    const auto maxBytes = internalLookupStageIntermediateDocumentMaxSizeBytes.load();
+    for (auto&& input : inputs) {
+        auto matchStage =
+            makeMatchStageFromInput(input, *_localField, _foreignField->fullPath(), BSONObj());
+        auto matcher = uassertStatusOK(
+            MatchExpressionParser::parse(matchStage.firstElement().embeddedObject(), _fromExpCtx));
+
+        std::vector<Value> results;
+        long long objsize = 0;
+        for (auto&& [matchable, result] : foreignResults) {
+            if (!matcher->matchesBSON(matchable)) {
+                continue;
+            }
+            long long safeSum = 0;
+            bool hasOverflowed = overflow::add(objsize, result.getApproximateSize(), &safeSum);
+            uassert(5958100,
+                    str::stream() << "Total size of documents in " << _fromNs.coll()
+                                  << " matching pipeline's $lookup stage exceeds " << maxBytes
+                                  << " bytes",
+                    !hasOverflowed && objsize <= maxBytes);
+            objsize = safeSum;
+            results.push_back(result);
+        }
+
+        MutableDocument output(std::move(input));
+        output.setNestedField(_as, Value(std::move(results)));
+        _batchedResults.emplace_back(output.freeze());
+    }
+
+    if (pendingPause) {
+        _batchedResults.push_back(std::move(*pendingPause));
+    }
+}
+
 std::unique_ptr<Pipeline, PipelineDeleter> DocumentSourceLookUp::buildPipelineFromViewDefinition(
     std::vector<BSONObj> serializedPipeline,
     ExpressionContext::ResolvedNamespace resolvedNamespace) {
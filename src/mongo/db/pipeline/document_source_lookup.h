@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <deque>
+
 #include <boost/optional.hpp>
 
 #include "mongo/db/exec/document_value/value_comparator.h"
@@ -271,6 +273,27 @@ private:
 
     GetNextResult unwindResult();
 
+    /**
+     * Returns true if this stage may gather several input documents and serve them all with a
+     * single combined query against the foreign collection. Only possible for a plain
+     * localField/foreignField join: a user pipeline, 'let' variables or an internalized $match all
+     * make the foreign pipeline dependent on the individual input document.
+     */
+    bool canBatchLocalFieldForeignFieldJoin() const;
+
+    /**
+     * Runs the foreign pipeline for a single input document and returns the joined result.
+     */
+    Document performSingleLookup(Document inputDoc);
+
+    /**
+     * Gathers up to 'batchSize' input documents, starting with 'firstInput', executes one foreign
+     * pipeline over the batch's deduplicated join keys, and appends one joined result per input
+     * document to '_batchedResults', in input order. If the source signalled a pause while the
+     * batch was being gathered, the pause is queued up behind the batch's results.
+     */
+    void performBatchedLookup(Document firstInput, long long batchSize);
+
     /**
      * Resolves let defined variables against 'localDoc' and stores the results in 'variables'.
      */
@@ -297,6 +320,12 @@ private:
      */
     std::unique_ptr<Pipeline, PipelineDeleter> buildPipeline(const Document& inputDoc);
 
+    /**
+     * Wrapper around buildPipeline() which turns stale shard version errors into the appropriate
+     * user-facing errors when the foreign collection is sharded.
+     */
+    std::unique_ptr<Pipeline, PipelineDeleter> buildPipelineForInput(const Document& inputDoc);
+
     /**
      * Reinitialize the cache with a new max size. May only be called if this DSLookup was created
      * with pipeline syntax only, the cache has not been frozen or abandoned, and no data has been
@@ -374,6 +403,10 @@ private:
     boost::intrusive_ptr<DocumentSourceMatch> _matchSrc;
     boost::intrusive_ptr<DocumentSourceUnwind> _unwindSrc;
 
+    // Joined results (and possibly a trailing pause) queued up by a batched lookup, returned in
+    // input order by subsequent doGetNext() calls.
+    std::deque<GetNextResult> _batchedResults;
+
     // The following members are used to hold onto state across getNext() calls when '_unwindSrc' is
     // not null.
     long long _cursorIndex = 0;
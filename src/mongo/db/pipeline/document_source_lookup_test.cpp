@@ -893,6 +893,65 @@ TEST_F(DocumentSourceLookUpTest, ShouldPropagatePauses) {
     lookup->dispose();
 }
 
+TEST_F(DocumentSourceLookUpTest, BatchedLookupDistributesResultsToCorrectInputDocuments) {
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs("test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    // Mock local documents sharing join keys, including an array-valued key and a missing one.
+    // These are all gathered into a single batch served by one foreign query.
+    auto mockLocalSource = DocumentSourceMock::createForTest(
+        {Document{{"joinKey", 0}},
+         Document{{"joinKey", std::vector<Value>{Value(0), Value(1)}}},
+         Document{{"joinKey", 1}},
+         Document{}},
+        expCtx);
+
+    // Mock out the foreign collection.
+    deque<DocumentSource::GetNextResult> mockForeignContents{
+        Document{{"_id", 0}}, Document{{"_id", 1}}, Document{{"_id", 2}}};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "joinKey"_sd},
+                                         {"foreignField", "_id"_sd},
+                                         {"as", "foreignDocs"_sd}}}}
+                          .toBson();
+    auto parsed = DocumentSourceLookUp::createFromBson(lookupSpec.firstElement(), expCtx);
+    auto lookup = static_cast<DocumentSourceLookUp*>(parsed.get());
+
+    lookup->setSource(mockLocalSource.get());
+
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"joinKey", 0}, {"foreignDocs", {Document{{"_id", 0}}}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"joinKey", std::vector<Value>{Value(0), Value(1)}},
+                  {"foreignDocs", {Document{{"_id", 0}}, Document{{"_id", 1}}}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"joinKey", 1}, {"foreignDocs", {Document{{"_id", 1}}}}}));
+
+    // A missing local field is treated as null, which matches none of the foreign documents.
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"foreignDocs", std::vector<Value>{}}}));
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    lookup->dispose();
+}
+
 TEST_F(DocumentSourceLookUpTest, ShouldPropagatePausesWhileUnwinding) {
     auto expCtx = getExpCtx();
     NamespaceString fromNs("test", "foreign");
@@ -107,6 +107,7 @@ void DocumentSourceUnwind::Unwinder::resetDocument(const Document& document) {
     _unwindPathFieldIndexes.clear();
     _index = 0;
     _inputArray = document.getNestedField(_unwindPath, &_unwindPathFieldIndexes);
+    uassert(5858203, "an array is expected", !_strict || _inputArray.getType() == Array);
     _haveNext = true;
 }
 
@@ -121,8 +122,6 @@ DocumentSource::GetNextResult DocumentSourceUnwind::Unwinder::getNext() {
     // this index in the output document, or null if the value didn't come from an array.
     boost::optional<long long> indexForOutput;
 
-    uassert(
-        5858203, "an array is expected", (_strict && _inputArray.getType() == Array) || !_strict);
     if (_inputArray.getType() == Array) {
         const size_t length = _inputArray.getArrayLength();
         invariant(_index == 0 || _index < length);
@@ -2257,7 +2257,7 @@ void ExpressionObject::_doAddDependencies(DepsTracker* deps) const {
 }
 
 Value ExpressionObject::evaluate(const Document& root, Variables* variables) const {
-    MutableDocument outputDoc;
+    MutableDocument outputDoc(_expressions.size());
     for (auto&& pair : _expressions) {
         outputDoc.addField(pair.first, pair.second->evaluate(root, variables));
     }
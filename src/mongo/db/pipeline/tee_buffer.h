@@ -65,7 +65,10 @@ public:
      */
     void dispose(size_t consumerId) {
         _consumers[consumerId].stillInUse = false;
-        _consumers[consumerId].nLeftToReturn = 0;
+        if (_consumers[consumerId].nLeftToReturn > 0) {
+            _consumers[consumerId].nLeftToReturn = 0;
+            --_nConsumersStillProcessingThisBatch;
+        }
         if (std::none_of(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
                 return info.stillInUse;
             })) {
@@ -103,5 +106,10 @@ private:
         int nLeftToReturn = 0;
     };
     std::vector<ConsumerInfo> _consumers;
+
+    // Number of in-use consumers that have not yet seen all of the current batch. Maintained
+    // incrementally so getNext(), which is called once per document per consumer, does not have
+    // to scan '_consumers'.
+    size_t _nConsumersStillProcessingThisBatch = 0;
 };
 }  // namespace mongo
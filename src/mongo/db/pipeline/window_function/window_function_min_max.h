@@ -29,11 +29,23 @@
 
 #pragma once
 
+#include <deque>
+
 #include "mongo/db/pipeline/accumulator.h"
 #include "mongo/db/pipeline/window_function/window_function.h"
 
 namespace mongo {
 
+/**
+ * A sliding-window min/max implemented with a monotonic deque. The deque holds the candidates
+ * that could still become the window's extremum: a value entering the window evicts every older
+ * value it dominates, so the deque stays sorted with the current extremum at the front. Each
+ * value is pushed and popped at most once, making add() and remove() amortized O(1), and only
+ * the candidates are retained rather than the whole window.
+ *
+ * This relies on the WindowFunctionState contract that remove() is called in FIFO order: a
+ * removed value either is the front of the deque or was already evicted by a newer dominator.
+ */
 template <AccumulatorMinMax::Sense sense>
 class WindowFunctionMinMax : public WindowFunctionState {
 public:
@@ -44,46 +56,47 @@ public:
     }
 
     explicit WindowFunctionMinMax(ExpressionContext* const expCtx)
-        : WindowFunctionState(expCtx),
-          _values(_expCtx->getValueComparator().makeOrderedValueMultiset()) {
+        : WindowFunctionState(expCtx) {
         _memUsageBytes = sizeof(*this);
     }
 
     void add(Value value) final {
+        // Evict values the new arrival dominates: anything strictly greater for $min, strictly
+        // less for $max. Equal values stay so that each pending remove() pops one instance.
+        const auto& cmp = _expCtx->getValueComparator();
+        while (!_candidates.empty() && cmp.compare(_candidates.back(), value) * sense > 0) {
+            _memUsageBytes -= _candidates.back().getApproximateSize();
+            _candidates.pop_back();
+        }
         _memUsageBytes += value.getApproximateSize();
-        _values.insert(std::move(value));
+        _candidates.push_back(std::move(value));
     }
 
     void remove(Value value) final {
-        // std::multiset::insert is guaranteed to put the element after any equal elements
-        // already in the container. So find() / erase() will remove the oldest equal element,
-        // which is what we want, to satisfy "remove() undoes add() when called in FIFO order".
-        auto iter = _values.find(std::move(value));
-        tassert(5371400, "Can't remove from an empty WindowFunctionMinMax", iter != _values.end());
-        _memUsageBytes -= iter->getApproximateSize();
-        _values.erase(iter);
+        tassert(
+            5371400, "Can't remove from an empty WindowFunctionMinMax", !_candidates.empty());
+        // If the departing value is not at the front it was evicted by a newer dominator at
+        // add() time, and there is nothing left to undo.
+        if (_expCtx->getValueComparator().compare(_candidates.front(), value) == 0) {
+            _memUsageBytes -= _candidates.front().getApproximateSize();
+            _candidates.pop_front();
+        }
     }
 
     void reset() final {
-        _values.clear();
+        _candidates.clear();
         _memUsageBytes = sizeof(*this);
     }
 
     Value getValue() const final {
-        if (_values.empty())
+        if (_candidates.empty())
             return kDefault;
-        switch (sense) {
-            case AccumulatorMinMax::Sense::kMin:
-                return *_values.begin();
-            case AccumulatorMinMax::Sense::kMax:
-                return *_values.rbegin();
-        }
-        MONGO_UNREACHABLE_TASSERT(5371401);
+        return _candidates.front();
     }
 
 protected:
-    // Holds all the values in the window, in order, with constant-time access to both ends.
-    ValueMultiset _values;
+    // Sorted with the window's current extremum at the front.
+    std::deque<Value> _candidates;
 };
 using WindowFunctionMin = WindowFunctionMinMax<AccumulatorMinMax::Sense::kMin>;
 using WindowFunctionMax = WindowFunctionMinMax<AccumulatorMinMax::Sense::kMax>;
@@ -151,5 +151,22 @@ TEST_F(WindowFunctionMinMaxTest, TracksMemoryUsageOnAddAndRemove) {
     ASSERT_EQ(min.getApproximateSize(), trackingSize);
 }
 
+TEST_F(WindowFunctionMinMaxTest, EvictsDominatedValuesOnAdd) {
+    auto largeStr = Value{"this is quite a long string"_sd};
+    min.add(largeStr);
+    min.add(largeStr);
+
+    // A new minimum evicts every earlier candidate, so only the new value is retained.
+    min.add(Value{"a"_sd});
+    ASSERT_EQ(min.getApproximateSize(),
+              sizeof(WindowFunctionMin) + Value{"a"_sd}.getApproximateSize());
+    ASSERT_VALUE_EQ(min.getValue(), Value{"a"_sd});
+
+    // Removing the evicted values in FIFO order leaves the minimum unchanged.
+    min.remove(largeStr);
+    min.remove(largeStr);
+    ASSERT_VALUE_EQ(min.getValue(), Value{"a"_sd});
+}
+
 }  // namespace
 }  // namespace mongo
@@ -29,16 +29,30 @@
 
 #include "mongo/db/profile_filter.h"
 
+#include "mongo/platform/atomic_word.h"
+
 namespace mongo {
 
 static std::shared_ptr<ProfileFilter> defaultProfileFilter;
+static AtomicWord<bool> anyFilterConfigured{false};
 
 std::shared_ptr<ProfileFilter> ProfileFilter::getDefault() {
     return defaultProfileFilter;
 }
 
 void ProfileFilter::setDefault(std::shared_ptr<ProfileFilter> filter) {
+    if (filter) {
+        noteConfigured();
+    }
     defaultProfileFilter = std::move(filter);
 }
 
+bool ProfileFilter::anyConfigured() {
+    return anyFilterConfigured.loadRelaxed();
+}
+
+void ProfileFilter::noteConfigured() {
+    anyFilterConfigured.store(true);
+}
+
 };  // namespace mongo
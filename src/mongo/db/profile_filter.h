@@ -57,6 +57,21 @@ public:
 
     // Not thread-safe: should only be called during initialization.
     static void setDefault(std::shared_ptr<ProfileFilter>);
+
+    /**
+     * Returns true if a profile filter has ever been configured on this server, either as the
+     * startup default or on an individual database. Lets per-operation code skip fetching the
+     * database profile settings when no filter can be present, which would require acquiring
+     * the current collection catalog.
+     */
+    static bool anyConfigured();
+
+    /**
+     * Records that a profile filter has been configured somewhere. The flag is sticky and
+     * remains set if the filter is later unset, so it can be read without synchronizing with
+     * the copy-on-write collection catalog that owns the per-database settings.
+     */
+    static void noteConfigured();
 };
 
 }  // namespace mongo
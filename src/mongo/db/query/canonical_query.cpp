@@ -40,11 +40,15 @@
 #include "mongo/db/matcher/expression_array.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/base/simple_string_data_comparator.h"
 #include "mongo/db/query/canonical_query_encoder.h"
 #include "mongo/db/query/collation/collator_factory_interface.h"
 #include "mongo/db/query/indexability.h"
+#include "mongo/db/query/lru_key_value.h"
 #include "mongo/db/query/projection_parser.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner_common.h"
+#include "mongo/platform/mutex.h"
 
 namespace mongo {
 namespace {
@@ -56,6 +60,120 @@ bool parsingCanProduceNoopMatchNodes(const ExtensionsCallback& extensionsCallbac
          allowedFeatures & MatchExpressionParser::AllowedFeatures::kJavascript);
 }
 
+//
+// A process-wide cache of parsed and normalized filter trees, keyed by the exact filter bytes.
+// Workloads dominated by a small set of repeated queries pay the MatchExpressionParser and
+// normalization cost once per distinct filter instead of once per request.
+//
+// Only filters built exclusively from self-contained expression types are cached: the prototype
+// trees must not hold references to per-request state such as the ExpressionContext (captured by
+// $expr, $where and $text) or a collator. For the same reason the cache is bypassed entirely for
+// queries with a non-simple collation, since the shape of a normalized tree (e.g. the deduped
+// equality list of a $in) can depend on the collation it was parsed under.
+//
+
+const size_t kFilterParseCacheMaxEntries = 256;
+
+// Filters larger than this are not cached; the parse cost is then dwarfed by execution anyway, and
+// this bounds the cache's memory footprint.
+const int kFilterParseCacheMaxFilterSizeBytes = 8 * 1024;
+
+struct FilterParseCacheKey {
+    BSONObj filter;
+
+    bool operator==(const FilterParseCacheKey& other) const {
+        return filter.binaryEqual(other.filter);
+    }
+};
+
+struct FilterParseCacheKeyHasher {
+    std::size_t operator()(const FilterParseCacheKey& key) const {
+        return SimpleStringDataComparator::kInstance.hash(
+            StringData(key.filter.objdata(), key.filter.objsize()));
+    }
+};
+
+struct FilterParseCacheEntry {
+    // Owns the buffer that the prototype tree's BSONElements point into. Handed out to cache
+    // consumers so the buffer outlives any clones even after the entry is evicted.
+    BSONObj backingFilter;
+
+    // The normalized prototype tree. Never returned directly; consumers receive a clone.
+    std::unique_ptr<MatchExpression> root;
+};
+
+class FilterParseCache {
+public:
+    /**
+     * Returns a clone of the cached normalized tree for 'filter', or nullptr on a cache miss. On a
+     * hit, 'backingOut' is set to the BSONObj owning the buffer the clone's elements point into;
+     * the caller must keep a reference to it for as long as the clone is alive.
+     */
+    std::unique_ptr<MatchExpression> lookup(const BSONObj& filter, BSONObj* backingOut) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        FilterParseCacheEntry* entry;
+        if (!_cache.get({filter}, &entry).isOK()) {
+            return nullptr;
+        }
+        *backingOut = entry->backingFilter;
+        return entry->root->shallowClone();
+    }
+
+    /**
+     * Caches 'root' as the parse of 'filter'. 'filter' must own its buffer and be the object that
+     * 'root' was parsed from.
+     */
+    void insert(const BSONObj& filter, std::unique_ptr<MatchExpression> root) {
+        invariant(filter.isOwned());
+        auto entry = std::make_unique<FilterParseCacheEntry>();
+        entry->backingFilter = filter;
+        entry->root = std::move(root);
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        _cache.add({filter}, entry.release());
+    }
+
+private:
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("FilterParseCache::_mutex");
+    LRUKeyValue<FilterParseCacheKey, FilterParseCacheEntry, FilterParseCacheKeyHasher> _cache{
+        kFilterParseCacheMaxEntries};
+};
+
+FilterParseCache& filterParseCache() {
+    static auto cache = new FilterParseCache();
+    return *cache;
+}
+
+/**
+ * Returns true if every node of 'expr' is self-contained, i.e. references nothing with
+ * per-request lifetime, so a clone of the tree can safely outlive the request it was parsed for.
+ */
+bool isParseCacheableExpression(const MatchExpression* expr) {
+    switch (expr->matchType()) {
+        case MatchExpression::AND:
+        case MatchExpression::OR:
+        case MatchExpression::NOR:
+        case MatchExpression::NOT:
+            for (size_t i = 0; i < expr->numChildren(); ++i) {
+                if (!isParseCacheableExpression(expr->getChild(i))) {
+                    return false;
+                }
+            }
+            return true;
+        case MatchExpression::EQ:
+        case MatchExpression::LT:
+        case MatchExpression::LTE:
+        case MatchExpression::GT:
+        case MatchExpression::GTE:
+        case MatchExpression::MATCH_IN:
+        case MatchExpression::EXISTS:
+        case MatchExpression::REGEX:
+            return true;
+        default:
+            return false;
+    }
+}
+
 }  // namespace
 
 // static
@@ -110,6 +228,12 @@ StatusWith<std::unique_ptr<CanonicalQuery>> CanonicalQuery::canonicalize(
     std::unique_ptr<CanonicalQuery> cq(new CanonicalQuery());
     cq->setExplain(explain);
 
+    const bool filterParseCacheEligible = internalQueryEnableFilterParseCache.load() &&
+        !newExpCtx->getCollator() &&
+        findCommand->getFilter().objsize() <= kFilterParseCacheMaxFilterSizeBytes &&
+        !(getTestCommandsEnabled() && internalQueryEnableCSTParser.load());
+    bool filterFromParseCache = false;
+
     StatusWithMatchExpression statusWithMatcher = [&]() -> StatusWithMatchExpression {
         if (getTestCommandsEnabled() && internalQueryEnableCSTParser.load()) {
             try {
@@ -119,6 +243,23 @@ StatusWith<std::unique_ptr<CanonicalQuery>> CanonicalQuery::canonicalize(
                 return ex.toStatus();
             }
         } else {
+            if (filterParseCacheEligible) {
+                BSONObj backing;
+                if (auto cached = filterParseCache().lookup(findCommand->getFilter(), &backing)) {
+                    // Point the request at the cache's binary-identical copy of the filter so that
+                    // the buffer referenced by the cloned tree stays alive for the lifetime of the
+                    // query.
+                    findCommand->setFilter(backing);
+                    filterFromParseCache = true;
+                    return {std::move(cached)};
+                }
+                // Parse from an owned copy of the filter so that, if the tree turns out to be
+                // cacheable, it can be stored together with its backing buffer after init() has
+                // normalized it.
+                if (!findCommand->getFilter().isOwned()) {
+                    findCommand->setFilter(findCommand->getFilter().getOwned());
+                }
+            }
             return MatchExpressionParser::parse(
                 findCommand->getFilter(), newExpCtx, extensionsCallback, allowedFeatures);
         }
@@ -145,6 +286,15 @@ StatusWith<std::unique_ptr<CanonicalQuery>> CanonicalQuery::canonicalize(
     if (!initStatus.isOK()) {
         return initStatus;
     }
+
+    // Cache the normalized tree for reuse by later requests with a byte-identical filter, if its
+    // expression types permit.
+    if (filterParseCacheEligible && !filterFromParseCache &&
+        isParseCacheableExpression(cq->root())) {
+        filterParseCache().insert(cq->getFindCommandRequest().getFilter(),
+                                  cq->root()->shallowClone());
+    }
+
     return std::move(cq);
 }
 
@@ -210,6 +360,11 @@ Status CanonicalQuery::init(OperationContext* opCtx,
         return status;
     }
 
+    // Flatten the filter for fast per-document evaluation during scans, when its shape allows.
+    // The compiled form reads each leaf's collator dynamically, so a later setCollator() does not
+    // invalidate it.
+    _compiledFilter = CompiledMatchExpression::tryCompile(_root.get());
+
     // Validate the projection if there is one.
     if (!_findCommand->getProjection().isEmpty()) {
         try {
@@ -320,6 +475,43 @@ bool CanonicalQuery::isSimpleIdQuery(const BSONObj& query) {
     return hasID;
 }
 
+// static
+bool CanonicalQuery::isSimpleIdInQuery(const BSONObj& query) {
+    // The filter must consist of a single $in predicate on _id.
+    if (query.nFields() != 1) {
+        return false;
+    }
+
+    BSONElement idElt = query.firstElement();
+    if (idElt.fieldNameStringData() != "_id" || idElt.type() != Object) {
+        return false;
+    }
+
+    BSONObj idPredicate = idElt.Obj();
+    if (idPredicate.nFields() != 1 ||
+        idPredicate.firstElementFieldNameStringData() != "$in" ||
+        idPredicate.firstElement().type() != Array) {
+        return false;
+    }
+
+    bool hasElements = false;
+    for (auto&& valueElt : idPredicate.firstElement().Obj()) {
+        hasElements = true;
+        if (valueElt.type() == Object) {
+            // A literal object match is fine, but the value cannot be a query operator.
+            if (valueElt.Obj().firstElementFieldName()[0] == '$') {
+                return false;
+            }
+        } else if (valueElt.type() == Array || !Indexability::isExactBoundsGenerating(valueElt)) {
+            // Arrays and values such as regexes have matching semantics beyond an exact point
+            // lookup on the _id index.
+            return false;
+        }
+    }
+
+    return hasElements;
+}
+
 size_t CanonicalQuery::countNodes(const MatchExpression* root, MatchExpression::MatchType type) {
     size_t sum = 0;
     if (type == root->matchType()) {
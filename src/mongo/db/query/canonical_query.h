@@ -33,6 +33,7 @@
 #include "mongo/base/status.h"
 #include "mongo/db/cst/c_node.h"
 #include "mongo/db/jsobj.h"
+#include "mongo/db/matcher/compiled_match_expression.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/matcher/extensions_callback_noop.h"
 #include "mongo/db/pipeline/inner_pipeline_stage_interface.h"
@@ -90,6 +91,13 @@ public:
      */
     static bool isSimpleIdQuery(const BSONObj& query);
 
+    /**
+     * Returns true if "query" is exactly {_id: {$in: [...]}} where every element of the $in list
+     * is a literal generating exact point bounds, i.e. the query describes a batch of exact-match
+     * point lookups on _id.
+     */
+    static bool isSimpleIdInQuery(const BSONObj& query);
+
     /**
      * Validates the match expression 'root' as well as the query specified by 'request', checking
      * for illegal combinations of operators. Returns a non-OK status if any such illegal
@@ -127,6 +135,15 @@ public:
     MatchExpression* root() const {
         return _root.get();
     }
+
+    /**
+     * Returns the flattened form of the filter, or nullptr if the filter's shape isn't supported
+     * by CompiledMatchExpression. Built once at canonicalization; points into the tree returned
+     * by root() and stays valid as long as this CanonicalQuery is alive.
+     */
+    const CompiledMatchExpression* getCompiledFilter() const {
+        return _compiledFilter.get();
+    }
     const BSONObj& getQueryObj() const {
         return _findCommand->getFilter();
     }
@@ -256,6 +273,9 @@ private:
 
     std::unique_ptr<MatchExpression> _root;
 
+    // Flattened form of '_root', when its shape allows. Points into '_root'.
+    std::unique_ptr<CompiledMatchExpression> _compiledFilter;
+
     boost::optional<projection_ast::Projection> _proj;
 
     boost::optional<SortPattern> _sortPattern;
@@ -114,6 +114,50 @@ TEST(CanonicalQueryTest, IsValidSortKeyMetaProjection) {
     }
 }
 
+TEST(CanonicalQueryTest, IsSimpleIdInQuery) {
+    // Point lookups on _id via $in are recognized.
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1, 2, 3]}}")));
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: ['a', {b: 1}]}}")));
+
+    // An empty $in matches nothing and is left to the normal planner.
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: []}}")));
+
+    // Values with matching semantics beyond an exact point lookup are rejected.
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1, /abc/]}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [[1, 2]]}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [null]}}")));
+
+    // The predicate must be a lone $in on _id.
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: 1}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{a: {$in: [1]}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1]}, a: 1}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1], $gt: 0}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$nin: [1]}}")));
+}
+
+TEST(CanonicalQueryTest, FilterParseCacheProducesEquivalentTree) {
+    QueryTestServiceContext serviceContext;
+    auto opCtx = serviceContext.makeOperationContext();
+
+    auto makeCQ = [&]() {
+        auto findCommand = query_request_helper::makeFromFindCommandForTests(
+            fromjson("{find: 'testcoll', filter: {a: 1, b: {$in: [1, 2]}}, '$db': 'test'}"));
+        auto statusWithCQ = CanonicalQuery::canonicalize(opCtx.get(), std::move(findCommand));
+        ASSERT_OK(statusWithCQ.getStatus());
+        return std::move(statusWithCQ.getValue());
+    };
+
+    // The first canonicalization populates the filter parse cache; the second may be served from
+    // it. Both must produce equivalent normalized trees, and the second query must remain valid
+    // after the first is destroyed.
+    auto first = makeCQ();
+    auto expected = first->root()->shallowClone();
+
+    auto second = makeCQ();
+    first.reset();
+    assertEquivalent("{a: 1, b: {$in: [1, 2]}}", expected.get(), second->root());
+}
+
 //
 // Tests for MatchExpression::sortTree
 //
@@ -86,6 +86,12 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
             params.requestResumeToken = csn->requestResumeToken;
             params.resumeAfterRecordId = csn->resumeAfterRecordId;
             params.stopApplyingFilterAfterFirstMatch = csn->stopApplyingFilterAfterFirstMatch;
+            // When this scan's filter is the whole query filter, hand the stage the flattened
+            // form compiled at canonicalization. The compiled filter is owned by '_cq', which
+            // outlives the plan.
+            if (csn->filter && _cq.getCompiledFilter() && csn->filter->equivalent(_cq.root())) {
+                params.compiledFilter = _cq.getCompiledFilter();
+            }
             return std::make_unique<CollectionScan>(
                 expCtx, _collection, params, _ws, csn->filter.get());
         }
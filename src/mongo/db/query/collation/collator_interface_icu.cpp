@@ -34,7 +34,6 @@
 #include <memory>
 
 #include <unicode/coll.h>
-#include <unicode/sortkey.h>
 
 #include "mongo/util/assert_util.h"
 
@@ -76,26 +75,35 @@ CollatorInterface::ComparisonKey CollatorInterfaceICU::getComparisonKey(
     StringData stringData) const {
     // A StringPiece is ICU's StringData. They are logically the same abstraction.
     const icu::StringPiece stringPiece(stringData.rawData(), stringData.size());
+    const auto unicodeString = icu::UnicodeString::fromUTF8(stringPiece);
+
+    // getSortKey() writes directly into a caller-provided buffer, unlike getCollationKey(), which
+    // heap-allocates an icu::CollationKey per call. Comparison keys are generated once per value
+    // on collated sort and index-build paths, so the per-call allocations are worth avoiding. Sort
+    // keys for typical field values fit in the stack buffer; for longer ones getSortKey() reports
+    // the length it needed and we retry once with an exactly-sized buffer. A zero length is only
+    // returned when a memory allocation fails inside ICU, which we consider fatal to the process.
+    uint8_t stackBuffer[256];
+    int32_t keyLength = _collator->getSortKey(unicodeString, stackBuffer, sizeof(stackBuffer));
+    fassert(34439, keyLength > 0);
+
+    if (static_cast<size_t>(keyLength) <= sizeof(stackBuffer)) {
+        // The last byte of the sort key should always be null. When we construct the comparison
+        // key, we omit the trailing null byte.
+        invariant(stackBuffer[keyLength - 1] == '\0');
+        return makeComparisonKey(
+            std::string(reinterpret_cast<const char*>(stackBuffer), keyLength - 1u));
+    }
 
-    UErrorCode status = U_ZERO_ERROR;
-    icu::CollationKey icuKey;
-    _collator->getCollationKey(icu::UnicodeString::fromUTF8(stringPiece), icuKey, status);
-
-    // Any sequence of bytes, even invalid UTF-8, has defined comparison behavior in ICU (invalid
-    // subsequences are weighted as the replacement character, U+FFFD). A non-ok error code is only
-    // expected when a memory allocation fails inside ICU, which we consider fatal to the process.
-    fassert(34439, U_SUCCESS(status));
-
-    int32_t keyLength;
-    const uint8_t* keyBuffer = icuKey.getByteArray(keyLength);
-    invariant(keyLength > 0);
-    invariant(keyBuffer);
-
-    // The last byte of the sort key should always be null. When we construct the comparison key, we
-    // omit the trailing null byte.
-    invariant(keyBuffer[keyLength - 1u] == '\0');
-    const char* charBuffer = reinterpret_cast<const char*>(keyBuffer);
-    return makeComparisonKey(std::string(charBuffer, keyLength - 1u));
+    // The key was too large for the stack buffer; build it directly in the string that the
+    // ComparisonKey will own.
+    std::string key(static_cast<size_t>(keyLength), '\0');
+    const int32_t fullLength =
+        _collator->getSortKey(unicodeString, reinterpret_cast<uint8_t*>(&key[0]), keyLength);
+    fassert(6174817, fullLength == keyLength);
+    invariant(key[keyLength - 1] == '\0');
+    key.pop_back();
+    return makeComparisonKey(std::move(key));
 }
 
 }  // namespace mongo
@@ -329,6 +329,27 @@ TEST(CollatorInterfaceICUTest, StringsWithEmbeddedNullByteCompareCorrectlyUsingC
     ASSERT_GT(key2.getKeyData().compare(key1.getKeyData()), 0);
 }
 
+TEST(CollatorInterfaceICUTest, LongStringsCompareCorrectlyUsingComparisonKeys) {
+    Collation collationSpec;
+    collationSpec.setLocale("en_US");
+
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::Collator> coll(
+        icu::Collator::createInstance(icu::Locale("en", "US"), status));
+    ASSERT(U_SUCCESS(status));
+
+    // Long enough that the sort keys exceed any reasonable stack buffer inside the collator.
+    const std::string string1(2048, 'a');
+    const std::string string2 = string1 + "b";
+
+    CollatorInterfaceICU icuCollator(collationSpec, std::move(coll));
+    auto key1 = icuCollator.getComparisonKey(string1);
+    auto key2 = icuCollator.getComparisonKey(string2);
+    ASSERT_EQ(key1.getKeyData().compare(key1.getKeyData()), 0);
+    ASSERT_LT(key1.getKeyData().compare(key2.getKeyData()), 0);
+    ASSERT_GT(key2.getKeyData().compare(key1.getKeyData()), 0);
+}
+
 TEST(CollatorInterfaceICUTest, TwoUSEnglishCollationsAreEqual) {
     Collation collationSpec;
     collationSpec.setLocale("en_US");
@@ -82,6 +82,48 @@ CoreIndexInfo indexInfoFromIndexCatalogEntry(const IndexCatalogEntry& ice) {
 CollectionQueryInfo::CollectionQueryInfo()
     : _keysComputed(false), _planCache(std::make_shared<PlanCache>()) {}
 
+CollectionQueryInfo::CollectionQueryInfo(const CollectionQueryInfo& other)
+    : _keysComputed(other._keysComputed),
+      _indexedPaths(other._indexedPaths),
+      _planCache(other._planCache),
+      _plannerIndexEntries(atomic_load(&other._plannerIndexEntries)),
+      _plannerIndexEntriesVersion(other._plannerIndexEntriesVersion.load()) {}
+
+CollectionQueryInfo& CollectionQueryInfo::operator=(const CollectionQueryInfo& other) {
+    if (this != &other) {
+        _keysComputed = other._keysComputed;
+        _indexedPaths = other._indexedPaths;
+        _planCache = other._planCache;
+        atomic_store(&_plannerIndexEntries, atomic_load(&other._plannerIndexEntries));
+        _plannerIndexEntriesVersion.store(other._plannerIndexEntriesVersion.load());
+    }
+    return *this;
+}
+
+std::shared_ptr<const CollectionQueryInfo::PlannerIndexEntries>
+CollectionQueryInfo::getPlannerIndexEntries() const {
+    auto entries = atomic_load(&_plannerIndexEntries);
+    if (entries && entries->version == _plannerIndexEntriesVersion.load()) {
+        return entries;
+    }
+    return nullptr;
+}
+
+void CollectionQueryInfo::setPlannerIndexEntries(
+    std::shared_ptr<const PlannerIndexEntries> entries) const {
+    // If an invalidation raced with the build then these entries may reflect either state; drop
+    // them and let the next query rebuild. Entries stored with a stale version are harmless as
+    // getPlannerIndexEntries() refuses to serve them.
+    if (entries->version != _plannerIndexEntriesVersion.load()) {
+        return;
+    }
+    atomic_store(&_plannerIndexEntries, std::move(entries));
+}
+
+void CollectionQueryInfo::invalidatePlannerIndexEntries() const {
+    _plannerIndexEntriesVersion.fetchAndAdd(1);
+}
+
 const UpdateIndexData& CollectionQueryInfo::getIndexKeys(OperationContext* opCtx) const {
     invariant(_keysComputed);
     return _indexedPaths;
@@ -204,6 +246,7 @@ void CollectionQueryInfo::clearQueryCacheForSetMultikey(const CollectionPtr& col
                 "Clearing plan cache for multikey - collection info cache cleared",
                 "namespace"_attr = coll->ns());
     _planCache->clear();
+    invalidatePlannerIndexEntries();
 }
 
 PlanCache* CollectionQueryInfo::getPlanCache() const {
@@ -212,6 +255,8 @@ PlanCache* CollectionQueryInfo::getPlanCache() const {
 
 void CollectionQueryInfo::updatePlanCacheIndexEntries(OperationContext* opCtx,
                                                       const CollectionPtr& coll) {
+    invalidatePlannerIndexEntries();
+
     std::vector<CoreIndexInfo> indexCores;
 
     // TODO We shouldn't need to include unfinished indexes, but we must here because the index
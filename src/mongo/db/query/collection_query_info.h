@@ -30,9 +30,11 @@
 #pragma once
 
 #include "mongo/db/catalog/collection.h"
+#include "mongo/db/query/index_entry.h"
 #include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/update_index_data.h"
+#include "mongo/platform/atomic_word.h"
 
 namespace mongo {
 
@@ -48,6 +50,25 @@ class CollectionQueryInfo {
 public:
     CollectionQueryInfo();
 
+    // Decorations on a Collection are copied when the Collection instance is cloned for a DDL
+    // write. Hand-written because AtomicWord is not copyable; the cached entries are shared with
+    // the clone and remain valid until the clone's own index data is rebuilt.
+    CollectionQueryInfo(const CollectionQueryInfo& other);
+    CollectionQueryInfo& operator=(const CollectionQueryInfo& other);
+
+    /**
+     * A fully-built vector of IndexEntries for the collection's ready, non-hidden indexes, shared
+     * by all queries planned against this point-in-time view of the collection. Building these
+     * from the index catalog copies key patterns, multikey paths and index specs, which is pure
+     * allocation churn when repeated for every query planned.
+     */
+    struct PlannerIndexEntries {
+        // Value of the invalidation counter when these entries were built. Entries whose version
+        // no longer matches are discarded rather than served.
+        uint64_t version;
+        std::vector<IndexEntry> entries;
+    };
+
     inline static const auto getCollectionQueryInfo =
         Collection::declareDecoration<CollectionQueryInfo>();
     static const CollectionQueryInfo& get(const CollectionPtr& collection) {
@@ -94,6 +115,27 @@ public:
      */
     void clearQueryCacheForSetMultikey(const CollectionPtr& coll) const;
 
+    /**
+     * Returns the cached planner index entries, or nullptr if none have been built since the last
+     * index DDL or multikey change. Safe to call concurrently with invalidation.
+     */
+    std::shared_ptr<const PlannerIndexEntries> getPlannerIndexEntries() const;
+
+    /**
+     * Publishes 'entries' for subsequent queries planned against this collection.
+     * 'entries->version' must have been read with plannerIndexEntriesVersion() before iterating
+     * the index catalog; if an invalidation raced with the build this is a no-op and the next
+     * query rebuilds.
+     */
+    void setPlannerIndexEntries(std::shared_ptr<const PlannerIndexEntries> entries) const;
+
+    /**
+     * Returns the current invalidation counter, to be stored in PlannerIndexEntries::version.
+     */
+    uint64_t plannerIndexEntriesVersion() const {
+        return _plannerIndexEntriesVersion.load();
+    }
+
     void notifyOfQuery(OperationContext* opCtx,
                        const CollectionPtr& coll,
                        const PlanSummaryStats& summaryStats) const;
@@ -101,6 +143,7 @@ public:
 private:
     void computeIndexKeys(OperationContext* opCtx, const CollectionPtr& coll);
     void updatePlanCacheIndexEntries(OperationContext* opCtx, const CollectionPtr& coll);
+    void invalidatePlannerIndexEntries() const;
 
     // ---  index keys cache
     bool _keysComputed;
@@ -108,6 +151,14 @@ private:
 
     // A cache for query plans. Shared across cloned Collection instances.
     std::shared_ptr<PlanCache> _planCache;
+
+    // Prebuilt IndexEntries served to the planner. Accessed with atomic_load/atomic_store since
+    // queries populate and read it concurrently through the const reference handed out by get().
+    mutable std::shared_ptr<const PlannerIndexEntries> _plannerIndexEntries;
+
+    // Incremented whenever the cached entries would go stale: index DDL funnels through
+    // rebuildIndexData() and an index turning multikey through clearQueryCacheForSetMultikey().
+    mutable AtomicWord<uint64_t> _plannerIndexEntriesVersion{0};
 };
 
 }  // namespace mongo
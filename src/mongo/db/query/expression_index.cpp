@@ -37,6 +37,8 @@
 #include "mongo/db/hasher.h"
 #include "mongo/db/index/expression_params.h"
 #include "mongo/db/query/expression_index_knobs_gen.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/lru_cache.h"
 #include "third_party/s2/s2cellid.h"
 #include "third_party/s2/s2region.h"
 #include "third_party/s2/s2regioncoverer.h"
@@ -107,10 +109,44 @@ void ExpressionMapping::cover2d(const R2Region& region,
     GeoHashsToIntervalsWithParents(unorderedCovering, oilOut);
 }
 
-std::vector<S2CellId> ExpressionMapping::get2dsphereCovering(const S2Region& region) {
-    auto minLevel = gInternalQueryS2GeoCoarsestLevel.load();
-    auto maxLevel = gInternalQueryS2GeoFinestLevel.load();
+namespace {
+
+// Guards 's2CoveringCache'.
+Mutex s2CoveringCacheMutex = MONGO_MAKE_LATCH("ExpressionMapping::s2CoveringCacheMutex");
+
+using S2CoveringCache = LRUCache<std::string, std::vector<S2CellId>>;
+
+// Process-wide cache of S2 cell coverings for predicate query geometries. Coverings depend only on
+// the geometry and the covering knobs, not on any collection or index, so a single cache serves
+// every consumer.
+S2CoveringCache* s2CoveringCache() {
+    // The cache size knob is startup-only, so the capacity is fixed for the lifetime of the
+    // process. No query can reach this code before startup options have been applied.
+    static S2CoveringCache* cache = gInternalQueryS2GeoCoveringCacheSize > 0
+        ? new S2CoveringCache(gInternalQueryS2GeoCoveringCacheSize)
+        : nullptr;
+    return cache;
+}
 
+std::string makeS2CoveringCacheKey(const BSONObj& rawGeometry,
+                                   int minLevel,
+                                   int maxLevel,
+                                   int maxCells) {
+    std::string key;
+    key.reserve(rawGeometry.objsize() + 3 * sizeof(int));
+    // BSON objects are length-prefixed, so appending the knob values after the raw bytes cannot
+    // collide with a different geometry.
+    key.append(rawGeometry.objdata(), rawGeometry.objsize());
+    key.append(reinterpret_cast<const char*>(&minLevel), sizeof(minLevel));
+    key.append(reinterpret_cast<const char*>(&maxLevel), sizeof(maxLevel));
+    key.append(reinterpret_cast<const char*>(&maxCells), sizeof(maxCells));
+    return key;
+}
+
+std::vector<S2CellId> computeS2Covering(const S2Region& region,
+                                        int minLevel,
+                                        int maxLevel,
+                                        int maxCells) {
     uassert(28739, "Geo coarsest level must be in range [0,30]", 0 <= minLevel && minLevel <= 30);
     uassert(28740, "Geo finest level must be in range [0,30]", 0 <= maxLevel && maxLevel <= 30);
     uassert(28741, "Geo coarsest level must be less than or equal to finest", minLevel <= maxLevel);
@@ -118,17 +154,57 @@ std::vector<S2CellId> ExpressionMapping::get2dsphereCovering(const S2Region& reg
     S2RegionCoverer coverer;
     coverer.set_min_level(minLevel);
     coverer.set_max_level(maxLevel);
-    coverer.set_max_cells(gInternalQueryS2GeoMaxCells.load());
+    coverer.set_max_cells(maxCells);
 
     std::vector<S2CellId> cover;
     coverer.GetCovering(region, &cover);
     return cover;
 }
 
+}  // namespace
+
+std::vector<S2CellId> ExpressionMapping::get2dsphereCovering(const S2Region& region) {
+    return computeS2Covering(region,
+                             gInternalQueryS2GeoCoarsestLevel.load(),
+                             gInternalQueryS2GeoFinestLevel.load(),
+                             gInternalQueryS2GeoMaxCells.load());
+}
+
+std::vector<S2CellId> ExpressionMapping::get2dsphereCovering(const S2Region& region,
+                                                             const BSONObj& rawGeometry) {
+    auto* cache = s2CoveringCache();
+    if (!cache) {
+        return get2dsphereCovering(region);
+    }
+
+    // Load the knobs once so that the values baked into the key are the values actually used to
+    // compute the covering, even if a setParameter lands in between.
+    const int minLevel = gInternalQueryS2GeoCoarsestLevel.load();
+    const int maxLevel = gInternalQueryS2GeoFinestLevel.load();
+    const int maxCells = gInternalQueryS2GeoMaxCells.load();
+
+    auto key = makeS2CoveringCacheKey(rawGeometry, minLevel, maxLevel, maxCells);
+    {
+        stdx::lock_guard<Latch> lk(s2CoveringCacheMutex);
+        auto it = cache->find(key);
+        if (it != cache->end()) {
+            return it->second;
+        }
+    }
+
+    auto cover = computeS2Covering(region, minLevel, maxLevel, maxCells);
+    {
+        stdx::lock_guard<Latch> lk(s2CoveringCacheMutex);
+        cache->add(key, cover);
+    }
+    return cover;
+}
+
 void ExpressionMapping::cover2dsphere(const S2Region& region,
+                                      const BSONObj& rawGeometry,
                                       const S2IndexingParams& indexingParams,
                                       OrderedIntervalList* oilOut) {
-    std::vector<S2CellId> cover = get2dsphereCovering(region);
+    std::vector<S2CellId> cover = get2dsphereCovering(region, rawGeometry);
     S2CellIdsToIntervalsWithParents(cover, indexingParams, oilOut);
 }
 
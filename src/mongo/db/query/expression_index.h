@@ -65,6 +65,16 @@ public:
 
     static std::vector<S2CellId> get2dsphereCovering(const S2Region& region);
 
+    /**
+     * As above, but first consults a process-wide LRU cache keyed on 'rawGeometry' - the raw BSON
+     * of the user's geo specification - and the covering knobs in effect. Parsing a geometry is
+     * deterministic, so identical raw bytes always describe the same region. Callers without the
+     * original specification (e.g. geoNear annuli derived during execution) must use the uncached
+     * overload.
+     */
+    static std::vector<S2CellId> get2dsphereCovering(const S2Region& region,
+                                                     const BSONObj& rawGeometry);
+
     static void S2CellIdsToIntervals(const std::vector<S2CellId>& intervalSet,
                                      S2IndexVersion indexVersion,
                                      OrderedIntervalList* oilOut);
@@ -76,6 +86,7 @@ public:
                                                 OrderedIntervalList* out);
 
     static void cover2dsphere(const S2Region& region,
+                              const BSONObj& rawGeometry,
                               const S2IndexingParams& indexParams,
                               OrderedIntervalList* oilOut);
 };
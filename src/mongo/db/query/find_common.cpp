@@ -72,6 +72,13 @@ bool FindCommon::enoughForFirstBatch(const FindCommandRequest& findCommand, long
 }
 
 bool FindCommon::haveSpaceForNext(const BSONObj& nextDoc, long long numDocs, int bytesBuffered) {
+    return haveSpaceForNext(nextDoc, numDocs, bytesBuffered, kMaxBytesToReturnToClientAtOnce);
+}
+
+bool FindCommon::haveSpaceForNext(const BSONObj& nextDoc,
+                                  long long numDocs,
+                                  int bytesBuffered,
+                                  int byteLimit) {
     invariant(numDocs >= 0);
     if (!numDocs) {
         // Allow the first output document to exceed the limit to ensure we can always make
@@ -79,7 +86,39 @@ bool FindCommon::haveSpaceForNext(const BSONObj& nextDoc, long long numDocs, int
         return true;
     }
 
-    return (bytesBuffered + nextDoc.objsize()) <= kMaxBytesToReturnToClientAtOnce;
+    return (bytesBuffered + nextDoc.objsize()) <= byteLimit;
+}
+
+bool FindCommon::isUnboundedCollectionScan(const FindCommandRequest& findCommand) {
+    // Only an empty filter guarantees a collection scan; any predicate may be answered by an
+    // index scan that touches a fraction of the collection.
+    if (!findCommand.getFilter().isEmpty()) {
+        return false;
+    }
+
+    // A sort or hint other than $natural routes the query through an index.
+    if (!findCommand.getSort().isEmpty() &&
+        !findCommand.getSort()[query_request_helper::kNaturalSortField]) {
+        return false;
+    }
+    if (!findCommand.getHint().isEmpty() &&
+        !findCommand.getHint()[query_request_helper::kNaturalSortField]) {
+        return false;
+    }
+
+    // min/max restrict the scan to an index-bounded range.
+    if (!findCommand.getMin().isEmpty() || !findCommand.getMax().isEmpty()) {
+        return false;
+    }
+
+    // Resumed scans cover an arbitrary portion of the collection, and their callers (e.g.
+    // resumable index builds) already request readOnce explicitly when it is appropriate.
+    if (findCommand.getRequestResumeToken() || !findCommand.getResumeAfter().isEmpty()) {
+        return false;
+    }
+
+    // Tailable cursors revisit the tail of a capped collection and benefit from caching it.
+    return !findCommand.getTailable();
 }
 
 void FindCommon::waitInFindBeforeMakingBatch(OperationContext* opCtx, const CanonicalQuery& cq) {
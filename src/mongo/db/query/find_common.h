@@ -120,6 +120,23 @@ public:
      */
     static bool haveSpaceForNext(const BSONObj& nextDoc, long long numDocs, int bytesBuffered);
 
+    /**
+     * Same as above, but against an explicit byte budget rather than the full response size limit.
+     * Used by getMore when adaptive batch sizing has computed a smaller budget for this cursor.
+     */
+    static bool haveSpaceForNext(const BSONObj& nextDoc,
+                                 long long numDocs,
+                                 int bytesBuffered,
+                                 int byteLimit);
+
+    /**
+     * Returns true if 'findCommand' is guaranteed to plan as an unbounded collection scan: an
+     * empty filter with no index hint and no sort, min, max or resume token that could route the
+     * query through an index or restrict the range of records scanned. Used to decide whether a
+     * scan should declare sequential, read-once access intent to the storage engine.
+     */
+    static bool isUnboundedCollectionScan(const FindCommandRequest& findCommand);
+
     /**
      * This function wraps waitWhileFailPointEnabled() on waitInFindBeforeMakingBatch.
      *
@@ -63,6 +63,7 @@
 #include "mongo/db/index_names.h"
 #include "mongo/db/matcher/extensions_callback_noop.h"
 #include "mongo/db/matcher/extensions_callback_real.h"
+#include "mongo/db/operation_trace.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/canonical_query_encoder.h"
 #include "mongo/db/query/collation/collation_index_key.h"
@@ -150,11 +151,23 @@ bool turnIxscanIntoCount(QuerySolution* soln);
  */
 bool isIdHackEligibleQuery(const CollectionPtr& collection, const CanonicalQuery& query) {
     const auto& findCommand = query.getFindCommandRequest();
-    return !findCommand.getShowRecordId() && findCommand.getHint().isEmpty() &&
-        findCommand.getMin().isEmpty() && findCommand.getMax().isEmpty() &&
-        !findCommand.getSkip() && CanonicalQuery::isSimpleIdQuery(findCommand.getFilter()) &&
-        !findCommand.getTailable() &&
-        CollatorInterface::collatorsMatch(query.getCollator(), collection->getDefaultCollator());
+    if (findCommand.getShowRecordId() || !findCommand.getHint().isEmpty() ||
+        !findCommand.getMin().isEmpty() || !findCommand.getMax().isEmpty() ||
+        findCommand.getSkip() || findCommand.getTailable() ||
+        !CollatorInterface::collatorsMatch(query.getCollator(),
+                                           collection->getDefaultCollator())) {
+        return false;
+    }
+
+    if (CanonicalQuery::isSimpleIdQuery(findCommand.getFilter())) {
+        return true;
+    }
+
+    // A batch of point lookups, {_id: {$in: [...]}}, can also use the IDHACK plan. Unlike the
+    // single-key case it can produce more than one document, so the query must not impose an
+    // ordering or a limit of its own.
+    return findCommand.getSort().isEmpty() && !findCommand.getLimit() &&
+        !findCommand.getNtoreturn() && CanonicalQuery::isSimpleIdInQuery(findCommand.getFilter());
 }
 }  // namespace
 
@@ -276,25 +289,52 @@ void fillOutPlannerParams(OperationContext* opCtx,
                           QueryPlannerParams* plannerParams) {
     invariant(canonicalQuery);
     bool apiStrict = APIParameters::get(opCtx).getAPIStrict().value_or(false);
-    // If it's not NULL, we may have indices.  Access the catalog and fill out IndexEntry(s)
-    std::unique_ptr<IndexCatalog::IndexIterator> ii =
-        collection->getIndexCatalog()->getIndexIterator(opCtx, false);
-    while (ii->more()) {
-        const IndexCatalogEntry* ice = ii->next();
 
-        // Indexes excluded from API version 1 should _not_ be used for planning if apiStrict is set
-        // to true.
-        auto indexType = ice->descriptor()->getIndexType();
+    // If it's not NULL, we may have indices. Use the prebuilt IndexEntry vector cached on
+    // CollectionQueryInfo when it is still valid, so planning a query doesn't have to walk the
+    // index catalog and recompute multikey metadata for every index.
+    const auto& queryInfo = CollectionQueryInfo::get(collection);
+    auto cachedEntries = queryInfo.getPlannerIndexEntries();
+    if (!cachedEntries) {
+        auto built = std::make_shared<CollectionQueryInfo::PlannerIndexEntries>();
+        built->version = queryInfo.plannerIndexEntriesVersion();
+
+        bool cacheable = true;
+        std::unique_ptr<IndexCatalog::IndexIterator> ii =
+            collection->getIndexCatalog()->getIndexIterator(opCtx, false);
+        while (ii->more()) {
+            const IndexCatalogEntry* ice = ii->next();
+
+            // Skip the addition of hidden indexes to prevent use in query planning.
+            if (ice->descriptor()->hidden())
+                continue;
+
+            // A multikey wildcard index derives its multikey path set from the fields of the
+            // query being planned, so its entry cannot be shared across queries.
+            if (ice->descriptor()->getIndexType() == IndexType::INDEX_WILDCARD &&
+                ice->isMultikey(opCtx, collection)) {
+                cacheable = false;
+            }
+
+            built->entries.push_back(
+                indexEntryFromIndexCatalogEntry(opCtx, collection, *ice, canonicalQuery));
+        }
+
+        if (cacheable) {
+            queryInfo.setPlannerIndexEntries(built);
+        }
+        cachedEntries = std::move(built);
+    }
+
+    for (const auto& entry : cachedEntries->entries) {
+        // Indexes excluded from API version 1 should _not_ be used for planning if apiStrict is
+        // set to true.
         if (apiStrict &&
-            (indexType == IndexType::INDEX_HAYSTACK || indexType == IndexType::INDEX_TEXT ||
-             ice->descriptor()->isSparse()))
+            (entry.type == IndexType::INDEX_HAYSTACK || entry.type == IndexType::INDEX_TEXT ||
+             entry.sparse))
             continue;
 
-        // Skip the addition of hidden indexes to prevent use in query planning.
-        if (ice->descriptor()->hidden())
-            continue;
-        plannerParams->indices.push_back(
-            indexEntryFromIndexCatalogEntry(opCtx, collection, *ice, canonicalQuery));
+        plannerParams->indices.push_back(entry);
     }
 
     // If query supports index filters, filter params.indices by indices in query settings.
@@ -935,6 +975,12 @@ protected:
             return nullptr;
         }
 
+        // The batched {_id: {$in: [...]}} form is answered by the classic IDHackStage; here we
+        // only build a plan for a single point lookup, so fall back to normal planning.
+        if (!CanonicalQuery::isSimpleIdQuery(_cq->getFindCommandRequest().getFilter())) {
+            return nullptr;
+        }
+
         invariant(descriptor->getEntry());
         std::unique_ptr<QuerySolutionNode> root = [&]() {
             auto ixScan = std::make_unique<IndexScanNode>(
@@ -1230,6 +1276,7 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorFind
     std::unique_ptr<CanonicalQuery> canonicalQuery,
     bool permitYield,
     size_t plannerOptions) {
+    OperationTrace::Span span(opCtx, "getExecutorFind"_sd);
     auto yieldPolicy = (permitYield && !opCtx->inMultiDocumentTransaction())
         ? PlanYieldPolicy::YieldPolicy::YIELD_AUTO
         : PlanYieldPolicy::YieldPolicy::INTERRUPT_ONLY;
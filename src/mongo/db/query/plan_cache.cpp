@@ -431,12 +431,37 @@ std::string SolutionCacheData::toString() const {
 // PlanCache
 //
 
+namespace {
+
+// Number of independently locked cache partitions. Keys are spread across partitions by hash, so
+// lookups of different query shapes only contend when they collide. Power of two, sized so that
+// the partition count comfortably exceeds the number of threads that typically hammer one
+// collection's cache during a spike.
+const size_t kNumPartitions = 8;
+
+// Partitioning splits the entry budget evenly, so caches too small to give each partition a
+// meaningful share keep a single partition and retain exact whole-cache LRU behavior.
+const size_t kMinEntriesPerPartition = 64;
+
+}  // namespace
+
 PlanCache::PlanCache() : PlanCache(internalQueryCacheMaxEntriesPerCollection.load()) {}
 
-PlanCache::PlanCache(size_t size) : _cache(size) {}
+PlanCache::PlanCache(size_t size) {
+    const size_t numPartitions =
+        size >= kNumPartitions * kMinEntriesPerPartition ? kNumPartitions : 1;
+    const size_t sizePerPartition = std::max(size_t(1), size / numPartitions);
+    for (size_t i = 0; i < numPartitions; ++i) {
+        _partitions.push_back(std::make_unique<Partition>(sizePerPartition));
+    }
+}
 
 PlanCache::~PlanCache() {}
 
+PlanCache::Partition& PlanCache::_partition(const PlanCacheKey& key) const {
+    return *_partitions[PlanCacheKeyHasher{}(key) % _partitions.size()];
+}
+
 std::unique_ptr<CachedSolution> PlanCache::getCacheEntryIfActive(const PlanCacheKey& key) const {
     PlanCache::GetResult res = get(key);
     if (res.state == PlanCache::CacheEntryState::kPresentInactive) {
@@ -586,7 +611,8 @@ Status PlanCache::set(const CanonicalQuery& query,
                                              }},
                     why->stats);
     const auto key = computeKey(query);
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
     bool isNewEntryActive = false;
     uint32_t queryHash;
     uint32_t planCacheKey;
@@ -597,7 +623,7 @@ Status PlanCache::set(const CanonicalQuery& query,
         queryHash = canonical_query_encoder::computeHash(key.getStableKeyStringData());
     } else {
         PlanCacheEntry* oldEntry = nullptr;
-        Status cacheStatus = _cache.get(key, &oldEntry);
+        Status cacheStatus = partition.cache.get(key, &oldEntry);
         invariant(cacheStatus.isOK() || cacheStatus == ErrorCodes::NoSuchKey);
         if (oldEntry) {
             queryHash = oldEntry->queryHash;
@@ -624,7 +650,7 @@ Status PlanCache::set(const CanonicalQuery& query,
     auto newEntry(PlanCacheEntry::create(
         solns, std::move(why), query, queryHash, planCacheKey, now, isNewEntryActive, newWorks));
 
-    std::unique_ptr<PlanCacheEntry> evictedEntry = _cache.add(key, newEntry.release());
+    std::unique_ptr<PlanCacheEntry> evictedEntry = partition.cache.add(key, newEntry.release());
 
     if (nullptr != evictedEntry.get()) {
         LOGV2_DEBUG(20942,
@@ -644,9 +670,10 @@ void PlanCache::deactivate(const CanonicalQuery& query) {
     }
 
     PlanCacheKey key = computeKey(query);
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
     PlanCacheEntry* entry = nullptr;
-    Status cacheStatus = _cache.get(key, &entry);
+    Status cacheStatus = partition.cache.get(key, &entry);
     if (!cacheStatus.isOK()) {
         invariant(cacheStatus == ErrorCodes::NoSuchKey);
         return;
@@ -661,9 +688,10 @@ PlanCache::GetResult PlanCache::get(const CanonicalQuery& query) const {
 }
 
 PlanCache::GetResult PlanCache::get(const PlanCacheKey& key) const {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
     PlanCacheEntry* entry = nullptr;
-    Status cacheStatus = _cache.get(key, &entry);
+    Status cacheStatus = partition.cache.get(key, &entry);
     if (!cacheStatus.isOK()) {
         invariant(cacheStatus == ErrorCodes::NoSuchKey);
         return {CacheEntryState::kNotPresent, nullptr};
@@ -676,13 +704,17 @@ PlanCache::GetResult PlanCache::get(const PlanCacheKey& key) const {
 }
 
 Status PlanCache::remove(const CanonicalQuery& canonicalQuery) {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-    return _cache.remove(computeKey(canonicalQuery));
+    const auto key = computeKey(canonicalQuery);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
+    return partition.cache.remove(key);
 }
 
 void PlanCache::clear() {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-    _cache.clear();
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> cacheLock(partition->mutex);
+        partition->cache.clear();
+    }
 }
 
 PlanCacheKey PlanCache::computeKey(const CanonicalQuery& cq) const {
@@ -698,9 +730,10 @@ PlanCacheKey PlanCache::computeKey(const CanonicalQuery& cq) const {
 StatusWith<std::unique_ptr<PlanCacheEntry>> PlanCache::getEntry(const CanonicalQuery& query) const {
     PlanCacheKey key = computeKey(query);
 
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
     PlanCacheEntry* entry;
-    Status cacheStatus = _cache.get(key, &entry);
+    Status cacheStatus = partition.cache.get(key, &entry);
     if (!cacheStatus.isOK()) {
         return cacheStatus;
     }
@@ -710,20 +743,29 @@ StatusWith<std::unique_ptr<PlanCacheEntry>> PlanCache::getEntry(const CanonicalQ
 }
 
 std::vector<std::unique_ptr<PlanCacheEntry>> PlanCache::getAllEntries() const {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
     std::vector<std::unique_ptr<PlanCacheEntry>> entries;
 
-    for (auto&& cacheEntry : _cache) {
-        auto entry = cacheEntry.second;
-        entries.push_back(std::unique_ptr<PlanCacheEntry>(entry->clone()));
+    // Partitions are visited one at a time, so entries added or evicted concurrently in an
+    // already-visited partition may be missed or duplicated. Callers of this reporting interface
+    // only need a point-in-time-ish view.
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> cacheLock(partition->mutex);
+        for (auto&& cacheEntry : partition->cache) {
+            auto entry = cacheEntry.second;
+            entries.push_back(std::unique_ptr<PlanCacheEntry>(entry->clone()));
+        }
     }
 
     return entries;
 }
 
 size_t PlanCache::size() const {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-    return _cache.size();
+    size_t size = 0;
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> cacheLock(partition->mutex);
+        size += partition->cache.size();
+    }
+    return size;
 }
 
 void PlanCache::notifyOfIndexUpdates(const std::vector<CoreIndexInfo>& indexCores) {
@@ -734,13 +776,15 @@ std::vector<BSONObj> PlanCache::getMatchingStats(
     const std::function<BSONObj(const PlanCacheEntry&)>& serializationFunc,
     const std::function<bool(const BSONObj&)>& filterFunc) const {
     std::vector<BSONObj> results;
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
 
-    for (auto&& cacheEntry : _cache) {
-        const auto entry = cacheEntry.second;
-        auto serializedEntry = serializationFunc(*entry);
-        if (filterFunc(serializedEntry)) {
-            results.push_back(serializedEntry);
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> cacheLock(partition->mutex);
+        for (auto&& cacheEntry : partition->cache) {
+            const auto entry = cacheEntry.second;
+            auto serializedEntry = serializationFunc(*entry);
+            if (filterFunc(serializedEntry)) {
+                results.push_back(serializedEntry);
+            }
         }
     }
 
@@ -30,7 +30,9 @@
 #pragma once
 
 #include <boost/optional/optional.hpp>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/query/canonical_query.h"
@@ -613,10 +615,29 @@ private:
                                    size_t newWorks,
                                    double growthCoefficient);
 
-    LRUKeyValue<PlanCacheKey, PlanCacheEntry, PlanCacheKeyHasher> _cache;
+    /**
+     * One independently locked slice of the cache. Entries are assigned to partitions by
+     * PlanCacheKey hash, so concurrent lookups of different query shapes contend only when they
+     * hash to the same partition. Each partition runs its own LRU over an equal share of the
+     * total entry budget. Even lookups must hold the partition lock, since LRUKeyValue::get()
+     * promotes the entry in the recency list.
+     */
+    struct Partition {
+        explicit Partition(size_t size) : cache(size) {}
+
+        LRUKeyValue<PlanCacheKey, PlanCacheEntry, PlanCacheKeyHasher> cache;
+
+        // Protects 'cache'. Held for hash map probes and recency-list splices only, so spinning
+        // beats parking on contention.
+        mutable Mutex mutex = MONGO_MAKE_LATCH("PlanCache::Partition::mutex",
+                                               latch_detail::SpinPolicy::kAdaptiveSpin);
+    };
+
+    Partition& _partition(const PlanCacheKey& key) const;
 
-    // Protects _cache.
-    mutable Mutex _cacheMutex = MONGO_MAKE_LATCH("PlanCache::_cacheMutex");
+    // Fixed at construction. Single-element for small caches, where splitting the entry budget
+    // would distort LRU behavior.
+    std::vector<std::unique_ptr<Partition>> _partitions;
 
     // Holds computed information about the collection's indexes.  Used for generating plan
     // cache keys.
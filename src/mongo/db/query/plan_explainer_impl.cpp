@@ -546,6 +546,10 @@ PlanSummaryStats collectExecutionStatsSummary(const PlanStageStats* stats,
             getKeysExamined(statsNodes[i]->stageType, statsNodes[i]->specific.get());
         summary.totalDocsExamined +=
             getDocsExamined(statsNodes[i]->stageType, statsNodes[i]->specific.get());
+        if (statsNodes[i]->common.executionTimeNanos > 0) {
+            summary.executionTimeByStageNanos[statsNodes[i]->common.stageTypeStr] +=
+                statsNodes[i]->common.executionTimeNanos;
+        }
     }
 
     summary.planFailed = stats->common.failed;
@@ -675,6 +679,12 @@ void PlanExplainerImpl::getSummaryStats(PlanSummaryStats* statsOut) const {
         statsOut->totalDocsExamined +=
             getDocsExamined(stages[i]->stageType(), stages[i]->getSpecificStats());
 
+        const CommonStats* commonStats = stages[i]->getCommonStats();
+        if (commonStats->executionTimeNanos > 0) {
+            statsOut->executionTimeByStageNanos[commonStats->stageTypeStr] +=
+                commonStats->executionTimeNanos;
+        }
+
         if (isSortStageType(stages[i]->stageType())) {
             statsOut->hasSortStage = true;
 
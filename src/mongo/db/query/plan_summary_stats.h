@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <map>
 #include <optional>
 #include <string>
 
@@ -61,6 +62,9 @@ struct PlanSummaryStats {
         usedDisk |= statsIn.usedDisk;
         planFailed |= statsIn.planFailed;
         indexesUsed.insert(statsIn.indexesUsed.begin(), statsIn.indexesUsed.end());
+        for (auto&& entry : statsIn.executionTimeByStageNanos) {
+            executionTimeByStageNanos[entry.first] += entry.second;
+        }
     }
 
     uint64_t estimateObjectSizeInBytes() const {
@@ -68,10 +72,15 @@ struct PlanSummaryStats {
             return str.capacity() * sizeof(std::string::value_type);
         };
 
+        uint64_t stageTimesSize = 0;
+        for (auto&& entry : executionTimeByStageNanos) {
+            stageTimesSize += sizeof(entry) + strSize(entry.first);
+        }
+
         return sizeof(*this) +
             container_size_helper::estimateObjectSizeInBytes(
                    indexesUsed, strSize, false /* includeShallowSize */) +
-            (replanReason ? strSize(*replanReason) : 0);
+            stageTimesSize + (replanReason ? strSize(*replanReason) : 0);
     }
 
     // The number of results returned by the plan.
@@ -94,6 +103,12 @@ struct PlanSummaryStats {
     // Time elapsed while executing this plan.
     long long executionTimeMillisEstimate = 0;
 
+    // Time spent working inside each stage type of the plan, measured with the tick source.
+    // Always collected, unlike 'executionTimeMillisEstimate' which requires explain or the
+    // profiler, so the slow query log and the profiler can attribute a query's time to stage
+    // types without rerunning it. Keyed by the stage type string (e.g. "COLLSCAN").
+    std::map<std::string, long long> executionTimeByStageNanos;
+
     // Did this plan use an in-memory sort stage?
     bool hasSortStage = false;
 
@@ -0,0 +1,186 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * End-to-end query execution benchmarks. Each benchmark stands up an ephemeral storage engine,
+ * seeds a canned dataset and then drives complete find/aggregate commands through the service
+ * entry point via DBDirectClient, so that parsing, planning, execution and response building are
+ * all on the measured path. Where the queried shape is SBE-eligible the benchmark is parameterized
+ * over the execution engine: Arg(0) runs the classic engine, Arg(1) enables
+ * 'internalQueryEnableSlotBasedExecutionEngine'.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+#include <boost/filesystem/operations.hpp>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/catalog_test_fixture.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/idl/server_parameter_test_util.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss("query_exec_bm.coll");
+
+constexpr size_t kNumDocs = 10'000;
+
+// Cardinality of the low-cardinality 'group' field, giving $group a realistic number of output
+// groups rather than one group per input document.
+constexpr size_t kNumGroups = 100;
+
+/**
+ * Stands up an ephemeral mongod-like environment (storage engine, catalog, mock replication
+ * coordinator) for the duration of one benchmark run and seeds it with 'numDocs' canned documents.
+ * Reuses CatalogTestFixture, whose setUp()/tearDown() are invoked explicitly here because
+ * benchmarks do not run under the unit test framework's Test::run() driver.
+ */
+class QueryExecBenchmarkFixture : public CatalogTestFixture {
+public:
+    explicit QueryExecBenchmarkFixture(size_t numDocs) {
+        setUp();
+
+        // Blocking sorts spill under the dbpath's '_tmp' directory, which a real mongod creates
+        // during startup.
+        boost::filesystem::create_directories(storageGlobalParams.dbpath + "/_tmp");
+
+        DBDirectClient client(operationContext());
+        for (size_t i = 0; i < numDocs; ++i) {
+            // 'a' covers [0, numDocs) in a scrambled order so that range scans and sorts do not
+            // see presorted input; 'payload' pads documents to a more realistic size.
+            client.insert(kNss.ns(),
+                          BSON("_id" << static_cast<int>(i) << "a"
+                                     << static_cast<int>((i * 2654435761u) % numDocs) << "group"
+                                     << static_cast<int>(i % kNumGroups) << "payload"
+                                     << "pppppppppppppppppppppppppppppppppppppppppppppppppppppppp"
+                                        "pppppppppppppppppppppppppppppppppppppppppppppppppppppppp"
+                                        "pppppppppppppppp"));
+        }
+    }
+
+    ~QueryExecBenchmarkFixture() {
+        tearDown();
+    }
+};
+
+/**
+ * Runs 'cmd' against the benchmark database and returns the reply, asserting that it succeeded.
+ * The benchmark commands request everything in a single batch, so no getMore round trips are
+ * needed to drain the results.
+ */
+BSONObj runCommand(DBDirectClient* client, const BSONObj& cmd) {
+    BSONObj reply;
+    bool ok = client->runCommand(kNss.db().toString(), cmd, reply);
+    invariant(ok, reply.toString());
+    return reply;
+}
+
+void BM_PointRead(benchmark::State& state) {
+    RAIIServerParameterControllerForTest sbe{"internalQueryEnableSlotBasedExecutionEngine",
+                                             state.range(0) == 1};
+    QueryExecBenchmarkFixture fixture(kNumDocs);
+    DBDirectClient client(fixture.operationContext());
+
+    size_t key = 0;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(
+            client.findOne(kNss.ns(), BSON("_id" << static_cast<int>(key++ % kNumDocs))));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_RangeScanWithFilter(benchmark::State& state) {
+    RAIIServerParameterControllerForTest sbe{"internalQueryEnableSlotBasedExecutionEngine",
+                                             state.range(0) == 1};
+    QueryExecBenchmarkFixture fixture(kNumDocs);
+    DBDirectClient client(fixture.operationContext());
+
+    // No index on 'a', so this is a full collection scan with a residual predicate selecting
+    // roughly 10% of the collection.
+    const auto filter = BSON("a" << BSON("$gte" << 0 << "$lt" << static_cast<int>(kNumDocs / 10)));
+    for (auto keepRunning : state) {
+        auto cursor = client.query(kNss, Query(filter));
+        while (cursor->more()) {
+            benchmark::DoNotOptimize(cursor->next());
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kNumDocs);
+}
+
+void BM_SortWithSpill(benchmark::State& state) {
+    RAIIServerParameterControllerForTest sbe{"internalQueryEnableSlotBasedExecutionEngine",
+                                             state.range(0) == 1};
+    // Cap the blocking sort memory budget well below the dataset size so the sorter must spill to
+    // disk, exercising the external sort path end to end.
+    RAIIServerParameterControllerForTest sortMemory{
+        "internalQueryMaxBlockingSortMemoryUsageBytes", 64 * 1024};
+    QueryExecBenchmarkFixture fixture(kNumDocs);
+    DBDirectClient client(fixture.operationContext());
+
+    const auto cmd = BSON("find" << kNss.coll() << "sort" << BSON("a" << 1) << "allowDiskUse"
+                                 << true << "singleBatch" << true << "batchSize"
+                                 << static_cast<int>(kNumDocs));
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(runCommand(&client, cmd));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kNumDocs);
+}
+
+void BM_GroupAggregation(benchmark::State& state) {
+    QueryExecBenchmarkFixture fixture(kNumDocs);
+    DBDirectClient client(fixture.operationContext());
+
+    const auto cmd =
+        BSON("aggregate" << kNss.coll() << "pipeline"
+                         << BSON_ARRAY(BSON("$group" << BSON("_id"
+                                                             << "$group"
+                                                             << "count" << BSON("$sum" << 1)
+                                                             << "total" << BSON("$sum"
+                                                                                << "$a"))))
+                         << "cursor" << BSON("batchSize" << static_cast<int>(kNumGroups)));
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(runCommand(&client, cmd));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kNumDocs);
+}
+
+BENCHMARK(BM_PointRead)->Arg(0)->Arg(1);
+BENCHMARK(BM_RangeScanWithFilter)->Arg(0)->Arg(1);
+BENCHMARK(BM_SortWithSpill)->Arg(0)->Arg(1);
+BENCHMARK(BM_GroupAggregation);
+
+}  // namespace
+}  // namespace mongo
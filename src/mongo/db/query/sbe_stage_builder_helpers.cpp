@@ -451,6 +451,7 @@ EvalStage makeHashAgg(EvalStage stage,
                                                 sbe::makeSV(),
                                                 true /* optimized close */,
                                                 collatorSlot,
+                                                false /* allowDiskUse */,
                                                 planNodeId);
     return stage;
 }
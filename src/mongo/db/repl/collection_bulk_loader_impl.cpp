@@ -31,6 +31,8 @@
 
 #include "mongo/platform/basic.h"
 
+#include <iterator>
+
 #include "mongo/base/status.h"
 #include "mongo/base/status_with.h"
 #include "mongo/bson/bsonobj.h"
@@ -125,8 +127,9 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
     const std::vector<BSONObj>::const_iterator begin,
     const std::vector<BSONObj>::const_iterator end) {
     auto iter = begin;
+    std::vector<RecordId> locs;
+    locs.reserve(std::distance(begin, end));
     while (iter != end) {
-        std::vector<RecordId> locs;
         Status status = writeConflictRetry(
             _opCtx.get(), "CollectionBulkLoaderImpl/insertDocumentsUncapped", _nss.ns(), [&] {
                 WriteUnitOfWork wunit(_opCtx.get());
@@ -164,8 +167,12 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
         // record store which can throw a write conflict exception.
         status = writeConflictRetry(_opCtx.get(), "_addDocumentToIndexBlocks", _nss.ns(), [&] {
             WriteUnitOfWork wunit(_opCtx.get());
+            // Take a fresh copy of the batch iterator on each attempt so a write conflict retry
+            // regenerates keys for the same documents rather than running off the end of the
+            // batch.
+            auto indexIter = iter;
             for (size_t index = 0; index < locs.size(); ++index) {
-                status = _addDocumentToIndexBlocks(*iter++, locs.at(index));
+                status = _addDocumentToIndexBlocks(*indexIter++, locs[index]);
                 if (!status.isOK()) {
                     return status;
                 }
@@ -177,6 +184,7 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
         if (!status.isOK()) {
             return status;
         }
+        std::advance(iter, locs.size());
     }
     return Status::OK();
 }
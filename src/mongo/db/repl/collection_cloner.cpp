@@ -445,9 +445,9 @@ void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
 void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd) {
     uassertStatusOK(cbd.status);
 
+    std::vector<BSONObj> docs;
     {
         stdx::lock_guard<Latch> lk(_mutex);
-        std::vector<BSONObj> docs;
         // Increment 'fetchedBatches' even if no documents were inserted to match the number of
         // 'receivedBatches'.
         ++_stats.fetchedBatches;
@@ -462,10 +462,15 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
         _stats.documentsCopied += docs.size();
         _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
         _progressMeter.hit(int(docs.size()));
-        invariant(_collLoader);
+    }
 
-        // The insert must be done within the lock, because CollectionBulkLoader is not
-        // thread safe.
+    {
+        // The insert happens outside '_mutex' so that handleNextBatch() can stash the next
+        // network batch while this one is being written; otherwise the exhaust stream stalls
+        // behind every storage insert. '_loaderMutex' still serializes access to the
+        // non-thread-safe CollectionBulkLoader.
+        stdx::lock_guard<Latch> lk(_loaderMutex);
+        invariant(_collLoader);
         uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend()));
     }
 
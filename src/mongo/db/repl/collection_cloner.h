@@ -255,8 +255,11 @@ private:
     ProgressMeter _progressMeter;                       // (X) progress meter for this instance.
     std::vector<BSONObj> _readyIndexSpecs;              // (X) Except for _id_
     std::vector<BSONObj> _unfinishedIndexSpecs;         // (X)
-    BSONObj _idIndexSpec;                               // (X)
-    std::unique_ptr<CollectionBulkLoader> _collLoader;  // (X)
+    BSONObj _idIndexSpec;  // (X)
+    // Serializes inserts into '_collLoader' from database work callbacks, without making them
+    // contend with '_mutex' holders such as the network thread stashing the next batch.
+    Mutex _loaderMutex = MONGO_MAKE_LATCH("CollectionCloner::_loaderMutex");  // (S)
+    std::unique_ptr<CollectionBulkLoader> _collLoader;                        // (X)
     //  Function for scheduling database work using the executor.
     ScheduleDbWorkFn _scheduleDbWorkFn;  // (R)
     // Documents read from source to insert.
@@ -85,6 +85,11 @@ class StorageInterface;
  * This class will use existing machinery like the Executor to schedule work and
  * network tasks, as well as provide serial access and synchronization of state.
  *
+ * This is a logical sync: every document is re-inserted and every index rebuilt on the
+ * syncing node. A physical (file-copy) sync would stream storage engine backup cursors
+ * from the sync source instead, but the backup cursor implementation behind
+ * BackupCursorHooks and the file streaming stages are not part of this codebase, so no
+ * such mode is provided here.
  *
  * Entry Points:
  *      -- startup: Start initial sync.
@@ -120,7 +120,7 @@ void _addOplogChainOpsToWriterVectors(OperationContext* opCtx,
     bool shouldSerialize = false;
     std::tie(txnOps, shouldSerialize) =
         readTransactionOperationsFromOplogChainAndCheckForCommands(opCtx, *op, *partialTxnList);
-    derivedOps->emplace_back(txnOps);
+    derivedOps->emplace_back(std::move(txnOps));
     partialTxnList->clear();
 
     // Transaction entries cannot have different session updates.
@@ -600,30 +600,6 @@ const boost::optional<std::int64_t> OplogEntry::getTxnNumber() const {
     return _entry.getTxnNumber();
 }
 
-const DurableReplOperation& OplogEntry::getDurableReplOperation() const {
-    return _entry.getDurableReplOperation();
-}
-
-mongo::repl::OpTypeEnum OplogEntry::getOpType() const {
-    return _entry.getOpType();
-}
-
-const mongo::NamespaceString& OplogEntry::getNss() const {
-    return _entry.getNss();
-}
-
-const boost::optional<mongo::UUID>& OplogEntry::getUuid() const {
-    return _entry.getUuid();
-}
-
-const mongo::BSONObj& OplogEntry::getObject() const {
-    return _entry.getObject();
-}
-
-const boost::optional<mongo::BSONObj>& OplogEntry::getObject2() const {
-    return _entry.getObject2();
-}
-
 const boost::optional<bool> OplogEntry::getUpsert() const {
     return _entry.getUpsert();
 }
@@ -636,10 +612,6 @@ const boost::optional<mongo::ShardId>& OplogEntry::getDestinedRecipient() const
     return _entry.getDestinedRecipient();
 }
 
-const mongo::Timestamp& OplogEntry::getTimestamp() const {
-    return _entry.getTimestamp();
-}
-
 const boost::optional<std::int64_t> OplogEntry::getTerm() const {
     return _entry.getTerm();
 }
@@ -652,10 +624,6 @@ const boost::optional<std::int64_t> OplogEntry::getHash() const& {
     return _entry.getHash();
 }
 
-std::int64_t OplogEntry::getVersion() const {
-    return _entry.getVersion();
-}
-
 const boost::optional<bool> OplogEntry::getFromMigrate() const& {
     return _entry.getFromMigrate();
 }
@@ -676,10 +644,6 @@ const boost::optional<RetryImageEnum> OplogEntry::getNeedsRetryImage() const {
     return _entry.getNeedsRetryImage();
 }
 
-OpTime OplogEntry::getOpTime() const {
-    return _entry.getOpTime();
-}
-
 bool OplogEntry::isCommand() const {
     return _entry.isCommand();
 }
@@ -526,26 +526,46 @@ public:
     const OperationSessionInfo& getOperationSessionInfo() const;
     const boost::optional<mongo::LogicalSessionId>& getSessionId() const;
     const boost::optional<std::int64_t> getTxnNumber() const;
-    const DurableReplOperation& getDurableReplOperation() const;
-    mongo::repl::OpTypeEnum getOpType() const;
-    const mongo::NamespaceString& getNss() const;
-    const boost::optional<mongo::UUID>& getUuid() const;
-    const mongo::BSONObj& getObject() const;
-    const boost::optional<mongo::BSONObj>& getObject2() const;
+    // These accessors are hit once or more per entry on the oplog application hot path, so they
+    // are defined inline rather than as out-of-line forwards like the accessors below.
+    const DurableReplOperation& getDurableReplOperation() const {
+        return _entry.getDurableReplOperation();
+    }
+    mongo::repl::OpTypeEnum getOpType() const {
+        return _entry.getOpType();
+    }
+    const mongo::NamespaceString& getNss() const {
+        return _entry.getNss();
+    }
+    const boost::optional<mongo::UUID>& getUuid() const {
+        return _entry.getUuid();
+    }
+    const mongo::BSONObj& getObject() const {
+        return _entry.getObject();
+    }
+    const boost::optional<mongo::BSONObj>& getObject2() const {
+        return _entry.getObject2();
+    }
     const boost::optional<bool> getUpsert() const;
     const boost::optional<mongo::repl::OpTime>& getPreImageOpTime() const;
     const boost::optional<mongo::ShardId>& getDestinedRecipient() const;
-    const mongo::Timestamp& getTimestamp() const;
+    const mongo::Timestamp& getTimestamp() const {
+        return _entry.getTimestamp();
+    }
     const boost::optional<std::int64_t> getTerm() const;
     const mongo::Date_t& getWallClockTime() const;
     const boost::optional<std::int64_t> getHash() const&;
-    std::int64_t getVersion() const;
+    std::int64_t getVersion() const {
+        return _entry.getVersion();
+    }
     const boost::optional<bool> getFromMigrate() const&;
     const boost::optional<mongo::UUID>& getFromTenantMigration() const&;
     const boost::optional<mongo::repl::OpTime>& getPrevWriteOpTimeInTransaction() const&;
     const boost::optional<mongo::repl::OpTime>& getPostImageOpTime() const&;
     const boost::optional<RetryImageEnum> getNeedsRetryImage() const;
-    OpTime getOpTime() const;
+    OpTime getOpTime() const {
+        return _entry.getOpTime();
+    }
     bool isCommand() const;
     bool isPartialTransaction() const;
     bool isEndOfLargeTransaction() const;
@@ -592,6 +592,7 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
             _cursor->more();
         }
 
+        batch.reserve(_cursor->objsLeftInBatch());
         while (_cursor->moreInCurrentBatch()) {
             batch.emplace_back(_cursor->nextSafe());
         }
@@ -755,18 +756,22 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     // Determine if we should stop syncing from our current sync source.
     auto changeSyncSourceAction = _dataReplicatorExternalState->shouldStopFetching(
         _config.source, replSetMetadata, oqMetadata, previousOpTimeFetched, lastDocOpTime);
-    str::stream errMsg;
-    errMsg << "sync source " << _config.source.toString();
-    errMsg << " (config version: " << replSetMetadata.getConfigVersion();
-    errMsg << "; last applied optime: " << oqMetadata.getLastOpApplied().toString();
-    errMsg << "; sync source index: " << oqMetadata.getSyncSourceIndex();
-    errMsg << "; has primary index: " << oqMetadata.hasPrimaryIndex();
-    errMsg << ") is no longer valid";
-    errMsg << " previous batch last fetched optime: " << previousOpTimeFetched.toString();
-    errMsg << " current batch last fetched optime: " << lastDocOpTime.toString();
+    // Only build the error message when we are actually stopping; this runs on every batch.
+    auto makeInvalidSyncSourceStatus = [&]() {
+        str::stream errMsg;
+        errMsg << "sync source " << _config.source.toString();
+        errMsg << " (config version: " << replSetMetadata.getConfigVersion();
+        errMsg << "; last applied optime: " << oqMetadata.getLastOpApplied().toString();
+        errMsg << "; sync source index: " << oqMetadata.getSyncSourceIndex();
+        errMsg << "; has primary index: " << oqMetadata.hasPrimaryIndex();
+        errMsg << ") is no longer valid";
+        errMsg << " previous batch last fetched optime: " << previousOpTimeFetched.toString();
+        errMsg << " current batch last fetched optime: " << lastDocOpTime.toString();
+        return Status(ErrorCodes::InvalidSyncSource, errMsg);
+    };
 
     if (changeSyncSourceAction == ChangeSyncSourceAction::kStopSyncingAndDropLastBatch) {
-        return Status(ErrorCodes::InvalidSyncSource, errMsg);
+        return makeInvalidSyncSourceStatus();
     }
 
     _dataReplicatorExternalState->processMetadata(replSetMetadata, oqMetadata);
@@ -794,7 +799,7 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     }
 
     if (changeSyncSourceAction == ChangeSyncSourceAction::kStopSyncingAndEnqueueLastBatch) {
-        return Status(ErrorCodes::InvalidSyncSource, errMsg);
+        return makeInvalidSyncSourceStatus();
     }
 
     if (MONGO_unlikely(hangOplogFetcherBeforeAdvancingLastFetched.shouldFail())) {
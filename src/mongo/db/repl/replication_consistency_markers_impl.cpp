@@ -498,6 +498,22 @@ ReplicationConsistencyMarkersImpl::refreshOplogTruncateAfterPointIfPrimary(
     }
     ON_BLOCK_EXIT([&] { opCtx->recoveryUnit()->setPrepareConflictBehavior(originalBehavior); });
 
+    // Fast path: if the all_durable timestamp has not moved since the last refresh, nothing new
+    // can have become durable and the cached result below is still correct. This runs on every
+    // journal flusher round, so on an idle primary it avoids acquiring the collection and oplog
+    // locks many times per second just to discover there is nothing to do. The mutex is not held
+    // across any lock acquisition here, so the lock ordering of the slow path is unaffected.
+    {
+        auto truncateTimestamp =
+            _storageInterface->getAllDurableTimestamp(opCtx->getServiceContext());
+        stdx::lock_guard<Latch> lk(_refreshOplogTruncateAfterPointMutex);
+        if (_lastNoHolesOplogTimestamp && truncateTimestamp == _lastNoHolesOplogTimestamp) {
+            invariant(_lastNoHolesOplogOpTimeAndWallTime);
+            // Return the last durable no-holes oplog entry. Nothing has changed in the system yet.
+            return _lastNoHolesOplogOpTimeAndWallTime;
+        }
+    }
+
     // The locks necessary to write to the oplog truncate after point's collection and read from the
     // oplog collection must be taken up front so that the mutex can also be taken around both
     // operations without causing deadlocks.
@@ -63,6 +63,7 @@
 #include "mongo/db/index_builds_coordinator.h"
 #include "mongo/db/kill_sessions_local.h"
 #include "mongo/db/mongod_options_storage_gen.h"
+#include "mongo/db/operation_trace.h"
 #include "mongo/db/prepare_conflict_tracker.h"
 #include "mongo/db/read_write_concern_defaults.h"
 #include "mongo/db/repl/always_allow_non_local_writes.h"
@@ -231,14 +232,18 @@ bool ReplicationCoordinatorImpl::WaiterList::remove_inlock(SharedWaiterHandle wa
 template <typename Func>
 void ReplicationCoordinatorImpl::WaiterList::setValueIf_inlock(Func&& func,
                                                                boost::optional<OpTime> opTime) {
-    for (auto it = _waiters.begin(); it != _waiters.end() && (!opTime || it->first <= *opTime);) {
+    // Visit waiters in descending opTime order. Predicates like write concern satisfaction are
+    // monotonic in opTime (a write concern satisfied at some opTime is satisfied at every earlier
+    // one), so this lets callers reuse the result of the most recent successful check instead of
+    // re-evaluating it for every waiter; see _wakeReadyWaiters().
+    for (auto it = opTime ? _waiters.upper_bound(*opTime) : _waiters.end();
+         it != _waiters.begin();) {
+        --it;
         const auto& waiter = it->second;
         try {
             if (func(it->first, waiter)) {
                 waiter->promise.emplaceValue();
                 it = _waiters.erase(it);
-            } else {
-                ++it;
             }
         } catch (const DBException& e) {
             waiter->promise.setError(e.toStatus());
@@ -316,6 +321,7 @@ ReplicationCoordinatorImpl::ReplicationCoordinatorImpl(
       _externalState(std::move(externalState)),
       _inShutdown(false),
       _memberState(MemberState::RS_STARTUP),
+      _memberStateShadow(MemberState::RS_STARTUP),
       _rsConfigState(kConfigPreStart),
       _selfIndex(-1),
       _sleptLastElection(false),
@@ -993,8 +999,10 @@ ReplicationCoordinator::Mode ReplicationCoordinatorImpl::getReplicationMode() co
 }
 
 MemberState ReplicationCoordinatorImpl::getMemberState() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    return _getMemberState_inlock();
+    // Reading the shadow is equivalent to taking _mutex and releasing it before returning: the
+    // state can change the moment either is dropped, so callers get the same guarantees without
+    // contending on the mutex.
+    return _memberStateShadow.load();
 }
 
 std::vector<MemberData> ReplicationCoordinatorImpl::getMemberData() const {
@@ -1898,6 +1906,8 @@ ReplicationCoordinator::StatusAndDuration ReplicationCoordinatorImpl::awaitRepli
     // deadlocks.
     invariant(OperationContextSession::get(opCtx) == nullptr);
 
+    OperationTrace::Span span(opCtx, "awaitReplication"_sd);
+
     Timer timer;
     WriteConcernOptions fixedWriteConcern = populateUnsetWriteConcernOptionsSyncMode(writeConcern);
 
@@ -2874,8 +2884,9 @@ bool ReplicationCoordinatorImpl::canAcceptWritesFor_UNSAFE(OperationContext* opC
         }
     }
 
-    stdx::lock_guard<Latch> lock(_mutex);
-    if (_memberState.rollback()) {
+    // ROLLBACK is entered and exited while holding the RSTL in mode X, and callers of the safe
+    // variant hold the RSTL, so the lock-free shadow cannot race with the transition here.
+    if (_memberStateShadow.load().rollback()) {
         return false;
     }
     return true;
@@ -2902,9 +2913,9 @@ Status ReplicationCoordinatorImpl::checkCanServeReadsFor_UNSAFE(OperationContext
     // Oplog reads are not allowed during STARTUP state, but we make an exception for internal
     // reads. Internal reads are required for cleaning up unfinished apply batches.
     if (!isPrimaryOrSecondary && getReplicationMode() == modeReplSet && ns.isOplog()) {
-        stdx::lock_guard<Latch> lock(_mutex);
-        if ((_memberState.startup() && client->isFromUserConnection()) || _memberState.startup2() ||
-            _memberState.rollback()) {
+        const auto memberState = _memberStateShadow.load();
+        if ((memberState.startup() && client->isFromUserConnection()) || memberState.startup2() ||
+            memberState.rollback()) {
             return Status{ErrorCodes::NotPrimaryOrSecondary,
                           "Oplog collection reads are not allowed while in the rollback or "
                           "startup state."};
@@ -4304,6 +4315,7 @@ ReplicationCoordinatorImpl::_updateMemberStateFromTopologyCoordinator(WithLock l
           "newState"_attr = newState,
           "oldState"_attr = _memberState);
     _memberState = newState;
+    _memberStateShadow.store(newState);
 
     _cancelAndRescheduleElectionTimeout_inlock();
 
@@ -4771,10 +4783,27 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig(WithLock lk,
 }
 
 void ReplicationCoordinatorImpl::_wakeReadyWaiters(WithLock lk, boost::optional<OpTime> opTime) {
+    // Waiters commonly share the same write concern (e.g. thousands of threads waiting on
+    // w:majority), and setValueIf_inlock visits them in descending opTime order. Once a write
+    // concern is satisfied at some opTime it is satisfied at every remaining (earlier) opTime, so
+    // remember the last satisfied write concern and skip re-scanning the topology for waiters
+    // with an equivalent one.
+    boost::optional<WriteConcernOptions> satisfiedWriteConcern;
     _replicationWaiterList.setValueIf_inlock(
-        [this](const OpTime& opTime, const SharedWaiterHandle& waiter) {
+        [&](const OpTime& opTime, const SharedWaiterHandle& waiter) {
             invariant(waiter->writeConcern);
-            return _doneWaitingForReplication_inlock(opTime, waiter->writeConcern.get());
+            const auto& wc = waiter->writeConcern.get();
+            if (satisfiedWriteConcern && satisfiedWriteConcern->wMode == wc.wMode &&
+                satisfiedWriteConcern->wNumNodes == wc.wNumNodes &&
+                satisfiedWriteConcern->syncMode == wc.syncMode &&
+                satisfiedWriteConcern->checkCondition == wc.checkCondition) {
+                return true;
+            }
+            if (_doneWaitingForReplication_inlock(opTime, wc)) {
+                satisfiedWriteConcern = wc;
+                return true;
+            }
+            return false;
         },
         opTime);
 }
@@ -1599,6 +1599,11 @@ private:
     // Current ReplicaSet state.
     MemberState _memberState;  // (M)
 
+    // Lock-free shadow of _memberState for readers that do not need to observe the state
+    // transition atomically with other guarded members, like _termShadow below. Updated
+    // whenever _memberState changes.
+    AtomicWord<MemberState> _memberStateShadow;  // (S)
+
     // Used to signal threads waiting for changes to _memberState.
     stdx::condition_variable _drainFinishedCond;  // (M)
 
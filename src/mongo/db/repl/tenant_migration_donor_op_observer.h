@@ -45,6 +45,11 @@ public:
     TenantMigrationDonorOpObserver() = default;
     ~TenantMigrationDonorOpObserver() = default;
 
+    // Only reacts to writes to config.tenantMigrationDonors.
+    NamespaceFilter getNamespaceFilter() const final {
+        return NamespaceFilter::kConfig;
+    }
+
     void onCreateIndex(OperationContext* opCtx,
                        const NamespaceString& nss,
                        CollectionUUID uuid,
@@ -46,6 +46,11 @@ public:
     TenantMigrationRecipientOpObserver() = default;
     ~TenantMigrationRecipientOpObserver() = default;
 
+    // Only reacts to writes to config.tenantMigrationRecipients.
+    NamespaceFilter getNamespaceFilter() const final {
+        return NamespaceFilter::kConfig;
+    }
+
     void onCreateIndex(OperationContext* opCtx,
                        const NamespaceString& nss,
                        CollectionUUID uuid,
@@ -373,6 +373,14 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicyImpl::selectChunksToMo
     std::shuffle(collections.begin(), collections.end(), _random);
 
     for (const auto& coll : collections) {
+        // Each migration occupies its source and destination shard for the rest of the round, so
+        // once fewer than two shards remain unused no further candidate can be scheduled and
+        // examining the remaining collections (each of which costs a routing table lookup and a
+        // full distribution computation) is wasted work.
+        if (usedShards.size() + 2 > shardStats.size()) {
+            break;
+        }
+
         const NamespaceString& nss(coll.getNss());
 
         if (!coll.getAllowBalance() || !coll.getAllowMigrations() || coll.getTimeseriesFields()) {
@@ -46,6 +46,11 @@ public:
     ConfigServerOpObserver();
     ~ConfigServerOpObserver();
 
+    // Only reacts to writes to config.shards and config.version.
+    NamespaceFilter getNamespaceFilter() const final {
+        return NamespaceFilter::kConfig;
+    }
+
     void onCreateIndex(OperationContext* opCtx,
                        const NamespaceString& nss,
                        CollectionUUID uuid,
@@ -33,6 +33,8 @@
 
 #include "mongo/db/s/migration_chunk_cloner_source_legacy.h"
 
+#include <iterator>
+
 #include "mongo/base/status.h"
 #include "mongo/client/read_preference.h"
 #include "mongo/db/catalog/index_catalog.h"
@@ -655,35 +657,58 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneLocs(OperationCon
                            internalQueryExecYieldIterations.load(),
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
+    // Number of record ids to copy out of '_cloneLocs' per mutex acquisition. Nothing else erases
+    // from the set while the clone phase is in progress, so the snapshotted ids stay valid while
+    // the mutex is released; taking them in runs avoids cycling the mutex around every single
+    // document fetch.
+    constexpr size_t kCloneLocsRunLength = 1000;
+
+    std::vector<RecordId> runOfIds;
+    runOfIds.reserve(kCloneLocsRunLength);
+
     stdx::unique_lock<Latch> lk(_mutex);
     auto iter = _cloneLocs.begin();
 
-    for (; iter != _cloneLocs.end(); ++iter) {
-        // We must always make progress in this method by at least one document because empty
-        // return indicates there is no more initial clone data.
-        if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
-            break;
+    bool reachedBatchLimit = false;
+    while (!reachedBatchLimit && iter != _cloneLocs.end()) {
+        runOfIds.clear();
+        for (auto runIter = iter;
+             runIter != _cloneLocs.end() && runOfIds.size() < kCloneLocsRunLength;
+             ++runIter) {
+            runOfIds.push_back(*runIter);
         }
 
-        auto nextRecordId = *iter;
-
         lk.unlock();
 
-        Snapshotted<BSONObj> doc;
-        if (collection->findDoc(opCtx, nextRecordId, &doc)) {
-            // Use the builder size instead of accumulating the document sizes directly so
-            // that we take into consideration the overhead of BSONArray indices.
-            if (arrBuilder->arrSize() &&
-                (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
-
+        size_t processedInRun = 0;
+        for (const auto& nextRecordId : runOfIds) {
+            // We must always make progress in this method by at least one document because empty
+            // return indicates there is no more initial clone data.
+            if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
+                reachedBatchLimit = true;
                 break;
             }
 
-            arrBuilder->append(doc.value());
-            ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
+            Snapshotted<BSONObj> doc;
+            if (collection->findDoc(opCtx, nextRecordId, &doc)) {
+                // Use the builder size instead of accumulating the document sizes directly so
+                // that we take into consideration the overhead of BSONArray indices.
+                if (arrBuilder->arrSize() &&
+                    (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
+
+                    reachedBatchLimit = true;
+                    break;
+                }
+
+                arrBuilder->append(doc.value());
+                ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
+            }
+
+            ++processedInRun;
         }
 
         lk.lock();
+        std::advance(iter, processedInRun);
     }
 
     _cloneLocs.erase(_cloneLocs.begin(), iter);
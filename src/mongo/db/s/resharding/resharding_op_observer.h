@@ -61,6 +61,11 @@ public:
     ReshardingOpObserver();
     ~ReshardingOpObserver() override;
 
+    // Only reacts to writes to the resharding state document collections in the config database.
+    NamespaceFilter getNamespaceFilter() const final {
+        return NamespaceFilter::kConfig;
+    }
+
     void onCreateIndex(OperationContext* opCtx,
                        const NamespaceString& nss,
                        CollectionUUID uuid,
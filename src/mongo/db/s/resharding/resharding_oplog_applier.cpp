@@ -38,6 +38,7 @@
 #include "mongo/db/s/resharding/resharding_donor_oplog_iterator.h"
 #include "mongo/db/s/resharding/resharding_future_util.h"
 #include "mongo/db/s/resharding/resharding_metrics.h"
+#include "mongo/db/s/resharding/resharding_server_parameters_gen.h"
 #include "mongo/db/s/resharding_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
@@ -129,18 +130,53 @@ SemiFuture<void> ReshardingOplogApplier::run(
     CancelableOperationContextFactory factory) {
     struct ChainContext {
         std::unique_ptr<ReshardingDonorOplogIteratorInterface> oplogIter;
+
+        // Cancels any in-flight prefetch of the next oplog batch once the apply loop has exited
+        // so the iterator can safely be disposed of.
+        boost::optional<CancellationSource> fetchCancelSource;
+
+        // A batch fetched concurrently with applying the previous one, consumed by the next loop
+        // iteration. The iterator is only ever used by one thread at a time because a new fetch is
+        // only started after this future has been waited on.
+        boost::optional<ExecutorFuture<OplogBatch>> prefetchedBatch;
     };
 
     auto chainCtx = std::make_shared<ChainContext>();
     chainCtx->oplogIter = std::move(_oplogIter);
+    chainCtx->fetchCancelSource.emplace(cancelToken);
 
     return AsyncTry([this, chainCtx, executor, cancelToken, factory] {
-               return chainCtx->oplogIter->getNextBatch(executor, cancelToken, factory)
+               auto batchFuture = [&] {
+                   if (chainCtx->prefetchedBatch) {
+                       auto fetched = std::move(*chainCtx->prefetchedBatch);
+                       chainCtx->prefetchedBatch = boost::none;
+                       return fetched;
+                   }
+                   return chainCtx->oplogIter->getNextBatch(
+                       executor, chainCtx->fetchCancelSource->token(), factory);
+               }();
+
+               return std::move(batchFuture)
                    .thenRunOn(executor)
-                   .then([this, executor, cancelToken, factory](OplogBatch batch) {
+                   .then([this, chainCtx, executor, cancelToken, factory](OplogBatch batch) {
                        LOGV2_DEBUG(5391002, 3, "Starting batch", "batchSize"_attr = batch.size());
                        _currentBatchToApply = std::move(batch);
 
+                       // Read the next batch from the oplog buffer collection on another thread
+                       // while this batch is being applied, so the applier never idles waiting on
+                       // reads. getNextBatch() fills the batch synchronously, so it must be
+                       // dispatched through the executor rather than called here directly.
+                       if (!_currentBatchToApply.empty() &&
+                           resharding::gReshardingOplogApplierPrefetchNextBatch.load()) {
+                           auto fetchCancelToken = chainCtx->fetchCancelSource->token();
+                           chainCtx->prefetchedBatch =
+                               ExecutorFuture(executor).then(
+                                   [chainCtx, executor, fetchCancelToken, factory] {
+                                       return chainCtx->oplogIter->getNextBatch(
+                                           executor, fetchCancelToken, factory);
+                                   });
+                       }
+
                        return _applyBatch(executor, cancelToken, factory);
                    })
                    .then([this, executor, cancelToken, factory] {
@@ -177,6 +213,14 @@ SemiFuture<void> ReshardingOplogApplier::run(
         // RecipientStateMachine, along with its ReshardingOplogApplier member, may have already
         // been destructed.
         .onCompletion([chainCtx](Status status) {
+            if (chainCtx->prefetchedBatch) {
+                // The apply loop exited with a prefetch still in flight. Cancel it and wait for it
+                // to settle before disposing of the iterator it is reading from.
+                chainCtx->fetchCancelSource->cancel();
+                std::move(*chainCtx->prefetchedBatch).getNoThrow().getStatus().ignore();
+                chainCtx->prefetchedBatch = boost::none;
+            }
+
             if (chainCtx->oplogIter) {
                 // Use a separate Client to make a better effort of calling dispose() even when the
                 // CancellationToken has been canceled.
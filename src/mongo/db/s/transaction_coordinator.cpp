@@ -268,7 +268,7 @@ TransactionCoordinator::TransactionCoordinator(OperationContext* operationContex
 
             return txn::persistDecision(*_scheduler, _lsid, _txnNumber, *_participants, *_decision);
         })
-        .then([this](repl::OpTime opTime) {
+        .then([this, apiParams](repl::OpTime opTime) {
             switch (_decision->getDecision()) {
                 case CommitDecision::kCommit: {
                     _decisionPromise.emplaceValue(CommitDecision::kCommit);
@@ -282,23 +282,50 @@ TransactionCoordinator::TransactionCoordinator(OperationContext* operationContex
                     MONGO_UNREACHABLE;
             };
 
-            return waitForMajorityWithHangFailpoint(_serviceContext,
-                                                    hangBeforeWaitingForDecisionWriteConcern,
-                                                    "hangBeforeWaitingForDecisionWriteConcern",
-                                                    std::move(opTime));
-        })
-        .then([this, apiParams] {
-            {
-                stdx::lock_guard<Latch> lg(_mutex);
-                _decisionDurable = true;
-            }
+            auto decisionWriteConcernFuture =
+                waitForMajorityWithHangFailpoint(_serviceContext,
+                                                 hangBeforeWaitingForDecisionWriteConcern,
+                                                 "hangBeforeWaitingForDecisionWriteConcern",
+                                                 std::move(opTime));
 
             // Send the commit/abort decision to the participants.
-            //  Input: _decisionDurable
-            //  Output: (none)
+            //  Input: _decision
+            //  Output: _decisionDurable = true
+            if (_decision->getDecision() == CommitDecision::kCommit) {
+                // A commit decision must not be externalized before it is majority committed
+                // locally. If the decision document rolled back after a participant had already
+                // committed, step-up recovery would re-run prepare and could reach an abort
+                // decision for a transaction which has committed effects.
+                return std::move(decisionWriteConcernFuture).then([this, apiParams] {
+                    {
+                        stdx::lock_guard<Latch> lg(_mutex);
+                        _decisionDurable = true;
+
+                        _step = Step::kWaitingForDecisionAcks;
+
+                        _transactionCoordinatorMetricsObserver->onStartWaitingForDecisionAcks(
+                            ServerTransactionCoordinatorsMetrics::get(_serviceContext),
+                            _serviceContext->getTickSource(),
+                            _serviceContext->getPreciseClockSource()->now());
+                    }
+
+                    return txn::sendCommit(_serviceContext,
+                                           *_scheduler,
+                                           _lsid,
+                                           _txnNumber,
+                                           apiParams,
+                                           *_participants,
+                                           *_decision->getCommitTimestamp());
+                });
+            }
+
+            // An abort decision is safe to send before it is majority committed: if the decision
+            // document rolls back, step-up recovery re-runs prepare and the already-aborted
+            // participants vote to abort again. Overlapping the write concern wait with the abort
+            // round releases the participants' prepared transactions (and the locks they hold)
+            // sooner.
             {
                 stdx::lock_guard<Latch> lg(_mutex);
-                invariant(_decisionDurable);
 
                 _step = Step::kWaitingForDecisionAcks;
 
@@ -308,23 +335,23 @@ TransactionCoordinator::TransactionCoordinator(OperationContext* operationContex
                     _serviceContext->getPreciseClockSource()->now());
             }
 
-            switch (_decision->getDecision()) {
-                case CommitDecision::kCommit: {
-                    return txn::sendCommit(_serviceContext,
-                                           *_scheduler,
-                                           _lsid,
-                                           _txnNumber,
-                                           apiParams,
-                                           *_participants,
-                                           *_decision->getCommitTimestamp());
-                }
-                case CommitDecision::kAbort: {
-                    return txn::sendAbort(
-                        _serviceContext, *_scheduler, _lsid, _txnNumber, apiParams, *_participants);
-                }
-                default:
-                    MONGO_UNREACHABLE;
-            };
+            auto sendAbortFuture = txn::sendAbort(
+                _serviceContext, *_scheduler, _lsid, _txnNumber, apiParams, *_participants);
+
+            // Join both futures unconditionally so that neither is abandoned with work still
+            // scheduled, surfacing the write concern error in preference to the abort one.
+            return std::move(decisionWriteConcernFuture)
+                .onCompletion([this, sendAbortFuture = std::move(sendAbortFuture)](
+                                  Status decisionWriteConcernStatus) mutable {
+                    return std::move(sendAbortFuture)
+                        .onCompletion([this, decisionWriteConcernStatus](Status sendAbortStatus) {
+                            uassertStatusOK(decisionWriteConcernStatus);
+                            uassertStatusOK(sendAbortStatus);
+
+                            stdx::lock_guard<Latch> lg(_mutex);
+                            _decisionDurable = true;
+                        });
+                });
         })
         .then([this] {
             // Do a best-effort attempt (i.e., writeConcern w:1) to delete the coordinator's durable
@@ -33,6 +33,7 @@
 
 #include "mongo/db/service_context.h"
 
+#include <cstddef>
 #include <list>
 #include <memory>
 
@@ -104,15 +105,17 @@ ServiceContext::ServiceContext()
 
 
 ServiceContext::~ServiceContext() {
-    stdx::lock_guard<Latch> lk(_mutex);
-    for (const auto& client : _clients) {
-        LOGV2_ERROR(23828,
-                    "{client} exists while destroying {serviceContext}",
-                    "Non-empty client list when destroying service context",
-                    "client"_attr = client->desc(),
-                    "serviceContext"_attr = reinterpret_cast<uint64_t>(this));
+    for (auto& shard : _clientShards) {
+        stdx::lock_guard<Latch> lk(shard.mutex);
+        for (const auto& client : shard.clients) {
+            LOGV2_ERROR(23828,
+                        "{client} exists while destroying {serviceContext}",
+                        "Non-empty client list when destroying service context",
+                        "client"_attr = client->desc(),
+                        "serviceContext"_attr = reinterpret_cast<uint64_t>(this));
+        }
+        invariant(shard.clients.empty());
     }
-    invariant(_clients.empty());
 }
 
 namespace {
@@ -172,12 +175,20 @@ ServiceContext::UniqueClient ServiceContext::makeClient(std::string desc,
     std::unique_ptr<Client> client(new Client(std::move(desc), this, std::move(session)));
     onCreate(client.get(), _clientObservers);
     {
-        stdx::lock_guard<Latch> lk(_mutex);
-        invariant(_clients.insert(client.get()).second);
+        auto& shard = _shardForClient(client.get());
+        stdx::lock_guard<Latch> lk(shard.mutex);
+        invariant(shard.clients.insert(client.get()).second);
     }
     return UniqueClient(client.release());
 }
 
+ServiceContext::ClientShard& ServiceContext::_shardForClient(Client* client) {
+    // Discard the low bits, which are constant across allocations due to alignment.
+    auto shardIndex =
+        (reinterpret_cast<uintptr_t>(client) / alignof(std::max_align_t)) % kNumClientShards;
+    return _clientShards[shardIndex];
+}
+
 void ServiceContext::setPeriodicRunner(std::unique_ptr<PeriodicRunner> runner) {
     invariant(!_runner);
     _runner = std::move(runner);
@@ -228,8 +239,9 @@ void ServiceContext::setTransportLayer(std::unique_ptr<transport::TransportLayer
 void ServiceContext::ClientDeleter::operator()(Client* client) const {
     ServiceContext* const service = client->getServiceContext();
     {
-        stdx::lock_guard<Latch> lk(service->_mutex);
-        invariant(service->_clients.erase(client));
+        auto& shard = service->_shardForClient(client);
+        stdx::lock_guard<Latch> lk(shard.mutex);
+        invariant(shard.clients.erase(client));
     }
     onDestroy(client, service->_clientObservers);
     delete client;
@@ -327,25 +339,46 @@ void ServiceContext::registerClientObserver(std::unique_ptr<ClientObserver> obse
 }
 
 ServiceContext::LockedClientsCursor::LockedClientsCursor(ServiceContext* service)
-    : _lock(service->_mutex), _curr(service->_clients.cbegin()), _end(service->_clients.cend()) {}
+    : _service(service) {
+    _lockShard(0);
+}
+
+void ServiceContext::LockedClientsCursor::_lockShard(size_t shardIndex) {
+    auto& shard = _service->_clientShards[shardIndex];
+    _shardIndex = shardIndex;
+    _lock = stdx::unique_lock<Latch>(shard.mutex);
+    _curr = shard.clients.cbegin();
+    _end = shard.clients.cend();
+}
 
 Client* ServiceContext::LockedClientsCursor::next() {
-    if (_curr == _end)
-        return nullptr;
-    Client* result = *_curr;
-    ++_curr;
-    return result;
+    while (!_done) {
+        if (_curr != _end) {
+            Client* result = *_curr;
+            ++_curr;
+            return result;
+        }
+        if (_shardIndex + 1 == kNumClientShards) {
+            _lock.unlock();
+            _done = true;
+            break;
+        }
+        // Release the exhausted shard before locking the next one, so at most one shard is ever
+        // held and previously returned Client pointers stay valid until this call.
+        _lock.unlock();
+        _lockShard(_shardIndex + 1);
+    }
+    return nullptr;
 }
 
 void ServiceContext::setKillAllOperations(const std::set<std::string>& excludedClients) {
-    stdx::lock_guard<Latch> clientLock(_mutex);
-
-    // Ensure that all newly created operation contexts will immediately be in the interrupted state
+    // Ensure that all newly created operation contexts will immediately be in the interrupted
+    // state, including ones on clients this enumeration does not observe.
     _globalKill.store(true);
     auto opsKilled = 0;
 
     // Interrupt all active operations
-    for (auto&& client : _clients) {
+    for (LockedClientsCursor cursor(this); Client* client = cursor.next();) {
         stdx::lock_guard<Client> lk(*client);
 
         // Do not kill operations from the excluded clients.
@@ -364,6 +397,7 @@ void ServiceContext::setKillAllOperations(const std::set<std::string>& excludedC
     LOGV2(4695300, "Interrupted all currently running operations", "opsKilled"_attr = opsKilled);
 
     // Notify any listeners who need to reach to the server shutting down
+    stdx::lock_guard<Latch> lk(_mutex);
     for (const auto listener : _killOpListeners) {
         try {
             listener->interruptAll();
@@ -195,13 +195,16 @@ public:
     /**
      * Cursor for enumerating the live Client objects belonging to a ServiceContext.
      *
-     * Lifetimes of this type are synchronized with client creation and destruction.
+     * The client registry is sharded; the cursor holds one shard's mutex at a time, so client
+     * creation and destruction in other shards proceeds during the enumeration. A Client pointer
+     * returned by next() remains valid until the subsequent call to next(), which may release
+     * the shard holding it. Clients created in shards the cursor has already passed are not
+     * enumerated.
      */
     class LockedClientsCursor {
     public:
         /**
-         * Constructs a cursor for enumerating the clients of "service", blocking "service" from
-         * creating or destroying Client objects until this instance is destroyed.
+         * Constructs a cursor for enumerating the clients of "service".
          */
         explicit LockedClientsCursor(ServiceContext* service);
 
@@ -211,6 +214,11 @@ public:
         Client* next();
 
     private:
+        void _lockShard(size_t shardIndex);
+
+        ServiceContext* _service;
+        size_t _shardIndex = 0;
+        bool _done = false;
         stdx::unique_lock<Latch> _lock;
         ClientSet::const_iterator _curr;
         ClientSet::const_iterator _end;
@@ -697,11 +705,25 @@ private:
      */
     SyncUnique<StorageEngine> _storageEngine;
 
+    /**
+     * One shard of the client registry. Clients are assigned to shards by address, so
+     * registration and deregistration of different clients usually synchronize on different
+     * mutexes rather than contending with each other and with client enumeration.
+     */
+    struct ClientShard {
+        mutable Mutex mutex = MONGO_MAKE_LATCH("ServiceContext::ClientShard::mutex");
+        ClientSet clients;
+    };
+
+    static constexpr size_t kNumClientShards = 16;
+
+    ClientShard& _shardForClient(Client* client);
+
     /**
      * Vector of registered observers.
      */
     std::vector<ClientObserverHolder> _clientObservers;
-    ClientSet _clients;
+    ClientShard _clientShards[kNumClientShards];
 
     /**
      * Managing classes for our issued operation IDs.
@@ -98,10 +98,12 @@
 #include "mongo/rpc/metadata/repl_set_metadata.h"
 #include "mongo/rpc/metadata/tracking_metadata.h"
 #include "mongo/rpc/op_msg.h"
+#include "mongo/rpc/op_msg_rpc_impls.h"
 #include "mongo/rpc/reply_builder_interface.h"
 #include "mongo/rpc/warn_deprecated_wire_ops.h"
 #include "mongo/s/shard_cannot_refresh_due_to_locks_held_exception.h"
 #include "mongo/transport/hello_metrics.h"
+#include "mongo/transport/reply_buffer_recycler.h"
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/session.h"
 #include "mongo/util/duration.h"
@@ -1725,7 +1727,10 @@ void curOpCommandSetup(OperationContext* opCtx, const OpMsgRequest& request) {
 
 Future<void> parseCommand(std::shared_ptr<HandleRequest::ExecutionContext> execContext) try {
     const auto& msg = execContext->getMessage();
-    auto opMsgReq = rpc::opMsgRequestFromAnyProtocol(msg);
+    // Loopback requests from DBDirectClient were serialized in-process from already-valid BSON
+    // moments ago; skip re-validating their documents.
+    const bool trustedMessage = execContext->getOpCtx()->getClient()->isInDirectClient();
+    auto opMsgReq = rpc::opMsgRequestFromAnyProtocol(msg, trustedMessage);
     if (msg.operation() == dbQuery) {
         checkAllowedOpQueryCommand(*(execContext->getOpCtx()->getClient()),
                                    opMsgReq.getCommandName());
@@ -1856,9 +1861,24 @@ DbResponse makeCommandResponse(std::shared_ptr<HandleRequest::ExecutionContext>
     return dbResponse;
 }
 
+std::unique_ptr<rpc::ReplyBuilderInterface> makeReplyBuilderForRequest(
+    const HandleRequest::ExecutionContext& execContext) {
+    const auto protocol = rpc::protocolForMessage(execContext.getMessage());
+    if (protocol == rpc::Protocol::kOpMsg) {
+        // Build the reply into the buffer that backed this session's previous reply, if the
+        // networking layer has released it. Together with receive buffer recycling this makes the
+        // request/reply cycle allocation-free for small responses.
+        SharedBuffer recycled;
+        if (auto session = execContext.getOpCtx()->getClient()->session()) {
+            recycled = transport::ReplyBufferRecycler::forSession(session).take();
+        }
+        return std::make_unique<rpc::OpMsgReplyBuilder>(std::move(recycled));
+    }
+    return rpc::makeReplyBuilder(protocol);
+}
+
 Future<DbResponse> receivedCommands(std::shared_ptr<HandleRequest::ExecutionContext> execContext) {
-    execContext->setReplyBuilder(
-        rpc::makeReplyBuilder(rpc::protocolForMessage(execContext->getMessage())));
+    execContext->setReplyBuilder(makeReplyBuilderForRequest(*execContext));
     return parseCommand(execContext)
         .then([execContext]() mutable { return executeCommand(std::move(execContext)); })
         .onError([execContext](Status status) {
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/optional.hpp>
 #include <vector>
 
@@ -91,10 +92,10 @@ public:
     SessionToKill checkOutSessionForKill(OperationContext* opCtx, KillToken killToken);
 
     /**
-     * Iterates through the SessionCatalog under the SessionCatalog mutex and applies 'workerFn' to
-     * each Session which matches the specified 'matcher'.
+     * Iterates through the SessionCatalog, one partition at a time under that partition's mutex,
+     * and applies 'workerFn' to each Session which matches the specified 'matcher'.
      *
-     * NOTE: Since this method runs with the session catalog mutex, the work done by 'workerFn' is
+     * NOTE: Since this method runs with a partition's mutex held, the work done by 'workerFn' is
      * not allowed to block, perform I/O or acquire any lock manager locks.
      * Iterates through the SessionCatalog and applies 'workerFn' to each Session. This locks the
      * SessionCatalog.
@@ -105,7 +106,7 @@ public:
                       const ScanSessionsCallbackFn& workerFn);
 
     /**
-     * Shortcut to invoke 'kill' on the specified session under the SessionCatalog mutex. Throws a
+     * Shortcut to invoke 'kill' on the specified session under its partition's mutex. Throws a
      * NoSuchSession exception if the session doesn't exist.
      */
     KillToken killSession(const LogicalSessionId& lsid);
@@ -129,23 +130,45 @@ private:
         // sessions entries from the map.
         int numWaitingToCheckOut{0};
 
-        // Signaled when the state becomes available. Uses the transaction table's mutex to protect
+        // Signaled when the state becomes available. Uses the owning partition's mutex to protect
         // the state transitions.
         stdx::condition_variable availableCondVar;
     };
     using SessionRuntimeInfoMap = LogicalSessionIdMap<std::unique_ptr<SessionRuntimeInfo>>;
 
+    /**
+     * The catalog is striped into a fixed number of partitions, each of which owns a disjoint
+     * subset of the sessions and protects it with its own latch, so that checkouts of unrelated
+     * sessions do not serialize on a single mutex. The partition owning a session is derived from
+     * the hash of its logical session id and never changes.
+     */
+    struct Partition {
+        mutable Mutex mutex =
+            MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(4), "SessionCatalog::Partition::mutex");
+
+        // Owns the Session objects for the sessions assigned to this partition.
+        SessionRuntimeInfoMap sessions;
+    };
+
+    static constexpr size_t kNumPartitions = 16;
+
     /**
      * Blocking method, which checks-out the session set on 'opCtx'.
      */
     ScopedCheckedOutSession _checkOutSession(OperationContext* opCtx);
 
     /**
-     * Creates or returns the session runtime info for 'lsid' from the '_sessions' map. The returned
-     * pointer is guaranteed to be linked on the map for as long as the mutex is held.
+     * Returns the partition which owns 'lsid'.
+     */
+    Partition& _partitionFor(const LogicalSessionId& lsid);
+
+    /**
+     * Creates or returns the session runtime info for 'lsid' from 'partition'. The returned
+     * pointer is guaranteed to be linked on the partition's map for as long as the partition's
+     * mutex is held.
      */
     SessionRuntimeInfo* _getOrCreateSessionRuntimeInfo(WithLock,
-                                                       OperationContext* opCtx,
+                                                       Partition& partition,
                                                        const LogicalSessionId& lsid);
 
     /**
@@ -153,12 +176,7 @@ private:
      */
     void _releaseSession(SessionRuntimeInfo* sri, boost::optional<KillToken> killToken);
 
-    // Protects the state below
-    mutable Mutex _mutex =
-        MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(4), "SessionCatalog::_mutex");
-
-    // Owns the Session objects for all current Sessions.
-    SessionRuntimeInfoMap _sessions;
+    std::array<Partition, kNumPartitions> _partitions;
 };
 
 /**
@@ -242,8 +260,8 @@ using SessionToKill = SessionCatalog::SessionToKill;
 /**
  * This type represents access to a session inside of a scanSessions loop.
  * If you have one of these, you're in a scanSessions callback context, and so
- * have locked the whole catalog and, if the observed session is bound to an operation context,
- * you hold that operation context's client's mutex, as well.
+ * have locked the catalog partition which owns the session and, if the observed session is bound
+ * to an operation context, you hold that operation context's client's mutex, as well.
  */
 class ObservableSession {
 public:
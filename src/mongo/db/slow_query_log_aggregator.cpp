@@ -0,0 +1,149 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/slow_query_log_aggregator.h"
+
+#include <algorithm>
+
+#include "mongo/db/service_context.h"
+#include "mongo/platform/bits.h"
+
+namespace mongo {
+
+namespace {
+
+const auto getSlowQueryLogAggregator = ServiceContext::declareDecoration<SlowQueryLogAggregator>();
+
+// Index of the power-of-two latency bucket for 'duration'.
+size_t latencyBucket(Milliseconds duration) {
+    auto millis = static_cast<unsigned long long>(std::max(duration.count(), 1LL));
+    size_t bucket = 63 - countLeadingZeros64(millis);
+    return std::min(bucket, SlowQueryLogAggregator::kNumLatencyBuckets - 1);
+}
+
+}  // namespace
+
+SlowQueryLogAggregator& SlowQueryLogAggregator::get(ServiceContext* serviceContext) {
+    return getSlowQueryLogAggregator(serviceContext);
+}
+
+bool SlowQueryLogAggregator::shouldLogRawLine(uint32_t queryHash,
+                                              StringData planSummary,
+                                              Milliseconds duration,
+                                              Date_t now,
+                                              double ratePerSec) {
+    stdx::lock_guard<Latch> lk(_mutex);
+
+    auto it = _shapes.find(queryHash);
+    if (it == _shapes.end()) {
+        if (_shapes.size() >= kMaxTrackedShapes) {
+            // Too many distinct shapes to track; let the line through unaggregated.
+            return true;
+        }
+        it = _shapes.emplace(queryHash, ShapeEntry{}).first;
+        // A new shape starts with a full second's worth of tokens so isolated slow operations are
+        // always logged raw.
+        it->second.tokens = std::max(ratePerSec, 1.0);
+        it->second.lastRefill = now;
+    }
+
+    auto& entry = it->second;
+    entry.count++;
+    entry.max = std::max(entry.max, duration);
+    entry.latencyHistogram[latencyBucket(duration)]++;
+    if (entry.planSummary.empty() && !planSummary.empty()) {
+        entry.planSummary = planSummary.toString();
+    }
+
+    // Refill the token bucket, capped at one second's worth of burst.
+    const double burst = std::max(ratePerSec, 1.0);
+    const double elapsedSeconds =
+        durationCount<Milliseconds>(now - entry.lastRefill) / 1000.0;
+    if (elapsedSeconds > 0) {
+        entry.tokens = std::min(burst, entry.tokens + elapsedSeconds * ratePerSec);
+        entry.lastRefill = now;
+    }
+
+    if (entry.tokens >= 1.0) {
+        entry.tokens -= 1.0;
+        return true;
+    }
+
+    entry.suppressed++;
+    return false;
+}
+
+std::vector<SlowQueryLogAggregator::ShapeDigest> SlowQueryLogAggregator::takeDigestsIfDue(
+    Date_t now, Milliseconds interval) {
+    decltype(_shapes) shapes;
+
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_lastDigest == Date_t()) {
+            _lastDigest = now;
+            return {};
+        }
+        if (now - _lastDigest < interval) {
+            return {};
+        }
+        _lastDigest = now;
+        shapes = std::exchange(_shapes, {});
+    }
+
+    std::vector<ShapeDigest> digests;
+    digests.reserve(shapes.size());
+    for (auto&& [queryHash, entry] : shapes) {
+        digests.push_back({queryHash,
+                           std::move(entry.planSummary),
+                           entry.count,
+                           entry.suppressed,
+                           _percentile(entry.latencyHistogram, entry.count, 0.5),
+                           _percentile(entry.latencyHistogram, entry.count, 0.99),
+                           entry.max});
+    }
+    return digests;
+}
+
+Milliseconds SlowQueryLogAggregator::_percentile(
+    const std::array<int64_t, kNumLatencyBuckets>& histogram, int64_t count, double fraction) {
+    const auto target = static_cast<int64_t>(count * fraction);
+    int64_t cumulative = 0;
+    for (size_t bucket = 0; bucket < kNumLatencyBuckets; ++bucket) {
+        cumulative += histogram[bucket];
+        if (cumulative > target) {
+            // Upper bound of the bucket.
+            return Milliseconds(1LL << (bucket + 1));
+        }
+    }
+    return Milliseconds(0);
+}
+
+}  // namespace mongo
@@ -0,0 +1,134 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class ServiceContext;
+
+/**
+ * Aggregates slow operations by query shape and rate-limits the raw "Slow query" log lines emitted
+ * for each shape with a per-shape token bucket, so that an incident producing thousands of slow
+ * operations per second of the same shape does not flood the log. Suppressed operations are not
+ * lost: every recorded operation contributes to a per-shape digest (count, approximate latency
+ * percentiles, plan summary) that the caller periodically retrieves and logs as a single
+ * structured record per shape.
+ *
+ * Shapes are keyed by the query hash computed from the canonical query encoding, which is already
+ * available on OpDebug at logging time. Operations without a query hash are not rate limited.
+ *
+ * Thread-safe.
+ */
+class SlowQueryLogAggregator {
+public:
+    /**
+     * Number of power-of-two latency buckets maintained per shape. The last bucket absorbs
+     * everything of roughly 24 days and over.
+     */
+    static constexpr size_t kNumLatencyBuckets = 32;
+
+    /**
+     * Maximum number of shapes tracked between two digest emissions. Operations for new shapes
+     * beyond this limit are logged unaggregated so the map cannot grow without bound.
+     */
+    static constexpr size_t kMaxTrackedShapes = 1024;
+
+    /**
+     * Per-shape summary handed back by takeDigestsIfDue().
+     */
+    struct ShapeDigest {
+        uint32_t queryHash;
+        std::string planSummary;
+        // Slow operations recorded for this shape since the last digest.
+        int64_t count;
+        // How many of those had their raw log line suppressed by the rate limit.
+        int64_t suppressed;
+        // Approximate latency percentiles, reported as the upper bound of the power-of-two bucket
+        // containing the percentile.
+        Milliseconds p50;
+        Milliseconds p99;
+        Milliseconds max;
+    };
+
+    static SlowQueryLogAggregator& get(ServiceContext* serviceContext);
+
+    /**
+     * Records one slow operation of the given shape and consults the shape's token bucket.
+     * Returns true if the raw log line should still be emitted, false if it should be suppressed.
+     * 'ratePerSec' is the maximum number of raw lines per shape per second; the bucket allows
+     * bursts of up to one second's worth of lines.
+     */
+    bool shouldLogRawLine(uint32_t queryHash,
+                          StringData planSummary,
+                          Milliseconds duration,
+                          Date_t now,
+                          double ratePerSec);
+
+    /**
+     * If 'interval' has elapsed since digests were last taken, returns the digest of every shape
+     * recorded since then and resets the aggregation. Otherwise returns an empty vector. The first
+     * call only starts the interval clock.
+     */
+    std::vector<ShapeDigest> takeDigestsIfDue(Date_t now, Milliseconds interval);
+
+private:
+    struct ShapeEntry {
+        std::string planSummary;
+        int64_t count = 0;
+        int64_t suppressed = 0;
+        Milliseconds max{0};
+        std::array<int64_t, kNumLatencyBuckets> latencyHistogram{};
+
+        // Token bucket state for the raw log line rate limit.
+        double tokens = 0;
+        Date_t lastRefill;
+    };
+
+    static Milliseconds _percentile(const std::array<int64_t, kNumLatencyBuckets>& histogram,
+                                    int64_t count,
+                                    double fraction);
+
+    Mutex _mutex = MONGO_MAKE_LATCH("SlowQueryLogAggregator::_mutex");
+    stdx::unordered_map<uint32_t, ShapeEntry> _shapes;
+    Date_t _lastDigest;
+};
+
+}  // namespace mongo
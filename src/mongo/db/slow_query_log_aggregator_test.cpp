@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/slow_query_log_aggregator.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+const Date_t kStart = Date_t::fromMillisSinceEpoch(1000000);
+
+TEST(SlowQueryLogAggregatorTest, TokenBucketLimitsRawLines) {
+    SlowQueryLogAggregator aggregator;
+
+    // At a rate of 2 lines/sec a new shape starts with a burst of 2 tokens.
+    ASSERT_TRUE(aggregator.shouldLogRawLine(1, "COLLSCAN", Milliseconds(150), kStart, 2.0));
+    ASSERT_TRUE(aggregator.shouldLogRawLine(1, "COLLSCAN", Milliseconds(150), kStart, 2.0));
+    ASSERT_FALSE(aggregator.shouldLogRawLine(1, "COLLSCAN", Milliseconds(150), kStart, 2.0));
+
+    // Half a second refills one token.
+    auto later = kStart + Milliseconds(500);
+    ASSERT_TRUE(aggregator.shouldLogRawLine(1, "COLLSCAN", Milliseconds(150), later, 2.0));
+    ASSERT_FALSE(aggregator.shouldLogRawLine(1, "COLLSCAN", Milliseconds(150), later, 2.0));
+
+    // A different shape has its own bucket.
+    ASSERT_TRUE(aggregator.shouldLogRawLine(2, "IXSCAN { a: 1 }", Milliseconds(150), later, 2.0));
+}
+
+TEST(SlowQueryLogAggregatorTest, DigestAggregatesSuppressedOperations) {
+    SlowQueryLogAggregator aggregator;
+
+    // The first call only starts the interval clock.
+    ASSERT_TRUE(aggregator.takeDigestsIfDue(kStart, Seconds(10)).empty());
+
+    for (int i = 0; i < 10; i++) {
+        aggregator.shouldLogRawLine(7, "COLLSCAN", Milliseconds(100), kStart, 1.0);
+    }
+    aggregator.shouldLogRawLine(7, "COLLSCAN", Milliseconds(5000), kStart, 1.0);
+
+    // Not yet due.
+    ASSERT_TRUE(aggregator.takeDigestsIfDue(kStart + Seconds(5), Seconds(10)).empty());
+
+    auto digests = aggregator.takeDigestsIfDue(kStart + Seconds(11), Seconds(10));
+    ASSERT_EQUALS(digests.size(), 1UL);
+
+    const auto& digest = digests[0];
+    ASSERT_EQUALS(digest.queryHash, 7U);
+    ASSERT_EQUALS(digest.planSummary, "COLLSCAN");
+    ASSERT_EQUALS(digest.count, 11);
+    // One raw line was allowed through by the initial token; the rest were suppressed.
+    ASSERT_EQUALS(digest.suppressed, 10);
+    ASSERT_EQUALS(digest.max, Milliseconds(5000));
+    // The p50 falls in the 100ms sample's power-of-two bucket; the reported value is the bucket's
+    // upper bound.
+    ASSERT_GREATER_THAN_OR_EQUALS(digest.p50, Milliseconds(100));
+    ASSERT_LESS_THAN(digest.p50, Milliseconds(5000));
+    ASSERT_GREATER_THAN_OR_EQUALS(digest.p99, digest.p50);
+
+    // Taking the digests resets the aggregation.
+    ASSERT_TRUE(aggregator.takeDigestsIfDue(kStart + Seconds(22), Seconds(10)).empty());
+}
+
+TEST(SlowQueryLogAggregatorTest, ShapeLimitLetsOverflowThrough) {
+    SlowQueryLogAggregator aggregator;
+
+    for (size_t i = 0; i < SlowQueryLogAggregator::kMaxTrackedShapes; i++) {
+        aggregator.shouldLogRawLine(
+            static_cast<uint32_t>(i), "COLLSCAN", Milliseconds(100), kStart, 1.0);
+        ASSERT_FALSE(aggregator.shouldLogRawLine(
+            static_cast<uint32_t>(i), "COLLSCAN", Milliseconds(100), kStart, 1.0));
+    }
+
+    // New shapes beyond the limit are not tracked and never suppressed.
+    const auto overflowHash = static_cast<uint32_t>(SlowQueryLogAggregator::kMaxTrackedShapes);
+    ASSERT_TRUE(aggregator.shouldLogRawLine(overflowHash, "COLLSCAN", Milliseconds(100), kStart, 1.0));
+    ASSERT_TRUE(aggregator.shouldLogRawLine(overflowHash, "COLLSCAN", Milliseconds(100), kStart, 1.0));
+}
+
+}  // namespace
+}  // namespace mongo
@@ -48,9 +48,12 @@
 
 #include "mongo/db/sorter/sorter.h"
 
+#include <algorithm>
 #include <boost/filesystem/operations.hpp>
+#include <exception>
 #include <snappy.h>
 #include <vector>
+#include <zstd.h>
 
 #include "mongo/base/string_data.h"
 #include "mongo/config.h"
@@ -61,6 +64,8 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/overflow_arithmetic.h"
 #include "mongo/s/is_mongos.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/destructor_guard.h"
 #include "mongo/util/str.h"
@@ -69,6 +74,14 @@ namespace mongo {
 
 namespace {
 
+/**
+ * Compressed blocks in the spill file are framed with a negated int32 size. Snappy predates this
+ * flag and remains the unflagged default; the flag is set in the (negated) size of blocks that
+ * were compressed with zstd instead. Block sizes are far below this bit, so the encoding is
+ * unambiguous and old-format files read back unchanged.
+ */
+constexpr int32_t kZstdBlockFlag = 1 << 30;
+
 /**
  * Calculates and returns a new murmur hash value based on the prior murmur hash and a new piece
  * of data.
@@ -279,6 +292,8 @@ private:
         // negative size means compressed
         const bool compressed = rawSize < 0;
         int32_t blockSize = std::abs(rawSize);
+        const bool zstd = compressed && (blockSize & kZstdBlockFlag);
+        blockSize &= ~kZstdBlockFlag;
 
         _buffer.reset(new char[blockSize]);
         _read(_buffer.get(), blockSize);
@@ -306,6 +321,25 @@ private:
             return;
         }
 
+        if (zstd) {
+            unsigned long long decompressedSize =
+                ZSTD_getFrameContentSize(_buffer.get(), blockSize);
+            uassert(5958101,
+                    "couldn't get uncompressed length",
+                    decompressedSize != ZSTD_CONTENTSIZE_UNKNOWN &&
+                        decompressedSize != ZSTD_CONTENTSIZE_ERROR);
+
+            std::unique_ptr<char[]> decompressionBuffer(new char[decompressedSize]);
+            size_t ret = ZSTD_decompress(
+                decompressionBuffer.get(), decompressedSize, _buffer.get(), blockSize);
+            uassert(5958102, "decompression failed", !ZSTD_isError(ret));
+
+            // hold on to decompressed data and throw out compressed data at block exit
+            _buffer.swap(decompressionBuffer);
+            _bufferReader.reset(new BufReader(_buffer.get(), decompressedSize));
+            return;
+        }
+
         dassert(snappy::IsValidCompressedBuffer(_buffer.get(), blockSize));
 
         size_t uncompressedSize;
@@ -363,6 +397,137 @@ private:
     const uint32_t _originalChecksum;
 };
 
+/**
+ * Pulls data from another iterator on a dedicated thread, staying up to two batches ahead of its
+ * consumer. This overlaps the wrapped iterator's disk reads, decompression and deserialization
+ * with the consumer's own work (double buffering), and is the glue that lets a wide merge be
+ * split across threads.
+ *
+ * Data is copied into owned form before crossing the thread boundary, since unowned results are
+ * only valid until the source iterator is advanced again.
+ */
+template <typename Key, typename Value>
+class BackgroundIterator : public SortIteratorInterface<Key, Value> {
+public:
+    typedef SortIteratorInterface<Key, Value> Input;
+    typedef std::pair<Key, Value> Data;
+
+    explicit BackgroundIterator(std::shared_ptr<Input> source) : _source(std::move(source)) {}
+
+    ~BackgroundIterator() {
+        _halt();
+    }
+
+    void openSource() {
+        _source->openSource();
+        _producer = stdx::thread([this] { _produce(); });
+    }
+
+    void closeSource() {
+        _halt();
+        _source->closeSource();
+    }
+
+    bool more() {
+        if (_currentPos < _currentBatch.size())
+            return true;
+        return _refill();
+    }
+
+    Data next() {
+        invariant(_currentPos < _currentBatch.size() || _refill());
+        return std::move(_currentBatch[_currentPos++]);
+    }
+
+private:
+    // Sized so each batch amortizes the queue handoff without buffering unbounded data; two
+    // batches may be queued and one more in flight in the producer.
+    static constexpr size_t kTargetBatchSizeBytes = 256 * 1024;
+    static constexpr size_t kMaxQueuedBatches = 2;
+
+    void _produce() noexcept {
+        try {
+            std::vector<Data> batch;
+            size_t batchBytes = 0;
+            while (_source->more()) {
+                Data data = _source->next();
+                batchBytes += data.first.memUsageForSorter() + data.second.memUsageForSorter();
+                batch.emplace_back(data.first.getOwned(), data.second.getOwned());
+                if (batchBytes >= kTargetBatchSizeBytes) {
+                    if (!_pushBatch(std::move(batch)))
+                        return;
+                    batch = {};
+                    batchBytes = 0;
+                }
+            }
+            if (!batch.empty())
+                _pushBatch(std::move(batch));
+        } catch (...) {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _error = std::current_exception();
+        }
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        _producerDone = true;
+        _consumerCv.notify_one();
+    }
+
+    bool _pushBatch(std::vector<Data> batch) {
+        stdx::unique_lock<Latch> lk(_mutex);
+        _producerCv.wait(lk, [&] { return _queue.size() < kMaxQueuedBatches || _halted; });
+        if (_halted)
+            return false;
+
+        _queue.push_back(std::move(batch));
+        _consumerCv.notify_one();
+        return true;
+    }
+
+    bool _refill() {
+        stdx::unique_lock<Latch> lk(_mutex);
+        _consumerCv.wait(lk, [&] { return !_queue.empty() || _producerDone; });
+        if (_error) {
+            auto error = _error;
+            _error = nullptr;
+            std::rethrow_exception(error);
+        }
+
+        if (_queue.empty())
+            return false;
+
+        _currentBatch = std::move(_queue.front());
+        _queue.pop_front();
+        _currentPos = 0;
+        _producerCv.notify_one();
+        return true;
+    }
+
+    void _halt() {
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _halted = true;
+            _producerCv.notify_one();
+        }
+        if (_producer.joinable())
+            _producer.join();
+    }
+
+    std::shared_ptr<Input> _source;
+    stdx::thread _producer;
+
+    // Batch currently being consumed; only touched by the consuming thread.
+    std::vector<Data> _currentBatch;
+    size_t _currentPos = 0;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("BackgroundIterator::_mutex");
+    stdx::condition_variable _producerCv;
+    stdx::condition_variable _consumerCv;
+    std::deque<std::vector<Data>> _queue;
+    std::exception_ptr _error;
+    bool _producerDone = false;
+    bool _halted = false;
+};
+
 /**
  * Merge-sorts results from 0 or more FileIterators, all of which should be iterating over sorted
  * ranges within the same file. This class is given the data source file name upon construction and
@@ -993,6 +1158,8 @@ Sorter<Key, Value>::File::~File() {
 
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::read(std::streamoff offset, std::streamsize size, void* out) {
+    stdx::lock_guard<Latch> lk(_readMutex);
+
     if (!_file.is_open()) {
         _open();
     }
@@ -1095,6 +1262,8 @@ SortedFileWriter<Key, Value>::SortedFileWriter(
     const Settings& settings)
     : _settings(settings),
       _file(std::move(file)),
+      _codec(opts.codec),
+      _spillBlockSizeBytes(opts.spillBlockSizeBytes),
       _fileStartOffset(_file->currentOffset()),
       _dbName(opts.dbName) {
     // This should be checked by consumers, but if we get here don't allow writes.
@@ -1121,7 +1290,7 @@ void SortedFileWriter<Key, Value>::addAlreadySorted(const Key& key, const Value&
     _checksum =
         addDataToChecksum(_buffer.buf() + _nextObjPos, _buffer.len() - _nextObjPos, _checksum);
 
-    if (_buffer.len() > 64 * 1024)
+    if (static_cast<size_t>(_buffer.len()) > _spillBlockSizeBytes)
         spill();
 }
 
@@ -1134,10 +1303,21 @@ void SortedFileWriter<Key, Value>::spill() {
         return;
 
     std::string compressed;
-    snappy::Compress(outBuffer, size, &compressed);
+    if (_codec == SorterCodec::kSnappy) {
+        snappy::Compress(outBuffer, size, &compressed);
+    } else if (_codec == SorterCodec::kZstd) {
+        compressed.resize(ZSTD_compressBound(size));
+        size_t compressedSize = ZSTD_compress(
+            &compressed[0], compressed.size(), outBuffer, size, ZSTD_CLEVEL_DEFAULT);
+        uassert(5958103, "compression failed", !ZSTD_isError(compressedSize));
+        compressed.resize(compressedSize);
+    }
     verify(compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
 
-    const bool shouldCompress = compressed.size() < size_t(_buffer.len() / 10 * 9);
+    // An incompressible block (or SorterCodec::kNone, which leaves 'compressed' empty) is written
+    // uncompressed rather than paying decompression overhead on read for no space savings.
+    const bool shouldCompress =
+        !compressed.empty() && compressed.size() < size_t(_buffer.len() / 10 * 9);
     if (shouldCompress) {
         size = compressed.size();
         outBuffer = const_cast<char*>(compressed.data());
@@ -1161,10 +1341,14 @@ void SortedFileWriter<Key, Value>::spill() {
         size = resultLen;
     }
 
-    // Negative size means compressed.
-    size = shouldCompress ? -size : size;
-    _file->write(reinterpret_cast<const char*>(&size), sizeof(size));
-    _file->write(outBuffer, std::abs(size));
+    // Negative size means compressed; zstd blocks additionally carry kZstdBlockFlag in the
+    // negated size so the reader knows which codec to use.
+    verify(size < kZstdBlockFlag);
+    int32_t header = size;
+    if (shouldCompress)
+        header = _codec == SorterCodec::kZstd ? -(size | kZstdBlockFlag) : -size;
+    _file->write(reinterpret_cast<const char*>(&header), sizeof(header));
+    _file->write(outBuffer, size);
 
     _buffer.reset();
 }
@@ -1187,6 +1371,28 @@ SortIteratorInterface<Key, Value>* SortIteratorInterface<Key, Value>::merge(
     const std::vector<std::shared_ptr<SortIteratorInterface>>& iters,
     const SortOptions& opts,
     const Comparator& comp) {
+    // Wide merges may be split into contiguous subtrees that are each merged on their own
+    // thread and drained through a double-buffered BackgroundIterator, leaving a small final
+    // merge over the subtree outputs. Contiguous partitioning preserves the stable tie-break
+    // by input position: within a subtree ties resolve by position as before, and across
+    // subtrees the final merge prefers the lower-numbered (earlier) subtree. Each subtree may
+    // apply opts.limit on its own; the final merge still enforces it globally.
+    const size_t degree = opts.parallelMergeDegree;
+    if (degree > 1 && iters.size() >= 2 * degree) {
+        const size_t perSubtree = (iters.size() + degree - 1) / degree;
+        std::vector<std::shared_ptr<SortIteratorInterface>> subtrees;
+        subtrees.reserve(degree);
+        for (size_t begin = 0; begin < iters.size(); begin += perSubtree) {
+            const size_t end = std::min(begin + perSubtree, iters.size());
+            std::vector<std::shared_ptr<SortIteratorInterface>> group(iters.begin() + begin,
+                                                                      iters.begin() + end);
+            subtrees.push_back(std::make_shared<sorter::BackgroundIterator<Key, Value>>(
+                std::make_shared<sorter::MergeIterator<Key, Value, Comparator>>(
+                    group, opts, comp)));
+        }
+        return new sorter::MergeIterator<Key, Value, Comparator>(subtrees, opts, comp);
+    }
+
     return new sorter::MergeIterator<Key, Value, Comparator>(iters, opts, comp);
 }
 
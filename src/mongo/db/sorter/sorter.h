@@ -41,6 +41,7 @@
 
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/sorter/sorter_gen.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/util/bufreader.h"
 
 /**
@@ -91,6 +92,18 @@
 
 namespace mongo {
 
+/**
+ * Compression codecs available for data blocks written to the spill file.
+ */
+enum class SorterCodec {
+    // Favors compression speed over ratio. The historical default.
+    kSnappy,
+    // Trades some compression speed for a considerably better ratio.
+    kZstd,
+    // No compression; blocks are written raw.
+    kNone,
+};
+
 /**
  * Runtime options that control the Sorter's behavior
  */
@@ -119,11 +132,28 @@ struct SortOptions {
     // instead of copying.
     bool moveSortedDataIntoIterator;
 
+    // Compression codec applied to blocks of spilled data.
+    SorterCodec codec;
+
+    // Amount of data accumulated before a block is compressed and written to the spill file.
+    // Larger blocks compress better and issue fewer, larger writes at the cost of buffering more
+    // data in memory while spilling.
+    size_t spillBlockSizeBytes;
+
+    // Number of threads the final k-way merge may be split across. With a value of n > 1, wide
+    // merges are partitioned into n subtrees that are each merged on a dedicated thread and
+    // drained through a double-buffered queue, with a small final merge over the subtree
+    // outputs. A value of 1 keeps the merge entirely on the consuming thread.
+    size_t parallelMergeDegree;
+
     SortOptions()
         : limit(0),
           maxMemoryUsageBytes(64 * 1024 * 1024),
           extSortAllowed(false),
-          moveSortedDataIntoIterator(false) {}
+          moveSortedDataIntoIterator(false),
+          codec(SorterCodec::kSnappy),
+          spillBlockSizeBytes(64 * 1024),
+          parallelMergeDegree(1) {}
 
     // Fluent API to support expressions like SortOptions().Limit(1000).ExtSortAllowed(true)
 
@@ -152,10 +182,25 @@ struct SortOptions {
         return *this;
     }
 
+    SortOptions& Codec(SorterCodec newCodec) {
+        codec = newCodec;
+        return *this;
+    }
+
+    SortOptions& SpillBlockSizeBytes(size_t newSpillBlockSizeBytes) {
+        spillBlockSizeBytes = newSpillBlockSizeBytes;
+        return *this;
+    }
+
     SortOptions& MoveSortedDataIntoIterator(bool newMoveSortedDataIntoIterator = true) {
         moveSortedDataIntoIterator = newMoveSortedDataIntoIterator;
         return *this;
     }
+
+    SortOptions& ParallelMergeDegree(size_t newParallelMergeDegree) {
+        parallelMergeDegree = newParallelMergeDegree;
+        return *this;
+    }
 };
 
 /**
@@ -276,7 +321,7 @@ public:
 
         /**
          * Reads the requested data from the file. Cannot write more to the file once this has been
-         * called.
+         * called. Safe to call concurrently from multiple threads.
          */
         void read(std::streamoff offset, std::streamsize size, void* out);
 
@@ -298,6 +343,10 @@ public:
         boost::filesystem::path _path;
         std::fstream _file;
 
+        // Serializes seek/read pairs on the shared stream so iterators can read from multiple
+        // threads during a parallel merge. The write path is always used serially.
+        Mutex _readMutex = MONGO_MAKE_LATCH("Sorter::File::_readMutex");
+
         // The current offset of the end of the file, or -1 if the file either has not yet been
         // opened or is already being read.
         std::streamoff _offset = -1;
@@ -401,6 +450,10 @@ private:
     std::shared_ptr<typename Sorter<Key, Value>::File> _file;
     BufBuilder _buffer;
 
+    // Spill-block policy copied from the SortOptions this writer was created with.
+    const SorterCodec _codec;
+    const std::size_t _spillBlockSizeBytes;
+
     // Keeps track of the hash of all data objects spilled to disk. Passed to the FileIterator
     // to ensure data has not been corrupted after reading from disk.
     uint32_t _checksum = 0;
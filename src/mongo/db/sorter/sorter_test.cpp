@@ -305,6 +305,17 @@ public:
                                         std::make_shared<IntIterator>(0, 10 * 1000 * 1000));
         }
 
+        // Every codec must round trip, including across a spill block boundary.
+        for (auto codec : {SorterCodec::kSnappy, SorterCodec::kZstd, SorterCodec::kNone}) {
+            SortedFileWriter<IntWrapper, IntWrapper> sorter(
+                SortOptions(opts).Codec(codec).SpillBlockSizeBytes(1024), makeFile());
+            for (int i = 0; i < 10 * 1000; i++)
+                sorter.addAlreadySorted(i, -i);
+
+            ASSERT_ITERATORS_EQUIVALENT(std::shared_ptr<IWIterator>(sorter.done()),
+                                        std::make_shared<IntIterator>(0, 10 * 1000));
+        }
+
         ASSERT(boost::filesystem::is_empty(tempDir.path()));
     }
 };
@@ -358,6 +369,29 @@ public:
                 mergeIterators(iterators, ASC, SortOptions().Limit(10)),
                 std::make_shared<LimitIterator>(10, std::make_shared<IntIterator>(0, 20, 1)));
         }
+        {  // test parallel merge subtrees
+            std::shared_ptr<IWIterator> iterators[] = {
+                std::make_shared<IntIterator>(0, 40, 4),  // 0, 4, ... 36
+                std::make_shared<IntIterator>(1, 40, 4),  // 1, 5, ... 37
+                std::make_shared<IntIterator>(2, 40, 4),  // 2, 6, ... 38
+                std::make_shared<IntIterator>(3, 40, 4),  // 3, 7, ... 39
+                std::make_shared<EmptyIterator>()};
+
+            ASSERT_ITERATORS_EQUIVALENT(
+                mergeIterators(iterators, ASC, SortOptions().ParallelMergeDegree(2)),
+                std::make_shared<IntIterator>(0, 40, 1));
+        }
+        {  // test parallel merge with a limit
+            std::shared_ptr<IWIterator> iterators[] = {
+                std::make_shared<IntIterator>(1, 20, 2),   // 1, 3, ... 19
+                std::make_shared<IntIterator>(0, 20, 2),   // 0, 2, ... 18
+                std::make_shared<IntIterator>(21, 40, 2),  // 21, 23, ... 39
+                std::make_shared<IntIterator>(20, 40, 2)};  // 20, 22, ... 38
+
+            ASSERT_ITERATORS_EQUIVALENT(
+                mergeIterators(iterators, ASC, SortOptions().Limit(30).ParallelMergeDegree(2)),
+                std::make_shared<LimitIterator>(30, std::make_shared<IntIterator>(0, 40, 1)));
+        }
     }
 };
 
@@ -623,6 +657,17 @@ public:
 };
 
 
+/**
+ * Drives the spilled merge phase through parallel subtrees, exercising concurrent File reads
+ * and the BackgroundIterator handoff end to end.
+ */
+class LotsOfDataParallelMerge : public LotsOfDataLittleMemory</*random=*/true> {
+public:
+    SortOptions adjustSortOptions(SortOptions opts) override {
+        return LotsOfDataLittleMemory::adjustSortOptions(opts).ParallelMergeDegree(4);
+    }
+};
+
 template <long long Limit, bool Random = true>
 class LotsOfDataWithLimit : public LotsOfDataLittleMemory<Random> {
     typedef LotsOfDataLittleMemory<Random> Parent;
@@ -669,6 +714,7 @@ public:
         add<SorterTests::Dupes>();
         add<SorterTests::LotsOfDataLittleMemory</*random=*/false>>();
         add<SorterTests::LotsOfDataLittleMemory</*random=*/true>>();
+        add<SorterTests::LotsOfDataParallelMerge>();
         add<SorterTests::LotsOfDataWithLimit<1, /*random=*/false>>();     // limit=1 is special case
         add<SorterTests::LotsOfDataWithLimit<1, /*random=*/true>>();      // limit=1 is special case
         add<SorterTests::LotsOfDataWithLimit<100, /*random=*/false>>();   // fits in mem
@@ -97,60 +97,77 @@ BSONObj OpCounters::getObj() const {
     return b.obj();
 }
 
+namespace {
+// Sums the stripes of a thread-striped counter. The result is not a point-in-time snapshot with
+// respect to concurrent writers, which is fine for metrics reporting. Each stripe wraps
+// individually at 2^60, so the sum cannot overflow a signed 64-bit value.
+long long sumStripes(const ThreadStriped<AtomicWord<long long>>& striped) {
+    long long total = 0;
+    for (auto&& stripe : striped.stripes()) {
+        total += stripe.loadRelaxed();
+    }
+    return total;
+}
+}  // namespace
+
 void NetworkCounter::hitPhysicalIn(long long bytes) {
     static const int64_t MAX = 1ULL << 60;
+    auto& counter = _physicalBytesIn.stripe();
 
     // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesIn.loadRelaxed() > MAX;
+    const bool overflow = counter.loadRelaxed() > MAX;
 
     if (overflow) {
-        _physicalBytesIn.store(bytes);
+        counter.store(bytes);
     } else {
-        _physicalBytesIn.fetchAndAdd(bytes);
+        counter.fetchAndAdd(bytes);
     }
 }
 
 void NetworkCounter::hitPhysicalOut(long long bytes) {
     static const int64_t MAX = 1ULL << 60;
+    auto& counter = _physicalBytesOut.stripe();
 
     // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesOut.loadRelaxed() > MAX;
+    const bool overflow = counter.loadRelaxed() > MAX;
 
     if (overflow) {
-        _physicalBytesOut.store(bytes);
+        counter.store(bytes);
     } else {
-        _physicalBytesOut.fetchAndAdd(bytes);
+        counter.fetchAndAdd(bytes);
     }
 }
 
 void NetworkCounter::hitLogicalIn(long long bytes) {
     static const int64_t MAX = 1ULL << 60;
+    auto& together = _together.stripe();
 
     // don't care about the race as its just a counter
-    const bool overflow = _together.logicalBytesIn.loadRelaxed() > MAX;
+    const bool overflow = together.logicalBytesIn.loadRelaxed() > MAX;
 
     if (overflow) {
-        _together.logicalBytesIn.store(bytes);
+        together.logicalBytesIn.store(bytes);
         // The requests field only gets incremented here (and not in hitPhysical) because the
         // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
         // functions would double-count the number of operations.
-        _together.requests.store(1);
+        together.requests.store(1);
     } else {
-        _together.logicalBytesIn.fetchAndAdd(bytes);
-        _together.requests.fetchAndAdd(1);
+        together.logicalBytesIn.fetchAndAdd(bytes);
+        together.requests.fetchAndAdd(1);
     }
 }
 
 void NetworkCounter::hitLogicalOut(long long bytes) {
     static const int64_t MAX = 1ULL << 60;
+    auto& counter = _logicalBytesOut.stripe();
 
     // don't care about the race as its just a counter
-    const bool overflow = _logicalBytesOut.loadRelaxed() > MAX;
+    const bool overflow = counter.loadRelaxed() > MAX;
 
     if (overflow) {
-        _logicalBytesOut.store(bytes);
+        counter.store(bytes);
     } else {
-        _logicalBytesOut.fetchAndAdd(bytes);
+        counter.fetchAndAdd(bytes);
     }
 }
 
@@ -167,13 +184,20 @@ void NetworkCounter::acceptedTFOIngress() {
 }
 
 void NetworkCounter::append(BSONObjBuilder& b) {
-    b.append("bytesIn", static_cast<long long>(_together.logicalBytesIn.loadRelaxed()));
-    b.append("bytesOut", static_cast<long long>(_logicalBytesOut.loadRelaxed()));
-    b.append("physicalBytesIn", static_cast<long long>(_physicalBytesIn.loadRelaxed()));
-    b.append("physicalBytesOut", static_cast<long long>(_physicalBytesOut.loadRelaxed()));
+    long long logicalBytesIn = 0;
+    long long requests = 0;
+    for (auto&& together : _together.stripes()) {
+        logicalBytesIn += together.logicalBytesIn.loadRelaxed();
+        requests += together.requests.loadRelaxed();
+    }
+
+    b.append("bytesIn", logicalBytesIn);
+    b.append("bytesOut", sumStripes(_logicalBytesOut));
+    b.append("physicalBytesIn", sumStripes(_physicalBytesIn));
+    b.append("physicalBytesOut", sumStripes(_physicalBytesOut));
     b.append("numSlowDNSOperations", static_cast<long long>(_numSlowDNSOperations.loadRelaxed()));
     b.append("numSlowSSLOperations", static_cast<long long>(_numSlowSSLOperations.loadRelaxed()));
-    b.append("numRequests", static_cast<long long>(_together.requests.loadRelaxed()));
+    b.append("numRequests", requests);
 
     BSONObjBuilder tfo;
 #ifdef __linux__
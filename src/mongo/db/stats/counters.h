@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 
 #include "mongo/db/commands/server_status_metric.h"
@@ -36,7 +37,9 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/basic.h"
 #include "mongo/rpc/message.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/concurrency/spin_lock.h"
+#include "mongo/util/concurrency/thread_striped.h"
 #include "mongo/util/processinfo.h"
 #include "mongo/util/string_map.h"
 #include "mongo/util/with_alignment.h"
@@ -211,8 +214,8 @@ public:
     void append(BSONObjBuilder& b);
 
 private:
-    CacheAligned<AtomicWord<long long>> _physicalBytesIn{0};
-    CacheAligned<AtomicWord<long long>> _physicalBytesOut{0};
+    ThreadStriped<AtomicWord<long long>> _physicalBytesIn;
+    ThreadStriped<AtomicWord<long long>> _physicalBytesOut;
 
     // These two counters are always incremented at the same time, so
     // we place them on the same cache line.
@@ -220,11 +223,11 @@ private:
         AtomicWord<long long> logicalBytesIn{0};
         AtomicWord<long long> requests{0};
     };
-    CacheAligned<Together> _together{};
-    static_assert(sizeof(decltype(_together)) <= stdx::hardware_constructive_interference_size,
+    static_assert(sizeof(Together) <= stdx::hardware_constructive_interference_size,
                   "cache line spill");
+    ThreadStriped<Together> _together;
 
-    CacheAligned<AtomicWord<long long>> _logicalBytesOut{0};
+    ThreadStriped<AtomicWord<long long>> _logicalBytesOut;
 
     CacheAligned<AtomicWord<long long>> _numSlowDNSOperations{0};
     CacheAligned<AtomicWord<long long>> _numSlowSSLOperations{0};
@@ -36,6 +36,7 @@
 #include "mongo/db/concurrency/lock_stats.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/util/concurrency/wait_duration_histogram.h"
 
 namespace mongo {
 namespace {
@@ -122,6 +123,11 @@ public:
 
         stats.report(&ret);
 
+        {
+            BSONObjBuilder waitLatency(ret.subobjStart("waitLatency"));
+            getGlobalLockWaitHistogram().append(&waitLatency);
+        }
+
         return ret.obj();
     }
 
@@ -153,6 +153,21 @@ void OperationLatencyHistogram::append(bool includeHistograms,
     _append(_transactions, "transactions", includeHistograms, slowMSBucketsOnly, builder);
 }
 
+void OperationLatencyHistogram::absorb(const OperationLatencyHistogram& other) {
+    auto absorbData = [](const HistogramData& from, HistogramData* into) {
+        for (int i = 0; i < kMaxBuckets; i++) {
+            into->buckets[i] += from.buckets[i];
+        }
+        into->entryCount += from.entryCount;
+        into->sum += from.sum;
+    };
+
+    absorbData(other._reads, &_reads);
+    absorbData(other._writes, &_writes);
+    absorbData(other._commands, &_commands);
+    absorbData(other._transactions, &_transactions);
+}
+
 // Computes the log base 2 of value, and checks for cases of split buckets.
 int OperationLatencyHistogram::_getBucket(uint64_t value) {
     // Zero is a special case since log(0) is undefined.
@@ -59,6 +59,12 @@ public:
      */
     void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
 
+    /**
+     * Adds the bucket counts, operation counts, and latency totals from 'other' into this
+     * histogram. Used to combine histograms that were accumulated separately.
+     */
+    void absorb(const OperationLatencyHistogram& other);
+
 private:
     struct HistogramData {
         std::array<uint64_t, kMaxBuckets> buckets{};
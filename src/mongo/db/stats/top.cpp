@@ -33,8 +33,10 @@
 
 #include "mongo/db/stats/top.h"
 
+#include "mongo/db/client.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/service_context.h"
+#include "mongo/util/processinfo.h"
 
 namespace mongo {
 
@@ -71,6 +73,18 @@ Top& Top::get(ServiceContext* service) {
     return getTop(service);
 }
 
+Top::Top()
+    : _usageStripes(std::max<size_t>(1, ProcessInfo::getNumAvailableCores())),
+      _histogramStripes(std::max<size_t>(1, ProcessInfo::getNumAvailableCores())) {}
+
+Top::HistogramStripe& Top::_globalHistogramStripe() {
+    // Spread updates across stripes by the calling thread's Client so that operations completing
+    // on different connections update different histograms. The shift discards the low pointer
+    // bits, which are all zero due to alignment.
+    auto slot = haveClient() ? (reinterpret_cast<uintptr_t>(&cc()) >> 6) : 0;
+    return _histogramStripes[slot % _histogramStripes.size()];
+}
+
 void Top::record(OperationContext* opCtx,
                  StringData ns,
                  LogicalOp logicalOp,
@@ -82,9 +96,10 @@ void Top::record(OperationContext* opCtx,
         return;
 
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    auto& stripe = _stripeFor(hashedNs);
+    stdx::lock_guard<SimpleMutex> lk(stripe.lock);
 
-    CollectionData& coll = _usage[hashedNs];
+    CollectionData& coll = stripe.usage[hashedNs];
     _record(opCtx, coll, logicalOp, lockType, micros, readWriteType);
 }
 
@@ -134,18 +149,29 @@ void Top::_record(OperationContext* opCtx,
 }
 
 void Top::collectionDropped(const NamespaceString& nss) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _usage.erase(nss.ns());
+    auto hashedNs = UsageMap::hasher().hashed_key(nss.ns());
+    auto& stripe = _stripeFor(hashedNs);
+    stdx::lock_guard<SimpleMutex> lk(stripe.lock);
+    stripe.usage.erase(nss.ns());
 }
 
 void Top::cloneMap(Top::UsageMap& out) const {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    out = _usage;
+    out.clear();
+    // Each namespace lives in exactly one stripe, so the merge is a plain union. The stripes are
+    // locked one at a time, so the result is not a single point-in-time snapshot, but the counters
+    // are monotonic and callers only compute diffs between successive reads.
+    for (auto&& stripe : _usageStripes) {
+        stdx::lock_guard<SimpleMutex> lk(stripe.lock);
+        for (auto&& entry : stripe.usage) {
+            out[entry.first] = entry.second;
+        }
+    }
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _appendToUsageMap(b, _usage);
+    UsageMap merged;
+    cloneMap(merged);
+    _appendToUsageMap(b, merged);
 }
 
 void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
@@ -190,9 +216,10 @@ void Top::appendLatencyStats(const NamespaceString& nss,
                              bool includeHistograms,
                              BSONObjBuilder* builder) {
     auto hashedNs = UsageMap::hasher().hashed_key(nss.ns());
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    auto& stripe = _stripeFor(hashedNs);
+    stdx::lock_guard<SimpleMutex> lk(stripe.lock);
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
+    stripe.usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
     builder->append("ns", nss.ns());
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -203,20 +230,26 @@ void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
     if (!opCtx->shouldIncrementLatencyStats())
         return;
 
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
+    auto& stripe = _globalHistogramStripe();
+    stdx::lock_guard<SimpleMutex> guard(stripe.lock);
+    _incrementHistogram(opCtx, latency, &stripe.histogram, readWriteType);
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms,
                                    bool slowMSBucketsOnly,
                                    BSONObjBuilder* builder) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder);
+    OperationLatencyHistogram merged;
+    for (auto&& stripe : _histogramStripes) {
+        stdx::lock_guard<SimpleMutex> guard(stripe.lock);
+        merged.absorb(stripe.histogram);
+    }
+    merged.append(includeHistograms, slowMSBucketsOnly, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(uint64_t latency) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
+    auto& stripe = _globalHistogramStripe();
+    stdx::lock_guard<SimpleMutex> guard(stripe.lock);
+    stripe.histogram.increment(latency, Command::ReadWriteType::kTransaction);
 }
 
 void Top::_incrementHistogram(OperationContext* opCtx,
@@ -34,6 +34,7 @@
  */
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <vector>
 
 #include "mongo/db/commands.h"
 #include "mongo/db/operation_context.h"
@@ -52,7 +53,7 @@ class Top {
 public:
     static Top& get(ServiceContext* service);
 
-    Top() = default;
+    Top();
 
     struct UsageData {
         UsageData() : time(0), count(0) {}
@@ -153,9 +154,36 @@ private:
                              OperationLatencyHistogram* histogram,
                              Command::ReadWriteType readWriteType);
 
-    mutable SimpleMutex _lock;
-    OperationLatencyHistogram _globalHistogramStats;
-    UsageMap _usage;
+    /**
+     * Per-collection usage is striped by namespace hash so that operations on different
+     * collections don't all contend on one global mutex on the completion path. A given namespace
+     * always maps to the same stripe, so readers can merge the stripes without combining partial
+     * counts for any one collection.
+     */
+    struct UsageStripe {
+        mutable SimpleMutex lock;
+        UsageMap usage;
+    };
+
+    /**
+     * The global latency histogram is updated by every operation regardless of namespace, so it is
+     * striped by the calling thread's Client instead and merged on read.
+     */
+    struct HistogramStripe {
+        mutable SimpleMutex lock;
+        OperationLatencyHistogram histogram;
+    };
+
+    UsageStripe& _stripeFor(StringMapHashedKey hashedNs) {
+        return _usageStripes[hashedNs.hash() % _usageStripes.size()];
+    }
+
+    HistogramStripe& _globalHistogramStripe();
+
+    // Sized once at construction (roughly one stripe per core) and never resized, so references
+    // to individual stripes remain valid for the lifetime of this object.
+    std::vector<UsageStripe> _usageStripes;
+    std::vector<HistogramStripe> _histogramStripes;
 };
 
 }  // namespace mongo
@@ -40,4 +40,17 @@ TEST(TopTest, CollectionDropped) {
     Top().collectionDropped(NamespaceString("test.coll"));
 }
 
+TEST(TopTest, GlobalLatencyStatsMergedAcrossStripes) {
+    Top top;
+    top.incrementGlobalTransactionLatencyStats(100);
+    top.incrementGlobalTransactionLatencyStats(200);
+
+    BSONObjBuilder builder;
+    top.appendGlobalLatencyStats(false, false, &builder);
+    auto stats = builder.obj();
+
+    ASSERT_EQ(stats["transactions"]["ops"].numberLong(), 2);
+    ASSERT_EQ(stats["transactions"]["latency"].numberLong(), 300);
+}
+
 }  // namespace
@@ -33,6 +33,8 @@
 
 #include "mongo/db/storage/checkpointer.h"
 
+#include <algorithm>
+
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/kv/kv_engine.h"
@@ -48,6 +50,15 @@ const auto getCheckpointer = ServiceContext::declareDecoration<std::unique_ptr<C
 
 MONGO_FAIL_POINT_DEFINE(pauseCheckpointThread);
 
+// Take a checkpoint ahead of schedule once this fraction of the engine's cache is dirty. Chosen to
+// stay below WiredTiger's default eviction dirty trigger (20% of cache) so the checkpoint starts
+// writing back before application threads get recruited for eviction.
+constexpr double kDirtyCacheThreshold = 0.15;
+
+// How often to re-examine the engine's dirty-byte accounting while waiting out
+// 'storageGlobalParams.checkpointDelaySecs'.
+constexpr std::int64_t kDirtyDataPollPeriodSecs = 1;
+
 }  // namespace
 
 Checkpointer* Checkpointer::get(ServiceContext* serviceCtx) {
@@ -78,21 +89,34 @@ void Checkpointer::run() {
             stdx::unique_lock<Latch> lock(_mutex);
             MONGO_IDLE_THREAD_BLOCK;
 
-            // Wait for 'storageGlobalParams.checkpointDelaySecs' seconds; or until either shutdown
-            // is signaled or a checkpoint is triggered.
-            _sleepCV.wait_for(lock,
-                              stdx::chrono::seconds(static_cast<std::int64_t>(
-                                  storageGlobalParams.checkpointDelaySecs)),
-                              [&] { return _shuttingDown || _triggerCheckpoint; });
-
-            // If the checkpointDelaySecs is set to 0, that means we should skip checkpointing.
+            // Wait for 'storageGlobalParams.checkpointDelaySecs' seconds; or until shutdown is
+            // signaled, a checkpoint is triggered, or the engine reports enough dirty data that
+            // waiting out the full delay would turn the next checkpoint into a latency spike.
+            // Dirty-triggered checkpoints are throttled to at most one per sixth of the configured
+            // delay, so a sustained write burst yields smaller, more frequent checkpoints rather
+            // than an unbounded checkpoint rate.
+            //
+            // If checkpointDelaySecs is set to 0, that means we should skip checkpointing.
             // However, checkpointDelaySecs is adjustable by a runtime server parameter, so we
-            // need to wake up to check periodically. The wakeup to check period is arbitrary.
-            while (storageGlobalParams.checkpointDelaySecs == 0 && !_shuttingDown &&
-                   !_triggerCheckpoint) {
-                _sleepCV.wait_for(lock, stdx::chrono::seconds(static_cast<std::int64_t>(3)), [&] {
-                    return _shuttingDown || _triggerCheckpoint;
-                });
+            // re-read it on every wakeup rather than sleeping the whole delay in one shot.
+            std::int64_t secondsWaited = 0;
+            while (!_shuttingDown && !_triggerCheckpoint) {
+                const auto delaySecs =
+                    static_cast<std::int64_t>(storageGlobalParams.checkpointDelaySecs);
+                if (delaySecs > 0 && secondsWaited >= delaySecs) {
+                    break;
+                }
+
+                _sleepCV.wait_for(lock,
+                                  stdx::chrono::seconds(kDirtyDataPollPeriodSecs),
+                                  [&] { return _shuttingDown || _triggerCheckpoint; });
+                secondsWaited += kDirtyDataPollPeriodSecs;
+
+                const auto minDirtyTriggerSecs = std::max<std::int64_t>(delaySecs / 6, 1);
+                if (delaySecs > 0 && secondsWaited >= minDirtyTriggerSecs &&
+                    _dirtyDataThresholdExceeded()) {
+                    break;
+                }
             }
 
             if (_shuttingDown) {
@@ -126,6 +150,17 @@ void Checkpointer::run() {
     }
 }
 
+bool Checkpointer::_dirtyDataThresholdExceeded() const {
+    const int64_t cacheSizeBytes = _kvEngine->getCacheSizeBytes();
+    if (cacheSizeBytes == 0) {
+        // The engine either does not track dirty bytes or has no bounded cache; fall back to the
+        // fixed schedule.
+        return false;
+    }
+    return _kvEngine->getCacheDirtyBytes() >
+        static_cast<int64_t>(kDirtyCacheThreshold * cacheSizeBytes);
+}
+
 void Checkpointer::triggerFirstStableCheckpoint(Timestamp prevStable,
                                                 Timestamp initialData,
                                                 Timestamp currStable) {
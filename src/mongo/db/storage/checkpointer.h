@@ -88,6 +88,12 @@ public:
     void shutdown(const Status& reason);
 
 private:
+    /**
+     * Returns true if the engine's dirty-byte accounting indicates enough unwritten data has
+     * accumulated in the cache that the next checkpoint should be taken ahead of schedule.
+     */
+    bool _dirtyDataThresholdExceeded() const;
+
     // A pointer to the KVEngine is maintained only due to unit testing limitations that don't fully
     // setup the ServiceContext.
     // TODO SERVER-50861: Remove this pointer.
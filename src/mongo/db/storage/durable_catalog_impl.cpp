@@ -214,6 +214,22 @@ public:
     const Entry _entry;
 };
 
+class DurableCatalogImpl::InvalidateMetaDataCacheChange : public RecoveryUnit::Change {
+public:
+    InvalidateMetaDataCacheChange(DurableCatalogImpl* catalog, RecordId catalogId)
+        : _catalog(catalog), _catalogId(catalogId) {}
+
+    virtual void commit(boost::optional<Timestamp>) {
+        _catalog->_invalidateMetaDataCache(_catalogId);
+    }
+    virtual void rollback() {
+        _catalog->_invalidateMetaDataCache(_catalogId);
+    }
+
+    DurableCatalogImpl* const _catalog;
+    const RecordId _catalogId;
+};
+
 class DurableCatalogImpl::AddIndexChange : public RecoveryUnit::Change {
 public:
     AddIndexChange(RecoveryUnit* ru, StorageEngineInterface* engine, StringData ident)
@@ -435,6 +451,17 @@ BSONObj DurableCatalogImpl::_findEntry(OperationContext* opCtx, RecordId catalog
 
 std::shared_ptr<BSONCollectionCatalogEntry::MetaData> DurableCatalogImpl::getMetaData(
     OperationContext* opCtx, RecordId catalogId) const {
+    {
+        stdx::lock_guard<Latch> lk(_metaDataCacheLock);
+        auto it = _metaDataCache.find(catalogId);
+        if (it != _metaDataCache.end()) {
+            // Return a copy so callers may modify the metadata without affecting the cache. The
+            // copy is shallow where it matters: the contained index specs share their underlying
+            // BSON buffers.
+            return std::make_shared<BSONCollectionCatalogEntry::MetaData>(*it->second);
+        }
+    }
+
     BSONObj obj = _findEntry(opCtx, catalogId);
     LOGV2_DEBUG(22209, 3, " fetched CCE metadata: {obj}", "obj"_attr = obj);
     std::shared_ptr<BSONCollectionCatalogEntry::MetaData> md;
@@ -443,10 +470,18 @@ std::shared_ptr<BSONCollectionCatalogEntry::MetaData> DurableCatalogImpl::getMet
         LOGV2_DEBUG(22210, 3, "returning metadata: {mdElement}", "mdElement"_attr = mdElement);
         md = std::make_shared<BSONCollectionCatalogEntry::MetaData>();
         md->parse(mdElement.Obj());
+
+        stdx::lock_guard<Latch> lk(_metaDataCacheLock);
+        _metaDataCache[catalogId] = std::make_shared<BSONCollectionCatalogEntry::MetaData>(*md);
     }
     return md;
 }
 
+void DurableCatalogImpl::_invalidateMetaDataCache(RecordId catalogId) const {
+    stdx::lock_guard<Latch> lk(_metaDataCacheLock);
+    _metaDataCache.erase(catalogId);
+}
+
 void DurableCatalogImpl::putMetaData(OperationContext* opCtx,
                                      RecordId catalogId,
                                      BSONCollectionCatalogEntry::MetaData& md) {
@@ -497,6 +532,12 @@ void DurableCatalogImpl::putMetaData(OperationContext* opCtx,
     LOGV2_DEBUG(22211, 3, "recording new metadata: {obj}", "obj"_attr = obj);
     Status status = _rs->updateRecord(opCtx, catalogId, obj.objdata(), obj.objsize());
     fassert(28521, status);
+
+    // Drop any cached parsed copy of this entry now, and again once the write commits or rolls
+    // back in case a concurrent reader repopulates the cache from its own snapshot in between.
+    _invalidateMetaDataCache(catalogId);
+    opCtx->recoveryUnit()->registerChange(
+        std::make_unique<InvalidateMetaDataCacheChange>(this, catalogId));
 }
 
 Status DurableCatalogImpl::_replaceEntry(OperationContext* opCtx,
@@ -517,6 +558,10 @@ Status DurableCatalogImpl::_replaceEntry(OperationContext* opCtx,
         fassert(28522, status);
     }
 
+    _invalidateMetaDataCache(catalogId);
+    opCtx->recoveryUnit()->registerChange(
+        std::make_unique<InvalidateMetaDataCacheChange>(this, catalogId));
+
     stdx::lock_guard<Latch> lk(_catalogIdToEntryMapLock);
     const auto it = _catalogIdToEntryMap.find(catalogId);
     invariant(it != _catalogIdToEntryMap.end());
@@ -555,6 +600,10 @@ Status DurableCatalogImpl::_removeEntry(OperationContext* opCtx, RecordId catalo
     _rs->deleteRecord(opCtx, catalogId);
     _catalogIdToEntryMap.erase(it);
 
+    _invalidateMetaDataCache(catalogId);
+    opCtx->recoveryUnit()->registerChange(
+        std::make_unique<InvalidateMetaDataCacheChange>(this, catalogId));
+
     return Status::OK();
 }
 
@@ -150,6 +150,7 @@ public:
 private:
     class AddIdentChange;
     class RemoveIdentChange;
+    class InvalidateMetaDataCacheChange;
     class AddIndexChange;
 
     friend class StorageEngineImpl;
@@ -188,6 +189,12 @@ private:
     // Allows featureDocuments to be checked with older versions
     static bool isFeatureDocument(BSONObj obj);
 
+    /**
+     * Drops the cached parsed metadata for 'catalogId', forcing the next getMetaData() call to
+     * re-read and re-parse the catalog record.
+     */
+    void _invalidateMetaDataCache(RecordId catalogId) const;
+
     RecordStore* _rs;  // not owned
     const bool _directoryPerDb;
     const bool _directoryForIndexes;
@@ -201,6 +208,14 @@ private:
     mutable Mutex _catalogIdToEntryMapLock =
         MONGO_MAKE_LATCH("DurableCatalogImpl::_catalogIdToEntryMap");
 
+    // Parsed copies of each entry's most recently read 'md' document, so steady-state metadata
+    // lookups do not re-read and re-parse the catalog record store. Entries are invalidated by any
+    // catalog write to the corresponding record. Like '_catalogIdToEntryMap' this is not
+    // MVCC-managed; callers rely on the locking protecting catalog reads from concurrent DDL.
+    mutable std::map<RecordId, std::shared_ptr<BSONCollectionCatalogEntry::MetaData>>
+        _metaDataCache;
+    mutable Mutex _metaDataCacheLock = MONGO_MAKE_LATCH("DurableCatalogImpl::_metaDataCache");
+
     StorageEngineInterface* const _engine;
 };
 }  // namespace mongo
@@ -221,6 +221,10 @@ BSONObj FlowControl::generateSection(OperationContext* opCtx,
     bob.append("isLagged", _isLagged.load());
     bob.append("isLaggedCount", _isLaggedCount.load());
     bob.append("isLaggedTimeMicros", _isLaggedTimeMicros.load());
+    {
+        BSONObjBuilder waitLatency(bob.subobjStart("waitLatency"));
+        FlowControlTicketholder::get(opCtx)->waitLatencies().append(&waitLatency);
+    }
 
     return bob.obj();
 }
@@ -365,15 +369,17 @@ int FlowControl::getNumTickets(Date_t now) {
     // value for lag, so ignore them.
     const bool ignoreWallTimes = lastCommitted.wallTime > myLastApplied.wallTime;
 
+    const auto lagMillis = getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime);
+
     // _approximateOpsBetween will return -1 if the input timestamps are in the same "bucket".
     // This is an indication that there are very few ops between the two timestamps.
     //
     // Don't let the no-op writer on idle systems fool the sophisticated "is the replica set
     // lagged" classifier.
-    const bool isHealthy = !ignoreWallTimes &&
-        (getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime) < thresholdLagMillis ||
-         _approximateOpsBetween(lastCommitted.opTime.getTimestamp(),
-                                myLastApplied.opTime.getTimestamp()) == -1);
+    const std::int64_t opsLagged = _approximateOpsBetween(lastCommitted.opTime.getTimestamp(),
+                                                          myLastApplied.opTime.getTimestamp());
+    const bool isHealthy =
+        !ignoreWallTimes && (lagMillis < thresholdLagMillis || opsLagged == -1);
 
     if (isHealthy) {
         // The add/multiply technique is used to ensure ticket allocation can ramp up quickly,
@@ -382,6 +388,22 @@ int FlowControl::getNumTickets(Date_t now) {
                                             gFlowControlTicketAdderConstant.load(),
                                         gFlowControlTicketMultiplierConstant.load(),
                                         kMaxTickets);
+
+        // Ease off the ramp as the observed lag closes in on the threshold. Ramping at full speed
+        // right up to the threshold and then shedding tickets on the other side produces a
+        // sawtooth; scaling the increase down linearly over the top of the healthy range lets the
+        // allocation settle near its equilibrium instead of oscillating across the threshold. Idle
+        // systems (opsLagged == -1) are exempt so a stale wall clock lag cannot hold the
+        // allocation down when there is no load.
+        const double dampeningStart = gFlowControlRampDampeningStartRatio.load();
+        const double lagRatio = static_cast<double>(lagMillis) / thresholdLagMillis;
+        if (opsLagged != -1 && dampeningStart < 1.0 && lagRatio > dampeningStart) {
+            const double dampen =
+                std::min(1.0, (lagRatio - dampeningStart) / (1.0 - dampeningStart));
+            const int lastTickets = _lastTargetTicketsPermitted.load();
+            ret = lastTickets + static_cast<int>((ret - lastTickets) * (1.0 - dampen));
+        }
+
         _lastTimeSustainerAdvanced = Date_t::now();
         if (_isLagged.load()) {
             _isLagged.store(false);
@@ -391,13 +413,12 @@ int FlowControl::getNumTickets(Date_t now) {
     } else if (!ignoreWallTimes && sustainerAdvanced(_prevMemberData, _currMemberData)) {
         // Expected case where flow control has meaningful data from the last period to make a new
         // calculation.
-        ret =
-            _calculateNewTicketsForLag(_prevMemberData,
-                                       _currMemberData,
-                                       locksUsedLastPeriod,
-                                       locksPerOp,
-                                       getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime),
-                                       thresholdLagMillis);
+        ret = _calculateNewTicketsForLag(_prevMemberData,
+                                         _currMemberData,
+                                         locksUsedLastPeriod,
+                                         locksPerOp,
+                                         lagMillis,
+                                         thresholdLagMillis);
         if (!_isLagged.load()) {
             _isLagged.store(true);
             _isLaggedCount.fetchAndAddRelaxed(1);
@@ -419,9 +440,8 @@ int FlowControl::getNumTickets(Date_t now) {
                 DEBUG_LOG_LEVEL,
                 "FlowControl debug.",
                 "isLagged"_attr = (_isLagged.load() ? "true" : "false"),
-                "currlagMillis"_attr = getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime),
-                "opsLagged"_attr = _approximateOpsBetween(lastCommitted.opTime.getTimestamp(),
-                                                          myLastApplied.opTime.getTimestamp()),
+                "currlagMillis"_attr = lagMillis,
+                "opsLagged"_attr = opsLagged,
                 "granting"_attr = ret,
                 "lastGranted"_attr = _lastTargetTicketsPermitted.load(),
                 "lastSustainerApplied"_attr = _lastSustainerAppliedCount.load(),
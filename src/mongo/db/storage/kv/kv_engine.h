@@ -215,6 +215,23 @@ public:
 
     virtual void checkpoint() {}
 
+    /**
+     * Returns the number of dirty bytes currently buffered in the engine's cache that the next
+     * checkpoint would have to write, or 0 if the engine does not track this. Used by the
+     * checkpoint thread to take a checkpoint ahead of schedule when dirty data is piling up.
+     */
+    virtual int64_t getCacheDirtyBytes() const {
+        return 0;
+    }
+
+    /**
+     * Returns the configured maximum size of the engine's cache in bytes, or 0 if the engine does
+     * not have a bounded cache.
+     */
+    virtual int64_t getCacheSizeBytes() const {
+        return 0;
+    }
+
     virtual bool isDurable() const = 0;
 
     /**
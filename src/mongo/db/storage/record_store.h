@@ -473,6 +473,25 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    /**
+     * Whether this record store can act on prefetch hints. If false, callers should not spend
+     * effort collecting RecordIds to pass to prefetchRecords().
+     */
+    virtual bool supportsPrefetchHint() const {
+        return false;
+    }
+
+    /**
+     * Hints that the records identified by 'recordIds' are about to be read, so the storage
+     * engine can start bringing the backing pages into cache before the blocking reads arrive.
+     * Purely advisory: implementations may issue asynchronous reads, touch pages, or do nothing,
+     * and must not change any visible state. RecordIds that no longer exist are ignored.
+     *
+     * Only called if supportsPrefetchHint() returns true.
+     */
+    virtual void prefetchRecords(OperationContext* opCtx,
+                                 const std::vector<RecordId>& recordIds) const {}
+
     /**
      * Performs record store specific validation to ensure consistency of underlying data
      * structures. If corruption is found, details of the errors will be in the results parameter.
@@ -30,6 +30,7 @@
 #include <boost/optional/optional.hpp>
 #include <boost/optional/optional_io.hpp>
 #include <memory>
+#include <vector>
 
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
@@ -276,6 +277,32 @@ public:
         virtual boost::optional<IndexKeyEntry> next(RequestedInfo parts = kKeyAndLoc) = 0;
         virtual boost::optional<KeyStringEntry> nextKeyString() = 0;
 
+        /**
+         * Moves forward up to 'maxEntries' times, appending each entry to 'out'. Returns the
+         * number of entries appended; fewer than requested means the cursor was exhausted (or
+         * unpositioned). Appended keys are owned, so they remain valid while the caller drains
+         * the batch and the cursor advances.
+         *
+         * This default implementation just loops over next(). Implementations are encouraged to
+         * override it so range scans pay the per-call overhead once per batch rather than once
+         * per entry.
+         */
+        virtual size_t nextBatch(size_t maxEntries,
+                                 std::vector<IndexKeyEntry>* out,
+                                 RequestedInfo parts = kKeyAndLoc) {
+            size_t numAppended = 0;
+            while (numAppended < maxEntries) {
+                auto entry = next(parts);
+                if (!entry)
+                    break;
+                if (!entry->key.isOwned())
+                    entry->key = entry->key.getOwned();
+                out->push_back(std::move(*entry));
+                ++numAppended;
+            }
+            return numAppended;
+        }
+
         //
         // Seeking
         //
@@ -53,7 +53,9 @@
 #include "mongo/logv2/log.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 
@@ -70,6 +72,11 @@ MONGO_FAIL_POINT_DEFINE(failToParseResumeIndexInfo);
 namespace {
 const std::string catalogInfo = "_mdb_catalog";
 const auto kCatalogLogLevel = logv2::LogSeverity::Debug(2);
+
+// Cap on the number of threads used to initialize collections when loading a large catalog. The
+// per-collection work is a mix of reads from the durable catalog and storage engine metadata
+// operations; beyond this the threads contend rather than scale.
+const size_t kMaxCatalogLoadThreads = 16;
 }  // namespace
 
 StorageEngineImpl::StorageEngineImpl(OperationContext* opCtx,
@@ -235,6 +242,11 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx, LastShutdownState l
         }
     }
 
+    // Collect the entries to initialize first; the expensive per-collection work is deferred so
+    // that large catalogs can be initialized in parallel below.
+    std::vector<std::pair<DurableCatalog::Entry, Timestamp>> collectionsToInit;
+    collectionsToInit.reserve(catalogEntries.size());
+
     for (DurableCatalog::Entry entry : catalogEntries) {
         if (loadingFromUncleanShutdownOrRepair) {
             // If we are loading the catalog after an unclean shutdown or during repair, it's
@@ -289,7 +301,7 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx, LastShutdownState l
             }
         }
 
-        _initCollection(opCtx, entry.catalogId, entry.nss, _options.forRepair, minVisibleTs);
+        collectionsToInit.emplace_back(entry, minVisibleTs);
 
         if (entry.nss.isOrphanCollection()) {
             LOGV2(22248,
@@ -299,6 +311,31 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx, LastShutdownState l
         }
     }
 
+    // Initializing a collection reads its metadata out of the durable catalog and opens its table
+    // in the storage engine, both of which are independent between entries, so large catalogs are
+    // loaded across a thread pool. The oplog is always initialized on this thread because opening
+    // it starts the oplog visibility manager. Repair keeps the serial path: it interleaves
+    // catalog modifications with collection initialization.
+    const size_t kMinCollectionsForParallelLoad = 100;
+    if (!_options.forRepair && collectionsToInit.size() >= kMinCollectionsForParallelLoad) {
+        std::vector<std::pair<DurableCatalog::Entry, Timestamp>> parallelEntries;
+        parallelEntries.reserve(collectionsToInit.size());
+        for (auto&& toInit : collectionsToInit) {
+            if (toInit.first.nss.isOplog()) {
+                _initCollection(
+                    opCtx, toInit.first.catalogId, toInit.first.nss, false, toInit.second);
+            } else {
+                parallelEntries.push_back(toInit);
+            }
+        }
+        _initCollectionsParallel(opCtx, parallelEntries);
+    } else {
+        for (auto&& toInit : collectionsToInit) {
+            _initCollection(
+                opCtx, toInit.first.catalogId, toInit.first.nss, _options.forRepair, toInit.second);
+        }
+    }
+
     opCtx->recoveryUnit()->abandonSnapshot();
 }
 
@@ -307,6 +344,19 @@ void StorageEngineImpl::_initCollection(OperationContext* opCtx,
                                         const NamespaceString& nss,
                                         bool forRepair,
                                         Timestamp minVisibleTs) {
+    auto collection = _makeCollection(opCtx, catalogId, nss, forRepair, minVisibleTs);
+    const auto uuid = collection->uuid();
+
+    CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
+        catalog.registerCollection(opCtx, uuid, std::move(collection));
+    });
+}
+
+std::shared_ptr<Collection> StorageEngineImpl::_makeCollection(OperationContext* opCtx,
+                                                               RecordId catalogId,
+                                                               const NamespaceString& nss,
+                                                               bool forRepair,
+                                                               Timestamp minVisibleTs) {
     auto md = _catalog->getMetaData(opCtx, catalogId);
     uassert(ErrorCodes::MustDowngrade,
             str::stream() << "Collection does not have UUID in KVCatalog. Collection: " << nss,
@@ -327,9 +377,78 @@ void StorageEngineImpl::_initCollection(OperationContext* opCtx,
     auto collectionFactory = Collection::Factory::get(getGlobalServiceContext());
     auto collection = collectionFactory->make(opCtx, nss, catalogId, md, std::move(rs));
     collection->setMinimumVisibleSnapshot(minVisibleTs);
+    return collection;
+}
 
+void StorageEngineImpl::_initCollectionsParallel(
+    OperationContext* opCtx,
+    const std::vector<std::pair<DurableCatalog::Entry, Timestamp>>& entries) {
+    // Each worker fills its own slots of 'collections', so no synchronization is needed on the
+    // vector itself; the pool join below publishes the results to this thread.
+    std::vector<std::shared_ptr<Collection>> collections(entries.size());
+
+    AtomicWord<bool> failed{false};
+    auto errorMutex = MONGO_MAKE_LATCH("StorageEngineImpl::_initCollectionsParallel::errorMutex");
+    Status firstError = Status::OK();
+
+    ThreadPool::Options threadPoolOptions;
+    threadPoolOptions.poolName = "StorageEngineCatalogLoad";
+    threadPoolOptions.maxThreads = std::max<size_t>(
+        1, std::min<size_t>(ProcessInfo::getNumAvailableCores(), kMaxCatalogLoadThreads));
+    threadPoolOptions.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName.c_str());
+    };
+    ThreadPool pool(threadPoolOptions);
+    pool.startup();
+
+    const size_t numChunks = threadPoolOptions.maxThreads;
+    const size_t chunkSize = (entries.size() + numChunks - 1) / numChunks;
+    for (size_t chunkBegin = 0; chunkBegin < entries.size(); chunkBegin += chunkSize) {
+        const size_t chunkEnd = std::min(chunkBegin + chunkSize, entries.size());
+        pool.schedule([&, chunkBegin, chunkEnd](Status scheduleStatus) {
+            invariant(scheduleStatus);
+
+            auto workerOpCtx = cc().makeOperationContext();
+            // At initial construction time the storage engine has not been registered with the
+            // service context yet, so the operation context is created with a no-op recovery
+            // unit (see the constructor). Give the worker a real one.
+            workerOpCtx->setRecoveryUnit(std::unique_ptr<RecoveryUnit>(_engine->newRecoveryUnit()),
+                                         WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
+
+            for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                if (failed.load()) {
+                    return;
+                }
+                try {
+                    collections[i] = _makeCollection(workerOpCtx.get(),
+                                                     entries[i].first.catalogId,
+                                                     entries[i].first.nss,
+                                                     /*forRepair=*/false,
+                                                     entries[i].second);
+                } catch (...) {
+                    stdx::lock_guard<Latch> lk(errorMutex);
+                    if (firstError.isOK()) {
+                        firstError = exceptionToStatus();
+                    }
+                    failed.store(true);
+                    return;
+                }
+            }
+        });
+    }
+
+    pool.waitForIdle();
+    pool.shutdown();
+    pool.join();
+    uassertStatusOK(firstError);
+
+    // Register all collections in a single catalog write. The caller holds the global exclusive
+    // lock, so the write is applied to the active catalog in place rather than copying it.
     CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
-        catalog.registerCollection(opCtx, md->options.uuid.get(), std::move(collection));
+        for (auto&& collection : collections) {
+            const auto uuid = collection->uuid();
+            catalog.registerCollection(opCtx, uuid, std::move(collection));
+        }
     });
 }
 
@@ -50,6 +50,7 @@
 
 namespace mongo {
 
+class Collection;
 class DurableCatalogImpl;
 class KVEngine;
 
@@ -367,6 +368,28 @@ private:
                          bool forRepair,
                          Timestamp minVisibleTs);
 
+    /**
+     * Performs the per-collection portion of _initCollection() that is independent between
+     * catalog entries: reading the durable catalog metadata, opening the underlying record store
+     * and constructing the in-memory Collection. The returned collection still needs to be
+     * registered with the CollectionCatalog.
+     */
+    std::shared_ptr<Collection> _makeCollection(OperationContext* opCtx,
+                                                RecordId catalogId,
+                                                const NamespaceString& nss,
+                                                bool forRepair,
+                                                Timestamp minVisibleTs);
+
+    /**
+     * Initializes the given catalog entries across a temporary thread pool, each worker using its
+     * own operation context, then registers the resulting collections with the CollectionCatalog
+     * on the calling thread under the global exclusive lock. Entries must not include the oplog,
+     * which starts the oplog visibility manager when opened and is initialized by the caller.
+     */
+    void _initCollectionsParallel(
+        OperationContext* opCtx,
+        const std::vector<std::pair<DurableCatalog::Entry, Timestamp>>& entries);
+
     Status _dropCollectionsNoTimestamp(OperationContext* opCtx, const std::vector<UUID>& toDrop);
 
     /**
@@ -50,29 +50,39 @@ WiredTigerBeginTxnBlock::WiredTigerBeginTxnBlock(
     : _session(session) {
     invariant(!_rollback);
 
-    str::stream builder;
+    // The option set is small and fixed, so compose the configuration from string literals into a
+    // stack buffer instead of materializing a std::string for every transaction. Most transactions
+    // take no options at all and pass a null configuration without any string handling.
+    fmt::memory_buffer builder;
+    auto append = [&builder](StringData piece) {
+        builder.append(piece.rawData(), piece.rawData() + piece.size());
+    };
     if (prepareConflictBehavior == PrepareConflictBehavior::kIgnoreConflicts) {
-        builder << "ignore_prepare=true,";
+        append("ignore_prepare=true,");
     } else if (prepareConflictBehavior == PrepareConflictBehavior::kIgnoreConflictsAllowWrites) {
-        builder << "ignore_prepare=force,";
+        append("ignore_prepare=force,");
     }
     if (roundUpPreparedTimestamps == RoundUpPreparedTimestamps::kRound ||
         roundUpReadTimestamp == RoundUpReadTimestamp::kRound) {
-        builder << "roundup_timestamps=(";
+        append("roundup_timestamps=(");
         if (roundUpPreparedTimestamps == RoundUpPreparedTimestamps::kRound) {
-            builder << "prepared=true,";
+            append("prepared=true,");
         }
         if (roundUpReadTimestamp == RoundUpReadTimestamp::kRound) {
-            builder << "read=true";
+            append("read=true");
         }
-        builder << "),";
+        append("),");
     }
     if (roundUpReadTimestamp == RoundUpReadTimestamp::kNoRoundForce) {
-        builder << "read_before_oldest=true,";
+        append("read_before_oldest=true,");
     }
 
-    const std::string beginTxnConfigString = builder;
-    invariantWTOK(_session->begin_transaction(_session, beginTxnConfigString.c_str()));
+    const char* config = nullptr;
+    if (builder.size() > 0) {
+        builder.push_back('\0');
+        config = builder.data();
+    }
+    invariantWTOK(_session->begin_transaction(_session, config));
     _rollback = true;
 }
 
@@ -91,9 +101,12 @@ WiredTigerBeginTxnBlock::~WiredTigerBeginTxnBlock() {
 
 Status WiredTigerBeginTxnBlock::setReadSnapshot(Timestamp readTimestamp) {
     invariant(_rollback);
-    std::string readTSConfigString = "read_timestamp={:x}"_format(readTimestamp.asULL());
+    // 'read_timestamp=' plus a 16 hex digit timestamp fits in the buffer's inline storage.
+    fmt::memory_buffer readTSConfig;
+    fmt::format_to(readTSConfig, FMT_STRING("read_timestamp={:x}"), readTimestamp.asULL());
+    readTSConfig.push_back('\0');
 
-    return wtRCToStatus(_session->timestamp_transaction(_session, readTSConfigString.c_str()));
+    return wtRCToStatus(_session->timestamp_transaction(_session, readTSConfig.data()));
 }
 
 void WiredTigerBeginTxnBlock::done() {
@@ -555,7 +555,9 @@ public:
     BulkBuilder(WiredTigerIndex* idx, OperationContext* opCtx)
         : _ordering(idx->_ordering),
           _opCtx(opCtx),
-          _session(WiredTigerRecoveryUnit::get(_opCtx)->getSessionCache()->getSession()),
+          _metrics(ResourceConsumption::MetricsCollector::get(opCtx)),
+          _ru(WiredTigerRecoveryUnit::get(_opCtx)),
+          _session(_ru->getSessionCache()->getSession()),
           _cursor(openBulkCursor(idx)) {}
 
     ~BulkBuilder() {
@@ -563,6 +565,16 @@ public:
     }
 
 protected:
+    /**
+     * Inserts the key/value staged on the bulk cursor. Same as wiredTigerCursorInsert(), but
+     * resolves the recovery unit once per bulk build rather than once per key.
+     */
+    void insertStagedKey(size_t keySize) {
+        invariantWTOK(_cursor->insert(_cursor));
+        _ru->setTxnModified();
+        _metrics.incrementOneIdxEntryWritten(keySize);
+    }
+
     WT_CURSOR* openBulkCursor(WiredTigerIndex* idx) {
         // Open cursors can cause bulk open_cursor to fail with EBUSY.
         // TODO any other cases that could cause EBUSY?
@@ -598,6 +610,10 @@ protected:
 
     const Ordering _ordering;
     OperationContext* const _opCtx;
+    // Resolved once up front; addKey() runs once per key over billions of keys, and the
+    // per-call decoration lookups showed up next to the actual cursor insert.
+    ResourceConsumption::MetricsCollector& _metrics;
+    WiredTigerRecoveryUnit* const _ru;
     UniqueWiredTigerSession const _session;
     WT_CURSOR* const _cursor;
 };
@@ -625,10 +641,7 @@ public:
 
         _cursor->set_value(_cursor, valueItem.Get());
 
-        invariantWTOK(wiredTigerCursorInsert(_opCtx, _cursor));
-
-        auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
-        metricsCollector.incrementOneIdxEntryWritten(item.size);
+        insertStagedKey(item.size);
 
         return Status::OK();
     }
@@ -691,10 +704,7 @@ public:
 
         _cursor->set_value(_cursor, valueItem.Get());
 
-        invariantWTOK(wiredTigerCursorInsert(_opCtx, _cursor));
-
-        auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
-        metricsCollector.incrementOneIdxEntryWritten(keyItem.size);
+        insertStagedKey(keyItem.size);
 
         // Don't copy the key again if dups are allowed.
         if (!_dupsAllowed)
@@ -743,10 +753,7 @@ public:
         setKey(_cursor, keyItem.Get());
         _cursor->set_value(_cursor, valueItem.Get());
 
-        invariantWTOK(wiredTigerCursorInsert(_opCtx, _cursor));
-
-        auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
-        metricsCollector.incrementOneIdxEntryWritten(keyItem.size);
+        insertStagedKey(keyItem.size);
 
         _previousKeyString.resetFromBuffer(newKeyString.getBuffer(), newKeyString.getSize());
         return Status::OK();
@@ -799,6 +806,26 @@ public:
         return getKeyStringEntry();
     }
 
+    size_t nextBatch(size_t maxEntries,
+                     std::vector<IndexKeyEntry>* out,
+                     RequestedInfo parts = kKeyAndLoc) override {
+        // Same loop as repeated next() calls, but one virtual dispatch per batch and no
+        // per-entry re-entry from the execution layer.
+        size_t numAppended = 0;
+        while (numAppended < maxEntries) {
+            if (!advanceNext())
+                break;
+            auto entry = curr(parts);
+            if (!entry)
+                break;
+            if (!entry->key.isOwned())
+                entry->key = entry->key.getOwned();
+            out->push_back(std::move(*entry));
+            ++numAppended;
+        }
+        return numAppended;
+    }
+
     void setEndPosition(const BSONObj& key, bool inclusive) override {
         LOGV2_TRACE_CURSOR(20098,
                            "setEndPosition inclusive: {inclusive} {key}",
@@ -981,8 +1008,16 @@ protected:
 
         BSONObj bson;
         if (TRACING_ENABLED || (parts & kWantKey)) {
-            bson =
-                KeyString::toBson(_key.getBuffer(), _key.getSize(), _idx.getOrdering(), _typeBits);
+            // Consecutive entries in an index scan almost always decode to the same BSON size, so
+            // size the builder off the previous key. This avoids both the default allocation being
+            // oversized for small keys and a mid-decode regrowth for large ones.
+            BSONObjBuilder builder(_lastDecodedKeySizeBytes
+                                       ? _lastDecodedKeySizeBytes
+                                       : static_cast<int>(BufBuilder::kDefaultInitSizeBytes));
+            KeyString::toBsonSafe(
+                _key.getBuffer(), _key.getSize(), _idx.getOrdering(), _typeBits, builder);
+            bson = builder.obj();
+            _lastDecodedKeySizeBytes = bson.objsize();
 
             LOGV2_TRACE_CURSOR(20000, "returning {bson} {id}", "bson"_attr = bson, "id"_attr = _id);
         }
@@ -1223,6 +1258,10 @@ protected:
     RecordId _id;
     bool _eof = true;
 
+    // Size of the BSON produced by the most recent key decode in curr(). Used to presize the
+    // builder for the next decode; mutable because curr() is const but caches this as it goes.
+    mutable int _lastDecodedKeySizeBytes = 0;
+
     // This differs from _eof in that it always reflects the result of the most recent call to
     // reposition _cursor.
     bool _cursorAtEof = false;
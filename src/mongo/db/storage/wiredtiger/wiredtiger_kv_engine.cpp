@@ -91,6 +91,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/background.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
+#include "mongo/util/concurrency/throughput_probing.h"
 #include "mongo/util/concurrency/ticketholder.h"
 #include "mongo/util/debug_util.h"
 #include "mongo/util/exit.h"
@@ -244,6 +245,65 @@ private:
     stdx::condition_variable _condvar;
 };
 
+class WiredTigerKVEngine::WiredTigerTicketProber : public BackgroundJob {
+public:
+    WiredTigerTicketProber(TicketHolder* readTicketHolder,
+                           TicketHolder* writeTicketHolder,
+                           Milliseconds interval)
+        : BackgroundJob(false /* deleteSelf */),
+          _interval(interval),
+          _probing(readTicketHolder, writeTicketHolder, ThroughputProbing::Options{}) {}
+
+    virtual string name() const {
+        return "WTTicketProber";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOGV2_DEBUG(6174803, 1, "starting {name} thread", "name"_attr = name());
+
+        auto lastRun = Date_t::now();
+        while (!_shuttingDown.load()) {
+            {
+                stdx::unique_lock<Latch> lock(_mutex);
+                MONGO_IDLE_THREAD_BLOCK;
+                _condvar.wait_for(lock, _interval.toSystemDuration());
+            }
+            if (_shuttingDown.load()) {
+                break;
+            }
+
+            // Measure the actual elapsed time rather than assuming the configured interval;
+            // the wait can be cut short or overshoot under load.
+            auto now = Date_t::now();
+            _probing.run(now - lastRun);
+            lastRun = now;
+        }
+        LOGV2_DEBUG(6174804, 1, "stopping {name} thread", "name"_attr = name());
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        {
+            stdx::unique_lock<Latch> lock(_mutex);
+            // Wake up the ticket prober thread early, we do not want the shutdown
+            // to wait for us too long.
+            _condvar.notify_one();
+        }
+        wait();
+    }
+
+private:
+    const Milliseconds _interval;
+    ThroughputProbing _probing;
+    AtomicWord<bool> _shuttingDown{false};
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerTicketProber::_mutex");  // protects _condvar
+    // The ticket prober thread idles on this condition variable between probing rounds. It can
+    // be triggered early to expediate shutdown.
+    stdx::condition_variable _condvar;
+};
+
 std::string toString(const StorageEngine::OldestActiveTransactionTimestampResult& r) {
     if (r.isOK()) {
         if (r.getValue()) {
@@ -516,6 +576,12 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
     _sessionSweeper = std::make_unique<WiredTigerSessionSweeper>(_sessionCache.get());
     _sessionSweeper->go();
 
+    if (auto probingIntervalMS = gWiredTigerAdaptiveConcurrencyProbingIntervalMS; probingIntervalMS > 0) {
+        _ticketProber = std::make_unique<WiredTigerTicketProber>(
+            &openReadTransaction, &openWriteTransaction, Milliseconds(probingIntervalMS));
+        _ticketProber->go();
+    }
+
     // Until the Replication layer installs a real callback, prevent truncating the oplog.
     setOldestActiveTransactionTimestampCallback(
         [](Timestamp) { return StatusWith(boost::make_optional(Timestamp::min())); });
@@ -604,6 +670,10 @@ void WiredTigerKVEngine::appendGlobalStats(BSONObjBuilder& b) {
         bbb.append("out", openWriteTransaction.used());
         bbb.append("available", openWriteTransaction.available());
         bbb.append("totalTickets", openWriteTransaction.outof());
+        {
+            BSONObjBuilder latency(bbb.subobjStart("waitLatency"));
+            openWriteTransaction.waitLatencies().append(&latency);
+        }
         bbb.done();
     }
     {
@@ -611,6 +681,10 @@ void WiredTigerKVEngine::appendGlobalStats(BSONObjBuilder& b) {
         bbb.append("out", openReadTransaction.used());
         bbb.append("available", openReadTransaction.available());
         bbb.append("totalTickets", openReadTransaction.outof());
+        {
+            BSONObjBuilder latency(bbb.subobjStart("waitLatency"));
+            openReadTransaction.waitLatencies().append(&latency);
+        }
         bbb.done();
     }
     bb.done();
@@ -723,6 +797,11 @@ void WiredTigerKVEngine::cleanShutdown() {
         _sessionSweeper->shutdown();
         LOGV2(22319, "Finished shutting down session sweeper thread");
     }
+    if (_ticketProber) {
+        LOGV2(6174805, "Shutting down ticket prober thread");
+        _ticketProber->shutdown();
+        LOGV2(6174806, "Finished shutting down ticket prober thread");
+    }
     LOGV2_FOR_RECOVERY(23988,
                        2,
                        "Shutdown timestamps.",
@@ -1871,6 +1950,22 @@ void WiredTigerKVEngine::checkpoint() {
     }
 }
 
+int64_t WiredTigerKVEngine::getCacheDirtyBytes() const {
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+    auto result = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    // This is scheduling advice, not an invariant of the system; treat a failed read as "no dirty
+    // data" rather than surfacing an error to the checkpoint thread.
+    return result.isOK() ? result.getValue() : 0;
+}
+
+int64_t WiredTigerKVEngine::getCacheSizeBytes() const {
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+    auto result = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_MAX);
+    return result.isOK() ? result.getValue() : 0;
+}
+
 bool WiredTigerKVEngine::hasIdent(OperationContext* opCtx, StringData ident) const {
     return _hasUri(WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession(), _uri(ident));
 }
@@ -2130,24 +2225,25 @@ void WiredTigerKVEngine::setOldestTimestamp(Timestamp newOldestTimestamp, bool f
 }
 
 Timestamp WiredTigerKVEngine::_calculateHistoryLagFromStableTimestamp(Timestamp stableTimestamp) {
-    // The oldest_timestamp should lag behind the stable_timestamp by
-    // 'minSnapshotHistoryWindowInSeconds' seconds.
+    // The oldest_timestamp should lag behind the stable_timestamp by the current snapshot
+    // history window, which tracks 'minSnapshotHistoryWindowInSeconds' but shrinks while the
+    // cache is under pressure.
 
     if (_ephemeral && !TestingProctor::instance().isEnabled()) {
         // No history should be maintained for the inMemory engine because it is not used yet.
         invariant(minSnapshotHistoryWindowInSeconds.load() == 0);
     }
 
-    if (stableTimestamp.getSecs() <
-        static_cast<unsigned>(minSnapshotHistoryWindowInSeconds.load())) {
+    const int historyWindowSeconds = _getSnapshotHistoryWindow();
+
+    if (stableTimestamp.getSecs() < static_cast<unsigned>(historyWindowSeconds)) {
         // The history window is larger than the timestamp history thus far. We must wait for
         // the history to reach the window size before moving oldest_timestamp forward. This should
         // only happen in unit tests.
         return Timestamp();
     }
 
-    Timestamp calculatedOldestTimestamp(stableTimestamp.getSecs() -
-                                            minSnapshotHistoryWindowInSeconds.load(),
+    Timestamp calculatedOldestTimestamp(stableTimestamp.getSecs() - historyWindowSeconds,
                                         stableTimestamp.getInc());
 
     if (calculatedOldestTimestamp.asULL() <= _oldestTimestamp.load()) {
@@ -2164,6 +2260,79 @@ Timestamp WiredTigerKVEngine::_calculateHistoryLagFromStableTimestamp(Timestamp
     return calculatedOldestTimestamp;
 }
 
+int WiredTigerKVEngine::_getSnapshotHistoryWindow() {
+    // How often cache pressure is sampled; stable timestamp advances (and therefore calls here)
+    // can be as frequent as every replicated write batch.
+    static constexpr Seconds kCachePressureCheckInterval{5};
+
+    // Matches the multiplicative decrease upstream eviction backoff schemes use: aggressive
+    // enough to relieve pressure within a few sampling periods, gentle enough not to discard the
+    // whole window on a transient spike.
+    static constexpr double kSnapshotWindowMultiplicativeDecrease = 0.75;
+
+    const int configuredWindow = minSnapshotHistoryWindowInSeconds.load();
+    int currentWindow = _snapshotHistoryWindow.load();
+    if (currentWindow < 0 || currentWindow > configuredWindow) {
+        // First call, or the operator lowered the configured window at runtime.
+        currentWindow = configuredWindow;
+        _snapshotHistoryWindow.store(currentWindow);
+    }
+
+    const auto now = _clockSource->now().toMillisSinceEpoch();
+    auto lastCheck = _lastCachePressureCheck.load();
+    if (now - lastCheck < durationCount<Milliseconds>(kCachePressureCheckInterval) ||
+        !_lastCachePressureCheck.compareAndSwap(&lastCheck, now)) {
+        // Not yet time to re-sample, or a concurrent caller won the race to do so.
+        return currentWindow;
+    }
+
+    int newWindow = currentWindow;
+    if (_isCacheUnderPressure()) {
+        newWindow = static_cast<int>(currentWindow * kSnapshotWindowMultiplicativeDecrease);
+    } else if (currentWindow < configuredWindow) {
+        newWindow = std::min(configuredWindow,
+                             currentWindow + snapshotWindowAdditiveIncreaseSeconds.load());
+    }
+
+    if (newWindow != currentWindow) {
+        _snapshotHistoryWindow.store(newWindow);
+        LOGV2_DEBUG(6174818,
+                    1,
+                    "Adjusted snapshot history window for cache pressure",
+                    "previousWindowSeconds"_attr = currentWindow,
+                    "newWindowSeconds"_attr = newWindow,
+                    "configuredWindowSeconds"_attr = configuredWindow);
+    }
+
+    return newWindow;
+}
+
+bool WiredTigerKVEngine::_isCacheUnderPressure() const {
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+
+    // The history store score is WiredTiger's own 0-100 measure of how much the history store
+    // (where snapshot history lives) is contributing to cache pressure.
+    auto hsScore = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_HS_SCORE);
+    if (hsScore.isOK() && hsScore.getValue() >= snapshotHistoryCachePressureThreshold.load()) {
+        return true;
+    }
+
+    // Dirty fill at or beyond WiredTiger's default eviction_dirty_trigger (20% of cache) means
+    // application threads are about to be drafted into eviction.
+    static constexpr int64_t kDirtyTriggerPercent = 20;
+    auto dirtyBytes = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    auto maxBytes = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_MAX);
+    if (dirtyBytes.isOK() && maxBytes.isOK() && maxBytes.getValue() > 0) {
+        return dirtyBytes.getValue() * 100 >= maxBytes.getValue() * kDirtyTriggerPercent;
+    }
+
+    // Stats reads are advisory; treat a failed read as "no pressure".
+    return false;
+}
+
 void WiredTigerKVEngine::setInitialDataTimestamp(Timestamp initialDataTimestamp) {
     LOGV2_DEBUG(22344,
                 2,
@@ -113,6 +113,10 @@ public:
 
     void checkpoint() override;
 
+    int64_t getCacheDirtyBytes() const override;
+
+    int64_t getCacheSizeBytes() const override;
+
     bool isDurable() const override {
         return _durable;
     }
@@ -362,6 +366,7 @@ public:
 
 private:
     class WiredTigerSessionSweeper;
+    class WiredTigerTicketProber;
 
     struct IdentToDrop {
         std::string uri;
@@ -403,6 +408,23 @@ private:
      */
     Timestamp _calculateHistoryLagFromStableTimestamp(Timestamp stableTimestamp);
 
+    /**
+     * Returns the snapshot history window, in seconds, that the oldest timestamp should lag
+     * behind the stable timestamp by. The window shrinks multiplicatively while the WiredTiger
+     * cache is under pressure and grows additively back toward
+     * 'minSnapshotHistoryWindowInSeconds' otherwise, so that long snapshot history cannot pin
+     * enough cache to stall eviction. Cache pressure is sampled at most once per few seconds;
+     * between samples the last computed window is returned.
+     */
+    int _getSnapshotHistoryWindow();
+
+    /**
+     * Returns true if retaining snapshot history is likely to cause eviction stalls: either the
+     * history store fullness score has reached 'snapshotHistoryCachePressureThreshold' or the
+     * dirty cache fill has reached WiredTiger's aggressive eviction trigger.
+     */
+    bool _isCacheUnderPressure() const;
+
     /**
      * Checks whether rollback to a timestamp can occur, enforcing a contract of use between the
      * storage engine and replication.
@@ -455,6 +477,7 @@ private:
     const bool _keepDataHistory = true;
 
     std::unique_ptr<WiredTigerSessionSweeper> _sessionSweeper;
+    std::unique_ptr<WiredTigerTicketProber> _ticketProber;
 
     std::string _rsOptions;
     std::string _indexOptions;
@@ -476,6 +499,15 @@ private:
     AtomicWord<std::uint64_t> _oldestTimestamp;
     AtomicWord<std::uint64_t> _stableTimestamp;
 
+    // Current snapshot history window in seconds, adjusted by _getSnapshotHistoryWindow()
+    // between zero and 'minSnapshotHistoryWindowInSeconds' based on cache pressure. -1 until
+    // first computed.
+    AtomicWord<int> _snapshotHistoryWindow{-1};
+
+    // When cache pressure was last sampled by _getSnapshotHistoryWindow(), in milliseconds since
+    // epoch.
+    AtomicWord<long long> _lastCachePressureCheck{0};
+
     // Timestamp of data at startup. Used internally to advise checkpointing and recovery to a
     // timestamp. Provided by replication layer because WT does not persist timestamps.
     AtomicWord<std::uint64_t> _initialDataTimestamp;
@@ -40,10 +40,13 @@
 
 #include <memory>
 
+#include <iterator>
+
 #include "mongo/base/checked_cast.h"
 #include "mongo/base/static_assert.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/catalog/validate_results.h"
+#include "mongo/db/client.h"
 #include "mongo/db/concurrency/locker.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/global_settings.h"
@@ -66,6 +69,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
 #include "mongo/logv2/log.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/fail_point.h"
@@ -107,6 +111,13 @@ MONGO_STATIC_ASSERT(kCurrentRecordStoreVersion <= kMaximumRecordStoreVersion);
 
 const double kNumMSInHour = 1000 * 60 * 60;
 
+// Maximum number of threads drawing random samples during oplog stone calculation at startup.
+const int64_t kOplogSamplingThreads = 4;
+
+// Minimum number of samples each additional sampling thread must be worth; small oplogs are
+// sampled on the startup thread alone rather than paying the thread spawn overhead.
+const int64_t kMinSamplesPerSamplingThread = 1000;
+
 void checkOplogFormatVersion(OperationContext* opCtx, const std::string& uri) {
     StatusWith<BSONObj> appMetadata = WiredTigerUtil::getApplicationMetadata(opCtx, uri);
     fassert(39999, appMetadata);
@@ -556,36 +567,96 @@ void WiredTigerRecordStore::OplogStones::_calculateStonesBySampling(OperationCon
     // approximately 'estRecordsPerStone'. Do so by oversampling the oplog, sorting the samples in
     // order of their RecordId, and then choosing the samples expected to be near the right edge of
     // each logical section.
-    auto cursor = _rs->getRandomCursor(opCtx);
-    std::vector<RecordIdAndWall> oplogEstimates;
-    auto lastProgressLog = Date_t::now();
-    for (int i = 0; i < numSamples; ++i) {
-        auto samplingLogIntervalSeconds = gOplogSamplingLogIntervalSeconds.load();
-        slowOplogSamplingReads.execute(
-            [&](const BSONObj& dataObj) { sleepsecs(dataObj["delay"].numberInt()); });
-        auto record = cursor->next();
-        if (!record) {
-            // This shouldn't really happen unless the size storer values are far off from reality.
-            // The collection is probably empty, but fall back to scanning the oplog just in case.
-            LOGV2(22391, "Failed to get enough random samples, falling back to scanning the oplog");
-            _calculateStonesByScanning(opCtx);
-            return;
-        }
+    //
+    // The samples are drawn in parallel: each worker pulls an equal share of the samples through
+    // its own random cursor on its own session. WiredTiger random cursors cannot be bounded to a
+    // RecordId range, but pooling samples from independent cursors over the whole oplog yields the
+    // same distribution as drawing them all from one cursor, and the workers' reads overlap.
+    size_t numWorkers = 1;
+    if (_rs->_kvEngine) {
+        numWorkers = std::max<int64_t>(
+            1,
+            std::min<int64_t>(kOplogSamplingThreads, numSamples / kMinSamplesPerSamplingThread));
+    }
+
+    std::vector<std::vector<RecordIdAndWall>> workerSamples(numWorkers);
+    AtomicWord<long long> samplesTaken{0};
+    AtomicWord<bool> samplingFailed{false};
+
+    const auto drawSamples = [&](OperationContext* workerOpCtx, size_t workerId, int64_t count) {
+        auto cursor = _rs->getRandomCursor(workerOpCtx);
+        auto& samples = workerSamples[workerId];
+        samples.reserve(count);
+        auto lastProgressLog = Date_t::now();
+        for (int64_t i = 0; i < count && !samplingFailed.load(); ++i) {
+            auto samplingLogIntervalSeconds = gOplogSamplingLogIntervalSeconds.load();
+            slowOplogSamplingReads.execute(
+                [&](const BSONObj& dataObj) { sleepsecs(dataObj["delay"].numberInt()); });
+            auto record = cursor->next();
+            if (!record) {
+                // This shouldn't really happen unless the size storer values are far off from
+                // reality. The collection is probably empty, but fall back to scanning the oplog
+                // just in case.
+                samplingFailed.store(true);
+                return;
+            }
 
-        BSONObj obj = record->data.toBson();
-        oplogEstimates.emplace_back(
-            record->id, obj.hasField("wall") ? obj["wall"].Date() : obj["ts"].timestampTime());
-
-        const auto now = Date_t::now();
-        if (samplingLogIntervalSeconds > 0 &&
-            now - lastProgressLog >= Seconds(samplingLogIntervalSeconds)) {
-            LOGV2(22392,
-                  "Oplog sampling progress: {current} of {total} samples taken",
-                  "Oplog sampling progress",
-                  "completed"_attr = (i + 1),
-                  "total"_attr = numSamples);
-            lastProgressLog = now;
+            BSONObj obj = record->data.toBson();
+            samples.emplace_back(
+                record->id, obj.hasField("wall") ? obj["wall"].Date() : obj["ts"].timestampTime());
+            samplesTaken.fetchAndAdd(1);
+
+            const auto now = Date_t::now();
+            if (workerId == 0 && samplingLogIntervalSeconds > 0 &&
+                now - lastProgressLog >= Seconds(samplingLogIntervalSeconds)) {
+                LOGV2(22392,
+                      "Oplog sampling progress: {current} of {total} samples taken",
+                      "Oplog sampling progress",
+                      "completed"_attr = samplesTaken.load(),
+                      "total"_attr = numSamples);
+                lastProgressLog = now;
+            }
         }
+    };
+
+    const int64_t samplesPerWorker = numSamples / numWorkers;
+    std::vector<stdx::thread> workers;
+    for (size_t workerId = 1; workerId < numWorkers; ++workerId) {
+        workers.emplace_back([&, workerId] {
+            Client::initThread("OplogStoneSampler");
+            try {
+                auto workerOpCtx = cc().makeOperationContext();
+                workerOpCtx->setRecoveryUnit(
+                    std::unique_ptr<RecoveryUnit>(_rs->_kvEngine->newRecoveryUnit()),
+                    WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
+                drawSamples(workerOpCtx.get(), workerId, samplesPerWorker);
+            } catch (const DBException& ex) {
+                // An exception on a worker is not fatal; the startup thread falls back to
+                // scanning the oplog below.
+                LOGV2_WARNING(5958104,
+                              "Oplog sampling worker failed",
+                              "error"_attr = redact(ex.toStatus()));
+                samplingFailed.store(true);
+            }
+        });
+    }
+
+    // This thread draws its own share, plus any remainder from the integer division.
+    drawSamples(opCtx, 0, samplesPerWorker + numSamples % numWorkers);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (samplingFailed.load()) {
+        LOGV2(22391, "Failed to get enough random samples, falling back to scanning the oplog");
+        _calculateStonesByScanning(opCtx);
+        return;
+    }
+
+    std::vector<RecordIdAndWall> oplogEstimates;
+    oplogEstimates.reserve(numSamples);
+    for (auto& samples : workerSamples) {
+        std::move(samples.begin(), samples.end(), std::back_inserter(oplogEstimates));
     }
     std::sort(oplogEstimates.begin(),
               oplogEstimates.end(),
@@ -1263,8 +1334,11 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
     invariant(opCtx->lockState()->inAWriteUnitOfWork() || opCtx->lockState()->isNoop());
 
     int64_t totalLength = 0;
-    for (size_t i = 0; i < nRecords; i++)
+    size_t nNullIdRecords = 0;
+    for (size_t i = 0; i < nRecords; i++) {
         totalLength += records[i].data.size();
+        nNullIdRecords += size_t(records[i].id.isNull());
+    }
 
     WiredTigerCursor curwrap(_uri, _tableId, _overwrite, opCtx);
     curwrap.assertInActiveTxn();
@@ -1277,6 +1351,12 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
     if (_keyFormat == KeyFormat::Long) {
         // Non-clustered record stores will extract the RecordId key for the oplog and generate
         // unique int64_t RecordIds if RecordIds are not set.
+        //
+        // Reserve a contiguous block of RecordIds for the whole batch up front, rather than
+        // paying an atomic increment per record.
+        int64_t nextId = (_isOplog || nNullIdRecords == 0)
+            ? 0
+            : _nextId(opCtx, nNullIdRecords).getLong();
         for (size_t i = 0; i < nRecords; i++) {
             auto& record = records[i];
             if (_isOplog) {
@@ -1289,7 +1369,7 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
                 // Some RecordStores, like TemporaryRecordStores, may want to set their own
                 // RecordIds.
                 if (record.id.isNull()) {
-                    record.id = _nextId(opCtx);
+                    record.id = RecordId(nextId++);
                 }
             }
             dassert(record.id > highestIdRecord.id);
@@ -1777,13 +1857,14 @@ void WiredTigerRecordStore::_initNextIdIfNeeded(OperationContext* opCtx) {
     _nextIdNum.store(nextId);
 }
 
-RecordId WiredTigerRecordStore::_nextId(OperationContext* opCtx) {
+RecordId WiredTigerRecordStore::_nextId(OperationContext* opCtx, size_t nRecords) {
     // Clustered record stores do not generate unique ObjectId's for RecordId's as the expectation
     // is for the caller to set the RecordId using the server generated ObjectId.
     invariant(_keyFormat == KeyFormat::Long);
     invariant(!_isOplog);
+    invariant(nRecords > 0);
     _initNextIdIfNeeded(opCtx);
-    RecordId out = RecordId(_nextIdNum.fetchAndAdd(1));
+    RecordId out = RecordId(_nextIdNum.fetchAndAdd(nRecords));
     invariant(out.isValid());
     return out;
 }
@@ -287,7 +287,11 @@ private:
                           const Timestamp* timestamps,
                           size_t nRecords);
 
-    RecordId _nextId(OperationContext* opCtx);
+    /**
+     * Reserves a contiguous block of 'nRecords' RecordIds with a single atomic increment and
+     * returns the first id in the block.
+     */
+    RecordId _nextId(OperationContext* opCtx, size_t nRecords);
     RecordData _getData(const WiredTigerCursor& cursor) const;
 
 
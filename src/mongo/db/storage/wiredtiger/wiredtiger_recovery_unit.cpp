@@ -34,6 +34,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/operation_trace.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
@@ -255,6 +256,8 @@ bool WiredTigerRecoveryUnit::waitUntilDurable(OperationContext* opCtx) {
     invariant(!_inUnitOfWork(), toString(_getState()));
     invariant(!opCtx->lockState()->isLocked() || storageGlobalParams.repair);
 
+    OperationTrace::Span span(opCtx, "waitUntilDurable"_sd);
+
     // Flushes the journal log to disk. Checkpoints all data if journaling is disabled.
     _sessionCache->waitUntilDurable(opCtx,
                                     WiredTigerSessionCache::Fsync::kJournal,
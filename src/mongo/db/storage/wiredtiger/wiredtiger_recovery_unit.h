@@ -45,6 +45,7 @@
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
+#include "mongo/util/per_thread_pooled.h"
 #include "mongo/util/timer.h"
 
 namespace mongo {
@@ -91,7 +92,10 @@ private:
     std::map<int, long long> _stats;
 };
 
-class WiredTigerRecoveryUnit final : public RecoveryUnit {
+// Recovery units are built and torn down once per operation; recycle their memory through a
+// per-thread pool rather than going to the allocator each time.
+class WiredTigerRecoveryUnit final : public RecoveryUnit,
+                                     public PerThreadPooled<WiredTigerRecoveryUnit> {
 public:
     WiredTigerRecoveryUnit(WiredTigerSessionCache* sc);
 
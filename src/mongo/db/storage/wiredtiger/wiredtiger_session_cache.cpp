@@ -361,25 +361,41 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
 void WiredTigerSessionCache::waitUntilPreparedUnitOfWorkCommitsOrAborts(OperationContext* opCtx,
                                                                         std::uint64_t lastCount) {
     invariant(opCtx);
+
+    // Register as a waiter before checking the counter so that a concurrent notifier either sees
+    // us here or has already bumped the counter, which the predicate below observes.
+    _prepareConflictWaiters.fetchAndAdd(1);
+    ON_BLOCK_EXIT([this] { _prepareConflictWaiters.fetchAndSubtract(1); });
+
     stdx::unique_lock<Latch> lk(_prepareCommittedOrAbortedMutex);
-    if (lastCount == _prepareCommitOrAbortCounter.loadRelaxed()) {
+    if (lastCount == _prepareCommitOrAbortCounter.load()) {
         opCtx->waitForConditionOrInterrupt(_prepareCommittedOrAbortedCond, lk, [&] {
-            return _prepareCommitOrAbortCounter.loadRelaxed() > lastCount;
+            return _prepareCommitOrAbortCounter.load() > lastCount;
         });
     }
 }
 
 void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
-    stdx::unique_lock<Latch> lk(_prepareCommittedOrAbortedMutex);
+    // Bump the counter before checking for waiters; see
+    // waitUntilPreparedUnitOfWorkCommitsOrAborts() for the ordering argument. When no operation is
+    // blocked on a prepare conflict, the common case, every prepared transaction resolution
+    // avoids the mutex and the notification entirely.
     _prepareCommitOrAbortCounter.fetchAndAdd(1);
+    if (_prepareConflictWaiters.load() == 0) {
+        return;
+    }
+
+    stdx::unique_lock<Latch> lk(_prepareCommittedOrAbortedMutex);
     _prepareCommittedOrAbortedCond.notify_all();
 }
 
 
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        for (auto session : partition.sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
@@ -387,15 +403,21 @@ void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        for (auto session : partition.sessions) {
+            session->closeCursorsForQueuedDrops(_engine);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        count += partition.sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -407,14 +429,14 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = partition.sessions.begin(); it != partition.sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = partition.sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
@@ -430,13 +452,20 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
+    // Increment the epoch as we are now closing all sessions with this epoch. A session from the
+    // old epoch that is checked in concurrently either lands in its partition before we swap it
+    // out below, or observes the new epoch under its partition lock and is deleted by
+    // releaseSession() instead of being cached.
+    _epoch.fetchAndAdd(1);
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+    SessionCache swap;
+    for (auto& partition : _partitions) {
+        SessionCache partitionSwap;
+        {
+            stdx::lock_guard<Latch> lock(partition.lock);
+            partition.sessions.swap(partitionSwap);
+        }
+        swap.insert(swap.end(), partitionSwap.begin(), partitionSwap.end());
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -448,24 +477,42 @@ bool WiredTigerSessionCache::isEphemeral() {
     return _engine && _engine->isEphemeral();
 }
 
+WiredTigerSessionCache::SessionCachePartition& WiredTigerSessionCache::_homePartition() {
+    return _partitions[std::hash<stdx::thread::id>()(stdx::this_thread::get_id()) %
+                       kSessionCachePartitions];
+}
+
 UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // We should never be able to get here after _shuttingDown is set, because no new
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
     {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
+        auto& partition = _homePartition();
+        stdx::lock_guard<Latch> lock(partition.lock);
+        if (!partition.sessions.empty()) {
             // Get the most recently used session so that if we discard sessions, we're
             // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
+            WiredTigerSession* cachedSession = partition.sessions.back();
+            partition.sessions.pop_back();
             // Reset the idle time
             cachedSession->setIdleExpireTime(Date_t::min());
             return UniqueWiredTigerSession(cachedSession);
         }
     }
 
+    // The home partition was empty. Opening a WT_SESSION is far more expensive than a few mutex
+    // acquisitions, so try to steal an idle session from another partition before creating one.
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        if (!partition.sessions.empty()) {
+            WiredTigerSession* cachedSession = partition.sessions.back();
+            partition.sessions.pop_back();
+            cachedSession->setIdleExpireTime(Date_t::min());
+            return UniqueWiredTigerSession(cachedSession);
+        }
+    }
+
     // Outside of the cache partition lock, but on release will be put back on the cache
     return UniqueWiredTigerSession(
         new WiredTigerSession(_conn, this, _epoch.load(), _cursorEpoch.load()));
@@ -521,10 +568,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        auto& partition = _homePartition();
+        stdx::lock_guard<Latch> lock(partition.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            partition.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
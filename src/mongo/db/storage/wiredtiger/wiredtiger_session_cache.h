@@ -379,9 +379,25 @@ private:
     AtomicWord<unsigned> _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // The cache of idle sessions is striped to spread checkout/checkin, which every operation
+    // performs, across independent mutexes. A thread always checks sessions in and out of the
+    // same partition, so stripes stay balanced. The rare maintenance operations (closing all
+    // sessions or cursors, expiring idle sessions) visit every partition in turn.
+    struct SessionCachePartition {
+        // Held only to push or pop a session pointer, so spinning beats parking on contention.
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::SessionCachePartition::lock",
+                                      latch_detail::SpinPolicy::kAdaptiveSpin);
+        SessionCache sessions;
+    };
+    static constexpr size_t kSessionCachePartitions = 16;
+    SessionCachePartition _partitions[kSessionCachePartitions];
+
+    /**
+     * Returns the partition the calling thread checks sessions in and out of.
+     */
+    SessionCachePartition& _homePartition();
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
@@ -399,6 +415,10 @@ private:
     stdx::condition_variable _prepareCommittedOrAbortedCond;
     AtomicWord<std::uint64_t> _prepareCommitOrAbortCounter{0};
 
+    // Number of operations currently blocked on a prepare conflict. Lets every prepared
+    // transaction resolution skip the mutex and notification when nobody is waiting.
+    AtomicWord<unsigned> _prepareConflictWaiters{0};
+
     // Protects getting and setting the _journalListener below.
     Mutex _journalListenerMutex = MONGO_MAKE_LATCH("WiredTigerSessionCache::_journalListenerMutex");
 
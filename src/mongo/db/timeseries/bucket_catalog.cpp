@@ -351,8 +351,9 @@ void BucketCatalog::finish(std::shared_ptr<WriteBatch> batch, const CommitInfo&
             // this metadata.
             _markBucketNotIdle(ptr, false /* locked */);
             {
-                stdx::lock_guard statesLk{_statesMutex};
-                _bucketStates.erase(ptr->_id);
+                auto& stateStripe = _stateStripeFor(ptr->_id);
+                stdx::lock_guard statesLk{stateStripe.mutex};
+                stateStripe.states.erase(ptr->_id);
             }
             _allBuckets.erase(ptr);
         } else {
@@ -506,8 +507,9 @@ bool BucketCatalog::_removeBucket(Bucket* bucket, bool expiringBuckets) {
     _removeNonNormalizedKeysForBucket(bucket);
     _openBuckets.erase({bucket->_ns, bucket->_metadata});
     {
-        stdx::lock_guard statesLk{_statesMutex};
-        _bucketStates.erase(bucket->_id);
+        auto& stateStripe = _stateStripeFor(bucket->_id);
+        stdx::lock_guard statesLk{stateStripe.mutex};
+        stateStripe.states.erase(bucket->_id);
     }
     _allBuckets.erase(it);
 
@@ -656,15 +658,17 @@ void BucketCatalog::_setIdTimestamp(Bucket* bucket,
     bucket->_minmax.update(
         controlDoc, bucket->_metadata.getMetaField(), bucket->_metadata.getComparator());
 
-    stdx::lock_guard statesLk{_statesMutex};
-    _bucketStates.emplace(bucket->_id, BucketState::kNormal);
+    auto& stateStripe = _stateStripeFor(bucket->_id);
+    stdx::lock_guard statesLk{stateStripe.mutex};
+    stateStripe.states.emplace(bucket->_id, BucketState::kNormal);
 }
 
 boost::optional<BucketCatalog::BucketState> BucketCatalog::_setBucketState(const OID& id,
                                                                            BucketState target) {
-    stdx::lock_guard statesLk{_statesMutex};
-    auto it = _bucketStates.find(id);
-    if (it == _bucketStates.end()) {
+    auto& stateStripe = _stateStripeFor(id);
+    stdx::lock_guard statesLk{stateStripe.mutex};
+    auto it = stateStripe.states.find(id);
+    if (it == stateStripe.states.end()) {
         return boost::none;
     }
 
@@ -700,6 +704,10 @@ boost::optional<BucketCatalog::BucketState> BucketCatalog::_setBucketState(const
     return state;
 }
 
+BucketCatalog::BucketStateStripe& BucketCatalog::_stateStripeFor(const OID& id) {
+    return _bucketStateStripes[OID::Hasher{}(id) % kNumBucketStateStripes];
+}
+
 BucketCatalog::BucketMetadata::BucketMetadata(BSONElement elem,
                                               const StringData::ComparatorInterface* comparator)
     : _metadataElement(elem), _comparator(comparator) {}
@@ -896,9 +904,10 @@ BucketCatalog::BucketAccess::BucketAccess(BucketCatalog* catalog,
         invariant(*targetState == BucketState::kNormal || *targetState == BucketState::kPrepared);
         state = _catalog->_setBucketState(_bucket->_id, *targetState);
     } else {
-        stdx::lock_guard statesLk{_catalog->_statesMutex};
-        auto statesIt = _catalog->_bucketStates.find(_bucket->_id);
-        if (statesIt != _catalog->_bucketStates.end()) {
+        auto& stateStripe = _catalog->_stateStripeFor(_bucket->_id);
+        stdx::lock_guard statesLk{stateStripe.mutex};
+        auto statesIt = stateStripe.states.find(_bucket->_id);
+        if (statesIt != stateStripe.states.end()) {
             state = statesIt->second;
         }
     }
@@ -964,9 +973,10 @@ BucketCatalog::BucketState BucketCatalog::BucketAccess::_findOpenBucketThenLockA
 }
 
 BucketCatalog::BucketState BucketCatalog::BucketAccess::_confirmStateForAcquiredBucket() {
-    stdx::lock_guard statesLk{_catalog->_statesMutex};
-    auto statesIt = _catalog->_bucketStates.find(_bucket->_id);
-    invariant(statesIt != _catalog->_bucketStates.end());
+    auto& stateStripe = _catalog->_stateStripeFor(_bucket->_id);
+    stdx::lock_guard statesLk{stateStripe.mutex};
+    auto statesIt = stateStripe.states.find(_bucket->_id);
+    invariant(statesIt != stateStripe.states.end());
     auto& [_, state] = *statesIt;
     if (state == BucketState::kCleared || state == BucketState::kPreparedAndCleared) {
         release();
@@ -990,9 +1000,10 @@ void BucketCatalog::BucketAccess::_findOrCreateOpenBucketThenLock(
     _acquire();
 
     {
-        stdx::lock_guard statesLk{_catalog->_statesMutex};
-        auto statesIt = _catalog->_bucketStates.find(_bucket->_id);
-        invariant(statesIt != _catalog->_bucketStates.end());
+        auto& stateStripe = _catalog->_stateStripeFor(_bucket->_id);
+        stdx::lock_guard statesLk{stateStripe.mutex};
+        auto statesIt = stateStripe.states.find(_bucket->_id);
+        invariant(statesIt != stateStripe.states.end());
         auto& [_, state] = *statesIt;
         if (state == BucketState::kNormal || state == BucketState::kPrepared) {
             _catalog->_markBucketNotIdle(_bucket, false /* locked */);
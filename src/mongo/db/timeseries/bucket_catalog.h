@@ -453,6 +453,17 @@ private:
         kPreparedAndCleared,
     };
 
+    /**
+     * Bucket states are striped by bucket OID so that the state lookups performed on every insert
+     * and commit for independent buckets do not contend on a single mutex. Each bucket's state is
+     * owned by exactly one stripe.
+     */
+    struct BucketStateStripe {
+        mutable Mutex mutex = MONGO_MAKE_LATCH("BucketCatalog::BucketStateStripe::mutex");
+        stdx::unordered_map<OID, BucketState, OID::Hasher> states;
+    };
+    static constexpr std::size_t kNumBucketStateStripes = 16;
+
     /**
      * Key to lookup open Bucket for namespace and metadata.
      */
@@ -696,6 +707,11 @@ private:
      */
     boost::optional<BucketState> _setBucketState(const OID& id, BucketState target);
 
+    /**
+     * Returns the stripe which owns the state for the bucket with the given id.
+     */
+    BucketStateStripe& _stateStripeFor(const OID& id);
+
     /**
      * You must hold a lock on _bucketMutex when accessing _allBuckets or _openBuckets.
      * While holding a lock on _bucketMutex, you can take a lock on an individual bucket, then
@@ -720,9 +736,8 @@ private:
     // The current open bucket for each namespace and metadata pair.
     stdx::unordered_map<BucketKey, Bucket*, BucketHasher, BucketEq> _openBuckets;
 
-    // Bucket state
-    mutable Mutex _statesMutex = MONGO_MAKE_LATCH("BucketCatalog::_statesMutex");
-    stdx::unordered_map<OID, BucketState, OID::Hasher> _bucketStates;
+    // Bucket state, striped by bucket OID.
+    std::array<BucketStateStripe, kNumBucketStateStripes> _bucketStateStripes;
 
     // This mutex protects access to _idleBuckets
     mutable Mutex _idleMutex = MONGO_MAKE_LATCH("BucketCatalog::_idleMutex");
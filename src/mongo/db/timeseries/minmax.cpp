@@ -82,8 +82,9 @@ void MinMaxStore::Data::setArray() {
 
 void MinMaxStore::Data::setValue(const BSONElement& elem) {
     auto requiredSize = elem.size() - elem.fieldNameSize() + 1;
-    if (_value.size < requiredSize) {
+    if (_value.allocated < requiredSize) {
         _value.buffer = std::make_unique<char[]>(requiredSize);
+        _value.allocated = requiredSize;
     }
     // Store element as BSONElement buffer but strip out the field name
     _value.buffer[0] = elem.type();
@@ -483,6 +484,21 @@ std::pair<MinMaxStore::Iterator, MinMaxStore::Iterator> MinMax::_update(
         return {obj.iterator(), obj.parent().end()};
     }
 
+    auto& minData = obj.element().min();
+    auto& maxData = obj.element().max();
+    if (updateMinValues && updateMaxValues && minData.type() == MinMaxStore::Type::kValue &&
+        maxData.type() == MinMaxStore::Type::kValue) {
+        // Both bounds hold values, where min sorts before max. An element that sorts after max
+        // cannot also sort before min, so one of the two comparisons can be skipped. Compare
+        // against max first as time-series measurements typically arrive in increasing order.
+        if (elem.compare(maxData.value(), std::greater<>{}, false, stringComparator)) {
+            maxData.setValue(elem);
+        } else if (elem.compare(minData.value(), std::less<>{}, false, stringComparator)) {
+            minData.setValue(elem);
+        }
+        return {obj.iterator(), obj.parent().end()};
+    }
+
     auto maybeUpdateValue = [&](MinMaxStore::Data& data, auto comp) {
         if (data.type() == MinMaxStore::Type::kUnset ||
             (data.type() == MinMaxStore::Type::kObject && comp(typeComp(Object), 0)) ||
@@ -493,11 +509,11 @@ std::pair<MinMaxStore::Iterator, MinMaxStore::Iterator> MinMax::_update(
         }
     };
     if (updateMinValues) {
-        maybeUpdateValue(obj.element().min(), std::less<>{});
+        maybeUpdateValue(minData, std::less<>{});
     }
 
     if (updateMaxValues) {
-        maybeUpdateValue(obj.element().max(), std::greater<>{});
+        maybeUpdateValue(maxData, std::greater<>{});
     }
 
     return {obj.iterator(), obj.parent().end()};
@@ -64,7 +64,11 @@ public:
      */
     struct Value {
         std::unique_ptr<char[]> buffer;
+        // Size of the element currently stored in 'buffer'.
         int size = 0;
+        // Allocated size of 'buffer'. May be larger than 'size' when a smaller element was stored
+        // after a larger one, so the buffer can be reused without reallocating.
+        int allocated = 0;
     };
 
     /**
@@ -147,6 +147,55 @@ TEST(MinMax, MinMaxMixedUpdates) {
     ASSERT_BSONOBJ_EQ(minMaxObj.maxUpdates(), BSON("u" << BSON("a" << 5)));
 }
 
+TEST(MinMax, MinMaxScalarBounds) {
+    MinMax minMaxObj;
+    const auto* strCmp = &SimpleStringDataComparator::kInstance;
+    minMaxObj.update(BSON("a" << 2), boost::none, strCmp);
+    ASSERT_BSONOBJ_EQ(minMaxObj.min(), BSON("a" << 2));
+    ASSERT_BSONOBJ_EQ(minMaxObj.max(), BSON("a" << 2));
+
+    // Above max, only the max side changes.
+    minMaxObj.update(BSON("a" << 5), boost::none, strCmp);
+    ASSERT_BSONOBJ_EQ(minMaxObj.minUpdates(), BSONObj());
+    ASSERT_BSONOBJ_EQ(minMaxObj.maxUpdates(), BSON("u" << BSON("a" << 5)));
+
+    // Between the bounds, neither side changes.
+    minMaxObj.update(BSON("a" << 3), boost::none, strCmp);
+    ASSERT_BSONOBJ_EQ(minMaxObj.minUpdates(), BSONObj());
+    ASSERT_BSONOBJ_EQ(minMaxObj.maxUpdates(), BSONObj());
+
+    // Below min, only the min side changes.
+    minMaxObj.update(BSON("a" << 1), boost::none, strCmp);
+    ASSERT_BSONOBJ_EQ(minMaxObj.minUpdates(), BSON("u" << BSON("a" << 1)));
+    ASSERT_BSONOBJ_EQ(minMaxObj.maxUpdates(), BSONObj());
+}
+
+TEST(MinMax, MinMaxVaryingValueSize) {
+    MinMax minMaxObj;
+    const auto* strCmp = &SimpleStringDataComparator::kInstance;
+
+    // Store a large value, then a smaller one, then a medium one. The medium value is stored in
+    // the buffer allocated for the large value which is bigger than the last stored size.
+    minMaxObj.update(BSON("a"
+                          << "mmmmmmmmmm"),
+                     boost::none,
+                     strCmp);
+    minMaxObj.update(BSON("a"
+                          << "a"),
+                     boost::none,
+                     strCmp);
+    minMaxObj.update(BSON("a"
+                          << "zzzzz"),
+                     boost::none,
+                     strCmp);
+    ASSERT_BSONOBJ_EQ(minMaxObj.min(),
+                      BSON("a"
+                           << "a"));
+    ASSERT_BSONOBJ_EQ(minMaxObj.max(),
+                      BSON("a"
+                           << "zzzzz"));
+}
+
 TEST(MinMax, SubObjInsert) {
     MinMaxStore minmax;
     auto obj = minmax.root();
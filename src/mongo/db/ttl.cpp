@@ -76,9 +76,11 @@ const auto getTTLMonitor = ServiceContext::declareDecoration<std::unique_ptr<TTL
 MONGO_FAIL_POINT_DEFINE(hangTTLMonitorWithLock);
 
 Counter64 ttlPasses;
+Counter64 ttlSubPasses;
 Counter64 ttlDeletedDocuments;
 
 ServerStatusMetricField<Counter64> ttlPassesDisplay("ttl.passes", &ttlPasses);
+ServerStatusMetricField<Counter64> ttlSubPassesDisplay("ttl.subPasses", &ttlSubPasses);
 ServerStatusMetricField<Counter64> ttlDeletedDocumentsDisplay("ttl.deletedDocuments",
                                                               &ttlDeletedDocuments);
 using MtabType = TenantMigrationAccessBlocker::BlockerType;
@@ -174,6 +176,14 @@ public:
 private:
     /**
      * Gets all TTL specifications for every collection and deletes expired documents.
+     *
+     * A pass is made up of one or more sub-passes. Each sub-pass visits every TTL index and
+     * clustered TTL collection once and deletes expired documents in batches bounded by
+     * 'ttlIndexDeleteTargetDocs' and 'ttlIndexDeleteTargetTimeMS'. When any batch was cut off
+     * with work remaining, another sub-pass runs until all indexes are drained or the
+     * 'ttlMonitorSubPassTargetSecs' budget is exhausted. Rotating between indexes in small
+     * batches keeps one backlogged index from starving the others and from holding tickets away
+     * from foreground writes for minutes at a time.
      */
     void doTTLPass() {
         const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
@@ -185,13 +195,36 @@ private:
             !repl::ReplicationCoordinator::get(opCtx)->getMemberState().readable())
             return;
 
+        // Increment the metric after the TTL work has been finished.
+        ON_BLOCK_EXIT([&] { ttlPasses.increment(); });
+
+        Timer passTimer;
+        bool moreToDelete = true;
+        while (moreToDelete) {
+            moreToDelete = doTTLSubPass(opCtx);
+            if (moreToDelete &&
+                passTimer.elapsed() >= Seconds(ttlMonitorSubPassTargetSecs.load())) {
+                // Carry the remaining work over to the next pass rather than chasing a workload
+                // that expires documents faster than we delete them.
+                break;
+            }
+        }
+    }
+
+    /**
+     * Visits every TTL index and clustered TTL collection once and deletes one batch of expired
+     * documents from each. Returns true if any of them was cut off at the batch targets with
+     * expired documents remaining.
+     */
+    bool doTTLSubPass(OperationContext* opCtx) {
         TTLCollectionCache& ttlCollectionCache = TTLCollectionCache::get(getGlobalServiceContext());
         auto ttlInfos = ttlCollectionCache.getTTLInfos();
 
-        // Increment the metric after the TTL work has been finished.
-        ON_BLOCK_EXIT([&] { ttlPasses.increment(); });
+        ON_BLOCK_EXIT([&] { ttlSubPasses.increment(); });
+
+        bool moreToDelete = false;
 
-        // Perform a pass for every collection and index described as being TTL.
+        // Perform a sub-pass for every collection and index described as being TTL.
         for (const auto& [uuid, infos] : ttlInfos) {
             for (const auto& info : infos) {
                 // Skip collections that have not been made visible yet. The TTLCollectionCache
@@ -210,12 +243,14 @@ private:
                 }
 
                 try {
-                    deleteExpired(opCtx, &ttlCollectionCache, uuid, *nss, info);
+                    if (deleteExpired(opCtx, &ttlCollectionCache, uuid, *nss, info)) {
+                        moreToDelete = true;
+                    }
                 } catch (const ExceptionForCat<ErrorCategory::Interruption>&) {
                     LOGV2_WARNING(22537,
                                   "TTLMonitor was interrupted, waiting before doing another pass",
                                   "wait"_attr = Milliseconds(Seconds(ttlMonitorSleepSecs.load())));
-                    return;
+                    return false;
                 } catch (const DBException& ex) {
                     LOGV2_ERROR(5400703,
                                 "Error running TTL job on collection",
@@ -225,12 +260,16 @@ private:
                 }
             }
         }
+
+        return moreToDelete;
     }
 
     /**
-     * Deletes expired data on the given collection with the provided information.
+     * Deletes one batch of expired data on the given collection with the provided information.
+     * Returns true if the batch was cut off at the configured targets with expired documents
+     * remaining.
      */
-    void deleteExpired(OperationContext* opCtx,
+    bool deleteExpired(OperationContext* opCtx,
                        TTLCollectionCache* ttlCollectionCache,
                        const UUID& uuid,
                        const NamespaceString& nss,
@@ -238,11 +277,11 @@ private:
         if (nss.isTemporaryReshardingCollection()) {
             // For resharding, the donor shard primary is responsible for performing the TTL
             // deletions.
-            return;
+            return false;
         }
 
         if (nss.isDropPendingNamespace()) {
-            return;
+            return false;
         }
 
         uassertStatusOK(userAllowedWriteNS(opCtx, nss));
@@ -251,7 +290,7 @@ private:
         // The collection with `uuid` might be renamed before the lock and the wrong namespace would
         // be locked and looked up so we double check here.
         if (!coll || coll->uuid() != uuid)
-            return;
+            return false;
 
         // TTL indexes are not compatible with capped collections.
         invariant(!coll->isCapped());
@@ -264,7 +303,7 @@ private:
         }
 
         if (!repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, nss)) {
-            return;
+            return false;
         }
 
         std::shared_ptr<TenantMigrationAccessBlocker> mtab;
@@ -279,23 +318,49 @@ private:
                         "Postpone TTL of DB because of active tenant migration",
                         "tenantMigrationAccessBlocker"_attr = mtab->getDebugInfo().jsonString(),
                         "database"_attr = coll.getDb()->name());
-            return;
+            return false;
         }
 
         ResourceConsumption::ScopedMetricsCollector scopedMetrics(opCtx, nss.db().toString());
 
         const auto& collection = coll.getCollection();
-        stdx::visit(
+        return stdx::visit(
             visit_helper::Overloaded{
                 [&](const TTLCollectionCache::ClusteredId&) {
-                    deleteExpiredWithCollscan(opCtx, ttlCollectionCache, collection);
+                    return deleteExpiredWithCollscan(opCtx, ttlCollectionCache, collection);
                 },
                 [&](const TTLCollectionCache::IndexName& indexName) {
-                    deleteExpiredWithIndex(opCtx, ttlCollectionCache, collection, indexName);
+                    return deleteExpiredWithIndex(opCtx, ttlCollectionCache, collection, indexName);
                 }},
             info);
     }
 
+    /**
+     * Drives a multi-delete plan that returns each deleted document until it hits EOF or reaches
+     * the batch targets. Returns the number of documents deleted and whether the batch was cut off
+     * with expired documents remaining. The plan's own yield policy still yields locks and
+     * snapshots between works, and every acquisition goes through normal ticket admission and flow
+     * control, so a batch never holds resources for longer than one document's delete.
+     */
+    std::pair<long long, bool> runBatchedDelete(PlanExecutor* exec) {
+        const long long targetDocs = ttlIndexDeleteTargetDocs.load();
+        const Milliseconds targetTime{ttlIndexDeleteTargetTimeMS.load()};
+
+        Timer timer;
+        long long numDeleted = 0;
+        bool moreToDelete = false;
+        BSONObj deletedDoc;
+        while (exec->getNext(&deletedDoc, nullptr) == PlanExecutor::ADVANCED) {
+            ++numDeleted;
+            if ((targetDocs > 0 && numDeleted >= targetDocs) ||
+                (targetTime > Milliseconds::zero() && Milliseconds(timer.millis()) >= targetTime)) {
+                moreToDelete = true;
+                break;
+            }
+        }
+        return {numDeleted, moreToDelete};
+    }
+
     /**
      * Generate the safe expiration date for a given collection and user-configured
      * expireAfterSeconds value.
@@ -318,26 +383,27 @@ private:
     }
 
     /**
-     * Removes documents from the collection using the specified TTL index after a sufficient
-     * amount of time has passed according to its expiry specification.
+     * Removes one batch of documents from the collection using the specified TTL index after a
+     * sufficient amount of time has passed according to its expiry specification. Returns true if
+     * the batch was cut off at the configured targets with expired documents remaining.
      */
-    void deleteExpiredWithIndex(OperationContext* opCtx,
+    bool deleteExpiredWithIndex(OperationContext* opCtx,
                                 TTLCollectionCache* ttlCollectionCache,
                                 const CollectionPtr& collection,
                                 std::string indexName) {
         if (!collection->isIndexPresent(indexName)) {
             ttlCollectionCache->deregisterTTLInfo(collection->uuid(), indexName);
-            return;
+            return false;
         }
 
         BSONObj spec = collection->getIndexSpec(indexName);
         if (!spec.hasField(IndexDescriptor::kExpireAfterSecondsFieldName)) {
             ttlCollectionCache->deregisterTTLInfo(collection->uuid(), indexName);
-            return;
+            return false;
         }
 
         if (!collection->isIndexReady(indexName)) {
-            return;
+            return false;
         }
 
         const BSONObj key = spec["key"].Obj();
@@ -346,7 +412,7 @@ private:
             LOGV2_ERROR(22540,
                         "key for ttl index can only have 1 field, skipping TTL job",
                         "index"_attr = spec);
-            return;
+            return false;
         }
 
         LOGV2_DEBUG(22533,
@@ -359,14 +425,14 @@ private:
         const IndexDescriptor* desc = collection->getIndexCatalog()->findIndexByName(opCtx, name);
         if (!desc) {
             LOGV2_DEBUG(22535, 1, "index not found; skipping ttl job", "index"_attr = spec);
-            return;
+            return false;
         }
 
         if (IndexType::INDEX_BTREE != IndexNames::nameToType(desc->getAccessMethodName())) {
             LOGV2_ERROR(22541,
                         "special index can't be used as a TTL index, skipping TTL job",
                         "index"_attr = spec);
-            return;
+            return false;
         }
 
         BSONElement secondsExpireElt = spec[IndexDescriptor::kExpireAfterSecondsFieldName];
@@ -376,7 +442,7 @@ private:
                         "field"_attr = IndexDescriptor::kExpireAfterSecondsFieldName,
                         "type"_attr = typeName(secondsExpireElt.type()),
                         "index"_attr = spec);
-            return;
+            return false;
         }
 
         const Date_t kDawnOfTime =
@@ -405,6 +471,9 @@ private:
         auto params = std::make_unique<DeleteStageParams>();
         params->isMulti = true;
         params->canonicalQuery = canonicalQuery.getValue().get();
+        // Return each deleted document so the batch loop can observe per-document progress and cut
+        // the batch off at the configured targets.
+        params->returnDeleted = true;
 
         Timer timer;
         auto exec =
@@ -419,7 +488,7 @@ private:
                                                  direction);
 
         try {
-            const auto numDeleted = exec->executeDelete();
+            const auto [numDeleted, moreToDelete] = runBatchedDelete(exec.get());
             ttlDeletedDocuments.increment(numDeleted);
 
             const auto duration = Milliseconds(timer.millis());
@@ -433,18 +502,23 @@ private:
                       logAttrs(collection->ns()),
                       "index"_attr = name,
                       "numDeleted"_attr = numDeleted,
+                      "moreToDelete"_attr = moreToDelete,
                       "duration"_attr = duration);
             }
+            return moreToDelete;
         } catch (const ExceptionFor<ErrorCodes::QueryPlanKilled>&) {
             // It is expected that a collection drop can kill a query plan while the TTL monitor
             // is deleting an old document, so ignore this error.
+            return false;
         }
     }
 
     /*
-     * Removes expired documents from a collection clustered by _id using a bounded collection scan.
+     * Removes one batch of expired documents from a collection clustered by _id using a bounded
+     * collection scan. Returns true if the batch was cut off at the configured targets with
+     * expired documents remaining.
      */
-    void deleteExpiredWithCollscan(OperationContext* opCtx,
+    bool deleteExpiredWithCollscan(OperationContext* opCtx,
                                    TTLCollectionCache* ttlCollectionCache,
                                    const CollectionPtr& collection) {
         const auto& collOptions = collection->getCollectionOptions();
@@ -457,7 +531,7 @@ private:
         if (!expireAfterSeconds) {
             ttlCollectionCache->deregisterTTLInfo(collection->uuid(),
                                                   TTLCollectionCache::ClusteredId{});
-            return;
+            return false;
         }
 
         LOGV2_DEBUG(5400704,
@@ -476,6 +550,9 @@ private:
 
         auto params = std::make_unique<DeleteStageParams>();
         params->isMulti = true;
+        // Return each deleted document so the batch loop can observe per-document progress and cut
+        // the batch off at the configured targets.
+        params->returnDeleted = true;
 
         // Deletes records using a bounded collection scan from the beginning of time to the
         // expiration time (inclusive).
@@ -490,7 +567,7 @@ private:
                                                       endId);
 
         try {
-            const auto numDeleted = exec->executeDelete();
+            const auto [numDeleted, moreToDelete] = runBatchedDelete(exec.get());
             ttlDeletedDocuments.increment(numDeleted);
 
             const auto duration = Milliseconds(timer.millis());
@@ -503,11 +580,14 @@ private:
                       "Deleted expired documents using collection scan",
                       logAttrs(collection->ns()),
                       "numDeleted"_attr = numDeleted,
+                      "moreToDelete"_attr = moreToDelete,
                       "duration"_attr = duration);
             }
+            return moreToDelete;
         } catch (const ExceptionFor<ErrorCodes::QueryPlanKilled>&) {
             // It is expected that a collection drop can kill a query plan while the TTL monitor
             // is deleting an old document, so ignore this error.
+            return false;
         }
     }
 
@@ -492,6 +492,13 @@ public:
         return _pool;
     }
 
+    /**
+     * Get the current time according to the pool's clock source
+     */
+    Date_t now() const {
+        return _pool->_factory->now();
+    }
+
     virtual void updateConnectionPoolStats([[maybe_unused]] ConnectionPoolStats* cps) const = 0;
 
 protected:
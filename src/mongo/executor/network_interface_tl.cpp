@@ -557,10 +557,15 @@ Status NetworkInterfaceTL::startCommand(const TaskExecutor::CallbackHandle& cbHa
             continue;
         }
 
-        // Otherwise, schedule the request.
-        std::move(connFuture).thenRunOn(_reactor).getAsync([cmdState = cmdState, idx](auto swConn) {
-            cmdState->requestManager->trySend(std::move(swConn), idx);
-        });
+        // Otherwise, schedule the request. Send from the baton if the operation has one, so the
+        // whole round-trip can stay on the requesting operation's thread; fall back to the
+        // reactor otherwise. The ready-connection path above already runs trySend() on the
+        // caller's thread.
+        std::move(connFuture)
+            .thenRunOn(makeGuaranteedExecutor(baton, _reactor))
+            .getAsync([cmdState = cmdState, idx](auto swConn) {
+                cmdState->requestManager->trySend(std::move(swConn), idx);
+            });
     }
 
     return Status::OK();
@@ -52,6 +52,34 @@
 
 namespace mongo::logv2 {
 
+namespace {
+
+// Number of records the asynchronous file sink may queue before it starts dropping. Sized so a
+// burst of a few thousand records rides out a slow disk without unbounded memory growth.
+constexpr std::size_t kAsyncFileSinkQueueSize = 8192;
+
+// Records discarded by the asynchronous file sink because its queue was full, and how many of
+// those have already been reported. Reported from rotate() so operators can see the loss.
+AtomicWord<int64_t> asyncFileSinkDropped{0};
+AtomicWord<int64_t> asyncFileSinkDroppedReported{0};
+
+// Like boost::log::sinks::drop_on_overflow, but counts what it throws away so overload is
+// visible instead of silent.
+class CountingDropOnOverflow {
+public:
+    template <typename LockT>
+    static bool on_overflow(boost::log::record_view const&, LockT&) {
+        asyncFileSinkDropped.fetchAndAdd(1);
+        return false;
+    }
+
+    static void on_queue_space_available() {}
+
+    static void interrupt() {}
+};
+
+}  // namespace
+
 void LogDomainGlobal::ConfigurationOptions::makeDisabled() {
     consoleEnabled = false;
 }
@@ -71,11 +99,18 @@ struct LogDomainGlobal::Impl {
 #endif
     typedef CompositeBackend<FileRotateSink, RamLogSink, RamLogSink, UserAssertSink>
         RotatableFileBackend;
+    typedef boost::log::sinks::asynchronous_sink<
+        RotatableFileBackend,
+        boost::log::sinks::bounded_fifo_queue<kAsyncFileSinkQueueSize, CountingDropOnOverflow>>
+        AsyncRotatableFileSink;
 
     Impl(LogDomainGlobal& parent);
+    ~Impl();
     Status configure(LogDomainGlobal::ConfigurationOptions const& options);
     Status rotate(bool rename, StringData renameSuffix, std::function<void(Status)> onMinorError);
 
+    void stopAsyncFileSink();
+
     const ConfigurationOptions& config() const;
 
     LogSource& source();
@@ -85,6 +120,7 @@ struct LogDomainGlobal::Impl {
     ConfigurationOptions _config;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<ConsoleBackend>> _consoleSink;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<RotatableFileBackend>> _rotatableFileSink;
+    boost::shared_ptr<AsyncRotatableFileSink> _asyncFileSink;
 #ifndef _WIN32
     boost::shared_ptr<boost::log::sinks::unlocked_sink<SyslogBackend>> _syslogSink;
 #endif
@@ -118,6 +154,23 @@ LogDomainGlobal::Impl::Impl(LogDomainGlobal& parent) : _parent(parent) {
     source();
 }
 
+LogDomainGlobal::Impl::~Impl() {
+    // The asynchronous sink owns a writer thread that must be joined before the boost::log core
+    // is torn down.
+    stopAsyncFileSink();
+}
+
+void LogDomainGlobal::Impl::stopAsyncFileSink() {
+    if (!_asyncFileSink)
+        return;
+    boost::log::core::get()->remove_sink(_asyncFileSink);
+    // Terminate the writer thread, then drain whatever was queued before it stopped so those
+    // records are written rather than lost.
+    _asyncFileSink->stop();
+    _asyncFileSink->flush();
+    _asyncFileSink.reset();
+}
+
 Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions const& options) {
 #ifndef _WIN32
     if (options.syslogEnabled) {
@@ -175,20 +228,41 @@ Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions co
         backend->setFilter<2>(
             TaggedSeverityFilter(_parent, {LogTag::kStartupWarnings}, LogSeverity::Log()));
 
-        _rotatableFileSink =
-            boost::make_shared<boost::log::sinks::unlocked_sink<RotatableFileBackend>>(backend);
-        _rotatableFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
-
-        boost::log::core::get()->add_sink(_rotatableFileSink);
-    } else if (_rotatableFileSink) {
-        boost::log::core::get()->remove_sink(_rotatableFileSink);
-        _rotatableFileSink.reset();
+        if (options.fileAsync) {
+            if (_rotatableFileSink) {
+                boost::log::core::get()->remove_sink(_rotatableFileSink);
+                _rotatableFileSink.reset();
+            }
+            // The asynchronous frontend queues records to a dedicated writer thread, so the
+            // format and write happen off the logging thread. The backend is only ever touched
+            // by that thread (and by rotate(), which synchronizes through locked_backend()).
+            _asyncFileSink = boost::make_shared<AsyncRotatableFileSink>(backend);
+            _asyncFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
+
+            boost::log::core::get()->add_sink(_asyncFileSink);
+        } else {
+            stopAsyncFileSink();
+            _rotatableFileSink =
+                boost::make_shared<boost::log::sinks::unlocked_sink<RotatableFileBackend>>(
+                    backend);
+            _rotatableFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
+
+            boost::log::core::get()->add_sink(_rotatableFileSink);
+        }
+    } else {
+        if (_rotatableFileSink) {
+            boost::log::core::get()->remove_sink(_rotatableFileSink);
+            _rotatableFileSink.reset();
+        }
+        stopAsyncFileSink();
     }
 
     auto setFormatters = [this](auto&& mkFmt) {
         _consoleSink->set_formatter(mkFmt());
         if (_rotatableFileSink)
             _rotatableFileSink->set_formatter(mkFmt());
+        if (_asyncFileSink)
+            _asyncFileSink->set_formatter(mkFmt());
 #ifndef _WIN32
         if (_syslogSink)
             _syslogSink->set_formatter(mkFmt());
@@ -228,17 +302,32 @@ const LogDomainGlobal::ConfigurationOptions& LogDomainGlobal::Impl::config() con
 Status LogDomainGlobal::Impl::rotate(bool rename,
                                      StringData renameSuffix,
                                      std::function<void(Status)> onMinorError) {
-    if (!_rotatableFileSink)
+    if (!_rotatableFileSink && !_asyncFileSink)
         return Status::OK();
     std::vector<Status> errors;
-    Status result = _rotatableFileSink->locked_backend()->lockedBackend<0>()->rotate(
-        rename, renameSuffix, [&](Status s) {
-            errors.push_back(s);
-            if (onMinorError)
-                onMinorError(s);
-        });
+    auto onError = [&](Status s) {
+        errors.push_back(s);
+        if (onMinorError)
+            onMinorError(s);
+    };
+    // locked_backend() on the asynchronous sink pauses the writer thread for the duration of
+    // the rotate, so the file is never swapped out under an in-flight write.
+    Status result = _asyncFileSink
+        ? _asyncFileSink->locked_backend()->lockedBackend<0>()->rotate(
+              rename, renameSuffix, onError)
+        : _rotatableFileSink->locked_backend()->lockedBackend<0>()->rotate(
+              rename, renameSuffix, onError);
     if (!errors.empty())
         LOGV2_WARNING(4719804, "Errors occurred during log rotate", "errors"_attr = errors);
+    if (_asyncFileSink) {
+        auto dropped = asyncFileSinkDropped.load();
+        auto reported = asyncFileSinkDroppedReported.swap(dropped);
+        if (dropped > reported) {
+            LOGV2_WARNING(6174813,
+                          "Asynchronous log file sink dropped records because its queue was full",
+                          "droppedRecords"_attr = dropped - reported);
+        }
+    }
     return result;
 }
 
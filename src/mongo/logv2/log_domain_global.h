@@ -42,6 +42,10 @@ public:
 
         bool consoleEnabled{true};
         bool fileEnabled{false};
+        // When set, file records are queued to a dedicated writer thread instead of being
+        // formatted and written on the logging thread. If the bounded queue fills up records
+        // are dropped and counted rather than blocking the logging thread.
+        bool fileAsync{false};
         std::string filePath;
         RotationMode fileRotationMode{RotationMode::kRename};
         OpenMode fileOpenMode{OpenMode::kTruncate};
@@ -29,8 +29,11 @@
 
 #include "mongo/platform/mutex.h"
 
+#include <algorithm>
+
 #include "mongo/base/init.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/pause.h"
 
 namespace mongo::latch_detail {
 
@@ -71,11 +74,41 @@ void Mutex::lock() {
     }
 
     _onContendedLock();
+    if (_data->identity().spinPolicy() == SpinPolicy::kAdaptiveSpin && _trySpinLock()) {
+        _isLocked = true;
+        _onSlowLock();
+        return;
+    }
     _mutex.lock();
     _isLocked = true;
     _onSlowLock();
 }
 
+bool Mutex::_trySpinLock() noexcept {
+    auto& spinLimit = _data->spinLimit();
+    const int limit = spinLimit.load();
+
+    int backoff = 1;
+    for (int spins = 0; spins < limit; spins += backoff, backoff *= 2) {
+        for (int i = 0; i < backoff; ++i) {
+            MONGO_YIELD_CORE_FOR_SMT();
+        }
+
+        if (_mutex.try_lock()) {
+            // The owner released within the spin window, so the hold time is short enough for
+            // spinning to pay off; allow future contended acquisitions a bigger window. Racing
+            // updates to the limit are benign: it only steers the heuristic.
+            spinLimit.store(std::min(limit * 2, kMaxSpinLimit));
+            return true;
+        }
+    }
+
+    // The hold time exceeded the spin window, so those cycles were wasted on top of the park we
+    // are about to pay for anyway; shrink the window quickly.
+    spinLimit.store(std::max(limit / 2, kMinSpinLimit));
+    return false;
+}
+
 void Mutex::unlock() {
     _onUnlock();
     _isLocked = false;
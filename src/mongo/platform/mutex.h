@@ -60,6 +60,29 @@ using Level = hierarchical_acquisition_detail::Level;
 
 static constexpr auto kAnonymousName = "AnonymousLatch"_sd;
 
+/**
+ * Controls how a Mutex behaves when lock() encounters contention
+ *
+ * kAdaptiveSpin is only appropriate for critical sections known to be held for well under the
+ * cost of a futex round trip (on the order of a few hundred nanoseconds). For such sections,
+ * spinning briefly beats parking in the kernel and being woken later. The spin window adapts:
+ * it grows when spinning wins the lock and shrinks when the spinner ends up parking anyway, so
+ * a section that turns out to be long-held decays back to parking behavior.
+ */
+enum class SpinPolicy {
+    // Park on the underlying stdx::mutex immediately. This is the default.
+    kParkImmediately,
+
+    // Spin with exponential backoff before parking.
+    kAdaptiveSpin,
+};
+
+// Bounds for the adaptive spin loop in Mutex::lock(), in pause-instruction iterations. See
+// SpinPolicy::kAdaptiveSpin.
+static constexpr int kMinSpinLimit = 4;
+static constexpr int kInitialSpinLimit = 16;
+static constexpr int kMaxSpinLimit = 1024;
+
 /**
  * An Identity encapsulates the context around a latch
  *
@@ -72,8 +95,12 @@ public:
 
     explicit Identity(StringData name) : Identity(boost::none, name) {}
 
-    Identity(boost::optional<Level> level, StringData name)
-        : _index(_nextIndex()), _level(level), _name(name.toString()) {}
+    Identity(StringData name, SpinPolicy spinPolicy) : Identity(boost::none, name, spinPolicy) {}
+
+    Identity(boost::optional<Level> level,
+             StringData name,
+             SpinPolicy spinPolicy = SpinPolicy::kParkImmediately)
+        : _index(_nextIndex()), _level(level), _name(name.toString()), _spinPolicy(spinPolicy) {}
 
     /**
      * Since SouceLocations usually come from macros, this function is a setter that allows
@@ -118,6 +145,13 @@ public:
         return _index;
     }
 
+    /**
+     * Return the contention behavior for this latch
+     */
+    SpinPolicy spinPolicy() const {
+        return _spinPolicy;
+    }
+
     /**
      * Append structured data describing this latch
      */
@@ -132,6 +166,7 @@ private:
     int64_t _index;
     boost::optional<Level> _level;
     std::string _name;
+    SpinPolicy _spinPolicy = SpinPolicy::kParkImmediately;
 
     boost::optional<SourceLocationHolder> _sourceLocation;
 };
@@ -228,6 +263,10 @@ public:
         return _identity;
     }
 
+    auto& spinLimit() {
+        return _spinLimit;
+    }
+
 private:
     const Identity _identity;
 
@@ -241,6 +280,10 @@ private:
     };
 
     Counts _counts;
+
+    // Pause-instruction budget for SpinPolicy::kAdaptiveSpin latches. Shared across all Mutexes
+    // registered under this Data so the observed hold times of one instance benefit the rest.
+    AtomicWord<int> _spinLimit{kInitialSpinLimit};
 };
 
 /**
@@ -348,6 +391,8 @@ public:
     ~Mutex();
 
 private:
+    bool _trySpinLock() noexcept;
+
     void _onContendedLock() noexcept;
     void _onQuickLock() noexcept;
     void _onSlowLock() noexcept;
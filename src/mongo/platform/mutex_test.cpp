@@ -31,6 +31,7 @@
 
 #include "mongo/config.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/thread.h"
 
 namespace mongo {
 TEST(MutexTest, BasicSingleThread) {
@@ -42,6 +43,22 @@ TEST(MutexTest, BasicSingleThread) {
     m.unlock();
 }
 
+TEST(MutexTest, AdaptiveSpinBehavesLikeAMutex) {
+    auto m = MONGO_MAKE_LATCH("adaptiveSpinLatchForTest", latch_detail::SpinPolicy::kAdaptiveSpin);
+    m.lock();
+    ASSERT(!m.try_lock());
+    m.unlock();
+    ASSERT(m.try_lock());
+
+    // Exercise the contended path: the waiter spins and then parks if the holder takes too long.
+    stdx::thread waiter([&] {
+        m.lock();
+        m.unlock();
+    });
+    m.unlock();
+    waiter.join();
+}
+
 #ifndef MONGO_CONFIG_USE_RAW_LATCHES
 namespace {
 // Since this MONGO_MAKE_LATCH has no arguments, the mutex is anonymous
@@ -69,10 +69,10 @@ std::unique_ptr<ReplyInterface> makeReply(const Message* unownedMessage) {
     }
 }
 
-OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage) {
+OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage, bool trustedMessage) {
     switch (unownedMessage.operation()) {
         case mongo::dbMsg:
-            return OpMsgRequest::parseOwned(unownedMessage);
+            return OpMsgRequest::parseOwned(unownedMessage, trustedMessage);
         case mongo::dbQuery:
             return opMsgRequestFromLegacyRequest(unownedMessage);
         default:
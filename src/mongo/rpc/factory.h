@@ -62,9 +62,11 @@ inline Message messageFromOpMsgRequest(ProtocolSet clientProtos,
 }
 
 /**
- * Parses the message (from any protocol) into an OpMsgRequest.
+ * Parses the message (from any protocol) into an OpMsgRequest. 'trustedMessage' skips deep BSON
+ * validation for messages serialized in-process, see OpMsg::parse().
  */
-OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage);
+OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage,
+                                         bool trustedMessage = false);
 
 /**
  * Returns the appropriate concrete ReplyBuilder.
@@ -129,11 +129,17 @@ void OpMsg::appendChecksum(Message* message) {
 #endif
 }
 
-OpMsg OpMsg::parse(const Message& message) try {
+OpMsg OpMsg::parse(const Message& message, bool trustedMessage) try {
     // It is the caller's responsibility to call the correct parser for a given message type.
     invariant(!message.empty());
     invariant(message.operation() == dbMsg);
 
+    // Deep BSON validation is redundant for trusted messages: their documents were serialized
+    // in-process from BSONObjs that were already valid.
+    auto readObj = [&](BufReader& buf) {
+        return trustedMessage ? buf.read<BSONObj>() : BSONObj(buf.read<Validated<BSONObj>>());
+    };
+
     const uint32_t flags = OpMsg::flags(message);
     uassert(ErrorCodes::IllegalOpMsgFlag,
             str::stream() << "Message contains illegal flags value: Ob"
@@ -162,7 +168,7 @@ OpMsg OpMsg::parse(const Message& message) try {
             case Section::kBody: {
                 uassert(40430, "Multiple body sections in message", !haveBody);
                 haveBody = true;
-                msg.body = sectionsBuf.read<Validated<BSONObj>>();
+                msg.body = readObj(sectionsBuf);
                 break;
             }
 
@@ -184,8 +190,29 @@ OpMsg OpMsg::parse(const Message& message) try {
                         !msg.getSequence(name));  // TODO IDL
 
                 msg.sequences.push_back({name.toString()});
+                auto& objs = msg.sequences.back().objs;
+
+                // Bulk writes can carry tens of thousands of documents in a single sequence, so
+                // size the vector exactly before parsing rather than letting it grow through
+                // repeated reallocation. This walk only touches the 4-byte length prefix of each
+                // document; any malformation it encounters is left for the validating read below
+                // to diagnose and report.
+                {
+                    size_t count = 0;
+                    const char* pos = static_cast<const char*>(seqBuf.pos());
+                    const char* end = pos + seqBuf.remaining();
+                    while (end - pos >= static_cast<ptrdiff_t>(sizeof(int32_t))) {
+                        const auto objSize = ConstDataView(pos).read<LittleEndian<int32_t>>();
+                        if (objSize < BSONObj::kMinBSONLength || objSize > end - pos)
+                            break;
+                        ++count;
+                        pos += objSize;
+                    }
+                    objs.reserve(count);
+                }
+
                 while (!seqBuf.atEof()) {
-                    msg.sequences.back().objs.push_back(seqBuf.read<Validated<BSONObj>>());
+                    objs.push_back(readObj(seqBuf));
                 }
                 break;
             }
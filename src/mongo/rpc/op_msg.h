@@ -119,14 +119,18 @@ struct OpMsg {
 
     /**
      * Parses and returns an OpMsg containing unowned BSON.
+     *
+     * 'trustedMessage' skips deep validation of the BSON documents in the message. It must only
+     * be set for messages that were serialized in-process from already-valid BSONObjs, such as
+     * DBDirectClient loopback requests; anything read from the network must be validated.
      */
-    static OpMsg parse(const Message& message);
+    static OpMsg parse(const Message& message, bool trustedMessage = false);
 
     /**
      * Parses and returns an OpMsg containing owned BSON.
      */
-    static OpMsg parseOwned(const Message& message) {
-        auto msg = parse(message);
+    static OpMsg parseOwned(const Message& message, bool trustedMessage = false) {
+        auto msg = parse(message, trustedMessage);
         msg.shareOwnershipWith(message.sharedBuffer());
         return msg;
     }
@@ -170,12 +174,12 @@ struct OpMsgRequest : public OpMsg {
     OpMsgRequest() = default;
     explicit OpMsgRequest(OpMsg&& generic) : OpMsg(std::move(generic)) {}
 
-    static OpMsgRequest parse(const Message& message) {
-        return OpMsgRequest(OpMsg::parse(message));
+    static OpMsgRequest parse(const Message& message, bool trustedMessage = false) {
+        return OpMsgRequest(OpMsg::parse(message, trustedMessage));
     }
 
-    static OpMsgRequest parseOwned(const Message& message) {
-        return OpMsgRequest(OpMsg::parseOwned(message));
+    static OpMsgRequest parseOwned(const Message& message, bool trustedMessage = false) {
+        return OpMsgRequest(OpMsg::parseOwned(message, trustedMessage));
     }
 
     static OpMsgRequest fromDBAndBody(StringData db,
@@ -223,6 +227,19 @@ public:
         skipHeaderAndFlags();
     }
 
+    /**
+     * Seeds the builder with `buffer` rather than allocating fresh, letting callers recycle a
+     * previous message's buffer. The buffer must not be shared. An empty buffer is equivalent to
+     * the default constructor.
+     */
+    explicit OpMsgBuilder(SharedBuffer buffer)
+        : _buf(buffer ? 0 : BufBuilder::kDefaultInitSizeBytes) {
+        if (buffer) {
+            _buf.useSharedBuffer(std::move(buffer));
+        }
+        skipHeaderAndFlags();
+    }
+
     /**
      * See the documentation for DocSequenceBuilder below.
      */
@@ -53,6 +53,14 @@ private:
 
 class OpMsgReplyBuilder final : public rpc::ReplyBuilderInterface {
 public:
+    OpMsgReplyBuilder() = default;
+
+    /**
+     * Builds the reply into `buffer` rather than a fresh allocation. The buffer must not be
+     * shared; callers recycle the buffer backing a previous reply once the wire has released it.
+     */
+    explicit OpMsgReplyBuilder(SharedBuffer buffer) : _builder(std::move(buffer)) {}
+
     ReplyBuilderInterface& setRawCommandReply(const BSONObj& reply) override {
         _builder.beginBody().appendElements(reply);
         return *this;
@@ -761,6 +761,36 @@ TEST(OpMsgSerializer, SetFlagWorks) {
     }
 }
 
+TEST(OpMsgSerializer, RecycledBufferIsReusedAndProducesSameBytes) {
+    OpMsgBuilder fresh;
+    fresh.setBody(fromjson("{ping: 1}"));
+    auto expected = fresh.finish();
+
+    // Build the same message into a recycled buffer and check that the buffer was actually
+    // reused and that the resulting bytes are identical.
+    auto recycled = SharedBuffer::allocate(1024);
+    const char* recycledPtr = recycled.get();
+    OpMsgBuilder seeded(std::move(recycled));
+    seeded.setBody(fromjson("{ping: 1}"));
+    auto msg = seeded.finish();
+
+    ASSERT_EQ(static_cast<const void*>(msg.buf()), static_cast<const void*>(recycledPtr));
+    ASSERT_EQ(msg.dataSize(), expected.dataSize());
+    ASSERT_EQ(memcmp(msg.singleData().data(), expected.singleData().data(), msg.dataSize()), 0);
+}
+
+TEST(OpMsgSerializer, EmptyRecycledBufferBehavesLikeDefaultConstruction) {
+    OpMsgBuilder seeded{SharedBuffer{}};
+    seeded.setBody(fromjson("{ping: 1}"));
+
+    testSerializer(seeded.finish(),
+                   OpMsgBytes{
+                       kNoFlags,  //
+                       kBodySection,
+                       fromjson("{ping: 1}"),
+                   });
+}
+
 TEST(OpMsgRequest, GetDatabaseWorks) {
     OpMsgRequest msg;
     msg.body = fromjson("{$db: 'foo'}");
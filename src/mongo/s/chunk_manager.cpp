@@ -191,6 +191,21 @@ ShardVersionMap ChunkMap::constructShardVersionMap() const {
     return shardVersions;
 }
 
+ShardPlacementRuns ChunkMap::constructShardPlacementRuns() const {
+    ShardPlacementRuns runs;
+
+    for (const auto& chunk : _chunkMap) {
+        const auto& shardId = chunk->getShardIdAt(boost::none);
+        if (runs.empty() || runs.back().shardId != shardId) {
+            runs.push_back({chunk->getMaxKeyString(), shardId});
+        } else {
+            runs.back().maxKeyString = chunk->getMaxKeyString();
+        }
+    }
+
+    return runs;
+}
+
 void ChunkMap::appendChunk(const std::shared_ptr<ChunkInfo>& chunk) {
     appendChunkTo(_chunkMap, chunk);
     const auto chunkVersion = chunk->getLastmod();
@@ -223,40 +238,68 @@ void validateChunk(const std::shared_ptr<ChunkInfo>& chunk, const ChunkVersion&
 ChunkMap ChunkMap::createMerged(
     const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks) const {
     size_t chunkMapIndex = 0;
-    size_t changedChunkIndex = 0;
 
     ChunkMap updatedChunkMap(
         getVersion().epoch(), getVersion().getTimestamp(), _chunkMap.size() + changedChunks.size());
 
-    while (chunkMapIndex < _chunkMap.size() || changedChunkIndex < changedChunks.size()) {
-        if (chunkMapIndex >= _chunkMap.size()) {
-            validateChunk(changedChunks[changedChunkIndex], getVersion());
-            updatedChunkMap.appendChunk(changedChunks[changedChunkIndex++]);
-            continue;
-        }
-
-        if (changedChunkIndex >= changedChunks.size()) {
+    // Changed chunks are validated below to carry versions at least as recent as the current
+    // collection version, so the merged collection version can be seeded with the current one and
+    // then only needs to be advanced by the changed chunks themselves. This allows the unchanged
+    // runs of the map, which are copied wholesale below, to skip the per-chunk version bookkeeping
+    // of appendChunk().
+    updatedChunkMap._collectionVersion = _collectionVersion;
+
+    // Copies the existing chunks in positions [chunkMapIndex, end) into the updated map. Only a
+    // prefix of such a run can overlap the most recently appended chunk and must go through
+    // appendChunk() so that superseded chunks get discarded; the remainder is guaranteed to be
+    // conflict-free and is copied in bulk. For a refresh which changes only a handful of a large
+    // collection's chunks this turns almost the entire merge into two bulk copies, instead of
+    // re-running the overlap and version checks against every chunk in the map.
+    const auto appendExistingUpTo = [&](size_t end) {
+        while (chunkMapIndex < end && !updatedChunkMap._chunkMap.empty() &&
+               _chunkMap[chunkMapIndex]->getRange().overlaps(
+                   updatedChunkMap._chunkMap.back()->getRange())) {
             updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
-            continue;
         }
 
-        auto overlap = _chunkMap[chunkMapIndex]->getRange().overlaps(
-            changedChunks[changedChunkIndex]->getRange());
-
-        if (overlap) {
-            auto& changedChunk = changedChunks[changedChunkIndex++];
-            auto& chunkInfo = _chunkMap[chunkMapIndex];
-
-            auto bytesInReplacedChunk = chunkInfo->getWritesTracker()->getBytesWritten();
+        updatedChunkMap._chunkMap.insert(updatedChunkMap._chunkMap.end(),
+                                         _chunkMap.begin() + chunkMapIndex,
+                                         _chunkMap.begin() + end);
+        chunkMapIndex = end;
+    };
+
+    for (const auto& changedChunk : changedChunks) {
+        validateChunk(changedChunk, getVersion());
+
+        // Existing chunks whose max is not past the changed chunk's min sort entirely before it
+        // and cannot overlap it, so the first candidate for an overlap can be located with a
+        // binary search on the precomputed max key strings.
+        const auto minKeyString = ShardKeyPattern::toKeyString(changedChunk->getRange().getMin());
+        const auto firstCandidate =
+            std::upper_bound(_chunkMap.begin() + chunkMapIndex,
+                             _chunkMap.end(),
+                             minKeyString,
+                             [](const std::string& minKeyString, const auto& chunkInfo) {
+                                 return minKeyString < chunkInfo->getMaxKeyString();
+                             });
+        appendExistingUpTo(firstCandidate - _chunkMap.begin());
+
+        if (chunkMapIndex < _chunkMap.size() &&
+            _chunkMap[chunkMapIndex]->getRange().overlaps(changedChunk->getRange())) {
+            // The changed chunk supersedes the chunk it overlaps, so it inherits the latter's
+            // tracked bytes. The superseded chunk is deliberately left in place: it may also
+            // overlap (and donate its tracked bytes to) the next changed chunk, and is discarded
+            // by appendChunk() once the merge moves past it.
+            auto bytesInReplacedChunk =
+                _chunkMap[chunkMapIndex]->getWritesTracker()->getBytesWritten();
             changedChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
-
-            validateChunk(changedChunk, getVersion());
-            updatedChunkMap.appendChunk(changedChunk);
-        } else {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
         }
+
+        updatedChunkMap.appendChunk(changedChunk);
     }
 
+    appendExistingUpTo(_chunkMap.size());
+
     return updatedChunkMap;
 }
 
@@ -333,7 +376,8 @@ RoutingTableHistory::RoutingTableHistory(
       _maxChunkSizeBytes(maxChunkSizeBytes),
       _allowMigrations(allowMigrations),
       _chunkMap(std::move(chunkMap)),
-      _shardVersions(_chunkMap.constructShardVersionMap()) {}
+      _shardVersions(_chunkMap.constructShardVersionMap()),
+      _shardPlacementRuns(_chunkMap.constructShardPlacementRuns()) {}
 
 void RoutingTableHistory::setShardStale(const ShardId& shardId) {
     if (gEnableFinerGrainedCatalogCacheRefresh) {
@@ -491,18 +535,47 @@ void ChunkManager::getShardIdsForRange(const BSONObj& min,
         return;
     }
 
-    _rt->optRt->forEachOverlappingChunk(min, max, true, [&](auto& chunkInfo) {
-        shardIds->insert(chunkInfo->getShardIdAt(_clusterTime));
+    // When not reading from a snapshot the chunk history is irrelevant, so the range can be
+    // targeted against the coalesced per-shard placement runs rather than by probing every chunk
+    // the range overlaps, which on a fragmented collection can be thousands of chunks per query.
+    if (!_clusterTime) {
+        const auto& placementRuns = _rt->optRt->_shardPlacementRuns;
+        const auto minKeyString = ShardKeyPattern::toKeyString(min);
+        const auto maxKeyString = ShardKeyPattern::toKeyString(max);
+
+        // Runs are keyed by the max bound of their last chunk, so the first run whose key is past
+        // 'min' is the one containing it, mirroring _findIntersectingChunk on the chunk map.
+        auto it = std::upper_bound(placementRuns.begin(),
+                                   placementRuns.end(),
+                                   minKeyString,
+                                   [](const std::string& keyString, const auto& run) {
+                                       return keyString < run.maxKeyString;
+                                   });
+
+        for (; it != placementRuns.end(); ++it) {
+            shardIds->insert(it->shardId);
+
+            // No need to iterate through the rest of the runs, because we already know we need to
+            // use all shards.
+            if (shardIds->size() == _rt->optRt->_shardVersions.size()) {
+                break;
+            }
 
-        // No need to iterate through the rest of the ranges, because we already know we need to use
-        // all shards. However, this optimization does not apply when we are reading from a snapshot
-        // because _shardVersions contains shards with chunks and is built based on the last
-        // refresh. Therefore, it is possible for _shardVersions to have fewer entries if a shard
-        // no longer owns chunks when it used to at _clusterTime.
-        if (!_clusterTime && shardIds->size() == _rt->optRt->_shardVersions.size()) {
-            return false;
+            // The run whose key is at or past 'max' is the last one the (max-inclusive) range can
+            // reach.
+            if (maxKeyString < it->maxKeyString) {
+                break;
+            }
         }
 
+        return;
+    }
+
+    // Reading from a snapshot, so each chunk must be consulted for the shard which owned it at
+    // _clusterTime. The placement runs (and _shardVersions) only describe the latest placement
+    // and may not match the ownership as of that time.
+    _rt->optRt->forEachOverlappingChunk(min, max, true, [&](auto& chunkInfo) {
+        shardIds->insert(chunkInfo->getShardIdAt(_clusterTime));
         return true;
     });
 }
@@ -67,6 +67,18 @@ struct ShardVersionTargetingInfo {
 // shard is currently marked as needing a catalog cache refresh (stale).
 using ShardVersionMap = stdx::unordered_map<ShardId, ShardVersionTargetingInfo, ShardId::Hasher>;
 
+// A maximal run of consecutive chunks which all reside on the same shard (at the latest known
+// placement), summarized by the precomputed KeyString of the max bound of the run's last chunk.
+struct ShardPlacementRun {
+    std::string maxKeyString;
+    ShardId shardId;
+};
+
+// Coalesced per-shard runs for an entire routing table, ordered by maxKeyString. On collections
+// whose chunks are fragmented across shards this is typically orders of magnitude smaller than the
+// chunk map itself, which makes it a cheap summary for range targeting.
+using ShardPlacementRuns = std::vector<ShardPlacementRun>;
+
 /**
  * This class serves as a Facade around how the mapping of ranges to chunks is represented. It also
  * provides a simpler, high-level interface for domain specific operations without exposing the
@@ -116,6 +128,7 @@ public:
     }
 
     ShardVersionMap constructShardVersionMap() const;
+    ShardPlacementRuns constructShardPlacementRuns() const;
     std::shared_ptr<ChunkInfo> findIntersectingChunk(const BSONObj& shardKey) const;
 
     void appendChunk(const std::shared_ptr<ChunkInfo>& chunk);
@@ -383,6 +396,12 @@ private:
     // Note: this declaration must not be moved before _chunkMap since it is initialized by using
     // the _chunkMap instance.
     ShardVersionMap _shardVersions;
+
+    // Coalesced runs of consecutive chunks per shard, used to answer range targeting requests
+    // against the latest chunk placement without probing every chunk the range overlaps.
+    // Note: this declaration must not be moved before _chunkMap since it is initialized by using
+    // the _chunkMap instance.
+    ShardPlacementRuns _shardPlacementRuns;
 };
 
 /**
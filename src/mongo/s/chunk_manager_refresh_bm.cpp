@@ -35,6 +35,7 @@
 #include "mongo/db/s/collection_metadata.h"
 #include "mongo/platform/random.h"
 #include "mongo/s/chunk_manager.h"
+#include "mongo/s/shard_key_pattern.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/str.h"
 
@@ -129,6 +130,30 @@ MONGO_COMPILER_NOINLINE auto runIncrementalUpdate(const CollectionMetadata& cm,
                               ShardId("shard0"));
 }
 
+// Produces the chunk updates that a refresh would see after 'nMoved' distinct chunks, spread
+// evenly across the collection, have been migrated between shard0 and shard1. The returned chunks
+// are in ascending range (and version) order, as they would arrive from the config server.
+std::vector<ChunkType> makeMoveChunkUpdates(const CollectionMetadata& metadata,
+                                            int nChunks,
+                                            int nMoved) {
+    invariant(nMoved <= nChunks);
+
+    auto postMoveVersion = metadata.getChunkManager()->getVersion();
+    std::vector<ChunkType> newChunks;
+    newChunks.reserve(nMoved);
+
+    for (int i = 0; i < nMoved; ++i) {
+        postMoveVersion.incMajor();
+        const auto chunkIdx = int(int64_t(i) * nChunks / nMoved);
+        newChunks.emplace_back(kNss,
+                               getRangeForChunk(chunkIdx, nChunks),
+                               postMoveVersion,
+                               ShardId(str::stream() << "shard" << (i % 2)));
+    }
+
+    return newChunks;
+}
+
 void BM_IncrementalRefreshOfPessimalBalancedDistribution(benchmark::State& state) {
     const int nShards = state.range(0);
     const int nChunks = state.range(1);
@@ -149,7 +174,29 @@ void BM_IncrementalRefreshOfPessimalBalancedDistribution(benchmark::State& state
 BENCHMARK(BM_IncrementalRefreshOfPessimalBalancedDistribution)
     ->Args({2, 50000})
     ->Args({2, 250000})
-    ->Args({2, 500000});
+    ->Args({2, 500000})
+    ->Args({2, 1000000});
+
+void BM_IncrementalRefreshOfChunkDeltas(benchmark::State& state) {
+    const int nChunks = state.range(0);
+    const int nMoved = state.range(1);
+    auto metadata = makeChunkManagerWithPessimalBalancedDistribution(2, nChunks);
+    auto newChunks = makeMoveChunkUpdates(metadata, nChunks, nMoved);
+
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(runIncrementalUpdate(metadata, newChunks));
+    }
+
+    state.SetItemsProcessed(state.iterations() * nMoved);
+}
+
+BENCHMARK(BM_IncrementalRefreshOfChunkDeltas)
+    ->Args({50000, 2})
+    ->Args({500000, 2})
+    ->Args({500000, 200})
+    ->Args({1000000, 2})
+    ->Args({1000000, 200})
+    ->Args({1000000, 2000});
 
 template <typename ShardSelectorFn>
 auto BM_FullBuildOfChunkManager(benchmark::State& state, ShardSelectorFn selectShard) {
@@ -374,6 +421,66 @@ void BM_RangeOverlapsChunk(benchmark::State& state,
     state.SetItemsProcessed(state.iterations());
 }
 
+// Number of documents per simulated insert batch.
+constexpr int kBatchSize = 1000;
+
+template <typename CollectionMetadataBuilderFn>
+void BM_TargetInsertBatch(benchmark::State& state,
+                          CollectionMetadataBuilderFn makeCollectionMetadata) {
+    const int nShards = state.range(0);
+    const int nChunks = state.range(1);
+
+    auto metadata = makeCollectionMetadata(nShards, nChunks);
+    const ShardKeyPattern shardKeyPattern(BSON("_id" << 1));
+
+    // The generated keys double as the documents being inserted.
+    auto docs = makeKeys(nChunks);
+    auto docsIter = makeCircularIterator(docs);
+
+    for (auto keepRunning : state) {
+        for (int i = 0; i < kBatchSize; ++i) {
+            auto shardKey = shardKeyPattern.extractShardKeyFromDoc(*docsIter);
+            benchmark::DoNotOptimize(
+                metadata.getChunkManager()->findIntersectingChunkWithSimpleCollation(shardKey));
+            ++docsIter;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+// Models the router's recovery loop after a write batch fails with a stale shard version: the
+// routing table is refreshed incrementally and the whole batch is targeted again.
+void BM_RetargetBatchAfterRefresh(benchmark::State& state) {
+    const int nShards = state.range(0);
+    const int nChunks = state.range(1);
+
+    auto metadata = makeChunkManagerWithPessimalBalancedDistribution(nShards, nChunks);
+    auto newChunks = makeMoveChunkUpdates(metadata, nChunks, 2);
+    const ShardKeyPattern shardKeyPattern(BSON("_id" << 1));
+
+    auto docs = makeKeys(nChunks);
+    auto docsIter = makeCircularIterator(docs);
+
+    for (auto keepRunning : state) {
+        auto refreshedMetadata = runIncrementalUpdate(metadata, newChunks);
+        for (int i = 0; i < kBatchSize; ++i) {
+            auto shardKey = shardKeyPattern.extractShardKeyFromDoc(*docsIter);
+            benchmark::DoNotOptimize(
+                refreshedMetadata.getChunkManager()->findIntersectingChunkWithSimpleCollation(
+                    shardKey));
+            ++docsIter;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+BENCHMARK(BM_RetargetBatchAfterRefresh)
+    ->Args({2, 50000})
+    ->Args({2, 500000})
+    ->Args({2, 1000000});
+
 // The following was adapted from the BENCHMARK_CAPTURE() macro where the
 // benchmark::internal::Benchmark* is returned rather than declared as a static variable.
 #define REGISTER_BENCHMARK_CAPTURE(func, test_case_name, ...) \
@@ -406,6 +513,10 @@ MONGO_INITIALIZER(RegisterBenchmarks)(InitializerContext* context) {
             BM_RangeOverlapsChunk, Pessimal, makeChunkManagerWithPessimalBalancedDistribution),
         REGISTER_BENCHMARK_CAPTURE(
             BM_RangeOverlapsChunk, Optimal, makeChunkManagerWithOptimalBalancedDistribution),
+        REGISTER_BENCHMARK_CAPTURE(
+            BM_TargetInsertBatch, Pessimal, makeChunkManagerWithPessimalBalancedDistribution),
+        REGISTER_BENCHMARK_CAPTURE(
+            BM_TargetInsertBatch, Optimal, makeChunkManagerWithOptimalBalancedDistribution),
     };
 
     for (auto bmCase : bmCases) {
@@ -413,6 +524,7 @@ MONGO_INITIALIZER(RegisterBenchmarks)(InitializerContext* context) {
             ->Args({10, 50000})
             ->Args({100, 50000})
             ->Args({1000, 50000})
+            ->Args({2, 1000000})
             ->Args({2, 2});
     }
 }
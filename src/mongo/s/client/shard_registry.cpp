@@ -111,8 +111,10 @@ void ShardRegistry::init(ServiceContext* service) {
                 "configServers"_attr = _initConfigServerCS.toString());
     {
         stdx::lock_guard<Latch> lk(_mutex);
-        _configShardData = ShardRegistryData::createWithConfigShardOnly(
-            _shardFactory->createShard(ShardId::kConfigServerId, _initConfigServerCS));
+        atomic_store(&_configShardData,
+                     std::make_shared<const ShardRegistryData>(
+                         ShardRegistryData::createWithConfigShardOnly(_shardFactory->createShard(
+                             ShardId::kConfigServerId, _initConfigServerCS))));
         _latestConnStrings[_initConfigServerCS.getSetName()] = _initConfigServerCS;
     }
 
@@ -210,6 +212,11 @@ ShardRegistry::Cache::LookupResult ShardRegistry::_lookup(OperationContext* opCt
                 "Finished ShardRegistry::_lookup",
                 "returnData"_attr = returnData.toBSON(),
                 "returnTime"_attr = returnTime);
+
+    // Publish the lookup result so that the per-request resolution paths can consult it without
+    // going through the cache's mutex.
+    atomic_store(&_latestData, std::make_shared<const Snapshot>(Snapshot{returnData, returnTime}));
+
     return Cache::LookupResult{returnData, returnTime};
 }
 
@@ -320,12 +327,26 @@ ConnectionString ShardRegistry::getConfigServerConnectionString() const {
 }
 
 std::shared_ptr<Shard> ShardRegistry::getConfigShard() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    return _configShardData.findShard(ShardId::kConfigServerId);
+    return atomic_load(&_configShardData)->findShard(ShardId::kConfigServerId);
 }
 
 StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opCtx,
                                                            const ShardId& shardId) {
+    // Fast path: if the most recently published shard table is already causally consistent with
+    // the current topology time, resolve the shard with a plain hash lookup, without touching the
+    // cache's mutex or allocating any futures.
+    if (auto latestData = atomic_load(&_latestData)) {
+        auto now = VectorClock::get(_service)->getTime();
+        Timestamp topologyTime = useActualTopologyTime() ? now.topologyTime().asTimestamp()
+                                                         : latestData->time.topologyTime;
+        Time requiredTime(topologyTime, _rsmIncrement.load(), _forceReloadIncrement.load());
+        if (requiredTime <= latestData->time) {
+            if (auto shard = latestData->data.findShard(shardId)) {
+                return shard;
+            }
+        }
+    }
+
     // First check if this is a non config shard lookup
     // This call will may be blocking if there is an ongoing or a need of a cache rebuild
     if (auto shard = _getData(opCtx)->findShard(shardId)) {
@@ -333,11 +354,8 @@ StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opC
     }
 
     // then check if this is a config shard (this call is blocking in any case)
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (auto shard = _configShardData.findShard(shardId)) {
-            return shard;
-        }
+    if (auto shard = atomic_load(&_configShardData)->findShard(shardId)) {
+        return shard;
     }
 
     // Reload and try again if the shard was not in the registry
@@ -401,10 +419,12 @@ void ShardRegistry::updateReplSetHosts(const ConnectionString& givenConnString,
 
         _latestConnStrings[setName] = newConnString;
 
-        if (auto shard = _configShardData.findByRSName(setName)) {
-            auto newData = ShardRegistryData::createFromExisting(
-                _configShardData, newConnString, _shardFactory.get());
-            _configShardData = newData;
+        auto configShardData = atomic_load(&_configShardData);
+        if (auto shard = configShardData->findByRSName(setName)) {
+            atomic_store(&_configShardData,
+                         std::make_shared<const ShardRegistryData>(
+                             ShardRegistryData::createFromExisting(
+                                 *configShardData, newConnString, _shardFactory.get())));
 
         } else {
             auto value = _rsmIncrement.addAndFetch(1);
@@ -444,10 +464,7 @@ void ShardRegistry::toBSON(BSONObjBuilder* result) const {
     BSONObjBuilder connStrings;
     auto data = _getCachedData();
     data->toBSON(&map, &hosts, &connStrings);
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        _configShardData.toBSON(&map, &hosts, &connStrings);
-    }
+    atomic_load(&_configShardData)->toBSON(&map, &hosts, &connStrings);
     result->append("map", map.obj());
     result->append("hosts", hosts.obj());
     result->append("connStrings", connStrings.obj());
@@ -464,6 +481,11 @@ void ShardRegistry::reload(OperationContext* opCtx) {
 
 void ShardRegistry::clearEntries() {
     _cache->invalidateAll();
+
+    // Reset the published snapshot so that, as with the invalidated cache, lock-free lookups no
+    // longer see the cleared entries. Its null topologyTime and zero increments cause the next
+    // getShard() to take the refreshing path.
+    atomic_store(&_latestData, std::make_shared<const Snapshot>());
 }
 
 void ShardRegistry::updateReplicaSetOnConfigServer(ServiceContext* serviceContext,
@@ -553,46 +575,46 @@ ShardRegistry::Cache::ValueHandle ShardRegistry::_getCachedData() const {
 
 std::shared_ptr<Shard> ShardRegistry::getShardNoReload(const ShardId& shardId) const {
     // First check if this is a config shard lookup.
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (auto shard = _configShardData.findShard(shardId)) {
-            return shard;
-        }
+    if (auto shard = atomic_load(&_configShardData)->findShard(shardId)) {
+        return shard;
     }
-    auto data = _getCachedData();
-    return data->findShard(shardId);
+    if (auto latestData = atomic_load(&_latestData)) {
+        return latestData->data.findShard(shardId);
+    }
+    return nullptr;
 }
 
 std::shared_ptr<Shard> ShardRegistry::getShardForHostNoReload(const HostAndPort& host) const {
     // First check if this is a config shard lookup.
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (auto shard = _configShardData.findByHostAndPort(host)) {
-            return shard;
-        }
+    if (auto shard = atomic_load(&_configShardData)->findByHostAndPort(host)) {
+        return shard;
     }
-    auto data = _getCachedData();
-    return data->findByHostAndPort(host);
+    if (auto latestData = atomic_load(&_latestData)) {
+        return latestData->data.findByHostAndPort(host);
+    }
+    return nullptr;
 }
 
 std::vector<ShardId> ShardRegistry::getAllShardIdsNoReload() const {
-    return _getCachedData()->getAllShardIds();
+    if (auto latestData = atomic_load(&_latestData)) {
+        return latestData->data.getAllShardIds();
+    }
+    return {};
 }
 
 int ShardRegistry::getNumShardsNoReload() const {
-    return _getCachedData()->getAllShardIds().size();
+    return getAllShardIdsNoReload().size();
 }
 
 std::shared_ptr<Shard> ShardRegistry::_getShardForRSNameNoReload(const std::string& name) const {
     // First check if this is a config shard lookup.
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (auto shard = _configShardData.findByRSName(name)) {
-            return shard;
-        }
+    if (auto shard = atomic_load(&_configShardData)->findByRSName(name)) {
+        return shard;
     }
-    auto data = _getCachedData();
-    return data->findByRSName(name);
+    if (auto latestData = atomic_load(&_latestData)) {
+        return latestData->data.findByRSName(name);
+    }
+    return nullptr;
 }
 
 ////////////// ShardRegistryData //////////////////
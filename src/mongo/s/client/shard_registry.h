@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -398,6 +399,15 @@ private:
 
     using Cache = ReadThroughCache<Singleton, ShardRegistryData, Time>;
 
+    /**
+     * The ShardRegistryData together with the Time it corresponds to, as returned by the most
+     * recently completed lookup.
+     */
+    struct Snapshot {
+        ShardRegistryData data;
+        Time time;
+    };
+
     Cache::LookupResult _lookup(OperationContext* opCtx,
                                 const Singleton& key,
                                 const Cache::ValueHandle& cachedData,
@@ -472,11 +482,20 @@ private:
     AtomicWord<Increment> _rsmIncrement{0};
     AtomicWord<Increment> _forceReloadIncrement{0};
 
-    // Protects _configShardData, and _latestNewConnStrings.
+    // Protects _latestConnStrings, and writes to _configShardData.
     mutable Mutex _mutex = MONGO_MAKE_LATCH("ShardRegistry::_mutex");
 
-    // Store a reference to the configShard.
-    ShardRegistryData _configShardData;
+    // Store a reference to the configShard. Only ever replaced (under _mutex) with a freshly
+    // allocated copy, and read lock-free via atomic_load, so that resolving the config shard does
+    // not contend on any mutex.
+    std::shared_ptr<const ShardRegistryData> _configShardData{
+        std::make_shared<const ShardRegistryData>()};
+
+    // The result of the most recently completed lookup, published via atomic_store by _lookup()
+    // (and reset by clearEntries()), and read lock-free via atomic_load by the per-request shard
+    // resolution paths. May briefly be ahead of what the _cache has stored, which is harmless
+    // since it only ever moves forward in Time. Null until the first lookup has completed.
+    std::shared_ptr<const Snapshot> _latestData;
 
     // The key is replset name (the type is ShardId just to take advantage of its hasher).
     LatestConnStrings _latestConnStrings;
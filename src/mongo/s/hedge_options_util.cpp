@@ -30,6 +30,7 @@
 #include "mongo/s/hedge_options_util.h"
 
 #include "mongo/s/mongos_server_parameters_gen.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -45,6 +46,31 @@ const std::set<std::string> supportedCmds{"collStats",
                                           "listCollections",
                                           "listIndexes",
                                           "planCacheListFilters"};
+
+// Tracks the hedged read budget as a fixed one-second window. Counter updates race with window
+// rollover, but the budget is a load-shedding backstop rather than an exact limit, so being off
+// by a few hedges around a window boundary is acceptable in exchange for staying lock-free.
+AtomicWord<long long> hedgingWindowStartMillis{0};
+AtomicWord<int> hedgedReadsInWindow{0};
+
+// Returns whether the current operation fits in the hedged read budget configured through the
+// maxHedgedReadsPerSecond server parameter. Operations beyond the budget are simply not hedged,
+// so exhausting the budget degrades hedging rather than the reads themselves.
+bool tryConsumeHedgingBudget() {
+    const auto budget = gMaxHedgedReadsPerSecond.load();
+    if (budget == 0) {
+        return true;
+    }
+
+    const auto nowMillis = Date_t::now().toMillisSinceEpoch();
+    auto windowStart = hedgingWindowStartMillis.load();
+    if (nowMillis - windowStart >= 1000 &&
+        hedgingWindowStartMillis.compareAndSwap(&windowStart, nowMillis)) {
+        hedgedReadsInWindow.store(0);
+    }
+
+    return hedgedReadsInWindow.addAndFetch(1) <= budget;
+}
 }  // namespace
 
 boost::optional<executor::RemoteCommandRequestOnAny::HedgeOptions> extractHedgeOptions(
@@ -56,7 +82,7 @@ boost::optional<executor::RemoteCommandRequestOnAny::HedgeOptions> extractHedgeO
 
     auto cmdName(cmdObj.firstElement().fieldNameStringData().toString());
 
-    if (supportedCmds.count(cmdName)) {
+    if (supportedCmds.count(cmdName) && tryConsumeHedgingBudget()) {
         return executor::RemoteCommandRequestOnAny::HedgeOptions{1,
                                                                  gMaxTimeMSForHedgedReads.load()};
     }
@@ -92,11 +92,13 @@ protected:
 
     static inline const std::string kReadHedgingModeFieldName = "readHedgingMode";
     static inline const std::string kMaxTimeMSForHedgedReadsFieldName = "maxTimeMSForHedgedReads";
+    static inline const std::string kMaxHedgedReadsPerSecondFieldName = "maxHedgedReadsPerSecond";
     static inline const int kMaxTimeMSForHedgedReadsDefault = 10;
 
     static inline const BSONObj kDefaultParameters =
         BSON(kReadHedgingModeFieldName << "on" << kMaxTimeMSForHedgedReadsFieldName
-                                       << kMaxTimeMSForHedgedReadsDefault);
+                                       << kMaxTimeMSForHedgedReadsDefault
+                                       << kMaxHedgedReadsPerSecondFieldName << 0);
 
 private:
     ServiceContext::UniqueServiceContext _serviceCtx = ServiceContext::make();
@@ -191,5 +193,34 @@ TEST_F(HedgeOptionsUtilTestFixture, MaxTimeMSForHedgedReads) {
     checkHedgeOptions(parameters, cmdObj, rspObj, true, 100);
 }
 
+TEST_F(HedgeOptionsUtilTestFixture, HedgingBudgetExhaustion) {
+    const auto cmdObj = BSON("find" << kCollName);
+    const auto rspObj = BSON("mode"
+                             << "nearest"
+                             << "hedge" << BSONObj());
+    const auto readPref = uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(rspObj));
+
+    // With a budget of one hedged read per second, a burst of requests must leave most of them
+    // unhedged. The exact number granted depends on how many one-second windows the loop spans,
+    // so only assert that the budget denied hedging to the bulk of the burst.
+    setParameters(BSON(kMaxHedgedReadsPerSecondFieldName << 1));
+
+    const int kNumRequests = 100;
+    int numHedged = 0;
+    for (int i = 0; i < kNumRequests; ++i) {
+        if (extractHedgeOptions(cmdObj, readPref)) {
+            ++numHedged;
+        }
+    }
+    ASSERT_LT(numHedged, kNumRequests / 2);
+
+    // An unlimited budget (the default) hedges every request.
+    setParameters(BSON(kMaxHedgedReadsPerSecondFieldName << 0));
+
+    for (int i = 0; i < kNumRequests; ++i) {
+        ASSERT_TRUE(extractHedgeOptions(cmdObj, readPref).has_value());
+    }
+}
+
 }  // namespace
 }  // namespace mongo
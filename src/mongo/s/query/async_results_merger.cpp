@@ -56,34 +56,6 @@ namespace {
 // Maximum number of retries for network and replication NotPrimary errors (per host).
 const int kMaxNumFailedHostRetryAttempts = 3;
 
-/**
- * Returns the sort key out of the $sortKey metadata field in 'obj'. The sort key should be
- * formatted as an array with one value per field of the sort pattern:
- *  {..., $sortKey: [<firstSortKeyComponent>, <secondSortKeyComponent>, ...], ...}
- *
- * This function returns the sort key not as an array, but as the equivalent BSONObj:
- *   {"0": <firstSortKeyComponent>, "1": <secondSortKeyComponent>}
- *
- * The return value is allowed to omit the key names, so the caller should not rely on the key names
- * being present. That is, the return value could consist of an object such as
- *   {"": <firstSortKeyComponent>, "": <secondSortKeyComponent>}
- *
- * If 'compareWholeSortKey' is true, then the value inside the $sortKey is directly interpreted as a
- * single-element sort key. For example, given the document
- *   {..., $sortKey: <value>, ...}
- * and 'compareWholeSortKey'=true, this function will return
- *   {"": <value>}
- */
-BSONObj extractSortKey(BSONObj obj, bool compareWholeSortKey) {
-    auto key = obj[AsyncResultsMerger::kSortKeyField];
-    invariant(key);
-    if (compareWholeSortKey) {
-        return key.wrap();
-    }
-    invariant(key.type() == BSONType::Array);
-    return key.embeddedObject();
-}
-
 /**
  * Returns an int less than 0 if 'leftSortKey' < 'rightSortKey', 0 if the two are equal, and an int
  * > 0 if 'leftSortKey' > 'rightSortKey' according to the pattern 'sortKeyPattern'.
@@ -107,8 +79,7 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(params.getTailableMode().value_or(TailableModeEnum::kNormal)),
       _params(std::move(params)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _mergeQueue(MergingComparator(_remotes, _params.getSort().value_or(BSONObj()))),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (params.getTxnNumber()) {
         invariant(params.getSessionId());
@@ -320,9 +291,7 @@ bool AsyncResultsMerger::_readySortedTailable(WithLock lk) {
     }
 
     auto smallestRemote = _mergeQueue.top();
-    auto smallestResult = _remotes[smallestRemote].docBuffer.front();
-    auto keyWeWantToReturn =
-        extractSortKey(*smallestResult.getResult(), _params.getCompareWholeSortKey());
+    auto keyWeWantToReturn = _remotes[smallestRemote].sortKeyBuffer.front();
     // We should always have a minPromisedSortKey from every shard in the sorted tailable case.
     auto minPromisedSortKey = _getMinPromisedSortKey(lk);
     invariant(minPromisedSortKey);
@@ -379,6 +348,8 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
 
     ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
     _remotes[smallestRemote].docBuffer.pop();
+    BSONObj frontSortKey = _remotes[smallestRemote].sortKeyBuffer.front();
+    _remotes[smallestRemote].sortKeyBuffer.pop();
 
     // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
     // next result.
@@ -389,8 +360,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
     if (_tailableMode == TailableModeEnum::kTailableAndAwaitData) {
         if (_remotes[smallestRemote].eligibleForHighWaterMark) {
-            _highWaterMark =
-                extractSortKey(*front.getResult(), _params.getCompareWholeSortKey()).getOwned();
+            _highWaterMark = frontSortKey.getOwned();
         }
     }
 
@@ -736,6 +706,8 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
         remote.partialResultsReturned = (remote.status != ErrorCodes::ExchangePassthrough);
         std::queue<ClusterQueryResult> emptyBuffer;
         std::swap(remote.docBuffer, emptyBuffer);
+        std::queue<BSONObj> emptySortKeyBuffer;
+        std::swap(remote.sortKeyBuffer, emptySortKeyBuffer);
         remote.status = Status::OK();
         remote.cursorId = 0;
     }
@@ -808,6 +780,14 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                          << "' was not of type Object in document: " << obj);
                 return false;
             }
+
+            // Extract the sort key once now, so that merge comparisons do not have to re-extract
+            // it from the document. The $sortKey is formatted as an array with one value per field
+            // of the sort pattern and is compared as the equivalent (possibly unnamed-field)
+            // BSONObj; when 'compareWholeSortKey' is set, the value is directly interpreted as a
+            // single-element sort key and wrapped accordingly. Kept in lockstep with 'docBuffer'.
+            remote.sortKeyBuffer.push(_params.getCompareWholeSortKey() ? key.wrap()
+                                                                       : key.embeddedObject());
         }
 
         ClusterQueryResult result(obj);
@@ -925,12 +905,9 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
 //
 
 bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
-
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+    return compareSortKeys(
+               _remotes[lhs].sortKeyBuffer.front(), _remotes[rhs].sortKeyBuffer.front(), _sort) >
+        0;
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
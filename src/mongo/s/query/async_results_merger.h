@@ -306,6 +306,11 @@ private:
         // The buffer of results that have been retrieved but not yet returned to the caller.
         std::queue<ClusterQueryResult> docBuffer;
 
+        // When merging in sorted order, the sort key of each buffered result, extracted once at
+        // buffering time and kept in lockstep with 'docBuffer'. Allows merge comparisons to avoid
+        // re-extracting the key from the document. Always empty for unsorted merges.
+        std::queue<BSONObj> sortKeyBuffer;
+
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
@@ -323,10 +328,8 @@ private:
 
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        MergingComparator(const std::vector<RemoteCursorData>& remotes, const BSONObj& sort)
+            : _remotes(remotes), _sort(sort) {}
 
         bool operator()(const size_t& lhs, const size_t& rhs);
 
@@ -334,11 +337,6 @@ private:
         const std::vector<RemoteCursorData>& _remotes;
 
         const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
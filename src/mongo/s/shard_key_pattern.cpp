@@ -209,9 +209,24 @@ BSONElement ShardKeyPattern::extractHashedField(BSONObj keyPattern) {
     }
     return BSONElement();
 }
+std::vector<ShardKeyPattern::FieldExtractionStep> ShardKeyPattern::_makeExtractionSteps(
+    const BSONObj& keyPatternBSON, const std::vector<std::unique_ptr<FieldRef>>& paths) {
+    std::vector<FieldExtractionStep> steps;
+    steps.reserve(paths.size());
+
+    size_t pathIdx = 0;
+    for (auto&& patternEl : keyPatternBSON) {
+        steps.push_back({patternEl, paths[pathIdx++].get(), isHashedPatternEl(patternEl)});
+    }
+    invariant(pathIdx == paths.size());
+
+    return steps;
+}
+
 ShardKeyPattern::ShardKeyPattern(const BSONObj& keyPattern)
     : _keyPattern(keyPattern),
       _keyPatternPaths(parseShardKeyPattern(keyPattern)),
+      _extractionSteps(_makeExtractionSteps(_keyPattern.toBSON(), _keyPatternPaths)),
       _hasId(keyPattern.hasField("_id"_sd)),
       _hashedField(extractHashedField(keyPattern)) {}
 
@@ -355,9 +370,9 @@ BSONObj ShardKeyPattern::extractShardKeyFromIndexKeyData(
 
 BSONObj ShardKeyPattern::extractShardKeyFromDocumentKey(const BSONObj& documentKey) const {
     BSONObjBuilder keyBuilder;
-    for (auto&& shardKeyField : _keyPattern.toBSON()) {
+    for (const auto& step : _extractionSteps) {
         auto matchEl =
-            extractFieldFromDocumentKey(documentKey, shardKeyField.fieldNameStringData());
+            extractFieldFromDocumentKey(documentKey, step.patternEl.fieldNameStringData());
 
         if (matchEl.eoo()) {
             matchEl = kNullObj.firstElement();
@@ -369,12 +384,12 @@ BSONObj ShardKeyPattern::extractShardKeyFromDocumentKey(const BSONObj& documentK
             return BSONObj();
         }
 
-        if (isHashedPatternEl(shardKeyField)) {
+        if (step.isHashed) {
             keyBuilder.append(
-                shardKeyField.fieldNameStringData(),
+                step.patternEl.fieldNameStringData(),
                 BSONElementHasher::hash64(matchEl, BSONElementHasher::DEFAULT_HASH_SEED));
         } else {
-            keyBuilder.appendAs(matchEl, shardKeyField.fieldNameStringData());
+            keyBuilder.appendAs(matchEl, step.patternEl.fieldNameStringData());
         }
     }
     dassert(isShardKey(keyBuilder.asTempObj()));
@@ -393,8 +408,12 @@ BSONObj ShardKeyPattern::extractShardKeyFromDocumentKeyThrows(const BSONObj& doc
 
 BSONObj ShardKeyPattern::extractShardKeyFromDoc(const BSONObj& doc) const {
     BSONObjBuilder keyBuilder;
-    for (auto&& patternEl : _keyPattern.toBSON()) {
-        BSONElement matchEl = extractKeyElementFromDoc(doc, patternEl.fieldNameStringData());
+    for (const auto& step : _extractionSteps) {
+        // Any arrays found get immediately returned, as in extractKeyElementFromDoc(), and are
+        // rejected below. Using the pre-parsed path avoids reconstructing a FieldRef per field
+        // for every document.
+        size_t idxPath;
+        BSONElement matchEl = getFieldDottedOrArray(doc, *step.path, &idxPath);
 
         if (matchEl.eoo()) {
             matchEl = kNullObj.firstElement();
@@ -404,14 +423,14 @@ BSONObj ShardKeyPattern::extractShardKeyFromDoc(const BSONObj& doc) const {
             return BSONObj();
         }
 
-        if (isHashedPatternEl(patternEl)) {
+        if (step.isHashed) {
             keyBuilder.append(
-                patternEl.fieldName(),
+                step.patternEl.fieldName(),
                 BSONElementHasher::hash64(matchEl, BSONElementHasher::DEFAULT_HASH_SEED));
         } else {
             // NOTE: The matched element may *not* have the same field name as the path -
             // index keys don't contain field names, for example
-            keyBuilder.appendAs(matchEl, patternEl.fieldName());
+            keyBuilder.appendAs(matchEl, step.patternEl.fieldName());
         }
     }
 
@@ -313,11 +313,27 @@ public:
     };
 
 private:
+    // A single field of the pattern, precompiled for per-document shard key extraction: the
+    // pattern element, a pointer to the parsed path in '_keyPatternPaths' and whether the field
+    // is hashed. Avoids re-walking the pattern and re-parsing the dotted paths per document.
+    struct FieldExtractionStep {
+        BSONElement patternEl;
+        const FieldRef* path;
+        bool isHashed;
+    };
+
+    static std::vector<FieldExtractionStep> _makeExtractionSteps(
+        const BSONObj& keyPatternBSON, const std::vector<std::unique_ptr<FieldRef>>& paths);
+
     KeyPattern _keyPattern;
 
     // Ordered, parsed paths
     std::vector<std::unique_ptr<FieldRef>> _keyPatternPaths;
 
+    // Ordered extraction steps, one per shard key field. Refers to '_keyPattern' and
+    // '_keyPatternPaths', so this declaration must not be moved before them.
+    std::vector<FieldExtractionStep> _extractionSteps;
+
     bool _hasId;
     BSONElement _hashedField;
 };
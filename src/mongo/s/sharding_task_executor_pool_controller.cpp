@@ -226,6 +226,30 @@ auto ShardingTaskExecutorPoolController::updateHost(PoolId id, const HostState&
     // Update the target for just the pool first
     poolData.target = stats.requests + stats.active;
 
+    // Hold pools near their recent peak demand so that the next burst after a lull doesn't pay
+    // connection setup (including TLS handshakes) inline. The remembered peak halves once per
+    // demandHalfLifeMS of lower demand; a half-life of zero sizes pools on instantaneous demand.
+    const auto demandHalfLife = Milliseconds(gParameters.demandHalfLifeMS.load());
+    if (demandHalfLife > Milliseconds(0)) {
+        const auto now = this->now();
+        if (poolData.target >= poolData.peakDemand) {
+            poolData.peakDemand = poolData.target;
+            poolData.peakTime = now;
+        } else {
+            while (poolData.peakDemand > poolData.target &&
+                   now - poolData.peakTime >= demandHalfLife) {
+                poolData.peakDemand /= 2;
+                poolData.peakTime += demandHalfLife;
+            }
+            if (poolData.peakDemand <= poolData.target) {
+                poolData.peakDemand = poolData.target;
+                poolData.peakTime = now;
+            } else {
+                poolData.target = poolData.peakDemand;
+            }
+        }
+    }
+
     if (poolData.target < minConns) {
         poolData.target = minConns;
     } else if (poolData.target > maxConns) {
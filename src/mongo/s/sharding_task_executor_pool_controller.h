@@ -100,6 +100,8 @@ public:
         AtomicWord<int> pendingTimeoutMS;
         AtomicWord<int> toRefreshTimeoutMS;
 
+        AtomicWord<int> demandHalfLifeMS;
+
         synchronized_value<std::string> matchingStrategyString;
         AtomicWord<MatchingStrategy> matchingStrategy;
     };
@@ -192,6 +194,11 @@ private:
         // The number of connections the host should maintain
         size_t target = 0;
 
+        // A decaying peak of requests + active connections, used to keep this pool warm between
+        // bursts of traffic. The peak halves once per demandHalfLifeMS of lower demand.
+        size_t peakDemand = 0;
+        Date_t peakTime;
+
         // This host is able to shutdown
         bool isAbleToShutdown = false;
     };
@@ -43,6 +43,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/logv2/log.h"
 #include "mongo/scripting/dbdirectclient_factory.h"
+#include "mongo/scripting/engine_gen.h"
 #include "mongo/util/ctype.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/file.h"
@@ -306,7 +307,7 @@ ScriptingFunction Scope::createFunction(const char* code) {
         }
     }
 
-    FunctionCacheMap::iterator i = _cachedFunctions.find(code);
+    FunctionCacheMap::iterator i = _cachedFunctions.find(StringData(code));
     if (i != _cachedFunctions.end())
         return i->second;
 
@@ -363,7 +364,8 @@ public:
             return;
         }
 
-        if (Date_t::now() - scope->getCreateTime() > kMaxScopeReuseTime) {
+        if (Date_t::now() - scope->getCreateTime() >
+            Seconds(gJSScopeCacheMaxReuseSeconds.load())) {
             return;  // too old to save
         }
 
@@ -371,7 +373,11 @@ public:
             return;  // not saving errored scopes
         }
 
-        if (_pools.size() >= kMaxPoolSize) {
+        const size_t maxPoolSize = static_cast<size_t>(gJSScopeCacheSize.load());
+        if (maxPoolSize == 0) {
+            return;  // scope reuse disabled
+        }
+        while (_pools.size() >= maxPoolSize) {
             // prefer to keep recently-used scopes
             _pools.pop_back();
         }
@@ -409,10 +415,8 @@ private:
         string poolName;
     };
 
-    // Note: if these numbers change, reconsider choice of datastructure for _pools
-    static const unsigned kMaxPoolSize = 10;
-    constexpr static inline Seconds kMaxScopeReuseTime = Seconds(10);
-
+    // Note: if jsScopeCacheSize is raised well beyond its default, reconsider choice of
+    // datastructure for _pools (tryAcquire is a linear scan).
     typedef std::deque<ScopeAndPool> Pools;  // More-recently used Scopes are kept at the front.
     Pools _pools;                            // protected by _mutex
     Mutex _mutex = MONGO_MAKE_LATCH("ScopeCache::_mutex");
@@ -33,11 +33,17 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/service_context.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 typedef unsigned long long ScriptingFunction;
 typedef BSONObj (*NativeFunction)(const BSONObj& args, void* data);
-typedef std::map<std::string, ScriptingFunction> FunctionCacheMap;
+
+// Hashed container so that looking up a compiled function costs one hash of the source plus a
+// single comparison. $where and $function resolve their function for every document, so with an
+// ordered map the per-document lookup was an allocation for the key plus O(log n) full string
+// compares.
+typedef StringMap<ScriptingFunction> FunctionCacheMap;
 
 class DBClientBase;
 class OperationContext;
@@ -95,6 +95,13 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
         return {msg};
     }
 
+    if (_bypassRemaining > 0) {
+        // Recent traffic on this connection did not compress meaningfully, so skip the
+        // compressor until it's time to probe again.
+        --_bypassRemaining;
+        return {msg};
+    }
+
     LOGV2_DEBUG(22925,
                 3,
                 "Compressing message with {compressor}",
@@ -139,9 +146,32 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
     auto realCompressedSize = sws.getValue();
     outMessage.setLen(realCompressedSize + CompressionHeader::size() + MsgData::MsgDataHeaderSize);
 
+    _recordCompressionResult(inputHeader.dataLen(), realCompressedSize);
+
     return {Message(outputMessageBuffer)};
 }
 
+void MessageCompressorManager::_recordCompressionResult(int64_t bytesIn, int64_t bytesOut) {
+    _windowBytesIn += bytesIn;
+    _windowBytesOut += bytesOut;
+    if (_windowBytesIn < kAdaptiveSampleWindowBytes) {
+        return;
+    }
+
+    if (_windowBytesOut >= _windowBytesIn - (_windowBytesIn / kAdaptiveMinSavingsDenominator)) {
+        LOGV2_DEBUG(6174800,
+                    2,
+                    "Traffic on this connection is incompressible, pausing compression",
+                    "windowBytesIn"_attr = _windowBytesIn,
+                    "windowBytesOut"_attr = _windowBytesOut,
+                    "bypassMessages"_attr = kAdaptiveBypassMessages);
+        _bypassRemaining = kAdaptiveBypassMessages;
+    }
+
+    _windowBytesIn = 0;
+    _windowBytesOut = 0;
+}
+
 StatusWith<Message> MessageCompressorManager::decompressMessage(const Message& msg,
                                                                 MessageCompressorId* compressorId) {
     auto inputHeader = msg.header();
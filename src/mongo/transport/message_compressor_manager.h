@@ -123,9 +123,29 @@ public:
 
     static MessageCompressorManager& forSession(const transport::SessionHandle& session);
 
+    /*
+     * Compression results are sampled over windows of kAdaptiveSampleWindowBytes input bytes. If
+     * a window shrinks the data by less than 1/kAdaptiveMinSavingsDenominator, the traffic on
+     * this connection is effectively incompressible (e.g. replicating pre-compressed field data)
+     * and the next kAdaptiveBypassMessages messages are sent uncompressed, after which
+     * compression is probed again. Sending an uncompressed message is always permitted by the
+     * wire protocol, regardless of what was negotiated.
+     */
+    static constexpr int64_t kAdaptiveSampleWindowBytes = 128 * 1024;
+    static constexpr int64_t kAdaptiveMinSavingsDenominator = 20;
+    static constexpr int32_t kAdaptiveBypassMessages = 64;
+
 private:
+    void _recordCompressionResult(int64_t bytesIn, int64_t bytesOut);
+
     std::vector<MessageCompressorBase*> _negotiated;
     MessageCompressorRegistry* _registry;
+
+    // Adaptive compression bypass state. A manager serves a single session's (serialized)
+    // pipeline, so these need no synchronization.
+    int64_t _windowBytesIn = 0;
+    int64_t _windowBytesOut = 0;
+    int32_t _bypassRemaining = 0;
 };
 
 }  // namespace mongo
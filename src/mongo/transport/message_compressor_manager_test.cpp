@@ -343,6 +343,77 @@ TEST(MessageCompressorManager, SERVER_28008) {
     ASSERT_EQ(compressorId, zstdId);
 }
 
+Message buildMessageWithPayload(size_t dataSize, char fill) {
+    const auto bufferSize = MsgData::MsgDataHeaderSize + dataSize;
+    auto buf = SharedBuffer::allocate(bufferSize);
+    MsgData::View testView(buf.get());
+    testView.setId(123456);
+    testView.setResponseToMsgId(654321);
+    testView.setOperation(dbQuery);
+    testView.setLen(bufferSize);
+    memset(testView.data(), fill, dataSize);
+    return Message{buf};
+}
+
+TEST(MessageCompressorManager, AdaptiveBypassForIncompressibleTraffic) {
+    // The noop compressor never shrinks its input, so from the manager's point of view the
+    // traffic is perfectly incompressible.
+    auto registry = buildRegistry();
+    MessageCompressorManager manager(&registry);
+
+    BSONObjBuilder serverOutput;
+    std::vector<StringData> negotiator({"noop"_sd});
+    manager.serverNegotiate(negotiator, &serverOutput);
+
+    const size_t dataSize = 4096;
+    auto msg = buildMessageWithPayload(dataSize, 'x');
+
+    // Messages keep getting compressed until a full sample window has been observed.
+    const auto messagesPerWindow = MessageCompressorManager::kAdaptiveSampleWindowBytes /
+        static_cast<int64_t>(msg.header().dataLen());
+    for (int64_t i = 0; i < messagesPerWindow; i++) {
+        auto compressed = assertOk(manager.compressMessage(msg));
+        ASSERT_EQ(compressed.singleData().getNetworkOp(), dbCompressed);
+    }
+
+    // The window showed no savings, so the next batch of messages passes through uncompressed.
+    for (int32_t i = 0; i < MessageCompressorManager::kAdaptiveBypassMessages; i++) {
+        auto out = assertOk(manager.compressMessage(msg));
+        ASSERT_EQ(out.singleData().getNetworkOp(), dbQuery);
+    }
+
+    // Once the bypass is exhausted, compression is probed again.
+    auto probed = assertOk(manager.compressMessage(msg));
+    ASSERT_EQ(probed.singleData().getNetworkOp(), dbCompressed);
+}
+
+TEST(MessageCompressorManager, AdaptiveBypassLeavesCompressibleTrafficAlone) {
+    auto compressor = std::make_unique<SnappyMessageCompressor>();
+    const auto compressorName = compressor->getName();
+
+    MessageCompressorRegistry registry;
+    registry.setSupportedCompressors({compressorName});
+    registry.registerImplementation(std::move(compressor));
+    ASSERT_OK(registry.finalizeSupportedCompressors());
+
+    MessageCompressorManager manager(&registry);
+    BSONObjBuilder serverOutput;
+    std::vector<StringData> negotiator({StringData(compressorName)});
+    manager.serverNegotiate(negotiator, &serverOutput);
+
+    // Highly repetitive payloads compress well, so several windows' worth of messages should
+    // never trigger the bypass.
+    const size_t dataSize = 4096;
+    auto msg = buildMessageWithPayload(dataSize, 'a');
+
+    const auto messagesForThreeWindows = 3 * MessageCompressorManager::kAdaptiveSampleWindowBytes /
+        static_cast<int64_t>(msg.header().dataLen());
+    for (int64_t i = 0; i < messagesForThreeWindows; i++) {
+        auto compressed = assertOk(manager.compressMessage(msg));
+        ASSERT_EQ(compressed.singleData().getNetworkOp(), dbCompressed);
+    }
+}
+
 TEST(MessageCompressorManager, MessageSizeTooLarge) {
     auto registry = buildRegistry();
     MessageCompressorManager compManager(&registry);
@@ -38,6 +38,26 @@
 #include "mongo/transport/message_compressor_zstd.h"
 
 namespace mongo {
+namespace {
+
+// The one-shot ZSTD_compress()/ZSTD_decompress() entry points allocate and free a compression
+// context on every call. That overhead is negligible for large messages but dominates for the
+// small heartbeat and oplog-entry messages that make up most intra-cluster traffic, so we keep a
+// context per thread and reuse it. A single ZstdMessageCompressor instance is shared by all
+// connections, which makes per-thread the natural granularity for this state.
+ZSTD_CCtx* getThreadLocalCCtx() {
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx(ZSTD_createCCtx(),
+                                                                           ZSTD_freeCCtx);
+    return cctx.get();
+}
+
+ZSTD_DCtx* getThreadLocalDCtx() {
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx(ZSTD_createDCtx(),
+                                                                           ZSTD_freeDCtx);
+    return dctx.get();
+}
+
+}  // namespace
 
 ZstdMessageCompressor::ZstdMessageCompressor() : MessageCompressorBase(MessageCompressor::kZstd) {}
 
@@ -47,11 +67,18 @@ std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 
 StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
-    size_t ret = ZSTD_compress(const_cast<char*>(output.data()),
-                               output.length(),
-                               input.data(),
-                               input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+    auto* cctx = getThreadLocalCCtx();
+    if (!cctx) {
+        return Status{ErrorCodes::ExceededMemoryLimit,
+                      "Could not allocate zstd compression context"};
+    }
+
+    size_t ret = ZSTD_compressCCtx(cctx,
+                                   const_cast<char*>(output.data()),
+                                   output.length(),
+                                   input.data(),
+                                   input.length(),
+                                   ZSTD_CLEVEL_DEFAULT);
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -63,8 +90,14 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
 
 StatusWith<std::size_t> ZstdMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
-    size_t ret = ZSTD_decompress(
-        const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    auto* dctx = getThreadLocalDCtx();
+    if (!dctx) {
+        return Status{ErrorCodes::ExceededMemoryLimit,
+                      "Could not allocate zstd decompression context"};
+    }
+
+    size_t ret = ZSTD_decompressDCtx(
+        dctx, const_cast<char*>(output.data()), output.length(), input.data(), input.length());
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
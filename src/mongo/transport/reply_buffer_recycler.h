@@ -0,0 +1,80 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/rpc/message.h"
+#include "mongo/transport/session.h"
+#include "mongo/util/shared_buffer.h"
+
+namespace mongo {
+namespace transport {
+
+/**
+ * A per-session stash for the buffer backing the most recent reply, so that the next reply on the
+ * session can write into it instead of allocating. The stash holds a reference alongside the
+ * Message being sunk; the buffer only becomes reusable once the networking layer has dropped its
+ * reference, which take() detects by checking whether the buffer is still shared.
+ */
+class ReplyBufferRecycler {
+public:
+    // Don't retain unusually large buffers, so a single jumbo reply doesn't pin memory for the
+    // lifetime of the session.
+    static constexpr size_t kMaxRecycledReplyBufferSize = 64 * 1024;
+
+    static ReplyBufferRecycler& forSession(const SessionHandle& session);
+
+    /**
+     * Remembers the buffer backing `message`, the reply about to be sunk to the wire.
+     */
+    void stash(Message& message) {
+        auto buffer = message.sharedBuffer();
+        if (buffer.capacity() > kMaxRecycledReplyBufferSize) {
+            return;
+        }
+        _buffer = std::move(buffer);
+    }
+
+    /**
+     * Returns the previous reply's buffer if nothing else still references it, and an empty
+     * buffer otherwise (in which case the caller allocates as usual).
+     */
+    SharedBuffer take() {
+        if (!_buffer || _buffer.isShared()) {
+            return {};
+        }
+        return std::move(_buffer);
+    }
+
+private:
+    SharedBuffer _buffer;
+};
+
+}  // namespace transport
+}  // namespace mongo
@@ -130,7 +130,9 @@ size_t getSupportedMax() {
 }
 
 ServiceEntryPointImpl::ServiceEntryPointImpl(ServiceContext* svcCtx)
-    : _svcCtx(svcCtx), _maxNumConnections(getSupportedMax()) {}
+    : _svcCtx(svcCtx),
+      _sessionsShards(std::max<size_t>(1, ProcessInfo::getNumAvailableCores())),
+      _maxNumConnections(getSupportedMax()) {}
 
 Status ServiceEntryPointImpl::start() {
     if (auto status = transport::ServiceExecutorSynchronous::get(_svcCtx)->start();
@@ -167,22 +169,11 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
 
     const bool quiet = serverGlobalParams.quiet.load();
 
-    size_t connectionCount;
-    auto maybeSsmIt = [&]() -> boost::optional<SSMListIterator> {
-        stdx::lock_guard lk(_sessionsMutex);
-        connectionCount = _currentConnections.load();
-        if (connectionCount > _maxNumConnections && !canOverrideMaxConns) {
-            return boost::none;
-        }
-
-        auto it = _sessions.emplace(_sessions.begin(), std::move(client));
-        connectionCount = _sessions.size();
-        _currentConnections.store(connectionCount);
-        _createdConnections.addAndFetch(1);
-        return it;
-    }();
-
-    if (!maybeSsmIt) {
+    // Claim a connection slot before touching any shard. The counter is authoritative for
+    // admission control; the sharded lists only track the sessions themselves.
+    const size_t connectionCount = _currentConnections.addAndFetch(1);
+    if (connectionCount > _maxNumConnections && !canOverrideMaxConns) {
+        _currentConnections.subtractAndFetch(1);
         if (!quiet) {
             LOGV2(22942,
                   "Connection refused because there are too many open connections",
@@ -190,7 +181,16 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
                   "connectionCount"_attr = connectionCount);
         }
         return;
-    } else if (!quiet) {
+    }
+    _createdConnections.addAndFetch(1);
+
+    auto& shard = _shardFor(session->id());
+    auto ssmIt = [&] {
+        stdx::lock_guard lk(shard.mutex);
+        return shard.sessions.emplace(shard.sessions.begin(), std::move(client));
+    }();
+
+    if (!quiet) {
         LOGV2(22943,
               "Connection accepted",
               "remote"_attr = session->remote(),
@@ -199,16 +199,13 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
               "connectionCount"_attr = connectionCount);
     }
 
-    auto ssmIt = *maybeSsmIt;
-    ssmIt->setCleanupHook([this, ssmIt, quiet, session = std::move(session), uuid] {
-        size_t connectionCount;
+    ssmIt->setCleanupHook([this, &shard, ssmIt, quiet, session = std::move(session), uuid] {
         auto remote = session->remote();
         {
-            stdx::lock_guard<decltype(_sessionsMutex)> lk(_sessionsMutex);
-            _sessions.erase(ssmIt);
-            connectionCount = _sessions.size();
-            _currentConnections.store(connectionCount);
+            stdx::lock_guard lk(shard.mutex);
+            shard.sessions.erase(ssmIt);
         }
+        const size_t connectionCount = _currentConnections.subtractAndFetch(1);
 
         if (!quiet) {
             LOGV2(22944,
@@ -219,6 +216,9 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
                   "connectionCount"_attr = connectionCount);
         }
 
+        // Take and release '_sessionsMutex' so a waiter in _waitForNoSessions() can't check the
+        // counter and block between our decrement and the notify below.
+        { stdx::lock_guard<decltype(_sessionsMutex)> lk(_sessionsMutex); }
         _sessionsCV.notify_one();
     });
 
@@ -229,11 +229,11 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
 }
 
 void ServiceEntryPointImpl::endAllSessions(transport::Session::TagMask tags) {
-    // While holding the _sesionsMutex, loop over all the current connections, and if their tags
-    // do not match the requested tags to skip, terminate the session.
-    {
-        stdx::unique_lock<decltype(_sessionsMutex)> lk(_sessionsMutex);
-        for (auto& ssm : _sessions) {
+    // Loop over all the current connections shard by shard, and if their tags do not match the
+    // requested tags to skip, terminate the session.
+    for (auto& shard : _sessionsShards) {
+        stdx::lock_guard lk(shard.mutex);
+        for (auto& ssm : shard.sessions) {
             ssm.terminateIfTagsDontMatch(tags);
         }
     }
@@ -253,14 +253,13 @@ bool ServiceEntryPointImpl::shutdown(Milliseconds timeout) {
 bool ServiceEntryPointImpl::shutdownAndWait(Milliseconds timeout) {
     auto deadline = _svcCtx->getPreciseClockSource()->now() + timeout;
 
-    stdx::unique_lock<decltype(_sessionsMutex)> lk(_sessionsMutex);
+    // Request that all sessions end by terminating them shard by shard. Then wait for the number
+    // of active connections to reach zero with a condition_variable that notifies in the session
+    // cleanup hook. If we haven't drained all active operations within the deadline, just keep
+    // going with shutdown: the OS will do it for us when the process terminates.
+    _terminateAll();
 
-    // Request that all sessions end, while holding the _sesionsMutex, loop over all the current
-    // connections and terminate them. Then wait for the number of active connections to reach zero
-    // with a condition_variable that notifies in the session cleanup hook. If we haven't closed
-    // drained all active operations within the deadline, just keep going with shutdown: the OS will
-    // do it for us when the process terminates.
-    _terminateAll(lk);
+    stdx::unique_lock<decltype(_sessionsMutex)> lk(_sessionsMutex);
     auto result = _waitForNoSessions(lk, deadline);
     lk.unlock();
 
@@ -281,13 +280,15 @@ bool ServiceEntryPointImpl::shutdownAndWait(Milliseconds timeout) {
 }
 
 void ServiceEntryPointImpl::endAllSessionsNoTagMask() {
-    auto lk = stdx::unique_lock<decltype(_sessionsMutex)>(_sessionsMutex);
-    _terminateAll(lk);
+    _terminateAll();
 }
 
-void ServiceEntryPointImpl::_terminateAll(WithLock) {
-    for (auto& ssm : _sessions) {
-        ssm.terminate();
+void ServiceEntryPointImpl::_terminateAll() {
+    for (auto& shard : _sessionsShards) {
+        stdx::lock_guard lk(shard.mutex);
+        for (auto& ssm : shard.sessions) {
+            ssm.terminate();
+        }
     }
 }
 
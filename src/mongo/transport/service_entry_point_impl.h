@@ -30,6 +30,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
@@ -85,19 +86,40 @@ public:
     }
 
 private:
-    void _terminateAll(WithLock);
+    void _terminateAll();
     bool _waitForNoSessions(stdx::unique_lock<Mutex>& lk, Date_t deadline);
 
     using SSMList = std::list<transport::ServiceStateMachine>;
     using SSMListIterator = SSMList::iterator;
 
+    /**
+     * The session list is sharded so that connection setup and teardown, which both mutate the
+     * list, don't serialize on a single mutex during connection storms. Each session is assigned
+     * to a shard by its id; aggregate counts are kept in atomics and may be momentarily stale
+     * with respect to the lists themselves.
+     */
+    struct SessionsShard {
+        mutable Mutex mutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0),
+                                               "ServiceEntryPointImpl::SessionsShard::mutex");
+        SSMList sessions;
+    };
+
+    SessionsShard& _shardFor(transport::Session::Id id) {
+        return _sessionsShards[static_cast<size_t>(id) % _sessionsShards.size()];
+    }
+
     ServiceContext* const _svcCtx;
     AtomicWord<std::size_t> _nWorkers;
 
+    // Sized once at construction (roughly one shard per core) and never resized, so references
+    // to individual shards remain valid for the lifetime of this object.
+    std::vector<SessionsShard> _sessionsShards;
+
+    // Only coordinates waiters in shutdownAndWait()/waitForNoSessions(); the session lists
+    // themselves are guarded by the per-shard mutexes above.
     mutable Mutex _sessionsMutex =
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "ServiceEntryPointImpl::_sessionsMutex");
     stdx::condition_variable _sessionsCV;
-    SSMList _sessions;
 
     const size_t _maxNumConnections{DEFAULT_MAX_CONN};
     AtomicWord<size_t> _currentConnections{0};
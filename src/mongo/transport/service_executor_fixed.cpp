@@ -144,8 +144,15 @@ public:
             _recursionDepth--;
             _executor->_stats->tasksEnded.fetchAndAdd(1);
 
-            auto lk = stdx::lock_guard(_executor->_mutex);
-            _executor->_checkForShutdown();
+            // Only take the mutex to run the shutdown check once shutdown has begun. The
+            // sequentially consistent increment above and load below pair with _beginShutdown(),
+            // which clears _isRunning before examining the task counters: either we observe the
+            // cleared flag and run the check ourselves, or _beginShutdown() observes this task as
+            // ended.
+            if (!_executor->_isRunning.load()) {
+                auto lk = stdx::lock_guard(_executor->_mutex);
+                _executor->_checkForShutdown();
+            }
         });
 
         std::forward<Task>(task)();
@@ -222,6 +229,7 @@ Status ServiceExecutorFixed::start() {
         switch (_state) {
             case State::kNotStarted:
                 _state = State::kRunning;
+                _isRunning.store(true);
                 break;
             case State::kRunning:
                 return Status::OK();
@@ -323,6 +331,7 @@ void ServiceExecutorFixed::_beginShutdown() {
             break;
         case State::kRunning:
             _state = State::kStopping;
+            _isRunning.store(false);
             // Cancel any session we own.
             for (auto& waiter : _waiters)
                 waiter.session->cancelAsyncOperations();
@@ -380,12 +389,8 @@ void ServiceExecutorFixed::_checkForShutdown() {
 }
 
 Status ServiceExecutorFixed::scheduleTask(Task task, ScheduleFlags flags) try {
-    {
-        auto lk = stdx::lock_guard(_mutex);
-        if (_state != State::kRunning)
-            return inShutdownStatus();
-        _stats->tasksScheduled.fetchAndAdd(1);
-    }
+    if (!_trySchedulingTask())
+        return inShutdownStatus();
 
     // Inline execution requires:
     //  - `kMayRecurse` flag must be set.
@@ -409,16 +414,27 @@ Status ServiceExecutorFixed::scheduleTask(Task task, ScheduleFlags flags) try {
     return e.toStatus();
 }
 
-void ServiceExecutorFixed::_schedule(OutOfLineExecutor::Task task) noexcept {
-    {
-        auto lk = stdx::unique_lock(_mutex);
-        if (_state != State::kRunning) {
-            lk.unlock();
-            task(inShutdownStatus());
-            return;
-        }
+bool ServiceExecutorFixed::_trySchedulingTask() {
+    // Optimistically count the task as scheduled before checking whether the executor is still
+    // running. _beginShutdown() clears _isRunning before it examines the task counters, so either
+    // it observes this task in tasksLeft() and waits for it to complete, or the load below
+    // observes the cleared flag and the task is never handed to the thread pool.
+    _stats->tasksScheduled.fetchAndAdd(1);
+    if (MONGO_likely(_isRunning.load()))
+        return true;
+
+    // Undo the optimistic count and rerun the shutdown check this schedule may have raced with,
+    // since no task completion will do so on its behalf.
+    _stats->tasksScheduled.fetchAndSubtract(1);
+    auto lk = stdx::lock_guard(_mutex);
+    _checkForShutdown();
+    return false;
+}
 
-        _stats->tasksScheduled.fetchAndAdd(1);
+void ServiceExecutorFixed::_schedule(OutOfLineExecutor::Task task) noexcept {
+    if (!_trySchedulingTask()) {
+        task(inShutdownStatus());
+        return;
     }
 
     _threadPool->schedule([this, task = std::move(task)](Status status) mutable {
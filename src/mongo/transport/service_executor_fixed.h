@@ -107,6 +107,12 @@ private:
     /** Requires `_mutex` locked. */
     void _beginShutdown();
 
+    /**
+     * Counts a task as scheduled if the executor is still running. Returns false, without
+     * scheduling anything, once shutdown has begun.
+     */
+    bool _trySchedulingTask();
+
     void _schedule(OutOfLineExecutor::Task task) noexcept;
 
     void _finalize() noexcept;
@@ -117,6 +123,12 @@ private:
     /** `_state` transitions: kNotStarted -> kRunning -> kStopping -> kStopped */
     State _state = State::kNotStarted;
 
+    /**
+     * Mirrors whether `_state` is kRunning, so the per-task paths (scheduling and task
+     * completion) can check it without contending on `_mutex`. Only written with `_mutex` held.
+     */
+    AtomicWord<bool> _isRunning{false};
+
     std::unique_ptr<Stats> _stats;
 
     ServiceContext* const _svcCtx;
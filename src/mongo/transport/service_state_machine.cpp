@@ -50,6 +50,7 @@
 #include "mongo/rpc/op_msg.h"
 #include "mongo/transport/message_compressor_base.h"
 #include "mongo/transport/message_compressor_manager.h"
+#include "mongo/transport/reply_buffer_recycler.h"
 #include "mongo/transport/service_entry_point.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/transport_layer.h"
@@ -105,15 +106,12 @@ Message makeExhaustMessage(Message requestMsg, DbResponse* dbresponse) {
         OpMsg::appendChecksum(&exhaustMessage);
     }
 
-    OpMsg::removeChecksum(&dbresponse->response);
     // Indicate that the response is part of an exhaust stream (unless the 'doNotSetMoreToCome'
-    // failpoint is set). Re-checksum if needed.
+    // failpoint is set). The caller appends the response's checksum once all of its flags are
+    // final, so there is no need to strip and recompute one here.
     if (!MONGO_unlikely(doNotSetMoreToCome.shouldFail())) {
         OpMsg::setFlag(&dbresponse->response, OpMsg::kMoreToCome);
     }
-    if (checksumPresent) {
-        OpMsg::appendChecksum(&dbresponse->response);
-    }
 
     return exhaustMessage;
 }
@@ -379,7 +377,21 @@ Future<void> ServiceStateMachine::Impl::processMessage() {
                 // Update the header for the response message.
                 toSink.header().setId(nextMessageId());
                 toSink.header().setResponseToMsgId(_inMessage.header().getId());
-                if (OpMsg::isFlagSet(_inMessage, OpMsg::kChecksumPresent)) {
+                const bool requestChecksumPresent =
+                    OpMsg::isFlagSet(_inMessage, OpMsg::kChecksumPresent);
+
+                // If the incoming message has the exhaust flag set, then we bypass the normal RPC
+                // behavior. We will sink the response to the network, but we also synthesize a new
+                // request, as if we sourced a new message from the network. This new request is
+                // sent to the database once again to be processed. This cycle repeats as long as
+                // the command indicates the exhaust stream should continue. This also sets the
+                // response's kMoreToCome flag, and must therefore precede the checksum append
+                // below so exhaust responses are checksummed exactly once rather than
+                // checksummed, stripped, and checksummed again.
+                _inMessage = makeExhaustMessage(_inMessage, &dbresponse);
+                _inExhaust = !_inMessage.empty();
+
+                if (requestChecksumPresent) {
 #ifdef MONGO_CONFIG_SSL
                     if (!SSLPeerInfo::forSession(session()).isTLS) {
                         OpMsg::appendChecksum(&toSink);
@@ -389,16 +401,13 @@ Future<void> ServiceStateMachine::Impl::processMessage() {
 #endif
                 }
 
-                // If the incoming message has the exhaust flag set, then we bypass the normal RPC
-                // behavior. We will sink the response to the network, but we also synthesize a new
-                // request, as if we sourced a new message from the network. This new request is
-                // sent to the database once again to be processed. This cycle repeats as long as
-                // the command indicates the exhaust stream should continue.
-                _inMessage = makeExhaustMessage(_inMessage, &dbresponse);
-                _inExhaust = !_inMessage.empty();
-
                 networkCounter.hitLogicalOut(toSink.size());
 
+                // Remember the reply's buffer so the next reply on this session can write into it
+                // once the networking layer has released it. This must precede compression, which
+                // replaces toSink with a freshly allocated message.
+                ReplyBufferRecycler::forSession(session()).stash(toSink);
+
                 beforeCompressingExhaustResponse.executeIf(
                     [&](const BSONObj&) {
                         // Nothing to do as we only need to record the incident.
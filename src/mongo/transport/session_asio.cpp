@@ -136,6 +136,14 @@ TransportLayerASIO::ASIOSession::ASIOSession(
 }
 
 void TransportLayerASIO::ASIOSession::end() {
+#ifdef MONGO_CONFIG_SSL
+    // Stash this connection's TLS session before tearing the connection down. Under TLS 1.3 the
+    // session recorded when the handshake completed may not yet have carried a ticket; by now
+    // any NewSessionTicket messages have been processed.
+    if (_sslSocket && _ranHandshake && !_egressSSLTarget.empty()) {
+        getSSLManager()->recordEgressSession(_sslSocket->native_handle(), _egressSSLTarget);
+    }
+#endif
     if (getSocket().is_open()) {
         std::error_code ec;
         getSocket().shutdown(GenericSocket::shutdown_both, ec);
@@ -283,6 +291,8 @@ Future<void> TransportLayerASIO::ASIOSession::handshakeSSLForEgressWithLock(
     }
 
     _sslSocket.emplace(std::move(_socket), *_sslContext->egress, removeFQDNRoot(target.host()));
+    _egressSSLTarget = target;
+    getSSLManager()->offerEgressSessionForResumption(_sslSocket->native_handle(), target);
     lk.unlock();
 
     auto doHandshake = [&] {
@@ -300,7 +310,10 @@ Future<void> TransportLayerASIO::ASIOSession::handshakeSSLForEgressWithLock(
         return getSSLManager()
             ->parseAndValidatePeerCertificate(
                 _sslSocket->native_handle(), _sslSocket->get_sni(), target.host(), target, reactor)
-            .then([this](SSLPeerInfo info) { SSLPeerInfo::forSession(shared_from_this()) = info; });
+            .then([this, target](SSLPeerInfo info) {
+                SSLPeerInfo::forSession(shared_from_this()) = info;
+                getSSLManager()->recordEgressSession(_sslSocket->native_handle(), target);
+            });
     });
 }
 
@@ -368,15 +381,61 @@ auto TransportLayerASIO::ASIOSession::getSocket() -> GenericSocket& {
 Future<Message> TransportLayerASIO::ASIOSession::sourceMessageImpl(const BatonHandle& baton) {
     static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
 
-    auto headerBuffer = SharedBuffer::allocate(kHeaderSize);
-    auto ptr = headerBuffer.get();
-    return read(asio::buffer(ptr, kHeaderSize), baton)
-        .then([headerBuffer = std::move(headerBuffer), this, baton]() mutable {
-            if (checkForHTTPRequest(asio::buffer(headerBuffer.get(), kHeaderSize))) {
+    // Reuse the previous message's receive buffer if all of its consumers have released it (we
+    // hold the only remaining reference), so that steady-state receives do not allocate. Any
+    // bytes a previous speculative read pulled in past the end of its message are carried over
+    // to the front of the buffer and count towards this message.
+    SharedBuffer buffer;
+    size_t available = 0;
+    if (_recycledMessageBuffer && !_recycledMessageBuffer.isShared()) {
+        buffer = _recycledMessageBuffer;
+        if (_leftoverSize > 0) {
+            std::memmove(buffer.get(), buffer.get() + _leftoverOffset, _leftoverSize);
+            available = std::exchange(_leftoverSize, 0);
+            _leftoverOffset = 0;
+        }
+    } else if (_leftoverSize > 0) {
+        // The previous buffer is still referenced by its message's consumers, but the bytes read
+        // ahead of that message are ours; move them into a fresh buffer. Consumers never mutate a
+        // received message, so reading from the shared buffer is safe.
+        buffer = SharedBuffer::allocate(std::max<size_t>(_leftoverSize, kHeaderSize));
+        memcpy(buffer.get(), _recycledMessageBuffer.get() + _leftoverOffset, _leftoverSize);
+        available = std::exchange(_leftoverSize, 0);
+        _leftoverOffset = 0;
+    } else {
+        buffer = SharedBuffer::allocate(kHeaderSize);
+    }
+
+    // Get at least the header into 'buffer'. A buffer with room to spare is filled
+    // opportunistically, which frequently picks up the message body (and, for pipelined clients,
+    // successor messages) in the same syscall as the header.
+    auto headerFuture = [&]() -> Future<size_t> {
+        if (available >= kHeaderSize) {
+            return available;
+        }
+        if (buffer.capacity() == kHeaderSize && available == 0) {
+            // A freshly allocated header-sized buffer. This is the only shape the session's very
+            // first read can take, and that read must go through read() so that SSL handshake
+            // detection can run.
+            return read(asio::buffer(buffer.get(), kHeaderSize), baton).then([] {
+                return size_t{kHeaderSize};
+            });
+        }
+        return readAtLeast(
+                   asio::mutable_buffer(buffer.get() + available, buffer.capacity() - available),
+                   kHeaderSize - available,
+                   baton)
+            .then([available](size_t bytesRead) { return available + bytesRead; });
+    }();
+
+    return std::move(headerFuture)
+        .then([this, buffer = std::move(buffer), baton](size_t available) mutable
+              -> Future<Message> {
+            if (checkForHTTPRequest(asio::buffer(buffer.get(), kHeaderSize))) {
                 return sendHTTPResponse(baton);
             }
 
-            const auto msgLen = size_t(MSGHEADER::View(headerBuffer.get()).getMessageLength());
+            const auto msgLen = size_t(MSGHEADER::View(buffer.get()).getMessageLength());
             if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
                 StringBuilder sb;
                 sb << "recv(): message msgLen " << msgLen << " is invalid. "
@@ -392,20 +451,40 @@ Future<Message> TransportLayerASIO::ASIOSession::sourceMessageImpl(const BatonHa
                 return Future<Message>::makeReady(Status(ErrorCodes::ProtocolError, str));
             }
 
-            if (msgLen == kHeaderSize) {
-                // This probably isn't a real case since all (current) messages have bodies.
+            if (available >= msgLen) {
+                // The whole message is already in hand; anything beyond it belongs to the next
+                // message(s) and stays behind for the next receive.
+                if (available > msgLen) {
+                    _recycledMessageBuffer = buffer;
+                    _leftoverOffset = msgLen;
+                    _leftoverSize = available - msgLen;
+                }
                 if (_isIngressSession) {
                     networkCounter.hitPhysicalIn(msgLen);
                 }
-                return Future<Message>::makeReady(Message(std::move(headerBuffer)));
+                return Future<Message>::makeReady(Message(std::move(buffer)));
             }
 
-            auto buffer = SharedBuffer::allocate(msgLen);
-            memcpy(buffer.get(), headerBuffer.get(), kHeaderSize);
+            if (msgLen > buffer.capacity()) {
+                auto newBuffer = SharedBuffer::allocate(msgLen);
+                memcpy(newBuffer.get(), buffer.get(), available);
+                if (msgLen <= kMaxRecycledMessageBufferSize) {
+                    _recycledMessageBuffer = newBuffer;
+                }
+                buffer = std::move(newBuffer);
+            }
 
-            MsgData::View msgView(buffer.get());
-            return read(asio::buffer(msgView.data(), msgView.dataLen()), baton)
-                .then([this, buffer = std::move(buffer), msgLen]() mutable {
+            return readAtLeast(asio::mutable_buffer(buffer.get() + available,
+                                                    buffer.capacity() - available),
+                               msgLen - available,
+                               baton)
+                .then([this, buffer = std::move(buffer), msgLen, available](
+                          size_t bytesRead) mutable {
+                    if (const auto total = available + bytesRead; total > msgLen) {
+                        _recycledMessageBuffer = buffer;
+                        _leftoverOffset = msgLen;
+                        _leftoverSize = total - msgLen;
+                    }
                     if (_isIngressSession) {
                         networkCounter.hitPhysicalIn(msgLen);
                     }
@@ -441,6 +520,83 @@ Future<void> TransportLayerASIO::ASIOSession::read(const MutableBufferSequence&
     return opportunisticRead(_socket, buffers, baton);
 }
 
+Future<size_t> TransportLayerASIO::ASIOSession::readAtLeast(const asio::mutable_buffer& buffer,
+                                                            size_t minBytes,
+                                                            const BatonHandle& baton) {
+    // Speculative reads only happen once a full message has already been exchanged on this
+    // session, so the SSL handshake detection performed by read() is not needed here.
+#ifdef MONGO_CONFIG_SSL
+    if (_sslSocket) {
+        return opportunisticReadAtLeast(*_sslSocket, buffer, minBytes, baton);
+    }
+#endif
+    return opportunisticReadAtLeast(_socket, buffer, minBytes, baton);
+}
+
+template <typename Stream>
+Future<size_t> TransportLayerASIO::ASIOSession::opportunisticReadAtLeast(
+    Stream& stream,
+    const asio::mutable_buffer& buffer,
+    size_t minBytes,
+    const BatonHandle& baton) {
+    std::error_code ec;
+    size_t size;
+
+    if (MONGO_unlikely(transportLayerASIOshortOpportunisticReadWrite.shouldFail()) &&
+        _blockingMode == Async) {
+        asio::mutable_buffer localBuffer = buffer;
+
+        if (buffer.size()) {
+            localBuffer = asio::mutable_buffer(buffer.data(), 1);
+        }
+
+        do {
+            size = asio::read(stream, localBuffer, ec);
+        } while (ec == asio::error::interrupted);  // retry syscall EINTR
+
+        if (!ec && minBytes > 1) {
+            ec = asio::error::would_block;
+        }
+    } else {
+        do {
+            size = asio::read(stream, buffer, asio::transfer_at_least(minBytes), ec);
+        } while (ec == asio::error::interrupted);  // retry syscall EINTR
+    }
+
+    if (((ec == asio::error::would_block) || (ec == asio::error::try_again)) &&
+        (_blockingMode == Async)) {
+        // asio::read may have partially filled the buffer before hitting would_block, so offset
+        // the buffer and shrink the minimum before continuing asynchronously.
+        asio::mutable_buffer asyncBuffer = buffer + size;
+        const size_t remainingMin = minBytes - size;
+
+        if (auto networkingBaton = baton ? baton->networking() : nullptr;
+            networkingBaton && networkingBaton->canWait()) {
+            return networkingBaton->addSession(*this, NetworkingBaton::Type::In)
+                .onError([](Status error) {
+                    if (ErrorCodes::isShutdownError(error)) {
+                        // If the baton has detached, it will cancel its polling. We catch that
+                        // error here and return Status::OK so that we invoke
+                        // opportunisticReadAtLeast() again and switch to asio::async_read() below.
+                        return Status::OK();
+                    }
+
+                    return error;
+                })
+                .then([&stream, asyncBuffer, remainingMin, baton, size, this] {
+                    return opportunisticReadAtLeast(stream, asyncBuffer, remainingMin, baton)
+                        .then([size](size_t furtherRead) { return size + furtherRead; });
+                });
+        }
+
+        return asio::async_read(stream, asyncBuffer, asio::transfer_at_least(remainingMin),
+                                UseFuture{})
+            .then([size](size_t furtherRead) { return size + furtherRead; });
+    } else {
+        return futurize(ec, size);
+    }
+}
+
 template <typename ConstBufferSequence>
 Future<void> TransportLayerASIO::ASIOSession::write(const ConstBufferSequence& buffers,
                                                     const BatonHandle& baton) {
@@ -168,6 +168,22 @@ private:
     template <typename MutableBufferSequence>
     Future<void> read(const MutableBufferSequence& buffers, const BatonHandle& baton = nullptr);
 
+    /**
+     * Reads at least 'minBytes' into the front of 'buffer', opportunistically filling the rest of
+     * it with whatever the socket already has available, and returns the number of bytes read.
+     * Must not be used for a session's first read, which has to go through read() for SSL
+     * handshake detection.
+     */
+    Future<size_t> readAtLeast(const asio::mutable_buffer& buffer,
+                               size_t minBytes,
+                               const BatonHandle& baton = nullptr);
+
+    template <typename Stream>
+    Future<size_t> opportunisticReadAtLeast(Stream& stream,
+                                            const asio::mutable_buffer& buffer,
+                                            size_t minBytes,
+                                            const BatonHandle& baton = nullptr);
+
     template <typename ConstBufferSequence>
     Future<void> write(const ConstBufferSequence& buffers, const BatonHandle& baton = nullptr);
 
@@ -250,10 +266,30 @@ private:
     boost::optional<asio::ssl::stream<decltype(_socket)>> _sslSocket;
     bool _ranHandshake = false;
     std::shared_ptr<const SSLConnectionContext> _sslContext;
+
+    // The hostname an egress TLS handshake was performed against; keys the manager's session
+    // cache so the negotiated session can be offered to later connections to the same peer.
+    HostAndPort _egressSSLTarget;
 #endif
 
     TransportLayerASIO* const _tl;
     bool _isIngressSession;
+
+    // Maximum size of a receive buffer that is kept around for reuse by subsequent messages on
+    // this session. Larger messages get a dedicated allocation that is freed when the message is
+    // released.
+    static constexpr size_t kMaxRecycledMessageBufferSize = 64 * 1024;
+
+    // The receive buffer handed to the most recent inbound message, retained so that the next
+    // sourceMessage() can read into it without allocating once the message's consumers have
+    // released it (i.e. once this is the only reference). Only accessed from the session's
+    // (serialized) read path.
+    SharedBuffer _recycledMessageBuffer;
+
+    // Bytes in _recycledMessageBuffer, starting at _leftoverOffset, that a speculative read
+    // pulled in past the end of the most recent message and that belong to the next message(s).
+    size_t _leftoverOffset = 0;
+    size_t _leftoverSize = 0;
 };
 
 }  // namespace mongo::transport
@@ -29,6 +29,8 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
+
 #include "mongo/util/alarm.h"
 
 namespace mongo {
@@ -167,4 +169,288 @@ void AlarmSchedulerPrecise::_clearAllAlarmsImpl(stdx::unique_lock<Latch>& lk) {
     }
 }
 
+class AlarmSchedulerHashedWheel::HandleImpl final : public AlarmScheduler::Handle {
+public:
+    HandleImpl(std::weak_ptr<AlarmSchedulerHashedWheel> service, AlarmNode* node)
+        : _service(std::move(service)), _node(node) {}
+
+    struct MakeEmptyHandle {};
+    explicit HandleImpl(MakeEmptyHandle)
+        : _service(std::shared_ptr<AlarmSchedulerHashedWheel>(nullptr)),
+          _node(nullptr),
+          _done(true) {}
+
+    Status cancel() override {
+        auto service = _service.lock();
+        if (!service) {
+            return {ErrorCodes::ShutdownInProgress, "The alarm scheduler was shutdown"};
+        }
+
+        stdx::unique_lock<Latch> lk(service->_mutex);
+        if (_done) {
+            return {ErrorCodes::AlarmAlreadyFulfilled, "The alarm has already been canceled"};
+        }
+
+        // Canceling only marks the node; the wheel reaps it in a batch when the cursor
+        // reaches its slot, so no wheel structure is touched here.
+        _done = true;
+        _node->canceled = true;
+        auto promise = std::move(_node->promise);
+        lk.unlock();
+
+        std::move(promise).setError(
+            {ErrorCodes::CallbackCanceled,
+             "The alarm was canceled before it expired or could be processed"});
+        return Status::OK();
+    }
+
+    void setDone() {
+        _done = true;
+    }
+
+private:
+    std::weak_ptr<AlarmSchedulerHashedWheel> const _service;
+    AlarmNode* const _node;
+    bool _done = false;
+};
+
+AlarmSchedulerHashedWheel::~AlarmSchedulerHashedWheel() {
+    clearAllAlarms();
+}
+
+int64_t AlarmSchedulerHashedWheel::_tickFor(Date_t date) const {
+    const auto ms = durationCount<Milliseconds>(date - _origin);
+    if (ms <= 0) {
+        return _cursor;
+    }
+
+    // Round up so alarms fire on the tick at or after their deadline, never before it. Avoid
+    // adding before the division so Date_t::max() cannot overflow.
+    constexpr auto tickMs = durationCount<Milliseconds>(kTick);
+    const auto tick = ms / tickMs + (ms % tickMs ? 1 : 0);
+    return std::max(tick, _cursor);
+}
+
+void AlarmSchedulerHashedWheel::_placeNode(std::unique_ptr<AlarmNode> node) {
+    const auto tick = _tickFor(node->when);
+    if (tick < _cursor + kWheelSize) {
+        _innerWheel[tick % kWheelSize].push_back(std::move(node));
+        ++_innerCount;
+        return;
+    }
+
+    const auto epoch = tick / kWheelSize;
+    if (epoch < _cursor / kWheelSize + kWheelSize) {
+        _outerWheel[epoch % kWheelSize].push_back(std::move(node));
+        ++_outerCount;
+        return;
+    }
+
+    const auto when = node->when;
+    _overflow.emplace(when, std::move(node));
+}
+
+void AlarmSchedulerHashedWheel::_cascade() {
+    // The cursor just reached an epoch boundary: everything stored for this outer slot is now
+    // due within the inner wheel's horizon. Canceled nodes are dropped here in a batch.
+    const auto epoch = _cursor / kWheelSize;
+    auto& slot = _outerWheel[epoch % kWheelSize];
+    for (auto& node : slot) {
+        --_outerCount;
+        if (!node->canceled) {
+            _placeNode(std::move(node));
+        }
+    }
+    slot.clear();
+
+    while (!_overflow.empty()) {
+        auto it = _overflow.begin();
+        if (_tickFor(it->first) / kWheelSize >= epoch + kWheelSize) {
+            break;
+        }
+        auto node = std::move(it->second);
+        _overflow.erase(it);
+        if (!node->canceled) {
+            _placeNode(std::move(node));
+        }
+    }
+}
+
+AlarmScheduler::Alarm AlarmSchedulerHashedWheel::alarmAt(Date_t date) {
+    stdx::unique_lock<Latch> lk(_mutex);
+    if (_shutdown) {
+        Alarm ret;
+        ret.future = Future<void>::makeReady(
+            Status(ErrorCodes::ShutdownInProgress, "Alarm scheduler has been shut down."));
+        ret.handle = std::make_shared<HandleImpl>(HandleImpl::MakeEmptyHandle{});
+        return ret;
+    }
+
+    auto pf = makePromiseFuture<void>();
+    auto node = std::make_unique<AlarmNode>(date, std::move(pf.promise));
+    auto handle = std::make_shared<HandleImpl>(shared_from_this(), node.get());
+    node->handle = handle;
+    // The register hook only needs this alarm's own wake-up time; the runner takes the
+    // minimum itself, which keeps scheduling O(1) instead of scanning for the global next.
+    auto nextAlarm = _origin + kTick * _tickFor(date);
+    _placeNode(std::move(node));
+    lk.unlock();
+
+    callRegisterHook(nextAlarm, shared_from_this());
+    return {std::move(pf.future), std::move(handle)};
+}
+
+void AlarmSchedulerHashedWheel::processExpiredAlarms(
+    boost::optional<AlarmScheduler::AlarmExpireHook> hook) {
+    AlarmCount processed = 0;
+    auto now = clockSource()->now();
+    std::vector<Promise<void>> toExpire;
+
+    stdx::unique_lock<Latch> lk(_mutex);
+    const auto elapsed = durationCount<Milliseconds>(now - _origin);
+    const int64_t targetTick = elapsed < 0 ? -1 : elapsed / durationCount<Milliseconds>(kTick);
+
+    bool stopped = false;
+    while (_cursor <= targetTick && !stopped) {
+        if (_innerCount == 0) {
+            // The inner wheel is empty; skip ahead to the next epoch boundary (or the target)
+            // instead of stepping through empty slots one tick at a time.
+            if (_outerCount == 0 && _overflow.empty()) {
+                _cursor = targetTick + 1;
+                break;
+            }
+            const auto boundary = (_cursor / kWheelSize + 1) * kWheelSize;
+            _cursor = std::min(boundary, targetTick + 1);
+            if (_cursor == boundary) {
+                _cascade();
+            }
+            continue;
+        }
+
+        auto& bucket = _innerWheel[_cursor % kWheelSize];
+        size_t swept = 0;
+        for (; swept < bucket.size(); ++swept) {
+            auto& node = bucket[swept];
+            if (node->canceled) {
+                continue;
+            }
+
+            if (hook && !(*hook)(processed + 1)) {
+                stopped = true;
+                break;
+            }
+
+            processed++;
+            toExpire.push_back(std::move(node->promise));
+            if (auto handle = node->handle.lock()) {
+                handle->setDone();
+            }
+        }
+
+        _innerCount -= swept;
+        bucket.erase(bucket.begin(), bucket.begin() + swept);
+        if (stopped) {
+            break;
+        }
+
+        ++_cursor;
+        if (_cursor % kWheelSize == 0) {
+            _cascade();
+        }
+    }
+
+    lk.unlock();
+
+    for (auto& promise : toExpire) {
+        promise.emplaceValue();
+    }
+}
+
+Date_t AlarmSchedulerHashedWheel::_nextAlarmImpl() const {
+    // This may be earlier than the true next alarm (an outer slot or a canceled node report
+    // their slot's start), which at worst costs the runner one spurious wakeup; it is never
+    // later.
+    Date_t result = Date_t::max();
+    if (_innerCount > 0) {
+        for (int64_t tick = _cursor; tick < _cursor + kWheelSize; ++tick) {
+            if (!_innerWheel[tick % kWheelSize].empty()) {
+                result = _origin + kTick * tick;
+                break;
+            }
+        }
+    }
+
+    if (_outerCount > 0) {
+        const auto epoch = _cursor / kWheelSize;
+        for (int64_t e = epoch + 1; e <= epoch + kWheelSize; ++e) {
+            if (!_outerWheel[e % kWheelSize].empty()) {
+                result = std::min(result, _origin + kTick * (e * kWheelSize));
+                break;
+            }
+        }
+    }
+
+    if (!_overflow.empty()) {
+        result = std::min(result, _overflow.begin()->first);
+    }
+
+    return result;
+}
+
+Date_t AlarmSchedulerHashedWheel::nextAlarm() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    return _nextAlarmImpl();
+}
+
+void AlarmSchedulerHashedWheel::clearAllAlarms() {
+    stdx::unique_lock<Latch> lk(_mutex);
+    _clearAllAlarmsImpl(lk);
+}
+
+void AlarmSchedulerHashedWheel::clearAllAlarmsAndShutdown() {
+    stdx::unique_lock<Latch> lk(_mutex);
+    _shutdown = true;
+    _clearAllAlarmsImpl(lk);
+}
+
+void AlarmSchedulerHashedWheel::_clearAllAlarmsImpl(stdx::unique_lock<Latch>& lk) {
+    std::vector<Promise<void>> toExpire;
+    auto drainBucket = [&](Bucket& bucket) {
+        for (auto& node : bucket) {
+            if (node->canceled) {
+                continue;
+            }
+            toExpire.push_back(std::move(node->promise));
+            if (auto handle = node->handle.lock()) {
+                handle->setDone();
+            }
+        }
+        bucket.clear();
+    };
+
+    for (auto& bucket : _innerWheel) {
+        drainBucket(bucket);
+    }
+    for (auto& bucket : _outerWheel) {
+        drainBucket(bucket);
+    }
+    for (auto& entry : _overflow) {
+        if (entry.second->canceled) {
+            continue;
+        }
+        toExpire.push_back(std::move(entry.second->promise));
+        if (auto handle = entry.second->handle.lock()) {
+            handle->setDone();
+        }
+    }
+    _overflow.clear();
+    _innerCount = 0;
+    _outerCount = 0;
+
+    lk.unlock();
+    for (auto& alarm : toExpire) {
+        alarm.setError({ErrorCodes::CallbackCanceled, "Alarm scheduler was cleared"});
+    }
+}
+
 }  // namespace mongo
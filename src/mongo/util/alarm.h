@@ -30,6 +30,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/platform/mutex.h"
@@ -192,4 +193,79 @@ private:
     AlarmMap _alarms;
 };
 
+/*
+ * Implements an alarm scheduler as a two-level hierarchical timing wheel with an ordered
+ * overflow map for alarms beyond the wheels' horizon.
+ *
+ * Scheduling an alarm within the horizon and canceling an alarm are both done in constant
+ * time. Canceled alarms are not unlinked eagerly; they are reaped in batches when the wheel
+ * cursor reaches their slot, so the overwhelmingly common case of timeouts that never fire
+ * never touches the wheel structure after the initial insert.
+ *
+ * The trade-off against AlarmSchedulerPrecise is granularity: alarms fire on the tick after
+ * their deadline, so they may run up to kTick late (never early).
+ */
+class AlarmSchedulerHashedWheel : public AlarmScheduler,
+                                  public std::enable_shared_from_this<AlarmSchedulerHashedWheel> {
+public:
+    /*
+     * Granularity of the inner wheel. Each wheel level has kWheelSize slots, so the inner
+     * wheel spans kTick * kWheelSize and the outer wheel kTick * kWheelSize^2 (about 10
+     * minutes); later deadlines go to the overflow map.
+     */
+    static constexpr auto kTick = Milliseconds(10);
+    static constexpr int64_t kWheelSize = 256;
+
+    explicit AlarmSchedulerHashedWheel(ClockSource* clockSource)
+        : AlarmScheduler(clockSource),
+          _origin(clockSource->now()),
+          _innerWheel(kWheelSize),
+          _outerWheel(kWheelSize) {}
+
+    ~AlarmSchedulerHashedWheel();
+
+    void clearAllAlarms() override;
+
+    void clearAllAlarmsAndShutdown() override;
+
+    Alarm alarmAt(Date_t time) override;
+
+    void processExpiredAlarms(boost::optional<AlarmExpireHook> hook) override;
+
+    Date_t nextAlarm() override;
+
+private:
+    class HandleImpl;
+
+    struct AlarmNode {
+        AlarmNode(Date_t when_, Promise<void> promise_)
+            : when(when_), promise(std::move(promise_)) {}
+
+        Date_t when;
+        Promise<void> promise;
+        std::weak_ptr<HandleImpl> handle;
+        bool canceled = false;
+    };
+
+    // Nodes are owned by their slot but referenced by their Handle, so slots hold unique_ptrs
+    // to keep node addresses stable while cascading between levels.
+    using Bucket = std::vector<std::unique_ptr<AlarmNode>>;
+
+    int64_t _tickFor(Date_t date) const;
+    void _placeNode(std::unique_ptr<AlarmNode> node);
+    void _cascade();
+    Date_t _nextAlarmImpl() const;
+    void _clearAllAlarmsImpl(stdx::unique_lock<Latch>& lk);
+
+    Mutex _mutex = MONGO_MAKE_LATCH("AlarmSchedulerHashedWheel::_mutex");
+    bool _shutdown = false;
+    const Date_t _origin;
+    int64_t _cursor = 0;
+    size_t _innerCount = 0;
+    size_t _outerCount = 0;
+    std::vector<Bucket> _innerWheel;
+    std::vector<Bucket> _outerWheel;
+    std::multimap<Date_t, std::unique_ptr<AlarmNode>> _overflow;
+};
+
 }  // namespace mongo
@@ -102,6 +102,104 @@ TEST(AlarmScheduler, BasicSingleThread) {
     ASSERT_EQ(shutdownStatus.code(), ErrorCodes::ShutdownInProgress);
 }
 
+TEST(AlarmScheduler, HashedWheelBasic) {
+    auto clockSource = std::make_unique<ClockSourceMock>();
+
+    std::shared_ptr<AlarmScheduler> scheduler =
+        std::make_shared<AlarmSchedulerHashedWheel>(clockSource.get());
+
+    auto testStart = clockSource->now();
+    auto alarm = scheduler->alarmAt(testStart + Milliseconds(10));
+    bool firstTimerExpired = false;
+    std::move(alarm.future).getAsync([&](Status status) { firstTimerExpired = true; });
+
+    alarm = scheduler->alarmAt(testStart + Milliseconds(500));
+    bool secondTimerExpired = false;
+    std::move(alarm.future).getAsync([&](Status status) { secondTimerExpired = true; });
+
+    alarm = scheduler->alarmAt(testStart + Milliseconds(515));
+    bool thirdTimerExpired = false;
+    std::move(alarm.future).getAsync([&](Status status) { thirdTimerExpired = true; });
+    auto missingEvent = alarm.handle;
+
+    alarm = scheduler->alarmAt(testStart + Milliseconds(250));
+
+    clockSource->advance(Milliseconds(11));
+    scheduler->processExpiredAlarms();
+    ASSERT_TRUE(firstTimerExpired);
+    ASSERT_FALSE(secondTimerExpired);
+
+    ASSERT_OK(alarm.handle->cancel());
+    auto cancelledStatus = std::move(alarm.future).getNoThrow();
+    ASSERT_EQ(cancelledStatus.code(), ErrorCodes::CallbackCanceled);
+
+    clockSource->advance(Milliseconds(501));
+    scheduler->processExpiredAlarms();
+    ASSERT_TRUE(secondTimerExpired);
+    ASSERT_FALSE(thirdTimerExpired);
+
+    clockSource->advance(Milliseconds(64));
+    scheduler->processExpiredAlarms();
+    ASSERT_TRUE(thirdTimerExpired);
+
+    cancelledStatus = missingEvent->cancel();
+    ASSERT_EQ(cancelledStatus.code(), ErrorCodes::AlarmAlreadyFulfilled);
+    alarm = scheduler->alarmAt(testStart + Hours(5));
+    scheduler->clearAllAlarmsAndShutdown();
+    cancelledStatus = std::move(alarm.future).getNoThrow();
+    ASSERT_EQ(cancelledStatus.code(), ErrorCodes::CallbackCanceled);
+
+    alarm = scheduler->alarmFromNow(Milliseconds{50});
+    auto shutdownStatus = alarm.future.getNoThrow();
+    ASSERT_EQ(shutdownStatus.code(), ErrorCodes::ShutdownInProgress);
+}
+
+TEST(AlarmScheduler, HashedWheelDistantAlarms) {
+    auto clockSource = std::make_unique<ClockSourceMock>();
+
+    std::shared_ptr<AlarmScheduler> scheduler =
+        std::make_shared<AlarmSchedulerHashedWheel>(clockSource.get());
+
+    // The first alarm lands in the outer wheel, the second in the overflow map.
+    auto outerAlarm = scheduler->alarmFromNow(Seconds(30));
+    auto overflowAlarm = scheduler->alarmFromNow(Minutes(20));
+    ASSERT_LTE(scheduler->nextAlarm(), clockSource->now() + Seconds(30));
+
+    clockSource->advance(Seconds(31));
+    scheduler->processExpiredAlarms();
+    ASSERT_OK(outerAlarm.future.getNoThrow());
+    ASSERT_FALSE(overflowAlarm.future.isReady());
+
+    clockSource->advance(Minutes(20));
+    scheduler->processExpiredAlarms();
+    ASSERT_OK(overflowAlarm.future.getNoThrow());
+}
+
+TEST(AlarmScheduler, HashedWheelBatchedCancel) {
+    auto clockSource = std::make_unique<ClockSourceMock>();
+
+    std::shared_ptr<AlarmScheduler> scheduler =
+        std::make_shared<AlarmSchedulerHashedWheel>(clockSource.get());
+
+    // Cancellation is lazy: the canceled alarms stay in their slots until the cursor sweeps
+    // past, but their futures must resolve immediately and survivors must still fire.
+    std::vector<AlarmScheduler::Alarm> alarms;
+    for (int i = 0; i < 100; i++) {
+        alarms.push_back(scheduler->alarmFromNow(Milliseconds(100 + i)));
+    }
+    auto survivor = scheduler->alarmFromNow(Milliseconds(150));
+
+    for (auto& alarm : alarms) {
+        ASSERT_OK(alarm.handle->cancel());
+        ASSERT_EQ(std::move(alarm.future).getNoThrow().code(), ErrorCodes::CallbackCanceled);
+        ASSERT_EQ(alarm.handle->cancel().code(), ErrorCodes::AlarmAlreadyFulfilled);
+    }
+
+    clockSource->advance(Milliseconds(251));
+    scheduler->processExpiredAlarms();
+    ASSERT_OK(survivor.future.getNoThrow());
+}
+
 TEST(AlarmRunner, BasicTest) {
     auto clockSource = std::make_unique<ClockSourceMock>();
     auto scheduler = std::make_shared<AlarmSchedulerPrecise>(clockSource.get());
@@ -37,6 +37,10 @@
 #include <cstdint>
 #include <iostream>
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 namespace mongo::base64 {
 namespace {
 
@@ -64,10 +68,103 @@ bool valid(unsigned char x) {
     return kDecodeTable[x] != kInvalid;
 }
 
+#if defined(__SSSE3__)
+
+// Vectorized kernels for the bulk of encode/decode, after Wojciech Muła's SSSE3 base64
+// algorithms. An encode step turns 12 input octets into 16 base64 characters; a decode step
+// turns 16 characters into 12 octets, refusing the whole block if any character falls outside
+// the alphabet so the scalar path can report the error.
+
+__m128i encodeBlock(__m128i in) {
+    // Spread each 3-octet group across a 32-bit lane and split it into four sextet indices.
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Translate indices to ASCII by adding a per-range offset picked with one shuffle. The
+    // ranges are A-Z (0..25), a-z (26..51), 0-9 (52..61), '+' (62) and '/' (63).
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    range = _mm_or_si128(range, _mm_and_si128(less, _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8('a' - 26,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '+' - 62,
+                                          '/' - 63,
+                                          'A',
+                                          0,
+                                          0);
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+}
+
+bool decodeBlock(__m128i in, __m128i* out) {
+    const __m128i higherNibble = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+    const __m128i lowerNibble = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+
+    // Validity of a character is a function of its two nibbles: the lower nibble selects a
+    // bitmask of acceptable higher nibbles, and the higher nibble selects the bit to probe.
+    const __m128i maskLUT = _mm_setr_epi8(char(0xa8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf0),
+                                          0x54,
+                                          0x50,
+                                          0x50,
+                                          0x50,
+                                          0x54);
+    const __m128i bitposLUT = _mm_setr_epi8(
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, char(0x80), 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_shuffle_epi8(maskLUT, lowerNibble);
+    const __m128i bit = _mm_shuffle_epi8(bitposLUT, higherNibble);
+    const __m128i nonMatch = _mm_cmpeq_epi8(_mm_and_si128(mask, bit), _mm_setzero_si128());
+    if (_mm_movemask_epi8(nonMatch))
+        return false;
+
+    // Map each character to its sextet value with a per-range additive shift; '/' shares a
+    // higher nibble with '+' and needs its own offset.
+    const __m128i shiftLUT =
+        _mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i sh = _mm_shuffle_epi8(shiftLUT, higherNibble);
+    const __m128i eq2f = _mm_cmpeq_epi8(in, _mm_set1_epi8(0x2f));
+    const __m128i shift =
+        _mm_or_si128(_mm_andnot_si128(eq2f, sh), _mm_and_si128(eq2f, _mm_set1_epi8(16)));
+    const __m128i values = _mm_add_epi8(in, shift);
+
+    // Pack four sextets per 32-bit lane into three octets, then compact the lanes.
+    const __m128i mergedPairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i merged = _mm_madd_epi16(mergedPairs, _mm_set1_epi32(0x00011000));
+    *out = _mm_shuffle_epi8(merged,
+                            _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    return true;
+}
+
+#endif  // defined(__SSSE3__)
+
 template <typename Writer>
 void encodeImpl(Writer&& write, StringData in) {
     const char* data = in.rawData();
     std::size_t size = in.size();
+#if defined(__SSSE3__)
+    const char* const dataEnd = data + size;
+#endif
     auto readOctet = [&data] { return static_cast<std::uint8_t>(*data++); };
     auto encodeSextet = [](unsigned x) { return kEncodeTable[x & 0b11'1111]; };
 
@@ -79,6 +176,19 @@ void encodeImpl(Writer&& write, StringData in) {
         std::size_t chunkGroups = std::min(fullGroups, sizeof(buf) / 4);
         fullGroups -= chunkGroups;
         p = buf.begin();
+#if defined(__SSSE3__)
+        // Each step consumes 4 groups (12 octets) and emits their 16 characters. The 16-byte
+        // load reads 4 bytes past the consumed groups, so stay vectorized only while a full
+        // register of input remains.
+        while (chunkGroups >= 4 && dataEnd - data >= 16) {
+            const __m128i chars =
+                encodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&*p), chars);
+            data += 12;
+            p += 16;
+            chunkGroups -= 4;
+        }
+#endif
         while (chunkGroups--) {
             accum = 0;
             accum |= readOctet() << (8 * (2 - 0));
@@ -143,6 +253,21 @@ void decodeImpl(const Writer& write, StringData in) {
         std::size_t chunkGroups = std::min(groups, buf.size() / 3);
         groups -= chunkGroups;
         p = buf.begin();
+#if defined(__SSSE3__)
+        // Each step consumes 4 groups (16 characters) and emits their 12 octets. The store
+        // writes 4 bytes of slack past the decoded octets, so leave room at the buffer tail;
+        // on an invalid character fall through to the scalar loop, which re-reads the block
+        // and raises the usual per-character error.
+        while (chunkGroups >= 4 && buf.end() - p >= 16) {
+            __m128i octets;
+            if (!decodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), &octets))
+                break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&*p), octets);
+            data += 16;
+            p += 12;
+            chunkGroups -= 4;
+        }
+#endif
         while (chunkGroups--) {
             accum = 0;
             accum |= decodeSextet(*data++) << (6 * (3 - 0));
@@ -52,6 +52,7 @@ void BM_Base64EncodeString(benchmark::State& state) {
 BENCHMARK(BM_Base64EncodeString)
     ->Arg(1)
     ->Arg(16)
+    ->Arg(64)
     ->Arg(1 << 10)
     ->Arg(2 << 10)
     ->Arg(3 << 10)
@@ -116,6 +117,7 @@ void BM_Base64DecodeString(benchmark::State& state) {
 BENCHMARK(BM_Base64DecodeString)
     ->Arg(1)
     ->Arg(16)
+    ->Arg(64)
     ->Arg(1 << 10)
     ->Arg(2 << 10)
     ->Arg(3 << 10)
@@ -0,0 +1,69 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+
+#include "mongo/stdx/thread.h"
+#include "mongo/util/with_alignment.h"
+
+namespace mongo {
+
+/**
+ * Stripes instances of T over multiple cache lines so that counters hit by every operation on
+ * every core do not all contend on the same line. Writers update the stripe selected by hashing
+ * the calling thread, readers visit all stripes and combine them. Reads are more expensive than
+ * for a single atomic and do not observe a point-in-time snapshot with respect to concurrent
+ * writers, which is acceptable for server status metrics.
+ */
+template <typename T>
+class ThreadStriped {
+public:
+    static constexpr std::size_t kNumStripes = 16;
+
+    /**
+     * Returns the stripe the calling thread should update.
+     */
+    T& stripe() {
+        static const std::hash<stdx::thread::id> hasher;
+        return _stripes[hasher(stdx::this_thread::get_id()) % kNumStripes];
+    }
+
+    const std::array<CacheAligned<T>, kNumStripes>& stripes() const {
+        return _stripes;
+    }
+
+private:
+    std::array<CacheAligned<T>, kNumStripes> _stripes{};
+};
+
+}  // namespace mongo
@@ -0,0 +1,138 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/concurrency/throughput_probing.h"
+
+#include <algorithm>
+
+#include "mongo/logv2/log.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+ThroughputProbing::ThroughputProbing(TicketHolder* readTicketHolder,
+                                     TicketHolder* writeTicketHolder,
+                                     Options options)
+    : _readTicketHolder(readTicketHolder),
+      _writeTicketHolder(writeTicketHolder),
+      _options(options),
+      _stableConcurrency(std::clamp(
+          readTicketHolder->outof(), options.minConcurrency, options.maxConcurrency)) {
+    invariant(_options.minConcurrency >= 5);
+    invariant(_options.maxConcurrency >= _options.minConcurrency);
+    _setConcurrency(_stableConcurrency);
+}
+
+void ThroughputProbing::run(Milliseconds elapsed) {
+    if (!_hasBaseline) {
+        // Nothing to compare against yet; just start counting.
+        _throughput(elapsed);
+        _hasBaseline = true;
+        return;
+    }
+
+    const double throughput = _throughput(elapsed);
+
+    switch (_state) {
+        case ProbingState::kStable:
+            _stableThroughput = throughput;
+            _probe();
+            break;
+
+        case ProbingState::kUp:
+        case ProbingState::kDown:
+            if (throughput > _stableThroughput) {
+                // The probe won; its concurrency level becomes the new stable level and its
+                // throughput the mark to beat.
+                _stableConcurrency = _readTicketHolder->outof();
+                _stableThroughput = throughput;
+                LOGV2_DEBUG(6174802,
+                            2,
+                            "Throughput probing found a better concurrency level",
+                            "concurrency"_attr = _stableConcurrency,
+                            "ticketsPerSecond"_attr = throughput * 1000);
+                _probe();
+            } else {
+                // The probe lost; go back to the stable level and re-measure it so the next
+                // comparison uses fresh numbers.
+                _setConcurrency(_stableConcurrency);
+                _state = ProbingState::kStable;
+            }
+            break;
+    }
+}
+
+void ThroughputProbing::_probe() {
+    const int step = std::max(1, static_cast<int>(_stableConcurrency * _options.stepMultiple));
+
+    // Alternate directions so the controller can walk toward the peak of the throughput curve
+    // from either side. Skip a direction when it would leave the configured bounds.
+    int probed = _stableConcurrency;
+    if (_probeUpNext && _stableConcurrency + step <= _options.maxConcurrency) {
+        probed = _stableConcurrency + step;
+        _state = ProbingState::kUp;
+    } else if (_stableConcurrency - step >= _options.minConcurrency) {
+        probed = _stableConcurrency - step;
+        _state = ProbingState::kDown;
+    } else if (_stableConcurrency + step <= _options.maxConcurrency) {
+        probed = _stableConcurrency + step;
+        _state = ProbingState::kUp;
+    } else {
+        _state = ProbingState::kStable;
+        return;
+    }
+    _probeUpNext = !_probeUpNext;
+
+    _setConcurrency(probed);
+}
+
+void ThroughputProbing::_setConcurrency(int concurrency) {
+    // Resizing down blocks until enough tickets are free; run() is called from a background
+    // thread where that is acceptable. Failures (e.g. a concurrent manual resize below the
+    // minimum) leave the pools at their current sizes and are retried by the next probe.
+    _readTicketHolder->resize(concurrency).ignore();
+    _writeTicketHolder->resize(concurrency).ignore();
+}
+
+double ThroughputProbing::_throughput(Milliseconds elapsed) {
+    const int64_t releases = _readTicketHolder->numReleases() + _writeTicketHolder->numReleases();
+    const int64_t completed = releases - _lastNumReleases;
+    _lastNumReleases = releases;
+
+    if (elapsed <= Milliseconds(0)) {
+        return 0;
+    }
+    return static_cast<double>(completed) / durationCount<Milliseconds>(elapsed);
+}
+
+}  // namespace mongo
@@ -0,0 +1,102 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+/**
+ * Adjusts the sizes of a pair of ticket pools by hill climbing on measured throughput.
+ *
+ * The controller alternates between a stable concurrency level and probes one step above or below
+ * it. Throughput is measured as tickets released per millisecond across both pools over the
+ * interval since the previous run() call. A probe that beats the stable level's throughput becomes
+ * the new stable level; one that doesn't is reverted. Probe directions alternate so the controller
+ * tracks the peak of the throughput curve from either side as the workload or cache pressure
+ * shifts.
+ *
+ * The owner is responsible for calling run() periodically from a background thread and for
+ * ensuring the ticket holders outlive this object. Not thread-safe; run() calls must be
+ * serialized.
+ */
+class ThroughputProbing {
+    ThroughputProbing(const ThroughputProbing&) = delete;
+    ThroughputProbing& operator=(const ThroughputProbing&) = delete;
+
+public:
+    struct Options {
+        // Bounds for each pool's concurrency level. The minimum matches the smallest size
+        // TicketHolder::resize() accepts.
+        int minConcurrency = 5;
+        int maxConcurrency = 1024;
+
+        // Probe step as a fraction of the stable concurrency level, with a floor of one ticket.
+        double stepMultiple = 0.1;
+    };
+
+    ThroughputProbing(TicketHolder* readTicketHolder,
+                      TicketHolder* writeTicketHolder,
+                      Options options);
+
+    /**
+     * Measures throughput over the interval since the previous call and moves the concurrency
+     * level accordingly. 'elapsed' is the wall time since that call; the first call only
+     * establishes a baseline.
+     */
+    void run(Milliseconds elapsed);
+
+    int stableConcurrency() const {
+        return _stableConcurrency;
+    }
+
+private:
+    enum class ProbingState { kStable, kUp, kDown };
+
+    void _probe();
+    void _setConcurrency(int concurrency);
+
+    double _throughput(Milliseconds elapsed);
+
+    TicketHolder* const _readTicketHolder;
+    TicketHolder* const _writeTicketHolder;
+    const Options _options;
+
+    ProbingState _state = ProbingState::kStable;
+    bool _probeUpNext = true;
+    int _stableConcurrency;
+    double _stableThroughput = 0;
+
+    bool _hasBaseline = false;
+    int64_t _lastNumReleases = 0;
+};
+
+}  // namespace mongo
@@ -0,0 +1,110 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kTest
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/concurrency/throughput_probing.h"
+
+namespace {
+using namespace mongo;
+
+// Simulates 'count' completed operations on 'holder' so numReleases() advances without keeping
+// tickets checked out.
+void simulateOps(TicketHolder* holder, int count) {
+    for (int i = 0; i < count; i++) {
+        ASSERT_TRUE(holder->tryAcquire());
+        holder->release();
+    }
+}
+
+TEST(ThroughputProbingTest, ProbeUpSticksWhenThroughputImproves) {
+    TicketHolder reads(10);
+    TicketHolder writes(10);
+    ThroughputProbing::Options options;
+    options.minConcurrency = 5;
+    options.maxConcurrency = 100;
+    ThroughputProbing probing(&reads, &writes, options);
+
+    // Establish a baseline, then a stable throughput measurement; the controller then probes up.
+    probing.run(Seconds(1));
+    simulateOps(&reads, 100);
+    probing.run(Seconds(1));
+    ASSERT_GT(reads.outof(), 10);
+
+    // More throughput at the probed level makes it the new stable level.
+    simulateOps(&reads, 200);
+    probing.run(Seconds(1));
+    ASSERT_GT(probing.stableConcurrency(), 10);
+}
+
+TEST(ThroughputProbingTest, FailedProbeRevertsToStableLevel) {
+    TicketHolder reads(10);
+    TicketHolder writes(10);
+    ThroughputProbing::Options options;
+    options.minConcurrency = 5;
+    options.maxConcurrency = 100;
+    ThroughputProbing probing(&reads, &writes, options);
+
+    probing.run(Seconds(1));
+    simulateOps(&reads, 100);
+    probing.run(Seconds(1));
+    ASSERT_GT(reads.outof(), 10);
+
+    // Less throughput at the probed level reverts both pools to the stable level.
+    simulateOps(&reads, 50);
+    probing.run(Seconds(1));
+    ASSERT_EQ(reads.outof(), 10);
+    ASSERT_EQ(writes.outof(), 10);
+    ASSERT_EQ(probing.stableConcurrency(), 10);
+}
+
+TEST(ThroughputProbingTest, ConcurrencyStaysWithinBounds) {
+    TicketHolder reads(10);
+    TicketHolder writes(10);
+    ThroughputProbing::Options options;
+    options.minConcurrency = 5;
+    options.maxConcurrency = 12;
+    ThroughputProbing probing(&reads, &writes, options);
+
+    probing.run(Seconds(1));
+    for (int i = 0; i < 20; i++) {
+        // Throughput always "improves", so the controller keeps accepting probes; the levels
+        // must still respect the configured bounds.
+        simulateOps(&reads, 100 * (i + 1));
+        probing.run(Seconds(1));
+        ASSERT_GTE(reads.outof(), options.minConcurrency);
+        ASSERT_LTE(reads.outof(), options.maxConcurrency);
+        ASSERT_GTE(writes.outof(), options.minConcurrency);
+        ASSERT_LTE(writes.outof(), options.maxConcurrency);
+    }
+}
+}  // namespace
@@ -36,6 +36,7 @@
 #include <iostream>
 
 #include "mongo/logv2/log.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -102,11 +103,16 @@ bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
     const Milliseconds intervalMs(500);
     struct timespec ts;
 
+    const Date_t startedWaiting = Date_t::now();
+    ON_BLOCK_EXIT([&] {
+        _waitLatencies.record(duration_cast<Microseconds>(Date_t::now() - startedWaiting));
+    });
+
     // To support interrupting ticket acquisition while still benefiting from semaphores, we do a
     // timed wait on an interval to periodically check for interrupts.
     // The wait period interval is the smaller of the default interval and the provided
     // deadline.
-    Date_t deadline = std::min(until, Date_t::now() + intervalMs);
+    Date_t deadline = std::min(until, startedWaiting + intervalMs);
     tsFromDate(deadline, ts);
 
     while (0 != sem_timedwait(&_sem, &ts)) {
@@ -131,6 +137,7 @@ bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
 
 void TicketHolder::release() {
     check(sem_post(&_sem));
+    _releases.fetchAndAdd(1);
 }
 
 Status TicketHolder::resize(int newSize) {
@@ -146,7 +153,9 @@ Status TicketHolder::resize(int newSize) {
                                     << "; given " << newSize);
 
     while (_outof.load() < newSize) {
-        release();
+        // Post the semaphore directly rather than through release() so resizes don't count as
+        // completed operations in numReleases().
+        check(sem_post(&_sem));
         _outof.fetchAndAdd(1);
     }
 
@@ -187,6 +196,15 @@ bool TicketHolder::tryAcquire() {
 void TicketHolder::waitForTicket(OperationContext* opCtx) {
     stdx::unique_lock<Latch> lk(_mutex);
 
+    if (_tryAcquire()) {
+        return;
+    }
+
+    const Date_t startedWaiting = Date_t::now();
+    ON_BLOCK_EXIT([&] {
+        _waitLatencies.record(duration_cast<Microseconds>(Date_t::now() - startedWaiting));
+    });
+
     if (opCtx) {
         opCtx->waitForConditionOrInterrupt(_newTicket, lk, [this] { return _tryAcquire(); });
     } else {
@@ -197,6 +215,15 @@ void TicketHolder::waitForTicket(OperationContext* opCtx) {
 bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
     stdx::unique_lock<Latch> lk(_mutex);
 
+    if (_tryAcquire()) {
+        return true;
+    }
+
+    const Date_t startedWaiting = Date_t::now();
+    ON_BLOCK_EXIT([&] {
+        _waitLatencies.record(duration_cast<Microseconds>(Date_t::now() - startedWaiting));
+    });
+
     if (opCtx) {
         return opCtx->waitForConditionOrInterruptUntil(
             _newTicket, lk, until, [this] { return _tryAcquire(); });
@@ -212,6 +239,7 @@ void TicketHolder::release() {
         _num++;
     }
     _newTicket.notify_one();
+    _releases.fetchAndAdd(1);
 }
 
 Status TicketHolder::resize(int newSize) {
@@ -259,4 +287,8 @@ bool TicketHolder::_tryAcquire() {
     return true;
 }
 #endif
+
+int64_t TicketHolder::numReleases() const {
+    return _releases.load();
+}
 }  // namespace mongo
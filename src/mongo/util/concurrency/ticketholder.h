@@ -36,6 +36,7 @@
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/concurrency/mutex.h"
+#include "mongo/util/concurrency/wait_duration_histogram.h"
 #include "mongo/util/hierarchical_acquisition.h"
 #include "mongo/util/time_support.h"
 
@@ -82,7 +83,26 @@ public:
 
     int outof() const;
 
+    /**
+     * Returns the number of tickets released over this holder's lifetime, i.e. the number of
+     * completed operations. Used by adaptive concurrency control to measure throughput per
+     * probing interval. Resizes do not count.
+     */
+    int64_t numReleases() const;
+
+    /**
+     * Histogram of how long operations blocked waiting for a ticket. Acquisitions that succeed
+     * immediately are not recorded.
+     */
+    const WaitDurationHistogram& waitLatencies() const {
+        return _waitLatencies;
+    }
+
 private:
+    AtomicWord<int64_t> _releases{0};
+
+    WaitDurationHistogram _waitLatencies;
+
 #if defined(__linux__)
     mutable sem_t _sem;
 
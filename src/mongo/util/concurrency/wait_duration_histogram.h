@@ -0,0 +1,107 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/bits.h"
+#include "mongo/util/concurrency/thread_striped.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+/**
+ * Low-overhead histogram of wait durations with power-of-two microsecond buckets, for
+ * instrumenting admission points (tickets, locks, flow control) that every operation may pass
+ * through. Recording is two relaxed atomic increments on a thread-striped set of buckets, so hot
+ * wait points do not contend on a shared cache line. Readers sum the stripes and therefore do not
+ * observe a point-in-time snapshot, which is acceptable for serverStatus metrics.
+ */
+class WaitDurationHistogram {
+public:
+    /**
+     * Buckets cover [2^i, 2^(i+1)) microseconds; the last bucket absorbs everything of roughly 36
+     * minutes and over.
+     */
+    static constexpr size_t kNumBuckets = 32;
+
+    void record(Microseconds duration) {
+        auto& stripe = _stripes.stripe();
+        stripe.buckets[_bucket(duration)].fetchAndAddRelaxed(1);
+        stripe.totalMicros.fetchAndAddRelaxed(durationCount<Microseconds>(duration));
+    }
+
+    /**
+     * Appends {count, totalMicros, micros: {"1": n, "2": n, ...}} into 'builder'. Every bucket is
+     * present regardless of its count and bucket names are their lower bounds in microseconds, so
+     * the document schema stays stable for FTDC's delta compression.
+     */
+    void append(BSONObjBuilder* builder) const {
+        std::array<long long, kNumBuckets> buckets{};
+        long long count = 0;
+        long long totalMicros = 0;
+        for (auto& stripe : _stripes.stripes()) {
+            for (size_t i = 0; i < kNumBuckets; ++i) {
+                auto n = stripe.buckets[i].loadRelaxed();
+                buckets[i] += n;
+                count += n;
+            }
+            totalMicros += stripe.totalMicros.loadRelaxed();
+        }
+
+        builder->append("count", count);
+        builder->append("totalMicros", totalMicros);
+        BSONObjBuilder micros(builder->subobjStart("micros"));
+        for (size_t i = 0; i < kNumBuckets; ++i) {
+            micros.append(std::to_string(1LL << i), buckets[i]);
+        }
+        micros.done();
+    }
+
+private:
+    struct Stripe {
+        std::array<AtomicWord<long long>, kNumBuckets> buckets;
+        AtomicWord<long long> totalMicros;
+    };
+
+    static size_t _bucket(Microseconds duration) {
+        auto micros = static_cast<unsigned long long>(std::max(duration.count(), 1LL));
+        return std::min(static_cast<size_t>(63 - countLeadingZeros64(micros)), kNumBuckets - 1);
+    }
+
+    ThreadStriped<Stripe> _stripes;
+};
+
+}  // namespace mongo
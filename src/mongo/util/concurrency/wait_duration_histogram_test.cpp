@@ -0,0 +1,116 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/concurrency/wait_duration_histogram.h"
+
+namespace {
+using namespace mongo;
+
+BSONObj toBSON(const WaitDurationHistogram& histogram) {
+    BSONObjBuilder bob;
+    histogram.append(&bob);
+    return bob.obj();
+}
+
+TEST(WaitDurationHistogramTest, EmptyHistogramAppendsAllBuckets) {
+    WaitDurationHistogram histogram;
+    auto obj = toBSON(histogram);
+
+    ASSERT_EQ(obj["count"].numberLong(), 0);
+    ASSERT_EQ(obj["totalMicros"].numberLong(), 0);
+
+    // Every bucket must be present even when empty so the schema stays stable for FTDC.
+    auto micros = obj["micros"].Obj();
+    ASSERT_EQ(static_cast<size_t>(micros.nFields()), WaitDurationHistogram::kNumBuckets);
+    for (auto&& elem : micros) {
+        ASSERT_EQ(elem.numberLong(), 0);
+    }
+}
+
+TEST(WaitDurationHistogramTest, RecordPlacesDurationsInPowerOfTwoBuckets) {
+    WaitDurationHistogram histogram;
+    histogram.record(Microseconds(1));
+    histogram.record(Microseconds(2));
+    histogram.record(Microseconds(3));
+    histogram.record(Microseconds(1000));
+
+    auto obj = toBSON(histogram);
+    ASSERT_EQ(obj["count"].numberLong(), 4);
+    ASSERT_EQ(obj["totalMicros"].numberLong(), 1006);
+
+    auto micros = obj["micros"].Obj();
+    ASSERT_EQ(micros["1"].numberLong(), 1);
+    ASSERT_EQ(micros["2"].numberLong(), 2);   // 2 and 3 both land in [2, 4).
+    ASSERT_EQ(micros["512"].numberLong(), 1);  // 1000 lands in [512, 1024).
+}
+
+TEST(WaitDurationHistogramTest, ExtremeDurationsUseBoundaryBuckets) {
+    WaitDurationHistogram histogram;
+    histogram.record(Microseconds(0));
+    histogram.record(Microseconds::max());
+
+    auto obj = toBSON(histogram);
+    auto micros = obj["micros"].Obj();
+
+    // Sub-microsecond waits count in the first bucket; enormous waits saturate into the last.
+    ASSERT_EQ(micros.firstElement().numberLong(), 1);
+    ASSERT_EQ(micros[std::to_string(1LL << (WaitDurationHistogram::kNumBuckets - 1))].numberLong(),
+              1);
+    ASSERT_EQ(obj["count"].numberLong(), 2);
+}
+
+TEST(WaitDurationHistogramTest, AppendSumsAcrossThreads) {
+    WaitDurationHistogram histogram;
+
+    constexpr int kThreads = 8;
+    constexpr int kRecordsPerThread = 1000;
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&histogram] {
+            for (int j = 0; j < kRecordsPerThread; ++j) {
+                histogram.record(Microseconds(16));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto obj = toBSON(histogram);
+    ASSERT_EQ(obj["count"].numberLong(), kThreads * kRecordsPerThread);
+    ASSERT_EQ(obj["totalMicros"].numberLong(), 16LL * kThreads * kRecordsPerThread);
+    ASSERT_EQ(obj["micros"].Obj()["16"].numberLong(), kThreads * kRecordsPerThread);
+}
+
+}  // namespace
@@ -0,0 +1,565 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kExecutor
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/concurrency/work_stealing_thread_pool.h"
+
+#include <deque>
+#include <fmt/format.h>
+#include <iterator>
+
+#include "mongo/base/status.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/idle_thread_block.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/hierarchical_acquisition.h"
+
+namespace mongo {
+
+namespace {
+
+using namespace fmt::literals;
+
+// Counter used to assign unique names to otherwise-unnamed thread pools.
+AtomicWord<int> nextUnnamedWorkStealingPoolId{1};
+
+/**
+ * Sets defaults and checks bounds limits on "options", and returns it.
+ *
+ * This method is just a helper for the WorkStealingThreadPool constructor.
+ */
+WorkStealingThreadPool::Options cleanUpOptions(WorkStealingThreadPool::Options&& options) {
+    if (options.poolName.empty()) {
+        options.poolName =
+            "WorkStealingThreadPool{}"_format(nextUnnamedWorkStealingPoolId.fetchAndAdd(1));
+    }
+    if (options.threadNamePrefix.empty()) {
+        options.threadNamePrefix = "{}-"_format(options.poolName);
+    }
+    if (options.numThreads < 1) {
+        LOGV2_FATAL(6174807,
+                    "Cannot create pool {poolName} with {numThreads} threads, which is less "
+                    "than 1",
+                    "Cannot create pool with fewer than 1 thread",
+                    "poolName"_attr = options.poolName,
+                    "numThreads"_attr = options.numThreads);
+    }
+    return {std::move(options)};
+}
+
+}  // namespace
+
+
+// Public functions forwarded from WorkStealingThreadPool.
+class WorkStealingThreadPool::Impl {
+public:
+    explicit Impl(Options options);
+    ~Impl();
+    void startup();
+    void shutdown();
+    void join();
+    void schedule(Task task);
+    void scheduleBatch(std::vector<Task> tasks);
+    void waitForIdle();
+
+private:
+    /**
+     * Stage of life of the pool; the same lifecycle as ThreadPool, minus thread retirement.
+     *
+     * Diagram of legal transitions:
+     *
+     * preStart -> running -> joinRequired -> joining -> shutdownComplete
+     *        \               ^
+     *         \_____________/
+     */
+    enum LifecycleState { preStart, running, joinRequired, joining, shutdownComplete };
+
+    /**
+     * One task queue and its synchronization. Each worker thread owns exactly one Worker; other
+     * threads touch it only to submit tasks or to steal.
+     */
+    struct Worker {
+        // Guards 'tasks', 'sleeping', 'stealHint' and 'closed'. Held only for deque pushes and
+        // pops, so spinning beats parking on contention.
+        Mutex mutex = MONGO_MAKE_LATCH("WorkStealingThreadPool::Worker::mutex",
+                                       latch_detail::SpinPolicy::kAdaptiveSpin);
+
+        // Signaled when work lands in 'tasks', when a sibling queue has work worth stealing, or
+        // when the pool shuts down.
+        stdx::condition_variable workAvailable;
+
+        // The owner pops from the front; thieves pop from the back.
+        std::deque<Task> tasks;
+
+        // True while the owning thread is blocked on 'workAvailable'.
+        bool sleeping = false;
+
+        // Set by _wakeOneSleeper() to tell the woken owner that the work is in a sibling queue.
+        bool stealHint = false;
+
+        // Set during join() once the worker threads have exited; tasks can no longer be enqueued.
+        bool closed = false;
+    };
+
+    /** The thread body for worker threads. */
+    void _workerThreadBody(size_t workerIndex) noexcept;
+
+    /**
+     * Blocks until a task is available, taken from the calling worker's own queue or stolen from
+     * a sibling. Returns an empty Task when the pool is shutting down and no work remains.
+     */
+    Task _nextTask(size_t workerIndex);
+
+    /**
+     * Attempts to steal one task from the back of another worker's queue, probing siblings in
+     * order starting after 'workerIndex'. Uses try_lock so a thief never stalls behind a busy
+     * queue. Returns an empty Task if nothing was found.
+     */
+    Task _trySteal(size_t workerIndex);
+
+    /**
+     * Returns the queue a submission from the current thread should target: the caller's own
+     * queue for pool threads, round-robin for everyone else.
+     */
+    Worker& _targetWorker();
+
+    /**
+     * Notifies one sleeping worker, if any, so it can go steal. Called when a submission finds
+     * its target queue's owner already busy.
+     */
+    void _wakeOneSleeper();
+
+    /** Bookkeeping run after each task finishes, successfully scheduled or not. */
+    void _onTaskDone();
+
+    /**
+     * Changes the lifecycle state (_state) of the pool and wakes up any threads waiting for a
+     * state change. Requires _mutex. Has no effect if _state == newState.
+     */
+    void _setState_inlock(LifecycleState newState);
+
+    // These are the options with which the pool was configured at construction time.
+    const Options _options;
+
+    // Guards lifecycle transitions and _threads. Never taken on the schedule() fast path.
+    mutable Mutex _mutex =
+        MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "WorkStealingThreadPool::_mutex");
+
+    // Condition variable signaled whenever _state changes.
+    stdx::condition_variable _stateChange;
+
+    // Condition signaled to indicate that there are no unfinished tasks.
+    stdx::condition_variable _poolIsIdle;
+
+    // The lifecycle state of the pool. Transitions happen under _mutex; hot paths read it
+    // without the lock.
+    AtomicWord<int> _state{preStart};
+
+    // One queue per worker thread, created at construction so submissions in the preStart state
+    // have somewhere to go.
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+    // The worker threads; populated by startup().
+    std::vector<stdx::thread> _threads;
+
+    // Round-robin cursor for submissions from threads outside the pool.
+    AtomicWord<unsigned> _nextWorker{0};
+
+    // Number of workers currently asleep waiting for work.
+    AtomicWord<int> _numSleeping{0};
+
+    // Tasks accepted but not yet finished; drives waitForIdle().
+    AtomicWord<int64_t> _unfinishedTasks{0};
+
+    // Identifies the pool and queue owned by the calling thread, if the calling thread is a
+    // WorkStealingThreadPool worker.
+    static thread_local Impl* _localPool;
+    static thread_local size_t _localWorkerIndex;
+};
+
+thread_local WorkStealingThreadPool::Impl* WorkStealingThreadPool::Impl::_localPool = nullptr;
+thread_local size_t WorkStealingThreadPool::Impl::_localWorkerIndex = 0;
+
+WorkStealingThreadPool::Impl::Impl(Options options)
+    : _options(cleanUpOptions(std::move(options))) {
+    for (size_t i = 0; i < _options.numThreads; ++i) {
+        _workers.push_back(std::make_unique<Worker>());
+    }
+}
+
+WorkStealingThreadPool::Impl::~Impl() {
+    shutdown();
+    if (_state.load() != shutdownComplete) {
+        join();
+    }
+    invariant(_state.load() == shutdownComplete);
+}
+
+void WorkStealingThreadPool::Impl::startup() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    if (_state.load() != preStart) {
+        LOGV2_FATAL(6174808,
+                    "Attempted to start pool {poolName}, but it has already started",
+                    "Attempted to start pool that has already started",
+                    "poolName"_attr = _options.poolName);
+    }
+    _setState_inlock(running);
+    invariant(_threads.empty());
+    for (size_t i = 0; i < _options.numThreads; ++i) {
+        _threads.emplace_back([this, i] { _workerThreadBody(i); });
+    }
+}
+
+void WorkStealingThreadPool::Impl::shutdown() {
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        switch (static_cast<LifecycleState>(_state.load())) {
+            case preStart:
+            case running:
+                _setState_inlock(joinRequired);
+                _poolIsIdle.notify_all();
+                break;
+            case joinRequired:
+            case joining:
+            case shutdownComplete:
+                return;
+        }
+    }
+    for (auto& worker : _workers) {
+        stdx::lock_guard<Latch> lk(worker->mutex);
+        worker->workAvailable.notify_all();
+    }
+}
+
+void WorkStealingThreadPool::Impl::join() {
+    stdx::unique_lock<Latch> lk(_mutex);
+    _stateChange.wait(lk, [this] {
+        auto state = _state.load();
+        return state != preStart && state != running;
+    });
+    if (_state.load() != joinRequired) {
+        LOGV2_FATAL(6174809,
+                    "Attempted to join pool {poolName} more than once",
+                    "Attempted to join pool more than once",
+                    "poolName"_attr = _options.poolName);
+    }
+    _setState_inlock(joining);
+    auto threadsToJoin = std::exchange(_threads, {});
+    lk.unlock();
+    for (auto& t : threadsToJoin) {
+        t.join();
+    }
+
+    // The workers have exited, so nothing pops from the queues anymore. Close them and collect
+    // whatever raced in after the workers drained.
+    std::deque<Task> leftoverTasks;
+    for (auto& worker : _workers) {
+        stdx::lock_guard<Latch> wlk(worker->mutex);
+        worker->closed = true;
+        std::move(
+            worker->tasks.begin(), worker->tasks.end(), std::back_inserter(leftoverTasks));
+        worker->tasks.clear();
+    }
+    if (!leftoverTasks.empty()) {
+        // Leftover tasks cannot be run inline because they can create OperationContexts and the
+        // join() caller may already have one associated with the thread.
+        stdx::thread cleanThread = stdx::thread([&] {
+            const std::string threadName = "{}drain"_format(_options.threadNamePrefix);
+            setThreadName(threadName);
+            if (_options.onCreateThread)
+                _options.onCreateThread(threadName);
+            for (auto& task : leftoverTasks) {
+                Task local = std::move(task);
+                local(Status::OK());
+                local = Task();
+                _onTaskDone();
+            }
+        });
+        cleanThread.join();
+    }
+
+    lk.lock();
+    invariant(_state.load() == joining);
+    _setState_inlock(shutdownComplete);
+}
+
+void WorkStealingThreadPool::Impl::schedule(Task task) {
+    auto state = _state.load();
+    if (state == joinRequired || state == joining || state == shutdownComplete) {
+        task(Status(ErrorCodes::ShutdownInProgress,
+                    "Shutdown of thread pool {} in progress"_format(_options.poolName)));
+        return;
+    }
+
+    _unfinishedTasks.fetchAndAdd(1);
+
+    auto& worker = _targetWorker();
+    bool wasSleeping;
+    {
+        stdx::unique_lock<Latch> lk(worker.mutex);
+        if (worker.closed) {
+            // Lost a race with join() closing the queues; this pool can no longer run the task.
+            lk.unlock();
+            _onTaskDone();
+            task(Status(ErrorCodes::ShutdownInProgress,
+                        "Shutdown of thread pool {} in progress"_format(_options.poolName)));
+            return;
+        }
+        worker.tasks.push_back(std::move(task));
+        wasSleeping = worker.sleeping;
+    }
+
+    if (wasSleeping) {
+        worker.workAvailable.notify_one();
+    } else if (_state.load() == running && _numSleeping.load() > 0) {
+        // The target queue's owner is already busy; an idle sibling can come steal this task.
+        _wakeOneSleeper();
+    }
+}
+
+void WorkStealingThreadPool::Impl::scheduleBatch(std::vector<Task> tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+
+    auto state = _state.load();
+    if (state == joinRequired || state == joining || state == shutdownComplete) {
+        auto status = Status(ErrorCodes::ShutdownInProgress,
+                             "Shutdown of thread pool {} in progress"_format(_options.poolName));
+        for (auto& task : tasks) {
+            task(status);
+        }
+        return;
+    }
+
+    _unfinishedTasks.fetchAndAdd(tasks.size());
+
+    const size_t numWorkers = _workers.size();
+    const size_t share = (tasks.size() + numWorkers - 1) / numWorkers;
+    size_t next = _nextWorker.fetchAndAdd(1) % numWorkers;
+    size_t taskIndex = 0;
+    while (taskIndex < tasks.size()) {
+        auto& worker = *_workers[next];
+        next = (next + 1) % numWorkers;
+
+        bool wasSleeping;
+        {
+            stdx::unique_lock<Latch> lk(worker.mutex);
+            if (worker.closed) {
+                lk.unlock();
+                auto status =
+                    Status(ErrorCodes::ShutdownInProgress,
+                           "Shutdown of thread pool {} in progress"_format(_options.poolName));
+                for (; taskIndex < tasks.size(); ++taskIndex) {
+                    _onTaskDone();
+                    tasks[taskIndex](status);
+                }
+                return;
+            }
+            for (size_t i = 0; i < share && taskIndex < tasks.size(); ++i, ++taskIndex) {
+                worker.tasks.push_back(std::move(tasks[taskIndex]));
+            }
+            wasSleeping = worker.sleeping;
+        }
+        if (wasSleeping) {
+            worker.workAvailable.notify_one();
+        }
+    }
+}
+
+void WorkStealingThreadPool::Impl::waitForIdle() {
+    stdx::unique_lock<Latch> lk(_mutex);
+    _poolIsIdle.wait(lk, [this] {
+        return _unfinishedTasks.load() == 0 || _state.load() == joinRequired;
+    });
+}
+
+void WorkStealingThreadPool::Impl::_workerThreadBody(size_t workerIndex) noexcept {
+    const std::string threadName = "{}{}"_format(_options.threadNamePrefix, workerIndex);
+    setThreadName(threadName);
+    if (_options.onCreateThread)
+        _options.onCreateThread(threadName);
+    _localPool = this;
+    _localWorkerIndex = workerIndex;
+    LOGV2_DEBUG(6174810,
+                1,
+                "Starting thread {threadName} in pool {poolName}",
+                "Starting thread",
+                "threadName"_attr = threadName,
+                "poolName"_attr = _options.poolName);
+
+    while (Task task = _nextTask(workerIndex)) {
+        task(Status::OK());
+        // Run the task's destructor before looking for more work.
+        task = Task();
+        _onTaskDone();
+    }
+
+    _localPool = nullptr;
+    LOGV2_DEBUG(6174811,
+                1,
+                "Shutting down thread {threadName} in pool {poolName}",
+                "Shutting down thread",
+                "threadName"_attr = threadName,
+                "poolName"_attr = _options.poolName);
+}
+
+WorkStealingThreadPool::Task WorkStealingThreadPool::Impl::_nextTask(size_t workerIndex) {
+    auto* self = _workers[workerIndex].get();
+    while (true) {
+        {
+            stdx::lock_guard<Latch> lk(self->mutex);
+            if (!self->tasks.empty()) {
+                Task task = std::move(self->tasks.front());
+                self->tasks.pop_front();
+                return task;
+            }
+        }
+
+        if (auto task = _trySteal(workerIndex)) {
+            return task;
+        }
+
+        stdx::unique_lock<Latch> lk(self->mutex);
+        if (!self->tasks.empty()) {
+            continue;
+        }
+
+        if (_state.load() != running) {
+            // Shutting down with nothing left to run locally or steal.
+            return {};
+        }
+
+        self->sleeping = true;
+        _numSleeping.fetchAndAdd(1);
+        {
+            MONGO_IDLE_THREAD_BLOCK;
+            self->workAvailable.wait(lk, [&] {
+                return !self->tasks.empty() || self->stealHint || _state.load() != running;
+            });
+        }
+        self->sleeping = false;
+        self->stealHint = false;
+        _numSleeping.fetchAndSub(1);
+    }
+}
+
+WorkStealingThreadPool::Task WorkStealingThreadPool::Impl::_trySteal(size_t workerIndex) {
+    const size_t numWorkers = _workers.size();
+    for (size_t k = 1; k < numWorkers; ++k) {
+        auto* victim = _workers[(workerIndex + k) % numWorkers].get();
+        stdx::unique_lock<Latch> lk(victim->mutex, stdx::try_to_lock);
+        if (!lk.owns_lock() || victim->tasks.empty()) {
+            continue;
+        }
+        // Steal from the back, opposite the owner's end, so owner and thief contend on the
+        // deque as little as possible.
+        Task task = std::move(victim->tasks.back());
+        victim->tasks.pop_back();
+        return task;
+    }
+    return {};
+}
+
+WorkStealingThreadPool::Impl::Worker& WorkStealingThreadPool::Impl::_targetWorker() {
+    if (_localPool == this) {
+        return *_workers[_localWorkerIndex];
+    }
+    return *_workers[_nextWorker.fetchAndAdd(1) % _workers.size()];
+}
+
+void WorkStealingThreadPool::Impl::_wakeOneSleeper() {
+    for (auto& worker : _workers) {
+        stdx::unique_lock<Latch> lk(worker->mutex, stdx::try_to_lock);
+        if (!lk.owns_lock() || !worker->sleeping) {
+            continue;
+        }
+        worker->stealHint = true;
+        lk.unlock();
+        worker->workAvailable.notify_one();
+        return;
+    }
+}
+
+void WorkStealingThreadPool::Impl::_onTaskDone() {
+    if (_unfinishedTasks.subtractAndFetch(1) == 0) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _poolIsIdle.notify_all();
+    }
+}
+
+void WorkStealingThreadPool::Impl::_setState_inlock(const LifecycleState newState) {
+    if (newState == _state.load()) {
+        return;
+    }
+    _state.store(newState);
+    _stateChange.notify_all();
+}
+
+// ========================================
+// WorkStealingThreadPool public functions that simply forward to the `_impl`.
+
+WorkStealingThreadPool::WorkStealingThreadPool(Options options)
+    : _impl{std::make_unique<Impl>(std::move(options))} {}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() = default;
+
+void WorkStealingThreadPool::startup() {
+    _impl->startup();
+}
+
+void WorkStealingThreadPool::shutdown() {
+    _impl->shutdown();
+}
+
+void WorkStealingThreadPool::join() {
+    _impl->join();
+}
+
+void WorkStealingThreadPool::schedule(Task task) {
+    _impl->schedule(std::move(task));
+}
+
+void WorkStealingThreadPool::scheduleBatch(std::vector<Task> tasks) {
+    _impl->scheduleBatch(std::move(tasks));
+}
+
+void WorkStealingThreadPool::waitForIdle() {
+    _impl->waitForIdle();
+}
+
+}  // namespace mongo
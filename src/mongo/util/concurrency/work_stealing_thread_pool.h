@@ -0,0 +1,113 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/util/concurrency/thread_pool_interface.h"
+
+namespace mongo {
+
+/**
+ * A fixed-size thread pool that keeps a task queue per worker thread instead of one shared queue.
+ *
+ * schedule() picks a single queue - the caller's own when invoked from a pool thread, round-robin
+ * otherwise - takes only that queue's mutex and wakes only that queue's worker, so concurrent
+ * submitters do not serialize on one pool-wide lock the way they do with ThreadPool. Workers that
+ * run out of local work steal from their siblings before going to sleep.
+ *
+ * This pool is worthwhile for workloads that push a high rate of short tasks through a pool from
+ * many threads. For long-running or infrequent tasks, prefer ThreadPool, which can also grow and
+ * shrink its thread count.
+ */
+class WorkStealingThreadPool final : public ThreadPoolInterface {
+public:
+    /**
+     * Structure used to configure an instance of WorkStealingThreadPool.
+     */
+    struct Options {
+        // Name of the thread pool. If this string is empty, the pool will be assigned a
+        // name unique to the current process.
+        std::string poolName;
+
+        // Prefix used to name threads for logging purposes. If you leave this empty, the
+        // prefix will be the pool name followed by a hyphen.
+        std::string threadNamePrefix;
+
+        // Number of worker threads, and thus task queues, in the pool. Fixed for the lifetime
+        // of the pool.
+        size_t numThreads = 8;
+
+        /** If callable, called before each worker thread begins consuming tasks. */
+        std::function<void(const std::string&)> onCreateThread;
+    };
+
+    /**
+     * Constructs a thread pool, configured with the given "options".
+     */
+    explicit WorkStealingThreadPool(Options options);
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+    ~WorkStealingThreadPool() override;
+
+    // from OutOfLineExecutor (base of ThreadPoolInterface)
+    void schedule(Task task) override;
+
+    // from ThreadPoolInterface
+    void startup() override;
+    void shutdown() override;
+    void join() override;
+
+    /**
+     * Schedules a batch of tasks, spreading them across the worker queues while taking each
+     * queue's mutex at most once. Equivalent to calling schedule() on every element, but cheaper
+     * for large batches.
+     */
+    void scheduleBatch(std::vector<Task> tasks);
+
+    /**
+     * Blocks the caller until there are no pending or running tasks on this pool.
+     *
+     * Carries the same caveat as ThreadPool::waitForIdle(): if called before shutdown(), there is
+     * no guarantee that there will still be no pending tasks when the function returns.
+     */
+    void waitForIdle();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace mongo
@@ -0,0 +1,107 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kTest
+
+#include "mongo/platform/basic.h"
+
+#include <vector>
+
+#include "mongo/base/init.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/concurrency/thread_pool_test_common.h"
+#include "mongo/util/concurrency/work_stealing_thread_pool.h"
+
+namespace {
+using namespace mongo;
+
+MONGO_INITIALIZER(WorkStealingThreadPoolCommonTests)(InitializerContext*) {
+    addTestsForThreadPool("WorkStealingThreadPoolCommon", []() {
+        return std::make_unique<WorkStealingThreadPool>(WorkStealingThreadPool::Options());
+    });
+}
+
+TEST(WorkStealingThreadPoolTest, ExecutesTasksFromManySubmitters) {
+    WorkStealingThreadPool::Options options;
+    options.numThreads = 4;
+    WorkStealingThreadPool pool(std::move(options));
+    pool.startup();
+
+    const int kSubmitters = 4;
+    const int kTasksPerSubmitter = 100;
+    AtomicWord<int> count{0};
+    std::vector<stdx::thread> submitters;
+    for (int t = 0; t < kSubmitters; ++t) {
+        submitters.emplace_back([&] {
+            for (int i = 0; i < kTasksPerSubmitter; ++i) {
+                pool.schedule([&](Status status) {
+                    ASSERT_OK(status);
+                    count.fetchAndAdd(1);
+                });
+            }
+        });
+    }
+    for (auto& t : submitters) {
+        t.join();
+    }
+
+    pool.waitForIdle();
+    ASSERT_EQ(count.load(), kSubmitters * kTasksPerSubmitter);
+
+    pool.shutdown();
+    pool.join();
+}
+
+TEST(WorkStealingThreadPoolTest, ScheduleBatchRunsAllTasks) {
+    WorkStealingThreadPool::Options options;
+    options.numThreads = 4;
+    WorkStealingThreadPool pool(std::move(options));
+    pool.startup();
+
+    const int kNumTasks = 64;
+    AtomicWord<int> count{0};
+    std::vector<WorkStealingThreadPool::Task> tasks;
+    for (int i = 0; i < kNumTasks; ++i) {
+        tasks.push_back([&](Status status) {
+            ASSERT_OK(status);
+            count.fetchAndAdd(1);
+        });
+    }
+    pool.scheduleBatch(std::move(tasks));
+
+    pool.waitForIdle();
+    ASSERT_EQ(count.load(), kNumTasks);
+
+    pool.shutdown();
+    pool.join();
+}
+
+}  // namespace
@@ -60,6 +60,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <new>
+
+#include "mongo/base/static_assert.h"
 #include "mongo/util/decoration_container.h"
 #include "mongo/util/decoration_registry.h"
 
@@ -132,6 +136,40 @@ public:
         return Decoration<T>(getRegistry()->template declareDecoration<T>());
     }
 
+    /**
+     * Decorables created with `new` get their decorations in the same allocation as the object:
+     * operator new over-allocates and publishes the trailing space to the DecorationContainer
+     * constructor through a thread-local slot. Decorables created any other way (on the stack,
+     * as members, via custom allocators) fall back to a separately allocated buffer.
+     */
+    void* operator new(size_t size) {
+        MONGO_STATIC_ASSERT(alignof(D) <= alignof(std::max_align_t));
+        const size_t bufferOffset =
+            (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        void* p = ::operator new(bufferOffset + getRegistry()->getDecorationBufferSizeBytes());
+        auto& pending = DecorationContainer<D>::_pendingInlineBuffer();
+        pending.allocation = p;
+        pending.buffer = static_cast<unsigned char*>(p) + bufferOffset;
+        return p;
+    }
+
+    void operator delete(void* p) noexcept {
+        // If construction never reached the Decorable base (an earlier base class constructor
+        // threw), the published slot is still pending and must not leak to a later allocation.
+        auto& pending = DecorationContainer<D>::_pendingInlineBuffer();
+        if (pending.allocation == p)
+            pending = {};
+        ::operator delete(p);
+    }
+
+    // Class-scope allocation functions hide the global placement forms; forward them so
+    // placement construction of decorables keeps working (with a fallback heap buffer).
+    void* operator new(size_t, void* placement) noexcept {
+        return placement;
+    }
+
+    void operator delete(void*, void*) noexcept {}
+
 protected:
     Decorable() : _decorations(this, getRegistry()) {}
     ~Decorable() = default;
@@ -209,6 +247,33 @@ public:
         return Decoration<T>(getRegistry()->template declareDecorationCopyable<T>());
     }
 
+    /** Same single-allocation scheme as Decorable; see above. */
+    void* operator new(size_t size) {
+        MONGO_STATIC_ASSERT(alignof(D) <= alignof(std::max_align_t));
+        const size_t bufferOffset =
+            (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        void* p = ::operator new(bufferOffset + getRegistry()->getDecorationBufferSizeBytes());
+        auto& pending = DecorationContainer<D>::_pendingInlineBuffer();
+        pending.allocation = p;
+        pending.buffer = static_cast<unsigned char*>(p) + bufferOffset;
+        return p;
+    }
+
+    void operator delete(void* p) noexcept {
+        auto& pending = DecorationContainer<D>::_pendingInlineBuffer();
+        if (pending.allocation == p)
+            pending = {};
+        ::operator delete(p);
+    }
+
+    // Class-scope allocation functions hide the global placement forms; forward them so
+    // placement construction of decorables keeps working (with a fallback heap buffer).
+    void* operator new(size_t, void* placement) noexcept {
+        return placement;
+    }
+
+    void operator delete(void*, void*) noexcept {}
+
 protected:
     DecorableCopyable() : _decorations(this, getRegistry()) {}
     ~DecorableCopyable() = default;
@@ -32,6 +32,7 @@
 #include "mongo/platform/basic.h"
 
 #include <boost/utility.hpp>
+#include <memory>
 
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/assert_util.h"
@@ -274,6 +275,32 @@ TEST(DecorableTest, DecorationWithOwner) {
     ASSERT_EQ(&owner, &DecorationWithOwner::get.owner(decoration));
 }
 
+TEST(DecorableTest, HeapAllocatedSharesAllocation) {
+    const auto dd1 = MyDecorable::declareDecoration<A>();
+    const auto dd2 = MyDecorable::declareDecoration<int>();
+    numConstructedAs = 0;
+    numDestructedAs = 0;
+    {
+        auto decorable = std::make_unique<MyDecorable>();
+        ASSERT_EQ(1, numConstructedAs);
+        ASSERT_EQ(0, dd1(*decorable).value);
+        ASSERT_EQ(0, dd2(*decorable));
+        dd1(*decorable).value = 17;
+        dd2(*decorable) = 42;
+        ASSERT_EQ(17, dd1(*decorable).value);
+        ASSERT_EQ(42, dd2(*decorable));
+        ASSERT_EQ(decorable.get(), &dd1.owner(dd1(*decorable)));
+
+        // operator new on Decorable places the decorations directly behind the object in a
+        // single allocation instead of a separately allocated buffer.
+        const auto objAddr = reinterpret_cast<uintptr_t>(decorable.get());
+        const auto decAddr = reinterpret_cast<uintptr_t>(&dd1(*decorable));
+        ASSERT_GT(decAddr, objAddr);
+        ASSERT_LT(decAddr, objAddr + sizeof(MyDecorable) + 4096);
+    }
+    ASSERT_EQ(1, numDestructedAs);
+}
+
 TEST(DecorableTest, DecorableCopyableType) {
     numCopyConstructedAs = 0;
     numCopyAssignedAs = 0;
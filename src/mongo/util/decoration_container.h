@@ -102,14 +102,14 @@ public:
     explicit DecorationContainer(Decorable<DecoratedType>* const decorated,
                                  const DecorationRegistry<DecoratedType>* const registry)
         : _registry(registry),
-          _decorationData(new unsigned char[registry->getDecorationBufferSizeBytes()]) {
+          _decorationData(_obtainBuffer(decorated, registry, _ownsDecorationData)) {
         // Because the decorations live in the externally allocated storage buffer at
         // `_decorationData`, there needs to be a way to get back from a known location within this
         // buffer to the type which owns those decorations.  We place a pointer to ourselves, a
         // "back link" in the front of this storage buffer, as this is the easiest "well known
         // location" to compute.
         Decorable<DecoratedType>** const backLink =
-            reinterpret_cast<Decorable<DecoratedType>**>(_decorationData.get());
+            reinterpret_cast<Decorable<DecoratedType>**>(_decorationData);
         *backLink = decorated;
         _registry->construct(this);
     }
@@ -122,14 +122,14 @@ public:
     explicit DecorationContainer(DecorableCopyable<DecoratedType>* const decorated,
                                  const DecorationRegistry<DecoratedType>* const registry)
         : _registry(registry),
-          _decorationData(new unsigned char[registry->getDecorationBufferSizeBytes()]) {
+          _decorationData(_obtainBuffer(decorated, registry, _ownsDecorationData)) {
         // Because the decorations live in the externally allocated storage buffer at
         // `_decorationData`, there needs to be a way to get back from a known location within this
         // buffer to the type which owns those decorations.  We place a pointer to ourselves, a
         // "back link" in the front of this storage buffer, as this is the easiest "well known
         // location" to compute.
         DecorableCopyable<DecoratedType>** const backLink =
-            reinterpret_cast<DecorableCopyable<DecoratedType>**>(_decorationData.get());
+            reinterpret_cast<DecorableCopyable<DecoratedType>**>(_decorationData);
         *backLink = decorated;
         _registry->construct(this);
     }
@@ -143,20 +143,22 @@ public:
                                  const DecorationRegistry<DecoratedType>* const registry,
                                  const DecorationContainer& other)
         : _registry(registry),
-          _decorationData(new unsigned char[registry->getDecorationBufferSizeBytes()]) {
+          _decorationData(_obtainBuffer(decorated, registry, _ownsDecorationData)) {
         // Because the decorations live in the externally allocated storage buffer at
         // `_decorationData`, there needs to be a way to get back from a known location within this
         // buffer to the type which owns those decorations.  We place a pointer to ourselves, a
         // "back link" in the front of this storage buffer, as this is the easiest "well known
         // location" to compute.
         DecorableCopyable<DecoratedType>** const backLink =
-            reinterpret_cast<DecorableCopyable<DecoratedType>**>(_decorationData.get());
+            reinterpret_cast<DecorableCopyable<DecoratedType>**>(_decorationData);
         *backLink = decorated;
         _registry->copyConstruct(this, &other);
     }
 
     ~DecorationContainer() {
         _registry->destroy(this);
+        if (_ownsDecorationData)
+            delete[] _decorationData;
     }
 
     /**
@@ -165,14 +167,14 @@ public:
      * The descriptor must be one returned from this DecorationContainer's associated _registry.
      */
     void* getDecoration(DecorationDescriptor descriptor) {
-        return _decorationData.get() + descriptor._index;
+        return _decorationData + descriptor._index;
     }
 
     /**
      * Same as the non-const form above, but returns a const result.
      */
     const void* getDecoration(DecorationDescriptor descriptor) const {
-        return _decorationData.get() + descriptor._index;
+        return _decorationData + descriptor._index;
     }
 
     /**
@@ -192,8 +194,45 @@ public:
     }
 
 private:
+    friend Decorable<DecoratedType>;
+    friend DecorableCopyable<DecoratedType>;
+
+    /**
+     * Handoff slot between the decorable's class-level operator new and this container's
+     * constructor. When a decorable is allocated with `new`, its operator new over-allocates
+     * and publishes the trailing space here, so the decorations land in the same allocation
+     * instead of requiring a second one. The constructor claims the slot only if the decorated
+     * object really lives inside the published allocation; decorables created any other way
+     * (on the stack, as members, via custom allocators) fall back to a heap buffer.
+     */
+    struct PendingInlineBuffer {
+        const void* allocation = nullptr;
+        unsigned char* buffer = nullptr;
+    };
+
+    static PendingInlineBuffer& _pendingInlineBuffer() {
+        thread_local PendingInlineBuffer pending;
+        return pending;
+    }
+
+    static unsigned char* _obtainBuffer(const void* decorated,
+                                        const DecorationRegistry<DecoratedType>* registry,
+                                        bool& ownsBuffer) {
+        auto& pending = _pendingInlineBuffer();
+        if (pending.buffer && decorated >= pending.allocation &&
+            decorated < static_cast<const void*>(pending.buffer)) {
+            auto buffer = pending.buffer;
+            pending = {};
+            ownsBuffer = false;
+            return buffer;
+        }
+        ownsBuffer = true;
+        return new unsigned char[registry->getDecorationBufferSizeBytes()];
+    }
+
     const DecorationRegistry<DecoratedType>* const _registry;
-    const std::unique_ptr<unsigned char[]> _decorationData;
+    bool _ownsDecorationData;
+    unsigned char* const _decorationData;
 };
 
 }  // namespace mongo
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -71,10 +72,10 @@ public:
             typename DecorationContainer<DecoratedType>::template DecorationDescriptorWithType<T>(
                 std::move(declareDecoration(sizeof(T),
                                             std::alignment_of<T>::value,
-                                            &constructAt<T>,
+                                            trivialConstructAs<T> ? nullptr : &constructAt<T>,
                                             nullptr,
                                             nullptr,
-                                            &destroyAt<T>)));
+                                            trivialDestroyAs<T> ? nullptr : &destroyAt<T>)));
     }
 
     /**
@@ -93,10 +94,10 @@ public:
             typename DecorationContainer<DecoratedType>::template DecorationDescriptorWithType<T>(
                 std::move(declareDecoration(sizeof(T),
                                             std::alignment_of<T>::value,
-                                            &constructAt<T>,
+                                            trivialConstructAs<T> ? nullptr : &constructAt<T>,
                                             &copyConstructAt<T>,
                                             &copyAssignAt<T>,
-                                            &destroyAt<T>)));
+                                            trivialDestroyAs<T> ? nullptr : &destroyAt<T>)));
     }
 
     size_t getDecorationBufferSizeBytes() const {
@@ -112,6 +113,15 @@ public:
     void construct(DecorationContainer<DecoratedType>* const container) const {
         using std::cbegin;
 
+        // Trivially default constructible decorations register no constructor; one pass of
+        // zeroing over the buffer produces the same bytes their value-initialization would,
+        // without an indirect call per decoration. Skip the back link at the buffer's front.
+        std::memset(container->getDecoration(
+                        typename DecorationContainer<DecoratedType>::DecorationDescriptor(
+                            sizeof(void*))),
+                    0,
+                    _totalSizeBytes - sizeof(void*));
+
         auto iter = cbegin(_decorationInfo);
 
         auto cleanupFunction = [&iter, container, this ]() noexcept->void {
@@ -119,8 +129,9 @@ public:
             std::for_each(std::make_reverse_iterator(iter),
                           crend(this->_decorationInfo),
                           [&](auto&& decoration) {
-                              decoration.destructor(
-                                  container->getDecoration(decoration.descriptor));
+                              if (decoration.destructor)
+                                  decoration.destructor(
+                                      container->getDecoration(decoration.descriptor));
                           });
         };
 
@@ -129,7 +140,8 @@ public:
         using std::cend;
 
         for (; iter != cend(_decorationInfo); ++iter) {
-            iter->constructor(container->getDecoration(iter->descriptor));
+            if (iter->constructor)
+                iter->constructor(container->getDecoration(iter->descriptor));
         }
 
         cleanup.dismiss();
@@ -152,8 +164,9 @@ public:
             std::for_each(std::make_reverse_iterator(iter),
                           crend(this->_decorationInfo),
                           [&](auto&& decoration) {
-                              decoration.destructor(
-                                  container->getDecoration(decoration.descriptor));
+                              if (decoration.destructor)
+                                  decoration.destructor(
+                                      container->getDecoration(decoration.descriptor));
                           });
         };
 
@@ -196,7 +209,8 @@ public:
      */
     void destroy(DecorationContainer<DecoratedType>* const container) const noexcept try {
         std::for_each(_decorationInfo.rbegin(), _decorationInfo.rend(), [&](auto&& decoration) {
-            decoration.destructor(container->getDecoration(decoration.descriptor));
+            if (decoration.destructor)
+                decoration.destructor(container->getDecoration(decoration.descriptor));
         });
     } catch (...) {
         std::terminate();
@@ -246,6 +260,16 @@ private:
 
     using DecorationInfoVector = std::vector<DecorationInfo>;
 
+    /**
+     * Value-initializing these types just writes zero bytes, which construct() already provides
+     * with its single memset; their constructor/destructor entries are registered as null.
+     */
+    template <typename T>
+    static constexpr bool trivialConstructAs = std::is_trivially_default_constructible<T>::value;
+
+    template <typename T>
+    static constexpr bool trivialDestroyAs = std::is_trivially_destructible<T>::value;
+
     template <typename T>
     static void constructAt(void* location) {
         new (location) T();
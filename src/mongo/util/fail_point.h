@@ -41,6 +41,7 @@
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/cancellation.h"
+#include "mongo/util/debug_util.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/interruptible.h"
 #include "mongo/util/string_map.h"
@@ -114,6 +115,12 @@ namespace mongo {
  * A FailPoint can be configured remotely by a database command.
  * See `src/mongo/db/commands/fail_point_cmd.cpp`.
  *
+ * Builds that must not pay anything at instrumented sites (e.g. performance-sensitive
+ * backports) can define MONGO_FAIL_POINTS_DISABLED for the whole build. The evaluation paths
+ * (`shouldFail`, `scoped`, `execute`, `pauseWhileSet`, ...) then compile to constant-false
+ * no-ops and the instrumented branches fold away entirely. Configuration (`setMode`) still
+ * works but has no observable effect. The macro must be set globally; mixing translation
+ * units with and without it is an ODR violation.
  */
 class FailPoint {
 public:
@@ -406,7 +413,11 @@ public:
      */
     template <typename Pred>
     bool shouldFail(Pred&& pred) {
+#ifdef MONGO_FAIL_POINTS_DISABLED
+        return false;
+#else
         return _impl()->shouldFail(pred);
+#endif
     }
 
     bool shouldFail() {
@@ -490,7 +501,11 @@ public:
      */
     template <typename Pred>
     LockHandle scopedIf(Pred&& pred) {
+#ifdef MONGO_FAIL_POINTS_DISABLED
+        return LockHandle{nullptr, false};
+#else
         return _impl()->tryLock(pred);
+#endif
     }
 
     template <typename F>
@@ -527,7 +542,9 @@ public:
      * `mongo::Interruptible::sleepFor`.
      */
     void pauseWhileSet(Interruptible* interruptible) {
+#ifndef MONGO_FAIL_POINTS_DISABLED
         _impl()->pauseWhileSet(interruptible);
+#endif
     }
 
     /**
@@ -536,7 +553,9 @@ public:
      * Interruptible* is interrupted.
      */
     void pauseWhileSetAndNotCanceled(Interruptible* interruptible, const CancellationToken& token) {
+#ifndef MONGO_FAIL_POINTS_DISABLED
         _impl()->pauseWhileSetAndNotCanceled(interruptible, token);
+#endif
     }
 
 private:
@@ -550,7 +569,10 @@ private:
 
     const Impl* _impl() const {
         // Relaxed: such violations can only occur during single-threaded static initialization.
-        invariant(_ready.loadRelaxed(), "Use of uninitialized FailPoint");
+        // Debug-only: this load sits on the disabled-failpoint fast path of every instrumented
+        // site, and use-before-init is a structural bug that debug builds will catch.
+        if (kDebugBuild)
+            invariant(_ready.loadRelaxed(), "Use of uninitialized FailPoint");
         return _rawImpl();
     }
 
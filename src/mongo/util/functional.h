@@ -29,8 +29,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 #include "mongo/stdx/type_traits.h"
 #include "mongo/util/assert_util.h"
@@ -45,6 +48,10 @@ class unique_function;
  * it is incapable of being copied.  Often this happens with C++14 or later lambdas which capture a
  * `std::unique_ptr` by move.  The interface of `unique_function` is nearly identical to
  * `std::function`, except that it is not copyable.
+ *
+ * Functors that fit in the small-object buffer and are nothrow move constructible are stored
+ * inline, so constructing and destroying a `unique_function` from a typical capturing lambda
+ * touches no allocator. Larger or potentially-throwing functors fall back to the heap.
  */
 template <typename RetType, typename... Args>
 class unique_function<RetType(Args...)> {
@@ -65,18 +72,31 @@ private:
 public:
     using result_type = RetType;
 
-    ~unique_function() noexcept = default;
+    ~unique_function() noexcept {
+        _destroy();
+    }
+
     unique_function() = default;
 
     unique_function(const unique_function&) = delete;
     unique_function& operator=(const unique_function&) = delete;
 
-    unique_function(unique_function&&) noexcept = default;
-    unique_function& operator=(unique_function&&) noexcept = default;
+    unique_function(unique_function&& that) noexcept {
+        _moveFrom(std::move(that));
+    }
+
+    unique_function& operator=(unique_function&& that) noexcept {
+        if (this != &that) {
+            _destroy();
+            _moveFrom(std::move(that));
+        }
+        return *this;
+    }
 
     void swap(unique_function& that) noexcept {
-        using std::swap;
-        swap(this->impl, that.impl);
+        unique_function tmp = std::move(that);
+        that = std::move(*this);
+        *this = std::move(tmp);
     }
 
     friend void swap(unique_function& a, unique_function& b) noexcept {
@@ -99,18 +119,19 @@ public:
             makeTag(),
         std::enable_if_t<std::is_move_constructible<Functor>::value, TagType> = makeTag(),
         std::enable_if_t<!std::is_same<std::decay_t<Functor>, unique_function>::value, TagType> =
-            makeTag())
-        : impl(makeImpl(std::forward<Functor>(functor))) {}
+            makeTag()) {
+        _makeImpl(std::forward<Functor>(functor));
+    }
 
     unique_function(std::nullptr_t) noexcept {}
 
     RetType operator()(Args... args) const {
         invariant(static_cast<bool>(*this));
-        return impl->call(std::forward<Args>(args)...);
+        return _impl->call(std::forward<Args>(args)...);
     }
 
     explicit operator bool() const noexcept {
-        return static_cast<bool>(this->impl);
+        return static_cast<bool>(this->_impl);
     }
 
     // Needed to make `std::is_convertible<mongo::unique_function<...>, std::function<...>>` be
@@ -135,8 +156,17 @@ private:
     struct Impl {
         virtual ~Impl() noexcept = default;
         virtual RetType call(Args&&... args) = 0;
+
+        // Move-constructs the concrete functor into 'dest' and returns the new Impl. Only ever
+        // invoked for inline-stored functors, whose moves are statically known not to throw.
+        virtual Impl* moveTo(void* dest) noexcept = 0;
     };
 
+    // Total bytes of in-object functor storage. The concrete Impl spends one pointer on its
+    // vtable, so captures up to kInlineSize - sizeof(void*) bytes stay off the heap. Sized so
+    // the future/executor continuation lambdas typical of async chains fit.
+    static constexpr std::size_t kInlineSize = 64;
+
     // These overload helpers are needed to squelch problems in the `T ()` -> `void ()` case.
     template <typename Functor>
     static void callRegularVoid(const std::true_type isVoid, Functor& f, Args&&... args) {
@@ -150,22 +180,67 @@ private:
         return f(std::forward<Args>(args)...);
     }
 
+    template <typename F>
+    struct SpecificImpl : Impl {
+        template <typename Functor>
+        explicit SpecificImpl(Functor&& func) : f(std::forward<Functor>(func)) {}
+
+        RetType call(Args&&... args) override {
+            return callRegularVoid(std::is_void<RetType>(), f, std::forward<Args>(args)...);
+        }
+
+        Impl* moveTo(void* dest) noexcept override {
+            return new (dest) SpecificImpl(std::move(f));
+        }
+
+        F f;
+    };
+
     template <typename Functor>
-    static auto makeImpl(Functor&& functor) {
-        struct SpecificImpl : Impl {
-            explicit SpecificImpl(Functor&& func) : f(std::forward<Functor>(func)) {}
+    void _makeImpl(Functor&& functor) {
+        using Concrete = SpecificImpl<std::decay_t<Functor>>;
+
+        if constexpr (sizeof(Concrete) <= kInlineSize &&
+                      alignof(Concrete) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible_v<std::decay_t<Functor>>) {
+            _impl = new (&_storage) Concrete(std::forward<Functor>(functor));
+        } else {
+            _impl = new Concrete(std::forward<Functor>(functor));
+        }
+    }
+
+    bool _isInline() const noexcept {
+        return static_cast<const void*>(_impl) == static_cast<const void*>(&_storage);
+    }
 
-            RetType call(Args&&... args) override {
-                return callRegularVoid(std::is_void<RetType>(), f, std::forward<Args>(args)...);
-            }
+    void _moveFrom(unique_function&& that) noexcept {
+        if (!that._impl) {
+            return;
+        }
+
+        if (that._isInline()) {
+            _impl = that._impl->moveTo(&_storage);
+            that._destroy();
+        } else {
+            _impl = std::exchange(that._impl, nullptr);
+        }
+    }
 
-            std::decay_t<Functor> f;
-        };
+    void _destroy() noexcept {
+        if (!_impl) {
+            return;
+        }
 
-        return std::make_unique<SpecificImpl>(std::forward<Functor>(functor));
+        if (_isInline()) {
+            _impl->~Impl();
+        } else {
+            delete _impl;
+        }
+        _impl = nullptr;
     }
 
-    std::unique_ptr<Impl> impl;
+    Impl* _impl = nullptr;
+    std::aligned_storage_t<kInlineSize, alignof(std::max_align_t)> _storage;
 };
 
 /**
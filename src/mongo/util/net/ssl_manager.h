@@ -348,6 +348,21 @@ public:
                                                                 const HostAndPort& hostForLogging,
                                                                 const ExecutorPtr& reactor) = 0;
 
+    /**
+     * Offers a previously negotiated TLS session for resumption on an outgoing connection to
+     * `target`. Must be called after the SSL object is created but before the handshake begins.
+     * The default implementation does nothing; only the OpenSSL manager caches egress sessions.
+     */
+    virtual void offerEgressSessionForResumption(SSLConnectionType ssl, const HostAndPort& target) {
+    }
+
+    /**
+     * Records the session negotiated on an outgoing connection to `target` so that later
+     * connections to the same peer can attempt an abbreviated handshake. Safe to call more than
+     * once per connection; later calls replace the cached session.
+     */
+    virtual void recordEgressSession(SSLConnectionType ssl, const HostAndPort& target) {}
+
     /**
      * No-op function for SChannel and SecureTransport. Attaches stapled OCSP response to the
      * SSL_CTX obect.
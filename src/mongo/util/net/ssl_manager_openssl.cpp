@@ -51,6 +51,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/ssl_connection_context.h"
 #include "mongo/util/assert_util.h"
@@ -484,6 +485,8 @@ public:
 using UniqueSSLContext =
     std::unique_ptr<SSL_CTX, OpenSSLDeleter<decltype(::SSL_CTX_free), ::SSL_CTX_free>>;
 using UniqueSSL = std::unique_ptr<SSL, OpenSSLDeleter<decltype(::SSL_free), ::SSL_free>>;
+using UniqueSSLSession =
+    std::unique_ptr<SSL_SESSION, OpenSSLDeleter<decltype(::SSL_SESSION_free), ::SSL_SESSION_free>>;
 static const int BUFFER_SIZE = 8 * 1024;
 
 using UniqueOpenSSLStringStack =
@@ -1181,6 +1184,10 @@ public:
                                                         const HostAndPort& hostForLogging,
                                                         const ExecutorPtr& reactor) final;
 
+    void offerEgressSessionForResumption(SSL* ssl, const HostAndPort& target) final;
+
+    void recordEgressSession(SSL* ssl, const HostAndPort& target) final;
+
     /**
      * Sets the OCSP Response to be stapled to the TLS Connection. Sets the _ocspStaplingAnchor
      * object in the class.
@@ -1234,6 +1241,15 @@ private:
     Mutex _sharedResponseMutex = MONGO_MAKE_LATCH("OCSPStaplingJobRunner::_sharedResponseMutex");
     std::shared_ptr<OCSPStaplingContext> _ocspStaplingContext;
 
+    // The most recently negotiated TLS session for each egress peer, used to attempt abbreviated
+    // handshakes when the connection pool grows back after a lull. Tickets are single use under
+    // TLS 1.3, so offering a session removes it from the cache; its replacement is recorded once
+    // the resumed connection has negotiated one.
+    static constexpr size_t kMaxEgressSessionCacheSize = 1024;
+    Mutex _egressSessionCacheMutex =
+        MONGO_MAKE_LATCH("SSLManagerOpenSSL::_egressSessionCacheMutex");
+    stdx::unordered_map<HostAndPort, UniqueSSLSession> _egressSessionCache;
+
     OCSPFetcher _fetcher;
 
     /** Password caching helper class.
@@ -2501,6 +2517,49 @@ void SSLManagerOpenSSL::registerOwnedBySSLContext(
     _ownedByContext = ownedByContext;
 }
 
+void SSLManagerOpenSSL::offerEgressSessionForResumption(SSL* ssl, const HostAndPort& target) {
+    UniqueSSLSession session;
+    {
+        stdx::lock_guard<Latch> lock(_egressSessionCacheMutex);
+        auto it = _egressSessionCache.find(target);
+        if (it == _egressSessionCache.end()) {
+            return;
+        }
+        session = std::move(it->second);
+        _egressSessionCache.erase(it);
+    }
+
+    if (::SSL_set_session(ssl, session.get()) != 1) {
+        LOGV2_DEBUG(6174801,
+                    2,
+                    "Failed to offer cached TLS session for resumption",
+                    "targetHost"_attr = target,
+                    "error"_attr = getSSLErrorMessage(ERR_get_error()));
+    }
+}
+
+void SSLManagerOpenSSL::recordEgressSession(SSL* ssl, const HostAndPort& target) {
+    UniqueSSLSession session(::SSL_get1_session(ssl));
+    if (!session) {
+        return;
+    }
+
+#if OPENSSL_VERSION_NUMBER >= 0x10101000L
+    // Under TLS 1.3 the session attached to the connection is only worth caching once a
+    // NewSessionTicket has been processed; before that it cannot be resumed.
+    if (!::SSL_SESSION_is_resumable(session.get())) {
+        return;
+    }
+#endif
+
+    stdx::lock_guard<Latch> lock(_egressSessionCacheMutex);
+    if (_egressSessionCache.size() >= kMaxEgressSessionCacheSize &&
+        _egressSessionCache.find(target) == _egressSessionCache.end()) {
+        return;
+    }
+    _egressSessionCache[target] = std::move(session);
+}
+
 bool SSLManagerOpenSSL::_initSynchronousSSLContext(UniqueSSLContext* contextPtr,
                                                    const SSLParams& params,
                                                    ConnectionDirection direction) {
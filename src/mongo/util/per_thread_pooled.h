@@ -0,0 +1,105 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace mongo {
+
+/**
+ * Mixin that gives a concrete class a small per-thread cache of its own allocations, for types
+ * that are created and destroyed once per operation (lockers, recovery units). Constructors and
+ * destructors still run on every use - only the underlying memory is recycled - so object
+ * lifecycle semantics are completely unchanged; a fresh-looking object is simply built in a
+ * block some earlier operation on this thread gave back.
+ *
+ * Usage:
+ *     class LockerImpl : public Locker, public PerThreadPooled<LockerImpl> { ... };
+ *
+ * Blocks are cached on the deleting thread and reused by the next allocation on that thread, so
+ * the cache needs no locking. Allocations of a different size than T (e.g. for a subclass) pass
+ * straight through to the global allocator. Deleting through a base pointer works as long as the
+ * base destructor is virtual, since the deleting destructor selects the dynamic type's
+ * operator delete.
+ */
+template <typename T>
+class PerThreadPooled {
+public:
+    static void* operator new(size_t size) {
+        // Cached blocks only carry the default allocation alignment; over-aligned types would
+        // need the align_val_t overloads, which this mixin does not provide.
+        static_assert(alignof(T) <= alignof(std::max_align_t),
+                      "PerThreadPooled does not support over-aligned types");
+        if (size == sizeof(T)) {
+            auto& blocks = _cache().blocks;
+            if (!blocks.empty()) {
+                void* p = blocks.back();
+                blocks.pop_back();
+                return p;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* p, size_t size) noexcept {
+        if (size == sizeof(T)) {
+            auto& blocks = _cache().blocks;
+            if (blocks.size() < kMaxCachedPerThread) {
+                blocks.push_back(p);
+                return;
+            }
+        }
+        ::operator delete(p);
+    }
+
+private:
+    // Enough for the operations a single thread can have torn down but not yet replaced;
+    // anything beyond that would just hold memory hostage on idle threads.
+    static constexpr size_t kMaxCachedPerThread = 4;
+
+    struct Cache {
+        ~Cache() {
+            for (void* p : blocks) {
+                ::operator delete(p);
+            }
+        }
+
+        std::vector<void*> blocks;
+    };
+
+    static Cache& _cache() {
+        thread_local Cache cache;
+        return cache;
+    }
+};
+
+}  // namespace mongo
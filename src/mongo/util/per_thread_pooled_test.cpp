@@ -0,0 +1,90 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/per_thread_pooled.h"
+
+#include <memory>
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+struct Pooled : PerThreadPooled<Pooled> {
+    Pooled() {
+        ++constructions;
+    }
+    virtual ~Pooled() {
+        ++destructions;
+    }
+
+    static inline int constructions = 0;
+    static inline int destructions = 0;
+
+    long long payload[8] = {};
+};
+
+struct DerivedPooled : Pooled {
+    long long morePayload[8] = {};
+};
+
+TEST(PerThreadPooledTest, ReusesBlocksOnTheSameThread) {
+    auto first = std::make_unique<Pooled>();
+    void* firstAddress = first.get();
+    first.reset();
+
+    // The freed block goes to this thread's cache, so the next same-sized allocation gets it
+    // back without visiting the allocator.
+    auto second = std::make_unique<Pooled>();
+    ASSERT_EQUALS(firstAddress, static_cast<void*>(second.get()));
+}
+
+TEST(PerThreadPooledTest, ConstructorAndDestructorRunOnEveryUse) {
+    const auto constructionsBefore = Pooled::constructions;
+    const auto destructionsBefore = Pooled::destructions;
+
+    for (int i = 0; i < 10; i++) {
+        std::make_unique<Pooled>();
+    }
+
+    ASSERT_EQUALS(Pooled::constructions, constructionsBefore + 10);
+    ASSERT_EQUALS(Pooled::destructions, destructionsBefore + 10);
+}
+
+TEST(PerThreadPooledTest, SubclassAllocationsPassThrough) {
+    // A subclass has a different size, so its allocations bypass the cache; deleting it through
+    // a base pointer must still reach the subclass destructor and free the larger block.
+    std::unique_ptr<Pooled> p = std::make_unique<DerivedPooled>();
+    p.reset();
+}
+
+}  // namespace
+}  // namespace mongo
@@ -63,6 +63,12 @@ public:
         PeriodicJob(std::string name, Job callable, Milliseconds period)
             : name(std::move(name)), job(std::move(callable)), interval(period) {}
 
+        PeriodicJob(std::string name, Job callable, Milliseconds period, Milliseconds maxDrift)
+            : name(std::move(name)),
+              job(std::move(callable)),
+              interval(period),
+              driftBudget(maxDrift) {}
+
         /**
          * name of the job
          */
@@ -77,6 +83,14 @@ public:
          * An interval at which the job should be run.
          */
         Milliseconds interval;
+
+        /**
+         * How far past 'interval' an execution may be delayed so that the runner can align this
+         * job's wakeups with those of other jobs. If unset, the runner picks a budget suitable for
+         * the interval. Jobs that need precise timing should pass Milliseconds(0) to disable
+         * alignment.
+         */
+        boost::optional<Milliseconds> driftBudget;
     };
 
     /**
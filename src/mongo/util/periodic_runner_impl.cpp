@@ -33,6 +33,8 @@
 
 #include "mongo/util/periodic_runner_impl.h"
 
+#include <algorithm>
+
 #include "mongo/base/error_codes.h"
 #include "mongo/db/client.h"
 #include "mongo/db/service_context.h"
@@ -43,6 +45,17 @@
 
 namespace mongo {
 
+namespace {
+
+// Jobs with second-or-longer periods tolerate some scheduling drift, so their wakeup deadlines are
+// rounded up to a shared wall-clock boundary. Jobs due around the same time then wake on the same
+// timer interrupt instead of each interrupting an idle host separately. Sub-second jobs are left
+// alone: rounding would be a large fraction of their period, and they keep the host awake anyway.
+constexpr Milliseconds kMinAlignableInterval{1000};
+constexpr Milliseconds kMaxWakeupAlignment{500};
+
+}  // namespace
+
 PeriodicRunnerImpl::PeriodicRunnerImpl(ServiceContext* svc, ClockSource* clockSource)
     : _svc(svc), _clockSource(clockSource) {}
 
@@ -103,7 +116,9 @@ void PeriodicRunnerImpl::PeriodicJobImpl::_run() {
                 _job.job(client.get());
                 lk.lock();
 
-                auto getDeadlineFromInterval = [&] { return start + _job.interval; };
+                auto getDeadlineFromInterval = [&] {
+                    return _alignedDeadline(start + _job.interval);
+                };
 
                 do {
                     auto deadline = getDeadlineFromInterval();
@@ -188,6 +203,25 @@ void PeriodicRunnerImpl::PeriodicJobImpl::stop() {
     stopFuture.get();
 }
 
+Date_t PeriodicRunnerImpl::PeriodicJobImpl::_alignedDeadline(Date_t deadline) const {
+    // Callers must hold _mutex, which protects '_job.interval'.
+    auto budget = _job.driftBudget.value_or(_job.interval < kMinAlignableInterval
+                                                ? Milliseconds(0)
+                                                : std::min(_job.interval / 10, kMaxWakeupAlignment));
+    if (budget <= Milliseconds(0)) {
+        return deadline;
+    }
+
+    // Round the deadline up to the next multiple of the budget. The boundaries are absolute
+    // (relative to the epoch), so every job using the same budget lands on the same instants.
+    auto budgetMillis = durationCount<Milliseconds>(budget);
+    auto deadlineMillis = deadline.toMillisSinceEpoch();
+    if (auto remainder = deadlineMillis % budgetMillis) {
+        return Date_t::fromMillisSinceEpoch(deadlineMillis + budgetMillis - remainder);
+    }
+    return deadline;
+}
+
 Milliseconds PeriodicRunnerImpl::PeriodicJobImpl::getPeriod() {
     stdx::lock_guard<Latch> lk(_mutex);
     return _job.interval;
@@ -75,6 +75,12 @@ private:
     private:
         void _run();
 
+        /**
+         * Rounds 'deadline' up to the next wakeup-alignment boundary, spending at most the job's
+         * drift budget. Callers must hold _mutex.
+         */
+        Date_t _alignedDeadline(Date_t deadline) const;
+
         PeriodicJob _job;
         ClockSource* _clockSource;
         ServiceContext* _serviceContext;
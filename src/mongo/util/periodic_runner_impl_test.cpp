@@ -450,6 +450,94 @@ TEST_F(PeriodicRunnerImplTest, ChangingIntervalWorks) {
     tearDown();
 }
 
+TEST_F(PeriodicRunnerImplTest, WakeupsAlignToDriftBudgetBoundary) {
+    size_t timesCalled = 0;
+
+    auto mutex = MONGO_MAKE_LATCH();
+    stdx::condition_variable cv;
+
+    // A 10 second job gets a 500ms drift budget by default. Skew the clock so that the raw
+    // deadline (start + interval) falls 123ms past a 500ms boundary.
+    const auto boundary = Milliseconds(500);
+    const auto nowMillis = clockSource().now().toMillisSinceEpoch();
+    const auto offPastBoundary = nowMillis % durationCount<Milliseconds>(boundary);
+    clockSource().advance(boundary - Milliseconds(offPastBoundary) + Milliseconds(123));
+
+    PeriodicRunner::PeriodicJob job("job",
+                                    [&](Client*) {
+                                        {
+                                            stdx::unique_lock<Latch> lk(mutex);
+                                            timesCalled++;
+                                        }
+                                        cv.notify_one();
+                                    },
+                                    Seconds(10));
+
+    auto jobAnchor = runner().makeJob(std::move(job));
+    jobAnchor.start();
+    // Wait for the first execution.
+    {
+        stdx::unique_lock<Latch> lk(mutex);
+        cv.wait(lk, [&] { return timesCalled; });
+    }
+
+    // Advancing to the raw deadline must not run the job; the deadline was rounded up to the next
+    // 500ms boundary, 377ms later.
+    clockSource().advance(Seconds(10));
+    {
+        stdx::lock_guard<Latch> lk(mutex);
+        ASSERT_EQ(timesCalled, 1ul);
+    }
+
+    clockSource().advance(Milliseconds(377));
+    {
+        stdx::unique_lock<Latch> lk(mutex);
+        cv.wait(lk, [&] { return timesCalled == 2ul; });
+    }
+
+    tearDown();
+}
+
+TEST_F(PeriodicRunnerImplTest, ZeroDriftBudgetDisablesAlignment) {
+    size_t timesCalled = 0;
+
+    auto mutex = MONGO_MAKE_LATCH();
+    stdx::condition_variable cv;
+
+    // Same skew as above, but the job opts out of alignment with a zero drift budget.
+    const auto boundary = Milliseconds(500);
+    const auto nowMillis = clockSource().now().toMillisSinceEpoch();
+    const auto offPastBoundary = nowMillis % durationCount<Milliseconds>(boundary);
+    clockSource().advance(boundary - Milliseconds(offPastBoundary) + Milliseconds(123));
+
+    PeriodicRunner::PeriodicJob job("job",
+                                    [&](Client*) {
+                                        {
+                                            stdx::unique_lock<Latch> lk(mutex);
+                                            timesCalled++;
+                                        }
+                                        cv.notify_one();
+                                    },
+                                    Seconds(10),
+                                    Milliseconds(0));
+
+    auto jobAnchor = runner().makeJob(std::move(job));
+    jobAnchor.start();
+    {
+        stdx::unique_lock<Latch> lk(mutex);
+        cv.wait(lk, [&] { return timesCalled; });
+    }
+
+    // The raw deadline is honored exactly.
+    clockSource().advance(Seconds(10));
+    {
+        stdx::unique_lock<Latch> lk(mutex);
+        cv.wait(lk, [&] { return timesCalled == 2ul; });
+    }
+
+    tearDown();
+}
+
 TEST_F(PeriodicRunnerImplTest, StopProperlyInterruptsOpCtx) {
     Milliseconds interval{5};
     unittest::Barrier barrier(2);
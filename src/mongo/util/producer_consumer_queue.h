@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <deque>
 #include <list>
@@ -769,7 +770,7 @@ private:
                 !(_producerEndClosed && _queue.empty()));
     }
 
-    void _notifyIfNecessary(WithLock) {
+    void _notifyIfNecessary(WithLock, size_t itemsAdded = 1) {
         // If we've closed the consumer end, or if the production end is closed and we've exhausted
         // the queue, wake everyone up and get out of here
         if (_consumerEndClosed || (_queue.empty() && _producerEndClosed)) {
@@ -793,9 +794,19 @@ private:
             return;
         }
 
-        // If we have consumers and anything in the queue, notify consumers
+        // If we have consumers and anything in the queue, notify consumers. After a batch push,
+        // fan out one wakeup per pushed item so the waiting consumers start in parallel, rather
+        // than each waking the next in a serial chain as it pops.
         if (_consumers && _queue.size()) {
-            _consumers.cv().notify_one();
+            auto toWake = std::min({itemsAdded, static_cast<size_t>(_consumers), _queue.size()});
+
+            if (toWake >= static_cast<size_t>(_consumers)) {
+                _consumers.cv().notify_all();
+            } else {
+                for (size_t i = 0; i < toWake; ++i) {
+                    _consumers.cv().notify_one();
+                }
+            }
 
             return;
         }
@@ -807,7 +818,13 @@ private:
 
         _checkProducerClosed(lk);
 
-        const auto guard = makeGuard([&] { _notifyIfNecessary(lk); });
+        // Remember how much was in the queue before the callback, so the notification on the way
+        // out can wake one consumer per item actually pushed.
+        const auto sizeBefore = _queue.size();
+        const auto guard = makeGuard([&] {
+            const auto sizeAfter = _queue.size();
+            _notifyIfNecessary(lk, sizeAfter > sizeBefore ? sizeAfter - sizeBefore : 1);
+        });
 
         return cb(lk);
     }
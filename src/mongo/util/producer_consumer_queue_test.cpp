@@ -496,6 +496,36 @@ PRODUCER_CONSUMER_QUEUE_TEST(pushManyPopWithoutBlocking, runPermutations<false,
     ASSERT_EQUALS(pcq.getStats().queueDepth, 0ul);
 }
 
+PRODUCER_CONSUMER_QUEUE_TEST(pushManyToManyBlockedConsumers, runPermutations<false, true>) {
+    typename Helper::template ProducerConsumerQueue<MoveOnly> pcq{};
+
+    // A batch push fans its wakeups out across waiting consumers; every consumer must receive
+    // exactly one item.
+    std::vector<stdx::thread> consumers;
+    for (int i = 0; i < 4; ++i) {
+        consumers.emplace_back(
+            helper.runThread("Consumer", [&](OperationContext* opCtx) { pcq.pop(opCtx); }));
+    }
+
+    helper
+        .runThread("Producer",
+                   [&](OperationContext* opCtx) {
+                       std::vector<MoveOnly> vec;
+                       for (int i = 0; i < 4; ++i) {
+                           vec.emplace_back(MoveOnly(i));
+                       }
+
+                       pcq.pushMany(begin(vec), end(vec), opCtx);
+                   })
+        .join();
+
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    ASSERT_EQUALS(pcq.getStats().queueDepth, 0ul);
+}
+
 PRODUCER_CONSUMER_QUEUE_TEST(popManyPopWithBlocking, runPermutations<false, false>) {
     using PCQ = typename Helper::template ProducerConsumerQueue<MoveOnly>;
     typename PCQ::Options options;
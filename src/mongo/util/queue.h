@@ -33,6 +33,7 @@
 #include <functional>
 #include <limits>
 #include <queue>
+#include <utility>
 
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/chrono.h"
@@ -88,10 +89,10 @@ public:
         for (auto i = begin; i != end; ++i) {
             size += _getSize(*i);
         }
-        // Block until enough space is available.
-        waitForSpace(size);
 
         stdx::unique_lock<Latch> lk(_lock);
+        // Block until enough space is available.
+        _waitForSpace_inlock(size, lk);
         const auto startedEmpty = _queue.empty();
         _clearing = false;
 
@@ -140,7 +141,7 @@ public:
         _clearing = true;
         _queue = std::queue<T>();
         _currentSize = 0;
-        _cvNoLongerFull.notify_one();
+        _notifySpaceWaiters_inlock();
         _cvNoLongerEmpty.notify_one();
     }
 
@@ -149,10 +150,10 @@ public:
         if (_queue.empty())
             return false;
 
-        t = _queue.front();
+        t = std::move(_queue.front());
         _queue.pop();
         _currentSize -= _getSize(t);
-        _cvNoLongerFull.notify_one();
+        _notifySpaceWaiters_inlock();
 
         return true;
     }
@@ -166,10 +167,10 @@ public:
             return T{};
         }
 
-        T t = _queue.front();
+        T t = std::move(_queue.front());
         _queue.pop();
         _currentSize -= _getSize(t);
-        _cvNoLongerFull.notify_one();
+        _notifySpaceWaiters_inlock();
 
         return t;
     }
@@ -193,10 +194,10 @@ public:
         if (_clearing) {
             return false;
         }
-        t = _queue.front();
+        t = std::move(_queue.front());
         _queue.pop();
         _currentSize -= _getSize(t);
-        _cvNoLongerFull.notify_one();
+        _notifySpaceWaiters_inlock();
         return true;
     }
 
@@ -247,9 +248,21 @@ private:
      * Returns when enough space is available.
      */
     void _waitForSpace_inlock(size_t size, stdx::unique_lock<Latch>& lk) {
+        ++_spaceWaiters;
         while (_currentSize + size > _maxSize) {
             _cvNoLongerFull.wait(lk);
         }
+        --_spaceWaiters;
+    }
+
+    /**
+     * Wakes the producer only when one is actually blocked on space; consumers pop far more
+     * often than the queue fills, so the unconditional notify is wasted work.
+     */
+    void _notifySpaceWaiters_inlock() {
+        if (_spaceWaiters > 0) {
+            _cvNoLongerFull.notify_one();
+        }
     }
 
     mutable Mutex _lock = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "BlockingQueue::_lock");
@@ -258,6 +271,7 @@ private:
     size_t _currentSize = 0;
     GetSizeFn _getSize;
     bool _clearing = false;
+    size_t _spaceWaiters = 0;
 
     stdx::condition_variable _cvNoLongerFull;
     stdx::condition_variable _cvNoLongerEmpty;
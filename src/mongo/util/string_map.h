@@ -31,12 +31,69 @@
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
+#include <absl/numeric/int128.h>
+#include <cstdint>
+#include <cstring>
 
 #include "mongo/base/string_data.h"
 #include "mongo/util/assert_util.h"
 
 namespace mongo {
 
+namespace string_map_detail {
+
+// Odd 64-bit constants with well-dispersed bits, from the splitmix64/wyhash family.
+constexpr std::uint64_t kHashMul0 = 0x9e3779b97f4a7c15ULL;
+constexpr std::uint64_t kHashMul1 = 0x2545f4914f6cdd1dULL;
+
+inline std::uint64_t loadUnaligned64(const char* p) {
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline std::uint32_t loadUnaligned32(const char* p) {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Folds a 128-bit product down to 64 bits, diffusing every input bit across the result.
+inline std::size_t mixHash(std::uint64_t a, std::uint64_t b) {
+    auto product = absl::uint128{a} * b;
+    return static_cast<std::size_t>(absl::Uint128Low64(product) ^ absl::Uint128High64(product));
+}
+
+// Wyhash-style hash for strings of at most 16 bytes: at most two (possibly overlapping)
+// unaligned loads and one wide multiply, where absl's general hash runs a byte-stream loop.
+// Field names hash constantly on document-heavy paths, so the short case is worth the branch.
+// Unlike absl's hash this is not seeded per process, so it must only be used where the hasher
+// and the table both come from this file.
+inline std::size_t hashShortString(const char* p, std::size_t len) {
+    std::uint64_t a;
+    std::uint64_t b;
+    if (len >= 8) {
+        a = loadUnaligned64(p);
+        b = loadUnaligned64(p + len - 8);
+    } else if (len >= 4) {
+        a = loadUnaligned32(p);
+        b = loadUnaligned32(p + len - 4);
+    } else if (len > 0) {
+        a = (std::uint64_t(std::uint8_t(p[0])) << 16) |
+            (std::uint64_t(std::uint8_t(p[len >> 1])) << 8) | std::uint8_t(p[len - 1]);
+        b = 0;
+    } else {
+        a = 0;
+        b = 0;
+    }
+
+    // Fold the length in via a multiply so that strings whose overlapping loads read the same
+    // bytes at different lengths (e.g. "k1000" and "k10000") cannot cancel it out.
+    return mixHash(a ^ (kHashMul0 ^ len * kHashMul1), b ^ kHashMul1);
+}
+
+}  // namespace string_map_detail
+
 // Type that bundles a hashed key with the actual string so hashing can be performed outside of
 // insert call by using heterogeneous lookup.
 struct StringMapHashedKey {
@@ -66,7 +123,11 @@ struct StringMapHasher {
     using is_transparent = void;
 
     std::size_t operator()(StringData sd) const {
-        // Use the default absl string hasher.
+        if (sd.size() <= 16) {
+            return string_map_detail::hashShortString(sd.rawData(), sd.size());
+        }
+
+        // Use the default absl string hasher for longer strings.
         return absl::Hash<absl::string_view>{}(absl::string_view(sd.rawData(), sd.size()));
     }
 
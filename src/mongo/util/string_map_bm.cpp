@@ -0,0 +1,98 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+namespace {
+
+// Keys shaped like the field names that dominate StringMap usage: short, mostly ASCII, sharing
+// prefixes.
+std::vector<std::string> makeKeys(size_t count, size_t len) {
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < count; ++i) {
+        std::string key = "f" + std::to_string(i);
+        key.resize(len, 'x');
+        keys.push_back(std::move(key));
+    }
+    return keys;
+}
+
+void BM_StringMapHashShortKey(benchmark::State& state) {
+    const auto keys = makeKeys(64, state.range(0));
+    StringMapHasher hasher;
+
+    size_t i = 0;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(hasher(StringData(keys[i++ % keys.size()])));
+    }
+}
+
+void BM_StringMapSuccessfulLookup(benchmark::State& state) {
+    const auto keys = makeKeys(64, state.range(0));
+    StringMap<int> map;
+    for (const auto& key : keys) {
+        map[key] = 1;
+    }
+
+    size_t i = 0;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(map.find(StringData(keys[i++ % keys.size()])));
+    }
+}
+
+void BM_StringMapUnsuccessfulLookup(benchmark::State& state) {
+    const auto keys = makeKeys(64, state.range(0));
+    const auto missingKeys = makeKeys(64, state.range(0) + 1);
+    StringMap<int> map;
+    for (const auto& key : keys) {
+        map[key] = 1;
+    }
+
+    size_t i = 0;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(map.find(StringData(missingKeys[i++ % missingKeys.size()])));
+    }
+}
+
+// Key lengths straddling the short-string hash cutoffs: both single-load paths, the two-load
+// path, and the absl fallback.
+BENCHMARK(BM_StringMapHashShortKey)->Arg(3)->Arg(7)->Arg(12)->Arg(16)->Arg(24);
+BENCHMARK(BM_StringMapSuccessfulLookup)->Arg(3)->Arg(7)->Arg(12)->Arg(16)->Arg(24);
+BENCHMARK(BM_StringMapUnsuccessfulLookup)->Arg(3)->Arg(7)->Arg(12)->Arg(16)->Arg(24);
+
+}  // namespace
+}  // namespace mongo
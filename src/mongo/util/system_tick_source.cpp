@@ -38,6 +38,10 @@
 #if defined(MONGO_CONFIG_HAVE_HEADER_UNISTD_H)
 #include <unistd.h>
 #endif
+#if defined(__x86_64__) && !defined(_WIN32)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
 #include <memory>
 
 #include "mongo/base/init.h"
@@ -116,6 +120,78 @@ TickSource::Tick timerNowPosixMonotonicClock() {
     return result;
 }
 
+#if defined(__x86_64__)
+
+TickSource::Tick timerNowTsc() {
+    // Plain rdtsc, without a serializing fence: callers time spans many orders of magnitude
+    // longer than the few cycles of reordering slack this allows, and the fence would cost more
+    // than the read.
+    return static_cast<TickSource::Tick>(__rdtsc());
+}
+
+// The TSC is only usable as a time source if the CPU advertises it as invariant, meaning it
+// ticks at a constant rate regardless of frequency scaling and deep sleep states. On such
+// hardware it is also synchronized across cores and sockets at reset.
+bool hasInvariantTsc() {
+    if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u) {
+        return false;
+    }
+
+    unsigned eax, ebx, ecx, edx;
+    __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx);
+    return edx & (1u << 8);
+}
+
+/**
+ * Measures the TSC frequency against the monotonic clock and, if the result looks sane, swaps
+ * the timer implementation over to raw rdtsc reads. Bracketing each clock_gettime between two
+ * TSC reads keeps the pairing error down to the cost of one clock read.
+ */
+bool tryInitTscTickSource() {
+    if (!hasInvariantTsc()) {
+        return false;
+    }
+
+    auto sample = [](TickSource::Tick& tsc, long long& ns) {
+        auto before = timerNowTsc();
+        ns = timerNowPosixMonotonicClock();
+        auto after = timerNowTsc();
+        tsc = before + (after - before) / 2;
+    };
+
+    TickSource::Tick tscStart, tscEnd;
+    long long nsStart, nsEnd;
+
+    sample(tscStart, nsStart);
+    constexpr long long kCalibrationNanos = 10 * 1000 * 1000;
+    do {
+        sample(tscEnd, nsEnd);
+    } while (nsEnd - nsStart < kCalibrationNanos);
+
+    const auto frequency = static_cast<TickSource::Tick>(
+        static_cast<double>(tscEnd - tscStart) * kNanosPerSecond / (nsEnd - nsStart));
+
+    // Reject frequencies outside anything plausible for real hardware; fall back to the
+    // monotonic clock rather than trusting a calibration disturbed by migration or suspend.
+    constexpr TickSource::Tick kMinPlausibleHz = 100 * 1000 * 1000;       // 100 MHz
+    constexpr TickSource::Tick kMaxPlausibleHz = 10LL * kNanosPerSecond;  // 10 GHz
+    if (frequency < kMinPlausibleHz || frequency > kMaxPlausibleHz) {
+        return false;
+    }
+
+    ticksPerSecond = frequency;
+    _timerNow = &timerNowTsc;
+    return true;
+}
+
+#else
+
+bool tryInitTscTickSource() {
+    return false;
+}
+
+#endif  // defined(__x86_64__)
+
 void initTickSource() {
     // If the monotonic clock is not available at runtime (sysconf() returns 0 or -1),
     // do not override the generic implementation or modify ticksPerSecond.
@@ -132,6 +208,10 @@ void initTickSource() {
     timespec the_time;
     fassert(16162, !clock_gettime(CLOCK_MONOTONIC, &the_time));
     fassert(16163, static_cast<long long>(the_time.tv_sec) < maxSecs);
+
+    // Prefer a raw TSC read to a clock_gettime call when the hardware allows: ticks feed hot
+    // paths (CurOp, lock stats, executor metrics) where the vDSO clock read is measurable.
+    tryInitTscTickSource();
 }
 #else
 void initTickSource() {}
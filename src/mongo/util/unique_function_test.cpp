@@ -148,6 +148,25 @@ TEST(UniqueFunctionTest, accepts_a_functor_that_is_move_only) {
     uf = std::move(uf2);
 }
 
+TEST(UniqueFunctionTest, moves_functors_that_exceed_the_inline_buffer) {
+    // Larger than any plausible small-object buffer, so this exercises the heap-stored path
+    // through moves and swaps just like the small functors above exercise the inline path.
+    struct Big {
+        char pad[256] = {};
+        int value = 7;
+    };
+
+    mongo::unique_function<int()> uf = [big = Big{}] { return big.value; };
+
+    mongo::unique_function<int()> uf2 = std::move(uf);
+    ASSERT_FALSE(static_cast<bool>(uf));
+    ASSERT_EQUALS(uf2(), 7);
+
+    uf.swap(uf2);
+    ASSERT_FALSE(static_cast<bool>(uf2));
+    ASSERT_EQUALS(uf(), 7);
+}
+
 TEST(UniqueFunctionTest, dtor_releases_functor_object_and_does_not_call_function) {
     RunDetection<0> runDetection0;
     RunDetection<1> runDetection1;